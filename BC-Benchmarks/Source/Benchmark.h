@@ -0,0 +1,95 @@
+#pragma once
+
+// Core Headers
+
+// C++ Standard Library Headers
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+// External Vendor Library Headers
+
+namespace BC::Benchmark
+{
+
+	using BenchmarkFunction = void(*)();
+
+	struct BenchmarkEntry
+	{
+		const char* Name;
+		BenchmarkFunction Function;
+	};
+
+	inline std::vector<BenchmarkEntry>& GetBenchmarks()
+	{
+		static std::vector<BenchmarkEntry> s_Benchmarks;
+		return s_Benchmarks;
+	}
+
+	struct BenchmarkRegistrar
+	{
+		BenchmarkRegistrar(const char* name, BenchmarkFunction function)
+		{
+			GetBenchmarks().push_back({ name, function });
+		}
+	};
+
+	inline volatile uint64_t s_Sink = 0;
+
+	/// <summary>
+	/// Hands a value derived from a benchmark's results to a volatile, so the
+	/// work producing them is not optimised away.
+	/// </summary>
+	inline void Consume(uint64_t value)
+	{
+		s_Sink = value;
+	}
+
+	/// <summary>
+	/// Runs the function repeat_count times.
+	/// </summary>
+	/// <returns>The fastest run in nanoseconds.</returns>
+	template<typename Function>
+	double Measure(size_t repeat_count, Function&& function)
+	{
+		double fastest = std::numeric_limits<double>::max();
+
+		for (size_t i = 0; i < repeat_count; ++i)
+		{
+			auto start = std::chrono::steady_clock::now();
+			function();
+			auto end = std::chrono::steady_clock::now();
+
+			fastest = std::min(fastest, std::chrono::duration<double, std::nano>(end - start).count());
+		}
+
+		return fastest;
+	}
+
+	/// <summary>
+	/// Prints one measurement, with its speed up over a baseline if one is given.
+	/// </summary>
+	inline void Report(const char* label, double nanoseconds, size_t item_count, double baseline_nanoseconds = 0.0)
+	{
+		std::printf("    %-44s %10.3f ms %10.2f ns/item", label, nanoseconds / 1.0e6, nanoseconds / static_cast<double>(std::max<size_t>(item_count, 1)));
+
+		if (baseline_nanoseconds > 0.0)
+			std::printf(" %8.2fx", baseline_nanoseconds / nanoseconds);
+
+		std::printf("\n");
+	}
+
+}
+
+/// <summary>
+/// Defines a benchmark run by BCEngineBenchmarks, either with every other
+/// benchmark or on its own when named on the command line.
+/// </summary>
+#define BC_BENCHMARK(name) \
+	static void name(); \
+	static ::BC::Benchmark::BenchmarkRegistrar s_##name##Registrar(#name, &name); \
+	static void name()
@@ -0,0 +1,30 @@
+#include "BC_PCH.h"
+#include "Benchmark.h"
+
+// Core Headers
+
+// C++ Standard Library Headers
+#include <cstring>
+
+// External Vendor Library Headers
+
+int main(int argc, char** argv)
+{
+	BC::LoggingSystem::Init();
+
+	// Every benchmark runs unless some are named on the command line
+	for (const auto& benchmark : BC::Benchmark::GetBenchmarks())
+	{
+		bool selected = argc <= 1;
+		for (int i = 1; i < argc && !selected; ++i)
+			selected = std::strcmp(argv[i], benchmark.Name) == 0;
+
+		if (!selected)
+			continue;
+
+		std::printf("%s\n", benchmark.Name);
+		benchmark.Function();
+	}
+
+	return 0;
+}
@@ -0,0 +1,136 @@
+#include "BC_PCH.h"
+#include "Benchmark.h"
+
+// Core Headers
+#include "Project/Scene/Bounds/FrustumCulling.h"
+
+// C++ Standard Library Headers
+#include <array>
+#include <random>
+#include <utility>
+#include <vector>
+
+// External Vendor Library Headers
+#include <glm/glm.hpp>
+
+namespace BC
+{
+
+	static constexpr size_t CULLING_BOUNDS_COUNT = 1 << 16;
+	static constexpr size_t CULLING_REPEAT_COUNT = 50;
+
+	static constexpr std::array<std::pair<CullingInstructionSet, const char*>, 3> CULLING_INSTRUCTION_SETS =
+	{{
+		{ CullingInstructionSet::Scalar,	"Batch Kernel (Scalar)" },
+		{ CullingInstructionSet::SSE4,		"Batch Kernel (SSE4)" },
+		{ CullingInstructionSet::AVX2,		"Batch Kernel (AVX2)" }
+	}};
+
+	/// <summary>
+	/// A box of slightly tilted planes, 40 units from the origin on each axis.
+	/// </summary>
+	static Frustum MakeCullingBenchmarkFrustum(std::mt19937& rng)
+	{
+		static const std::array<glm::vec3, 6> AXES =
+		{
+			glm::vec3( 1.0f, 0.0f, 0.0f), glm::vec3(-1.0f, 0.0f, 0.0f),
+			glm::vec3(0.0f,  1.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f),
+			glm::vec3(0.0f, 0.0f,  1.0f), glm::vec3(0.0f, 0.0f, -1.0f)
+		};
+
+		std::uniform_real_distribution<float> tilt(-0.2f, 0.2f);
+
+		Frustum frustum;
+		for (size_t i = 0; i < frustum.planes.size(); ++i)
+		{
+			frustum.planes[i].normal = glm::normalize(AXES[i] + glm::vec3(tilt(rng), tilt(rng), tilt(rng)));
+			frustum.planes[i].distance = 40.0f;
+		}
+		return frustum;
+	}
+
+	static uint64_t SumResults(const std::vector<FrustumContainResult>& results)
+	{
+		uint64_t sum = 0;
+		for (FrustumContainResult result : results)
+			sum += static_cast<uint64_t>(result);
+		return sum;
+	}
+
+	/// <summary>
+	/// Frustum::Contains per bounds against each instruction set of the batch
+	/// kernels, over bounds of which roughly half are visible.
+	/// </summary>
+	template<typename BoundsType, typename CullFunction>
+	static void RunCullingBenchmark(const Frustum& frustum, const std::vector<BoundsType>& bounds, CullFunction&& cull)
+	{
+		FrustumPlanesSoA planes(frustum);
+		std::vector<FrustumContainResult> results(bounds.size());
+
+		double baseline = Benchmark::Measure(CULLING_REPEAT_COUNT, [&]()
+		{
+			for (size_t i = 0; i < bounds.size(); ++i)
+				results[i] = frustum.Contains(bounds[i]);
+
+			Benchmark::Consume(SumResults(results));
+		});
+		Benchmark::Report("Frustum::Contains", baseline, bounds.size());
+
+		for (const auto& [instruction_set, label] : CULLING_INSTRUCTION_SETS)
+		{
+			if (static_cast<uint8_t>(instruction_set) > static_cast<uint8_t>(Util::GetCullingInstructionSet()))
+			{
+				std::printf("    %-44s Not Supported\n", label);
+				continue;
+			}
+
+			double nanoseconds = Benchmark::Measure(CULLING_REPEAT_COUNT, [&]()
+			{
+				cull(instruction_set, planes, bounds.data(), bounds.size(), results.data());
+				Benchmark::Consume(SumResults(results));
+			});
+			Benchmark::Report(label, nanoseconds, bounds.size(), baseline);
+		}
+	}
+
+	BC_BENCHMARK(FrustumCullingAABBs)
+	{
+		std::mt19937 rng(35);
+		std::uniform_real_distribution<float> coordinate(-50.0f, 50.0f);
+		std::uniform_real_distribution<float> extent(0.1f, 4.0f);
+
+		Frustum frustum = MakeCullingBenchmarkFrustum(rng);
+
+		std::vector<Bounds_AABB> bounds(CULLING_BOUNDS_COUNT);
+		for (auto& aabb : bounds)
+		{
+			glm::vec3 centre(coordinate(rng), coordinate(rng), coordinate(rng));
+			glm::vec3 half_size(extent(rng), extent(rng), extent(rng));
+			aabb = Bounds_AABB(centre - half_size, centre + half_size);
+		}
+
+		RunCullingBenchmark(frustum, bounds, [](CullingInstructionSet instruction_set, const FrustumPlanesSoA& planes, const Bounds_AABB* batch, size_t count, FrustumContainResult* out_results)
+		{
+			Util::CullAABBs(instruction_set, planes, batch, count, out_results);
+		});
+	}
+
+	BC_BENCHMARK(FrustumCullingSpheres)
+	{
+		std::mt19937 rng(3535);
+		std::uniform_real_distribution<float> coordinate(-50.0f, 50.0f);
+		std::uniform_real_distribution<float> radius(0.1f, 4.0f);
+
+		Frustum frustum = MakeCullingBenchmarkFrustum(rng);
+
+		std::vector<Bounds_Sphere> bounds(CULLING_BOUNDS_COUNT);
+		for (auto& sphere : bounds)
+			sphere = Bounds_Sphere(glm::vec3(coordinate(rng), coordinate(rng), coordinate(rng)), radius(rng));
+
+		RunCullingBenchmark(frustum, bounds, [](CullingInstructionSet instruction_set, const FrustumPlanesSoA& planes, const Bounds_Sphere* batch, size_t count, FrustumContainResult* out_results)
+		{
+			Util::CullSpheres(instruction_set, planes, batch, count, out_results);
+		});
+	}
+
+}
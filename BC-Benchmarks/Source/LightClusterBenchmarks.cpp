@@ -0,0 +1,106 @@
+#include "BC_PCH.h"
+#include "Benchmark.h"
+
+// Core Headers
+#include "Graphics/Renderer/CameraContext.h"
+#include "Graphics/Renderer/LightClusters.h"
+
+// C++ Standard Library Headers
+#include <array>
+#include <random>
+
+// External Vendor Library Headers
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace BC
+{
+
+	static constexpr size_t LIGHT_CLUSTER_REPEAT_COUNT = 20;
+	static constexpr std::array<size_t, 3> LIGHT_CLUSTER_LIGHT_COUNTS = { 256, 1024, 4096 };
+
+	static LightEnvironment MakeBenchmarkLights(std::mt19937& rng, size_t light_count)
+	{
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		std::uniform_real_distribution<float> radius(1.0f, 8.0f);
+		std::uniform_real_distribution<float> angle(20.0f, 120.0f);
+
+		LightEnvironment light_environment;
+		for (size_t i = 0; i < light_count; ++i)
+		{
+			// Mostly within the view, which looks down -Z
+			glm::vec4 position(unit(rng) * 60.0f, unit(rng) * 30.0f, -100.0f + unit(rng) * 100.0f, 1.0f);
+
+			Util::LightData light = {};
+			if (i % 2)
+			{
+				light.cone.light_type = Util::LightType_Cone;
+				light.cone.position = position;
+				light.cone.direction = glm::vec4(glm::normalize(glm::vec3(unit(rng), unit(rng), unit(rng))), 0.0f);
+				light.cone.range = radius(rng) * 2.0f;
+				light.cone.angle = angle(rng);
+			}
+			else
+			{
+				light.sphere.light_type = Util::LightType_Sphere;
+				light.sphere.position = position;
+				light.sphere.radius = radius(rng);
+			}
+
+			light_environment.lights.push_back(light);
+		}
+
+		return light_environment;
+	}
+
+	/// <summary>
+	/// Each step of building a camera's light clusters, with the slices
+	/// assigned one after another as a single job would.
+	/// </summary>
+	BC_BENCHMARK(LightClusterAssignment)
+	{
+		CameraContext context;
+		context.near_clip = 0.1f;
+		context.far_clip = 250.0f;
+		context.view_matrix = glm::lookAt(glm::vec3(0.0f, 0.0f, 10.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+		context.projection_matrix = glm::perspective(glm::radians(context.fov), context.aspect_ratio, context.near_clip, context.far_clip);
+
+		std::mt19937 rng(45);
+
+		for (size_t light_count : LIGHT_CLUSTER_LIGHT_COUNTS)
+		{
+			LightEnvironment light_environment = MakeBenchmarkLights(rng, light_count);
+			LightClusterGrid grid;
+
+			double begin = Benchmark::Measure(LIGHT_CLUSTER_REPEAT_COUNT, [&]()
+			{
+				grid.Begin(context, light_environment);
+			});
+
+			double assign = Benchmark::Measure(LIGHT_CLUSTER_REPEAT_COUNT, [&]()
+			{
+				grid.Begin(context, light_environment);
+				for (uint32_t slice = 0; slice < LightClusterGrid::SLICE_COUNT; ++slice)
+					grid.AssignSlice(slice);
+			}) - begin;
+
+			double total = Benchmark::Measure(LIGHT_CLUSTER_REPEAT_COUNT, [&]()
+			{
+				grid.Begin(context, light_environment);
+				for (uint32_t slice = 0; slice < LightClusterGrid::SLICE_COUNT; ++slice)
+					grid.AssignSlice(slice);
+				grid.Finalise();
+
+				Benchmark::Consume(grid.light_indices.size());
+			});
+
+			std::printf("  %zu Lights, %.2f Lights per Cluster\n", light_count,
+				static_cast<double>(grid.light_indices.size()) / LightClusterGrid::CLUSTER_COUNT);
+
+			Benchmark::Report("LightClusterGrid::Begin", begin, light_count);
+			Benchmark::Report("LightClusterGrid::AssignSlice (Every Slice)", assign, light_count);
+			Benchmark::Report("Total", total, light_count);
+		}
+	}
+
+}
@@ -0,0 +1,399 @@
+#include "BC_PCH.h"
+#include "Benchmark.h"
+#include "Reference/SharedPtrOctree.h"
+
+// Core Headers
+#include "Project/Scene/Bounds/BVH.h"
+#include "Project/Scene/Bounds/Octree.h"
+
+// C++ Standard Library Headers
+#include <array>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+// External Vendor Library Headers
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace BC
+{
+
+	static constexpr size_t SPATIAL_INDEX_REPEAT_COUNT = 5;
+	static constexpr std::array<size_t, 3> SPATIAL_INDEX_ITEM_COUNTS = { 1000, 10000, 100000 };
+	static constexpr size_t SPATIAL_INDEX_QUERY_COUNT = 64;
+	static constexpr float SPATIAL_INDEX_WORLD_EXTENT = 500.0f;
+
+	/// <summary>
+	/// Every tenth data source moves between its bounds and its moved bounds.
+	/// </summary>
+	static constexpr size_t SPATIAL_INDEX_MOVE_STRIDE = 10;
+	static constexpr size_t SPATIAL_INDEX_NEAREST_COUNT = 8;
+
+	/// <summary>
+	/// The shared_ptr octree keeps its data sources in one vector, searched
+	/// and shifted on every insert, update and remove, so its runs grow with
+	/// the square of the item count. Above this count only the pooled octree
+	/// is timed.
+	/// </summary>
+	static constexpr size_t SPATIAL_INDEX_REFERENCE_ITEM_LIMIT = 10000;
+
+	/// <summary>
+	/// The share of a scene like workload's data sources inserted as static,
+	/// as the scene does for meshes without a rigidbody or skinning.
+	/// </summary>
+	static constexpr float SPATIAL_INDEX_STATIC_FRACTION = 0.9f;
+
+	struct SpatialIndexWorkload
+	{
+		std::vector<Bounds_AABB> Bounds;
+		std::vector<Bounds_AABB> MovedBounds;
+
+		/// <summary>
+		/// The first StaticCount data sources are inserted as static and never
+		/// moved, the rest are dynamic.
+		/// </summary>
+		size_t StaticCount = 0;
+
+		std::vector<Frustum> Frustums;
+		std::vector<Bounds_AABB> QueryBoxes;
+		std::vector<Bounds_Sphere> QuerySpheres;
+		std::vector<Ray> QueryRays;
+		std::vector<glm::vec3> QueryPoints;
+	};
+
+	struct SpatialIndexTimings
+	{
+		double Insert = 0.0;
+		double Update = 0.0;
+		double Remove = 0.0;
+
+		double QueryFrustum = 0.0;
+		double QueryAABB = 0.0;
+		double QuerySphere = 0.0;
+
+		/// <summary>
+		/// Left at zero for indices without ray or nearest queries.
+		/// </summary>
+		double QueryRay = 0.0;
+		double QueryNearest = 0.0;
+	};
+
+	/// <summary>
+	/// Small bounds scattered through the world, queried by cameras placed
+	/// within it, by boxes and spheres a tenth of its size, by rays towards
+	/// data sources and by nearest searches from random points.
+	/// </summary>
+	static SpatialIndexWorkload MakeSpatialIndexWorkload(std::mt19937& rng, size_t item_count, size_t static_count = 0)
+	{
+		std::uniform_real_distribution<float> coordinate(-SPATIAL_INDEX_WORLD_EXTENT, SPATIAL_INDEX_WORLD_EXTENT);
+		std::uniform_real_distribution<float> extent(0.5f, 4.0f);
+		std::uniform_real_distribution<float> movement(-2.0f, 2.0f);
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+		SpatialIndexWorkload workload;
+		workload.StaticCount = static_count;
+		workload.Bounds.reserve(item_count);
+		workload.MovedBounds.reserve(item_count);
+
+		for (size_t i = 0; i < item_count; ++i)
+		{
+			glm::vec3 centre(coordinate(rng), coordinate(rng), coordinate(rng));
+			glm::vec3 half_size(extent(rng), extent(rng), extent(rng));
+			glm::vec3 offset(movement(rng), movement(rng), movement(rng));
+
+			workload.Bounds.emplace_back(centre - half_size, centre + half_size);
+			workload.MovedBounds.emplace_back(centre + offset - half_size, centre + offset + half_size);
+		}
+
+		const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, SPATIAL_INDEX_WORLD_EXTENT * 0.5f);
+		const float query_size = SPATIAL_INDEX_WORLD_EXTENT * 0.1f;
+		std::uniform_int_distribution<size_t> target_index(0, item_count - 1);
+
+		for (size_t i = 0; i < SPATIAL_INDEX_QUERY_COUNT; ++i)
+		{
+			glm::vec3 position(coordinate(rng), coordinate(rng), coordinate(rng));
+			glm::vec3 direction = glm::normalize(glm::vec3(unit(rng), unit(rng) * 0.5f, unit(rng)) + glm::vec3(0.0f, 0.0f, 0.01f));
+			workload.Frustums.emplace_back(projection * glm::lookAt(position, position + direction, glm::vec3(0.0f, 1.0f, 0.0f)));
+
+			glm::vec3 centre(coordinate(rng), coordinate(rng), coordinate(rng));
+			workload.QueryBoxes.emplace_back(centre - glm::vec3(query_size), centre + glm::vec3(query_size));
+			workload.QuerySpheres.emplace_back(glm::vec3(coordinate(rng), coordinate(rng), coordinate(rng)), query_size);
+
+			// Aimed at a data source, so the ray has something to hit
+			const Bounds_AABB& target = workload.Bounds[target_index(rng)];
+			glm::vec3 ray_origin(coordinate(rng), coordinate(rng), coordinate(rng));
+			workload.QueryRays.push_back(Ray{ ray_origin, glm::normalize((target.BoundsMin + target.BoundsMax) * 0.5f - ray_origin) });
+			workload.QueryPoints.emplace_back(coordinate(rng), coordinate(rng), coordinate(rng));
+		}
+
+		return workload;
+	}
+
+	/// <summary>
+	/// Inserts the workload as the scene does. Indices with a static tree are
+	/// built in one pass, as the scene builds them on load, since inserting
+	/// static data one at a time rebuilds the static tree every
+	/// StaticRebuildThreshold changes. Other indices have every data source
+	/// inserted on its own.
+	/// </summary>
+	template<typename IndexType>
+	static void InsertSpatialIndexWorkload(IndexType& index, const SpatialIndexWorkload& workload)
+	{
+		const uint32_t item_count = static_cast<uint32_t>(workload.Bounds.size());
+		const uint32_t static_count = static_cast<uint32_t>(workload.StaticCount);
+
+		if constexpr (requires { index.BuildStatic(); })
+		{
+			if (static_count > 0)
+			{
+				std::vector<SpatialDataSource<uint32_t>> data_sources;
+				data_sources.reserve(item_count);
+				for (uint32_t i = 0; i < item_count; ++i)
+					data_sources.emplace_back(i, workload.Bounds[i]);
+
+				index.Build(data_sources, [static_count](uint32_t data) { return data < static_count; });
+				return;
+			}
+		}
+
+		for (uint32_t i = 0; i < item_count; ++i)
+		{
+			if constexpr (std::is_base_of_v<SpatialIndex<uint32_t>, IndexType>)
+			{
+				if (i < static_count)
+				{
+					index.InsertStatic(i, workload.Bounds[i]);
+					continue;
+				}
+			}
+
+			index.Insert(i, workload.Bounds[i]);
+		}
+	}
+
+	template<typename IndexType, typename ShapeType, typename QueryFunction>
+	static double MeasureSpatialIndexQueries(IndexType& index, const std::vector<ShapeType>& shapes, QueryFunction& query)
+	{
+		return Benchmark::Measure(SPATIAL_INDEX_REPEAT_COUNT, [&]()
+		{
+			uint64_t hit_count = 0;
+			for (const ShapeType& shape : shapes)
+				hit_count += query(index, shape);
+
+			Benchmark::Consume(hit_count);
+		});
+	}
+
+	/// <summary>
+	/// Times each operation the scene performs on its spatial index. Each run of
+	/// the insert builds its own index, which the matching run of the remove
+	/// then empties, so neither is measured against a half built index. Only
+	/// dynamic data sources are removed one at a time, static data is cleared
+	/// with the index as when its scene is released.
+	/// </summary>
+	/// <param name="query">
+	/// Called with the index and a Frustum, Bounds_AABB or Bounds_Sphere,
+	/// returning the amount of data sources found.
+	/// </param>
+	template<typename IndexType, typename QueryFunction>
+	static SpatialIndexTimings RunSpatialIndexBenchmark(const SpatialIndexWorkload& workload, QueryFunction&& query)
+	{
+		const uint32_t item_count = static_cast<uint32_t>(workload.Bounds.size());
+
+		std::vector<std::unique_ptr<IndexType>> indices(SPATIAL_INDEX_REPEAT_COUNT);
+		for (auto& index : indices)
+			index = std::make_unique<IndexType>();
+
+		SpatialIndexTimings timings;
+		size_t run = 0;
+
+		timings.Insert = Benchmark::Measure(SPATIAL_INDEX_REPEAT_COUNT, [&]()
+		{
+			IndexType& index = *indices[run++];
+			InsertSpatialIndexWorkload(index, workload);
+
+			Benchmark::Consume(index.TotalCount());
+		});
+
+		IndexType& built_index = *indices.front();
+
+		timings.QueryFrustum = MeasureSpatialIndexQueries(built_index, workload.Frustums, query);
+		timings.QueryAABB = MeasureSpatialIndexQueries(built_index, workload.QueryBoxes, query);
+		timings.QuerySphere = MeasureSpatialIndexQueries(built_index, workload.QuerySpheres, query);
+
+		if constexpr (std::is_base_of_v<SpatialIndex<uint32_t>, IndexType>)
+		{
+			const float query_distance = SPATIAL_INDEX_WORLD_EXTENT * 0.1f;
+			std::vector<SpatialQueryHit<uint32_t>> hits;
+
+			timings.QueryRay = Benchmark::Measure(SPATIAL_INDEX_REPEAT_COUNT, [&]()
+			{
+				uint64_t hit_count = 0;
+				for (const Ray& ray : workload.QueryRays)
+				{
+					hits.clear();
+					built_index.QueryRay(ray, SPATIAL_INDEX_WORLD_EXTENT * 2.0f, hits, true);
+					hit_count += hits.size();
+				}
+
+				Benchmark::Consume(hit_count);
+			});
+
+			timings.QueryNearest = Benchmark::Measure(SPATIAL_INDEX_REPEAT_COUNT, [&]()
+			{
+				uint64_t hit_count = 0;
+				for (const glm::vec3& point : workload.QueryPoints)
+				{
+					hits.clear();
+					built_index.QueryNearest(point, SPATIAL_INDEX_NEAREST_COUNT, query_distance, hits);
+					hit_count += hits.size();
+				}
+
+				Benchmark::Consume(hit_count);
+			});
+		}
+
+		// Alternates between the moved and original bounds, so every run moves.
+		// Only dynamic data sources move.
+		run = 0;
+		timings.Update = Benchmark::Measure(SPATIAL_INDEX_REPEAT_COUNT, [&]()
+		{
+			const std::vector<Bounds_AABB>& bounds = run++ % 2 == 0 ? workload.MovedBounds : workload.Bounds;
+			for (uint32_t i = static_cast<uint32_t>(workload.StaticCount); i < item_count; i += SPATIAL_INDEX_MOVE_STRIDE)
+				built_index.Update(i, bounds[i]);
+
+			Benchmark::Consume(built_index.TotalCount());
+		});
+
+		run = 0;
+		timings.Remove = Benchmark::Measure(SPATIAL_INDEX_REPEAT_COUNT, [&]()
+		{
+			IndexType& index = *indices[run++];
+			for (uint32_t i = static_cast<uint32_t>(workload.StaticCount); i < item_count; ++i)
+				index.Remove(i);
+
+			if constexpr (std::is_base_of_v<SpatialIndex<uint32_t>, IndexType>)
+			{
+				if (workload.StaticCount > 0)
+					index.Clear();
+			}
+
+			Benchmark::Consume(index.TotalCount());
+		});
+
+		return timings;
+	}
+
+	/// <summary>
+	/// Prints each operation timed for both indices, with the speed up of the
+	/// second index over the baseline. Operations the baseline was not timed
+	/// for are printed for the second index alone.
+	/// </summary>
+	static void ReportSpatialIndexTimings(const SpatialIndexWorkload& workload, const char* baseline_name, const SpatialIndexTimings& baseline, const char* name, const SpatialIndexTimings& timings)
+	{
+		const size_t item_count = workload.Bounds.size();
+		const size_t dynamic_count = item_count - workload.StaticCount;
+		const size_t update_count = (dynamic_count + SPATIAL_INDEX_MOVE_STRIDE - 1) / SPATIAL_INDEX_MOVE_STRIDE;
+
+		auto report = [&](const char* operation, double SpatialIndexTimings::* timing, size_t count)
+		{
+			if (timings.*timing == 0.0)
+				return;
+
+			char label[64];
+			if (baseline.*timing != 0.0)
+			{
+				std::snprintf(label, sizeof(label), "%s (%s)", operation, baseline_name);
+				Benchmark::Report(label, baseline.*timing, count);
+			}
+
+			std::snprintf(label, sizeof(label), "%s (%s)", operation, name);
+			Benchmark::Report(label, timings.*timing, count, baseline.*timing);
+		};
+
+		if (workload.StaticCount > 0)
+			std::printf("  %zu Bounds, %zu Static\n", item_count, workload.StaticCount);
+		else
+			std::printf("  %zu Bounds\n", item_count);
+
+		report("Insert", &SpatialIndexTimings::Insert, item_count);
+		report("Query Frustum", &SpatialIndexTimings::QueryFrustum, SPATIAL_INDEX_QUERY_COUNT);
+		report("Query AABB", &SpatialIndexTimings::QueryAABB, SPATIAL_INDEX_QUERY_COUNT);
+		report("Query Sphere", &SpatialIndexTimings::QuerySphere, SPATIAL_INDEX_QUERY_COUNT);
+		report("Query Ray (First Hit)", &SpatialIndexTimings::QueryRay, SPATIAL_INDEX_QUERY_COUNT);
+		report("Query Nearest", &SpatialIndexTimings::QueryNearest, SPATIAL_INDEX_QUERY_COUNT);
+		report("Update", &SpatialIndexTimings::Update, update_count);
+		report("Remove", &SpatialIndexTimings::Remove, dynamic_count);
+	}
+
+	/// <summary>
+	/// The pooled OctreeBounds against the shared_ptr octree it replaced, up
+	/// to SPATIAL_INDEX_REFERENCE_ITEM_LIMIT bounds.
+	/// </summary>
+	BC_BENCHMARK(OctreePoolVsSharedPtr)
+	{
+		std::mt19937 rng(32);
+
+		for (size_t item_count : SPATIAL_INDEX_ITEM_COUNTS)
+		{
+			SpatialIndexWorkload workload = MakeSpatialIndexWorkload(rng, item_count);
+
+			SpatialIndexTimings shared_ptr_octree;
+			if (item_count <= SPATIAL_INDEX_REFERENCE_ITEM_LIMIT)
+			{
+				shared_ptr_octree = RunSpatialIndexBenchmark<Reference::OctreeBounds<uint32_t>>(workload,
+					[](Reference::OctreeBounds<uint32_t>& octree, const auto& shape)
+					{
+						return octree.Query(shape).size();
+					});
+			}
+
+			SpatialIndexTimings pooled_octree = RunSpatialIndexBenchmark<OctreeBounds<uint32_t>>(workload,
+				[results = std::vector<SpatialDataSource<uint32_t>>()](const OctreeBounds<uint32_t>& octree, const auto& shape) mutable
+				{
+					results.clear();
+					octree.Query(shape, results);
+					return results.size();
+				});
+
+			ReportSpatialIndexTimings(workload, "shared_ptr Octree", shared_ptr_octree, "Pooled Octree", pooled_octree);
+		}
+	}
+
+	/// <summary>
+	/// The BVH against the pooled OctreeBounds, first with every data source
+	/// inserted as dynamic data as the scene does for moving entities, then
+	/// with most inserted as static data, as in a typical scene, so the BVH's
+	/// SAH built static tree is measured too.
+	/// </summary>
+	BC_BENCHMARK(OctreeVsBVH)
+	{
+		std::mt19937 rng(36);
+
+		auto query = [results = std::vector<SpatialDataSource<uint32_t>>()](const SpatialIndex<uint32_t>& index, const auto& shape) mutable
+		{
+			results.clear();
+			index.Query(shape, results);
+			return results.size();
+		};
+
+		for (size_t item_count : SPATIAL_INDEX_ITEM_COUNTS)
+		{
+			const size_t static_count = static_cast<size_t>(static_cast<float>(item_count) * SPATIAL_INDEX_STATIC_FRACTION);
+
+			for (size_t workload_static_count : { size_t(0), static_count })
+			{
+				SpatialIndexWorkload workload = MakeSpatialIndexWorkload(rng, item_count, workload_static_count);
+
+				SpatialIndexTimings octree = RunSpatialIndexBenchmark<OctreeBounds<uint32_t>>(workload, query);
+				SpatialIndexTimings bvh = RunSpatialIndexBenchmark<BVHBounds<uint32_t>>(workload, query);
+
+				ReportSpatialIndexTimings(workload, "Pooled Octree", octree, "BVH", bvh);
+			}
+		}
+	}
+
+}
@@ -0,0 +1,73 @@
+#include "BC_PCH.h"
+#include "Prefab.h"
+
+#include "Project/Scene/Entity.h"
+
+namespace BC
+{
+
+    namespace Util
+    {
+        template<typename... Component>
+        static void CaptureComponents(ComponentGroup<Component...>, entt::registry& registry, const std::vector<entt::entity>& template_handles, const std::vector<Entity>& source_entities)
+        {
+            ([&]()
+                {
+                    auto& storage = registry.storage<Component>();
+                    for (size_t i = 0; i < source_entities.size(); ++i)
+                    {
+                        if (const Component* component = source_entities[i].TryGetComponent<Component>(); component)
+                            storage.emplace(template_handles[i], *component);
+                    }
+                }(), ...);
+        }
+    }
+
+    std::shared_ptr<Prefab> Prefab::CreateFromEntity(const Entity& root_entity)
+    {
+        BC_PROFILE_SCOPE("Prefab::CreateFromEntity");
+
+        if (!root_entity)
+        {
+            BC_CORE_WARN("Prefab::CreateFromEntity: Cannot Create Prefab - Root Entity Is Invalid.");
+            return nullptr;
+        }
+
+        auto prefab = std::make_shared<Prefab>();
+        prefab->Handle = GUID();
+
+        // 1. Flatten the hierarchy depth first so parents precede children
+        std::vector<Entity> source_entities;
+        {
+            std::vector<std::pair<Entity, uint32_t>> stack = { { root_entity, ROOT_NODE_PARENT } };
+            while (!stack.empty())
+            {
+                auto [entity, parent_index] = stack.back();
+                stack.pop_back();
+
+                uint32_t node_index = static_cast<uint32_t>(prefab->m_Nodes.size());
+                prefab->m_Nodes.push_back({ parent_index, {} });
+                if (parent_index != ROOT_NODE_PARENT)
+                    prefab->m_Nodes[parent_index].ChildIndices.push_back(node_index);
+
+                source_entities.push_back(entity);
+
+                // Pushed in reverse so children are flattened in sibling order
+                size_t first_child = stack.size();
+                for (Entity child_entity : entity.GetChildren())
+                    stack.emplace_back(child_entity, node_index);
+                std::reverse(stack.begin() + first_child, stack.end());
+            }
+        }
+
+        // 2. Copy the component data of every node into the template, the
+        //    copy constructors leave the template unbound from any entity
+        prefab->m_TemplateHandles.resize(source_entities.size());
+        prefab->m_Registry.create(prefab->m_TemplateHandles.begin(), prefab->m_TemplateHandles.end());
+
+        Util::CaptureComponents(Util::AllComponents{}, prefab->m_Registry, prefab->m_TemplateHandles, source_entities);
+
+        return prefab;
+    }
+
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+// Core Headers
+#include "Asset/Asset.h"
+
+// C++ Standard Library Headers
+#include <memory>
+#include <vector>
+#include <limits>
+
+// External Vendor Library Headers
+#include <entt/entt.hpp>
+
+namespace BC
+{
+
+    class Entity;
+
+    /// @brief Tag placed on every entity of a pooled prefab instance whilst
+    /// it is parked waiting to be instantiated again
+    struct PrefabPoolParked { };
+
+    class Prefab : public Asset
+    {
+
+    public:
+
+        static constexpr uint32_t ROOT_NODE_PARENT = std::numeric_limits<uint32_t>::max();
+
+        /// @brief Hierarchy of the template. Nodes are stored depth first so
+        /// a parent always precedes its children.
+        struct PrefabNode
+        {
+            uint32_t ParentIndex = ROOT_NODE_PARENT;
+            std::vector<uint32_t> ChildIndices = {};
+        };
+
+        Prefab() = default;
+        ~Prefab() = default;
+
+        Prefab(const Prefab& other) = delete;
+        Prefab& operator=(const Prefab& other) = delete;
+
+        AssetType GetType() const override { return AssetType::Prefab; }
+
+        /// @brief Captures the entity and all of its descendants into a new
+        /// template. The template is immutable once created and may be
+        /// instantiated into any number of scenes.
+        static std::shared_ptr<Prefab> CreateFromEntity(const Entity& root_entity);
+
+        size_t GetNodeCount() const { return m_Nodes.size(); }
+        const std::vector<PrefabNode>& GetNodes() const { return m_Nodes; }
+
+    private:
+
+        std::vector<PrefabNode> m_Nodes = {};
+
+        /// @brief Template entity of each node, indexed the same as m_Nodes
+        std::vector<entt::entity> m_TemplateHandles = {};
+
+        /// @brief Component data of the template, one storage per component
+        /// type. Only ever read once the prefab has been created.
+        entt::registry m_Registry;
+
+        friend class Scene;
+
+    };
+
+}
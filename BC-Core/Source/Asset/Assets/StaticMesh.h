@@ -6,6 +6,7 @@
 #include "Project/Scene/Bounds/Bounds.h"
 
 // C++ Standard Library Headers
+#include <cstdint>
 #include <vector>
 #include <memory>
 
@@ -17,6 +18,17 @@ namespace BC
     class SubMesh
     {
 
+    public:
+
+        void SetIndexCount(uint32_t index_count) { m_IndexCount = index_count; }
+
+        uint32_t GetIndexCount() const { return m_IndexCount; }
+        uint32_t GetTriangleCount() const { return m_IndexCount / 3; }
+
+    private:
+
+        uint32_t m_IndexCount = 0;
+
     };
 
     class StaticMesh : public Asset
@@ -98,6 +98,34 @@ namespace BC
 
             BC_PROFILE_SCOPE("Application::Run: Main Loop");
 
+            // Kick Job to Snapshot Current Scene State for Rendering in Frame
+            // N + 2. Kicked here rather than by the render thread, so the main
+            // thread knows the job exists before anything it does this frame
+            // could add or remove a scene, see WaitForSceneSnapshot.
+            {
+                uint32_t snapshot_frame_index = (m_VulkanCore->GetFrameIndex() + 2) % m_VulkanCore->GetSwapchain().GetImageCount();
+                m_InFlightSceneSnapshot = &m_SceneSnapshotJobCounters[snapshot_frame_index];
+
+                m_JobSystem->SubmitJob
+                (
+                    "Render Prep: Snapshot Scene State", 
+                    [this, snapshot_frame_index]() 
+                    { 
+                        std::vector<CameraContext> camera_overrides = {};
+                        for (Layer* layer : *m_LayerStack)
+                        {
+                            camera_overrides = layer->GetCameraOverrides();
+                            if (!camera_overrides.empty())
+                                break;
+                        }
+                        SceneRenderer::SnapshotScene(snapshot_frame_index, camera_overrides); 
+                    }, 
+                    m_InFlightSceneSnapshot,
+                    JobPriority::High, // Needs to be done quick before update functions start modifying the scene state!
+                    false
+                );
+            }
+
             m_JobSystem->BeginFrameProfile();
             Profiler::Get().NewFrame();
             Time::UpdateTime();
@@ -232,7 +260,7 @@ namespace BC
             // ----------------------------
             //     Render Thread Flow
             //
-            // 1. Kick Job to SnapshotScene for N + 2
+            // 1. SnapshotScene for N + 2 is kicked by the main thread
             //      a. Collect override cameras from attached layers if any
             //      b. Snapshot scene state including lighting, geometry, etc.
             // 2. Kick Job to RecordCommandBuffers for N + 1
@@ -242,26 +270,6 @@ namespace BC
             // 4. Submit Command Buffers once job complete
             // ----------------------------
 
-            // Kick Job to Snapshot Current Scene State for Rendering in Frame N + 2
-            m_JobSystem->SubmitJob
-            (
-                "Render Prep: Snapshot Scene State", 
-                [&]() 
-                { 
-                    std::vector<CameraContext> camera_overrides = {};
-                    for (Layer* layer : *m_LayerStack)
-                    {
-                        camera_overrides = layer->GetCameraOverrides();
-                        if (!camera_overrides.empty())
-                            break;
-                    }
-                    SceneRenderer::SnapshotScene((current_frame_index + 2) % m_VulkanCore->GetSwapchain().GetImageCount(), camera_overrides); 
-                }, 
-                &m_SceneSnapshotJobCounters[(current_frame_index + 2) % m_VulkanCore->GetSwapchain().GetImageCount()], 
-                JobPriority::High, // Needs to be done quick before update functions start modifying the scene state!
-                false
-            );
-
             // Kick Job to Record Command Buffers for frame N + 1
             m_JobSystem->SubmitJob
             (
@@ -282,6 +290,7 @@ namespace BC
             // Render
             // 1. Submit Render Command Buffers for frame N
             // 2. Wait for GPU to Complete Work for frame N
+            SceneRenderer::SubmitCommandBuffers(current_frame_index);
 
             {
                 BC_PROFILE_SCOPE("Render Thread: Waiting For Main Thread to Finish Updates.");
@@ -333,6 +342,12 @@ namespace BC
         // TODO: Implement
     }
 
+    void Application::WaitForSceneSnapshot()
+    {
+        if (m_InFlightSceneSnapshot)
+            m_InFlightSceneSnapshot->Wait();
+    }
+
     void Application::OnUpdate()
     {
         BC_PROFILE_SCOPE("Application::OnUpdate: On Update Loop");
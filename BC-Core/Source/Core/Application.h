@@ -79,6 +79,11 @@ namespace BC
 
 		void SubmitToMainThread(const std::function<void()>& function);
 
+		/// @brief Blocks until this frame's scene snapshot job has finished
+		/// reading the scenes. Main thread only. Once it returns, scenes may be
+		/// published, released or replaced until the next frame starts.
+		void WaitForSceneSnapshot();
+
 		void ResizeScreenSpace(uint32_t width, uint32_t height);
 		void ResizeSwapchain(const SwapchainSpecification& swapchain_spec);
 
@@ -88,6 +93,7 @@ namespace BC
 
 		void SetProject(std::unique_ptr<Project> project)
 		{
+			WaitForSceneSnapshot();
 			m_Project = std::move(project);
 		}
 
@@ -155,6 +161,9 @@ namespace BC
 		/// Each counter tracks the capture of scene data for (frame_index + 2),
 		/// used to prepare render commands ahead of time.
 		std::vector<JobCounter> m_SceneSnapshotJobCounters = {};
+
+		/// @brief Counter of the snapshot kicked this frame, see WaitForSceneSnapshot
+		JobCounter* m_InFlightSceneSnapshot = nullptr;
 		
 		/// @brief Triple-buffered job counters for render command preparation.
 		///
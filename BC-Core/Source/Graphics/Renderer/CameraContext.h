@@ -9,12 +9,16 @@
 #include "GeometryEnvironment.h"
 #include "LightEnvironment.h"
 #include "ShadowEnvironment.h"
+#include "OcclusionBuffer.h"
+#include "InstanceBatcher.h"
+#include "LightClusters.h"
 
 #include "Project/Scene/Bounds/Frustum.h"
 
 // C++ Standard Library Headers
 
 // External Vendor Library Headers
+#include <vulkan/vulkan.h>
 
 namespace BC
 {
@@ -69,12 +73,15 @@ namespace BC
 
     struct CameraEnvironment
     {
+        // Recorded in parallel by SceneRenderer::RecordCommandBuffers, from the
+        // recording thread's pool, and executed by the snapshot's primary
+        // command buffer in this order. Left null when a pass has nothing to
+        // record for this camera.
         struct
         {
-            // CommandBuffer depth_prepass_cmd;
-            // CommandBuffer shadow_pass_cmd;
-            // CommandBuffer compute_light_cull_cmd;
-            // CommandBuffer color_pass_cmd;
+            VkCommandBuffer depth_prepass_cmd = VK_NULL_HANDLE;
+            VkCommandBuffer compute_culling_cmd = VK_NULL_HANDLE;
+            VkCommandBuffer colour_pass_cmd = VK_NULL_HANDLE;
             // CommandBuffer postprocess_cmd;
         } secondary_command_buffers;
 
@@ -83,6 +90,21 @@ namespace BC
 
         GeometryEnvironment geometry_environment;
         CameraContext camera_ctx;
+
+        // Instanced draws built from geometry_environment, indexing into the
+        // snapshot's instance buffer
+        std::pmr::vector<Util::InstanceBatch> instance_batches;
+
+        // Occluders of this camera drawn on the CPU
+        OcclusionBuffer occlusion_buffer;
+        OcclusionCullingStats occlusion_stats;
+
+        // Sphere and cone lights of the frame's light environment binned into
+        // this camera's clusters
+        LightClusterGrid light_clusters;
+
+        explicit CameraEnvironment(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) :
+            geometry_environment(resource), instance_batches(resource), occlusion_buffer(resource), light_clusters(resource) {}
     };
 
 }
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "BC_PCH.h"
+#include "FrameArena.h"
+
+namespace BC
+{
+
+    // Blocks start on a cache line, allocations are aligned by address
+    static constexpr size_t FRAME_ARENA_BLOCK_ALIGNMENT = 64;
+
+    FrameArena::FrameArena(size_t initial_size)
+    {
+        AddBlock(initial_size);
+    }
+
+    FrameArena::~FrameArena()
+    {
+        FreeBlocks();
+    }
+
+    void FrameArena::Reset()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        // Outgrown, fold every block into one large enough for the whole frame
+        if (m_Blocks.size() > 1)
+        {
+            size_t total_size = 0;
+            for (const Block& block : m_Blocks)
+                total_size += block.size;
+
+            FreeBlocks();
+            AddBlock(total_size);
+        }
+
+        m_CurrentBlock = 0;
+        m_CurrentOffset = 0;
+        m_UsedBytes = 0;
+    }
+
+    size_t FrameArena::GetUsedBytes() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_UsedBytes;
+    }
+
+    size_t FrameArena::GetCapacity() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        size_t capacity = 0;
+        for (const Block& block : m_Blocks)
+            capacity += block.size;
+        return capacity;
+    }
+
+    void* FrameArena::do_allocate(size_t bytes, size_t alignment)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        while (true)
+        {
+            Block& block = m_Blocks[m_CurrentBlock];
+
+            uintptr_t block_address = reinterpret_cast<uintptr_t>(block.data);
+            size_t aligned_offset = ((block_address + m_CurrentOffset + alignment - 1) & ~(alignment - 1)) - block_address;
+            if (aligned_offset + bytes <= block.size)
+            {
+                m_UsedBytes += aligned_offset + bytes - m_CurrentOffset;
+                m_CurrentOffset = aligned_offset + bytes;
+                return block.data + aligned_offset;
+            }
+
+            if (m_CurrentBlock + 1 == m_Blocks.size())
+                AddBlock(std::max(block.size * 2, bytes + alignment));
+
+            m_CurrentBlock++;
+            m_CurrentOffset = 0;
+        }
+    }
+
+    void FrameArena::AddBlock(size_t minimum_size)
+    {
+        Block block = {};
+        block.size = (std::max(minimum_size, FRAME_ARENA_BLOCK_ALIGNMENT) + FRAME_ARENA_BLOCK_ALIGNMENT - 1) & ~(FRAME_ARENA_BLOCK_ALIGNMENT - 1);
+        block.data = static_cast<std::byte*>(::operator new(block.size, std::align_val_t(FRAME_ARENA_BLOCK_ALIGNMENT)));
+
+        m_Blocks.push_back(block);
+    }
+
+    void FrameArena::FreeBlocks()
+    {
+        for (const Block& block : m_Blocks)
+            ::operator delete(block.data, std::align_val_t(FRAME_ARENA_BLOCK_ALIGNMENT));
+
+        m_Blocks.clear();
+    }
+
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+// Core Headers
+
+// C++ Standard Library Headers
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+// External Vendor Library Headers
+
+namespace BC
+{
+
+    /// @brief A linear allocator owned by a frame in flight. Every container of
+    /// that frame's snapshot allocates from it through std::pmr, deallocation
+    /// is a no-op, and the whole arena is rewound at once when the frame slot
+    /// is recycled.
+    ///
+    /// When a frame outgrows the arena further blocks are chained on. The next
+    /// Reset replaces them with a single block of the combined size, so once
+    /// the scene settles a snapshot no longer touches the heap.
+    class FrameArena : public std::pmr::memory_resource
+    {
+
+    public:
+
+        static constexpr size_t DEFAULT_BLOCK_SIZE = 1024 * 1024;
+
+        explicit FrameArena(size_t initial_size = DEFAULT_BLOCK_SIZE);
+        ~FrameArena() override;
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        /// @brief Rewinds the arena. Everything allocated from it must have
+        /// been destroyed, or no longer be touched, by the time this is called.
+        void Reset();
+
+        /// @brief Bytes handed out since the last Reset, including padding
+        size_t GetUsedBytes() const;
+        size_t GetCapacity() const;
+
+    private:
+
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {}
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        struct Block
+        {
+            std::byte* data = nullptr;
+            size_t size = 0;
+        };
+
+        void AddBlock(size_t minimum_size);
+        void FreeBlocks();
+
+        // Snapshot jobs allocate from several threads at once. Containers grow
+        // geometrically so the lock is rarely taken more than a few hundred
+        // times a frame.
+        mutable std::mutex m_Mutex;
+
+        std::vector<Block> m_Blocks;
+        size_t m_CurrentBlock = 0;
+        size_t m_CurrentOffset = 0;
+
+        size_t m_UsedBytes = 0;
+
+    };
+
+}
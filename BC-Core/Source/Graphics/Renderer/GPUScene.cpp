@@ -0,0 +1,304 @@
+#include "BC_PCH.h"
+#include "GPUScene.h"
+
+#include "Asset/AssetManagerAPI.h"
+#include "Asset/Assets/Material.h"
+#include "Asset/Assets/StaticMesh.h"
+
+#include "Graphics/Vulkan/VulkanUtil.h"
+
+#include "Project/Scene/SceneManager.h"
+#include "Project/Scene/Components/MeshComponents.h"
+
+namespace BC
+{
+
+    void GPUSceneUpload::Write(Util::GPUSceneBuffer buffer, uint32_t slot, const void* element)
+    {
+        size_t element_size = Util::GPU_SCENE_ELEMENT_SIZES[buffer];
+        size_t data_offset = data.size();
+
+        data.resize(data_offset + element_size);
+        std::memcpy(data.data() + data_offset, element, element_size);
+
+        if (!regions.empty())
+        {
+            Region& last_region = regions.back();
+            if (last_region.buffer == buffer && last_region.first_slot + last_region.slot_count == slot)
+            {
+                last_region.slot_count++;
+                return;
+            }
+        }
+
+        regions.push_back({ buffer, slot, 1, data_offset });
+    }
+
+    void GPUScene::Update(const SceneManager& scene_manager, GPUSceneUpload& upload, GPUSceneStats& out_stats)
+    {
+        BC_PROFILE_SCOPE("GPUScene::Update");
+
+        if (m_UploadDiscarded.exchange(false))
+        {
+            m_Objects.Invalidate();
+            m_Lights.Invalidate();
+            m_Materials.Invalidate();
+        }
+
+        uint64_t update_index = ++m_UpdateCount;
+        uint32_t slot = 0;
+
+        out_stats = {};
+
+        // 1. Objects, and the materials they are drawn with
+        for (Entity entity : scene_manager.GetAllEntitiesWithComponent<MeshRendererComponent>())
+        {
+            const auto& mesh_component = entity.GetComponent<MeshRendererComponent>();
+            if (!mesh_component.GetActive())
+                continue;
+
+            // Bounds come from the mesh once it has loaded, so the slot is
+            // written again when it does
+            auto static_mesh_asset = AssetManager::GetAsset<StaticMesh>(mesh_component.GetMesh());
+            AssetHandle bounds_source = static_mesh_asset ? mesh_component.GetMesh() : NULL_GUID;
+
+            auto& transform = entity.GetTransform();
+            if (m_Objects.Touch(entity, { transform.GetGlobalTransformVersion(), bounds_source }, update_index, slot))
+            {
+                const glm::mat4& transform_matrix = transform.GetGlobalMatrix();
+                Bounds_AABB bounds = static_mesh_asset ? static_mesh_asset->GetMeshBounds().Transformed(transform_matrix) : mesh_component.GetTransformedAABB();
+
+                Util::GPUObjectData object_data = {};
+                object_data.transform_matrix = transform_matrix;
+                object_data.bounds_min = glm::vec4(bounds.BoundsMin, 0.0f);
+                object_data.bounds_max = glm::vec4(bounds.BoundsMax, 0.0f);
+
+                upload.Write(Util::GPUSceneBuffer_Objects, slot, &object_data);
+                out_stats.uploaded_object_count++;
+            }
+
+            for (AssetHandle material_handle : mesh_component.GetMaterialHandles())
+            {
+                auto material_asset = AssetManager::GetAsset<Material>(material_handle);
+                if (!material_asset)
+                    continue;
+
+                if (!m_Materials.Touch(material_handle, { 0, material_asset->GetMaterialRenderType() }, update_index, slot))
+                    continue;
+
+                Util::GPUMaterialData material_data = {};
+                material_data.render_type = material_asset->GetMaterialRenderType();
+
+                upload.Write(Util::GPUSceneBuffer_Materials, slot, &material_data);
+                out_stats.uploaded_material_count++;
+            }
+        }
+
+        // 2. Lights, every active light whether or not a camera sees it, so a
+        // light moving into view has nothing to upload
+        auto update_lights = [&]<typename Component>(Util::LightType light_type, Util::LightData (*make_light_data)(const Component&))
+        {
+            for (Entity entity : scene_manager.GetAllEntitiesWithComponent<Component>())
+            {
+                const auto& component = entity.GetComponent<Component>();
+                if (!component.GetActive())
+                    continue;
+
+                ChangeKey change_key = { entity.GetTransform().GetGlobalTransformVersion(), component.GetDataVersion() };
+                if (!m_Lights.Touch({ entity, light_type }, change_key, update_index, slot))
+                    continue;
+
+                Util::LightData light_data = make_light_data(component);
+
+                upload.Write(Util::GPUSceneBuffer_Lights, slot, &light_data);
+                out_stats.uploaded_light_count++;
+            }
+        };
+
+        update_lights(Util::LightType_Sphere, &Util::MakeSphereLightData);
+        update_lights(Util::LightType_Cone, &Util::MakeConeLightData);
+        update_lights(Util::LightType_Directional, &Util::MakeDirectionalLightData);
+
+        // 3. Slots of destroyed or deactivated entities, and unused materials
+        m_Objects.Sweep(update_index);
+        m_Lights.Sweep(update_index);
+        m_Materials.Sweep(update_index);
+
+        upload.slot_counts[Util::GPUSceneBuffer_Objects] = m_Objects.GetSlotCount();
+        upload.slot_counts[Util::GPUSceneBuffer_Lights] = m_Lights.GetSlotCount();
+        upload.slot_counts[Util::GPUSceneBuffer_Materials] = m_Materials.GetSlotCount();
+
+        out_stats.uploaded_bytes = upload.data.size();
+        out_stats.object_count = m_Objects.GetUsedSlotCount();
+        out_stats.light_count = m_Lights.GetUsedSlotCount();
+        out_stats.material_count = m_Materials.GetUsedSlotCount();
+    }
+
+    uint32_t GPUScene::GetObjectIndex(const Entity& entity) const
+    {
+        return m_Objects.Find(entity);
+    }
+
+    uint32_t GPUScene::GetLightIndex(const Entity& entity, Util::LightType light_type) const
+    {
+        return m_Lights.Find({ entity, light_type });
+    }
+
+    uint32_t GPUScene::GetMaterialIndex(AssetHandle material_handle) const
+    {
+        return m_Materials.Find(material_handle);
+    }
+
+    void GPUScene::RecordUpload(VkCommandBuffer cmd, uint32_t frame_index, uint32_t frame_count, const GPUSceneUpload& upload)
+    {
+        BC_PROFILE_SCOPE("GPUScene::RecordUpload");
+
+        auto vulkan_core = Application::GetVulkanCore();
+        VkDevice device = vulkan_core->GetLogicalDevice();
+
+        // A buffer retired frame_count uploads ago was last used by a submit
+        // which finished before this frame slot's fence was signalled
+        m_UploadCount++;
+        std::erase_if(m_RetiredBuffers, [&](RetiredBuffer& retired)
+        {
+            if (m_UploadCount - retired.retired_upload < frame_count)
+                return false;
+
+            DestroyBuffer(device, retired.buffer);
+            return true;
+        });
+
+        std::array<VkDeviceSize, Util::GPUSceneBuffer_Count> required_sizes = {};
+        bool needs_growth = false;
+        for (size_t i = 0; i < Util::GPUSceneBuffer_Count; ++i)
+        {
+            required_sizes[i] = static_cast<VkDeviceSize>(upload.slot_counts[i]) * Util::GPU_SCENE_ELEMENT_SIZES[i];
+            needs_growth |= required_sizes[i] > m_Buffers[i].size;
+        }
+
+        if (!needs_growth && upload.regions.empty())
+            return;
+
+        // Earlier frames' shader reads and uploads finish before these copies
+        VkMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+
+        constexpr VkPipelineStageFlags SHADER_STAGES = VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+
+        vkCmdPipelineBarrier(cmd, SHADER_STAGES | VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+        // 1. Buffers too small for their slots are replaced by ones at least
+        // twice the size, keeping their contents
+        if (needs_growth)
+        {
+            for (size_t i = 0; i < Util::GPUSceneBuffer_Count; ++i)
+            {
+                DeviceBuffer& buffer = m_Buffers[i];
+                if (required_sizes[i] <= buffer.size)
+                    continue;
+
+                DeviceBuffer grown_buffer;
+                grown_buffer.size = std::max({ required_sizes[i], buffer.size * 2, static_cast<VkDeviceSize>(64 * Util::GPU_SCENE_ELEMENT_SIZES[i]) });
+
+                Util::CreateBuffer(device, vulkan_core->GetPhysicalDevice(), grown_buffer.size,
+                                    VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                    VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                    grown_buffer.buffer, grown_buffer.memory);
+
+                if (buffer.buffer != VK_NULL_HANDLE)
+                {
+                    VkBufferCopy copy_region{};
+                    copy_region.size = buffer.size;
+                    vkCmdCopyBuffer(cmd, buffer.buffer, grown_buffer.buffer, 1, &copy_region);
+
+                    m_RetiredBuffers.push_back({ buffer, m_UploadCount });
+                }
+
+                buffer = grown_buffer;
+            }
+
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+        }
+
+        // 2. Changed slots, through this frame slot's staging buffer
+        if (!upload.regions.empty())
+        {
+            if (m_StagingRing.size() < frame_count)
+                m_StagingRing.resize(frame_count);
+
+            DeviceBuffer& staging_buffer = m_StagingRing[frame_index];
+            if (staging_buffer.size < upload.data.size())
+            {
+                DestroyBuffer(device, staging_buffer);
+
+                staging_buffer.size = std::max(static_cast<VkDeviceSize>(upload.data.size()), staging_buffer.size * 2);
+                Util::CreateBuffer(device, vulkan_core->GetPhysicalDevice(), staging_buffer.size,
+                                    VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                                    VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                    staging_buffer.buffer, staging_buffer.memory);
+
+                VkResult result = vkMapMemory(device, staging_buffer.memory, 0, staging_buffer.size, 0, &staging_buffer.mapped);
+                BC_THROW(result == VK_SUCCESS, "GPUScene::RecordUpload: Could Not Map Staging Buffer.");
+            }
+
+            std::memcpy(staging_buffer.mapped, upload.data.data(), upload.data.size());
+
+            std::array<std::vector<VkBufferCopy>, Util::GPUSceneBuffer_Count> copy_regions;
+            for (const auto& region : upload.regions)
+            {
+                VkDeviceSize element_size = Util::GPU_SCENE_ELEMENT_SIZES[region.buffer];
+
+                VkBufferCopy& copy_region = copy_regions[region.buffer].emplace_back();
+                copy_region.srcOffset = region.data_offset;
+                copy_region.dstOffset = region.first_slot * element_size;
+                copy_region.size = region.slot_count * element_size;
+            }
+
+            for (size_t i = 0; i < Util::GPUSceneBuffer_Count; ++i)
+            {
+                if (!copy_regions[i].empty())
+                    vkCmdCopyBuffer(cmd, staging_buffer.buffer, m_Buffers[i].buffer, static_cast<uint32_t>(copy_regions[i].size()), copy_regions[i].data());
+            }
+        }
+
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, SHADER_STAGES, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+    }
+
+    void GPUScene::Destroy()
+    {
+        VkDevice device = Application::GetVulkanCore()->GetLogicalDevice();
+
+        for (auto& buffer : m_Buffers)
+            DestroyBuffer(device, buffer);
+
+        for (auto& staging_buffer : m_StagingRing)
+            DestroyBuffer(device, staging_buffer);
+
+        for (auto& retired : m_RetiredBuffers)
+            DestroyBuffer(device, retired.buffer);
+
+        m_StagingRing.clear();
+        m_RetiredBuffers.clear();
+    }
+
+    void GPUScene::DestroyBuffer(VkDevice device, DeviceBuffer& buffer)
+    {
+        if (buffer.mapped)
+            vkUnmapMemory(device, buffer.memory);
+
+        if (buffer.buffer != VK_NULL_HANDLE)
+            vkDestroyBuffer(device, buffer.buffer, nullptr);
+
+        if (buffer.memory != VK_NULL_HANDLE)
+            vkFreeMemory(device, buffer.memory, nullptr);
+
+        buffer = {};
+    }
+
+}
@@ -0,0 +1,291 @@
+#pragma once
+
+// Core Headers
+#include "Asset/Asset.h"
+
+#include "LightEnvironment.h"
+
+#include "Project/Scene/Entity.h"
+
+// C++ Standard Library Headers
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory_resource>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// External Vendor Library Headers
+#include <glm/glm.hpp>
+#include <vulkan/vulkan.h>
+
+namespace BC
+{
+    class SceneManager;
+
+    namespace Util
+    {
+        constexpr uint32_t INVALID_GPU_SCENE_INDEX = UINT32_MAX;
+
+        /// @brief An object of the GPU scene, referenced by index from the
+        /// frame's instance data
+        struct GPUObjectData
+        {
+            glm::mat4 transform_matrix;  //  0-63
+            glm::vec4 bounds_min;        // 64-79 world space, w unused
+            glm::vec4 bounds_max;        // 80-95 world space, w unused
+        };
+
+        struct GPUMaterialData
+        {
+            uint32_t render_type;        //  0-3
+            uint32_t padding0[3];        //  4-15
+
+            // TODO: Material parameters, once materials have them
+        };
+
+        using GPUSceneBuffer = uint8_t;
+        enum : GPUSceneBuffer
+        {
+            GPUSceneBuffer_Objects,     // Util::GPUObjectData
+            GPUSceneBuffer_Lights,      // Util::LightData
+            GPUSceneBuffer_Materials,   // Util::GPUMaterialData
+            GPUSceneBuffer_Count
+        };
+
+        constexpr std::array<size_t, GPUSceneBuffer_Count> GPU_SCENE_ELEMENT_SIZES =
+        {
+            sizeof(GPUObjectData),
+            sizeof(LightData),
+            sizeof(GPUMaterialData)
+        };
+    }
+
+    struct GPUSceneStats
+    {
+        // Written by the last snapshot
+        uint64_t uploaded_bytes         = 0;
+        uint32_t uploaded_object_count  = 0;
+        uint32_t uploaded_light_count   = 0;
+        uint32_t uploaded_material_count = 0;
+
+        // Held by the GPU scene in total
+        uint32_t object_count           = 0;
+        uint32_t light_count            = 0;
+        uint32_t material_count         = 0;
+    };
+
+    /// @brief The elements of the GPU scene a snapshot changed, copied into
+    /// the scene's buffers when the snapshot is recorded
+    struct GPUSceneUpload
+    {
+        /// @brief Consecutive slots of one buffer, packed at data_offset
+        struct Region
+        {
+            Util::GPUSceneBuffer buffer = Util::GPUSceneBuffer_Objects;
+            uint32_t first_slot = 0;
+            uint32_t slot_count = 0;
+            size_t data_offset = 0;
+        };
+
+        std::pmr::vector<uint8_t> data;
+        std::pmr::vector<Region> regions;
+
+        // Slots each buffer must hold once uploaded
+        std::array<uint32_t, Util::GPUSceneBuffer_Count> slot_counts = {};
+
+        explicit GPUSceneUpload(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) :
+            data(resource), regions(resource) {}
+
+        /// @brief Appends an element to upload, merged into the last region
+        /// when it is the next slot of the same buffer
+        void Write(Util::GPUSceneBuffer buffer, uint32_t slot, const void* element);
+    };
+
+    /// @brief Object, light and material data kept on the GPU between frames,
+    /// at slots which stay the same for as long as their entity or asset is
+    /// drawn. Draws refer to these slots by index rather than copying them.
+    ///
+    /// Each snapshot finds the slots whose source changed, using the
+    /// TransformComponent and light component versions, and only those are
+    /// written to the snapshot's GPUSceneUpload. Slots are freed once a
+    /// snapshot no longer sees their entity or asset.
+    ///
+    /// Update and the Get*Index lookups belong to SceneRenderer::SnapshotScene,
+    /// RecordUpload and the buffers to SceneRenderer::RecordCommandBuffers.
+    /// The lookups may be called from jobs once Update has returned.
+    class GPUScene
+    {
+
+    public:
+
+        GPUScene() = default;
+        ~GPUScene() = default;
+
+        GPUScene(const GPUScene&) = delete;
+        GPUScene& operator=(const GPUScene&) = delete;
+
+        /// @brief Assigns a slot to every active mesh, light and material of
+        /// the scenes, writing the changed ones to upload
+        void Update(const SceneManager& scene_manager, GPUSceneUpload& upload, GPUSceneStats& out_stats);
+
+        uint32_t GetObjectIndex(const Entity& entity) const;
+        uint32_t GetLightIndex(const Entity& entity, Util::LightType light_type) const;
+        uint32_t GetMaterialIndex(AssetHandle material_handle) const;
+
+        /// @brief Copies a snapshot's upload through the frame slot's staging
+        /// buffer into the scene's buffers, growing them first if needed. The
+        /// frame slot's previous submit must have finished.
+        void RecordUpload(VkCommandBuffer cmd, uint32_t frame_index, uint32_t frame_count, const GPUSceneUpload& upload);
+
+        /// @brief Called when an upload was recorded but will never be
+        /// submitted. Every slot is written again by the next Update.
+        void DiscardUpload() { m_UploadDiscarded = true; }
+
+        VkBuffer GetBuffer(Util::GPUSceneBuffer buffer) const { return m_Buffers[buffer].buffer; }
+
+        /// @brief Destroys every buffer, the device must be idle
+        void Destroy();
+
+    private:
+
+        /// @brief What a slot's data was built from, the slot is written again
+        /// once this changes
+        struct ChangeKey
+        {
+            uint64_t version = 0;
+            uint64_t source = 0;
+
+            bool operator==(const ChangeKey& other) const { return version == other.version && source == other.source; }
+        };
+
+        template<typename Key, typename Hash = std::hash<Key>>
+        class SlotTable
+        {
+
+        public:
+
+            /// @brief Marks the key as seen by this update, assigning it a slot
+            /// if it has none. Returns true if the slot must be written.
+            bool Touch(const Key& key, const ChangeKey& change_key, uint64_t update_index, uint32_t& out_slot)
+            {
+                auto [it, inserted] = m_Slots.try_emplace(key);
+                Slot& slot = it->second;
+
+                if (inserted)
+                {
+                    if (!m_FreeSlots.empty())
+                    {
+                        slot.index = m_FreeSlots.back();
+                        m_FreeSlots.pop_back();
+                    }
+                    else
+                    {
+                        slot.index = m_SlotCount++;
+                    }
+                }
+
+                slot.last_update = update_index;
+                out_slot = slot.index;
+
+                if (!inserted && slot.written && slot.change_key == change_key)
+                    return false;
+
+                slot.change_key = change_key;
+                slot.written = true;
+                return true;
+            }
+
+            /// @brief Frees the slots not seen by this update
+            void Sweep(uint64_t update_index)
+            {
+                for (auto it = m_Slots.begin(); it != m_Slots.end();)
+                {
+                    if (it->second.last_update == update_index)
+                    {
+                        ++it;
+                        continue;
+                    }
+
+                    m_FreeSlots.push_back(it->second.index);
+                    it = m_Slots.erase(it);
+                }
+            }
+
+            /// @brief Every slot is written again on its next Touch
+            void Invalidate()
+            {
+                for (auto& [key, slot] : m_Slots)
+                    slot.written = false;
+            }
+
+            uint32_t Find(const Key& key) const
+            {
+                auto it = m_Slots.find(key);
+                return it != m_Slots.end() ? it->second.index : Util::INVALID_GPU_SCENE_INDEX;
+            }
+
+            uint32_t GetSlotCount() const { return m_SlotCount; }
+            uint32_t GetUsedSlotCount() const { return static_cast<uint32_t>(m_Slots.size()); }
+
+        private:
+
+            struct Slot
+            {
+                uint32_t index = 0;
+                bool written = false;
+                ChangeKey change_key = {};
+                uint64_t last_update = 0;
+            };
+
+            std::unordered_map<Key, Slot, Hash> m_Slots;
+            std::vector<uint32_t> m_FreeSlots;
+            uint32_t m_SlotCount = 0;
+
+        };
+
+        struct LightKeyHash
+        {
+            size_t operator()(const std::pair<Entity, Util::LightType>& key) const
+            {
+                return std::hash<Entity>()(key.first) ^ (static_cast<size_t>(key.second) * 0x9E3779B97F4A7C15ull);
+            }
+        };
+
+        struct DeviceBuffer
+        {
+            VkBuffer buffer = VK_NULL_HANDLE;
+            VkDeviceMemory memory = VK_NULL_HANDLE;
+            VkDeviceSize size = 0;
+            void* mapped = nullptr;  // Staging only
+        };
+
+        /// @brief A buffer replaced by a larger one, destroyed once the frames
+        /// which may still read it have finished
+        struct RetiredBuffer
+        {
+            DeviceBuffer buffer;
+            uint64_t retired_upload = 0;
+        };
+
+        static void DestroyBuffer(VkDevice device, DeviceBuffer& buffer);
+
+        // Snapshot side
+        SlotTable<Entity> m_Objects;
+        SlotTable<std::pair<Entity, Util::LightType>, LightKeyHash> m_Lights;
+        SlotTable<AssetHandle> m_Materials;
+        uint64_t m_UpdateCount = 0;
+
+        std::atomic<bool> m_UploadDiscarded = false;
+
+        // Record side. The staging ring holds one persistently mapped buffer
+        // per frame slot, reused once that slot's previous submit is done.
+        std::array<DeviceBuffer, Util::GPUSceneBuffer_Count> m_Buffers = {};
+        std::vector<DeviceBuffer> m_StagingRing;
+        std::vector<RetiredBuffer> m_RetiredBuffers;
+        uint64_t m_UploadCount = 0;
+
+    };
+
+}
@@ -3,86 +3,139 @@
 
 #include "Asset/AssetManagerAPI.h"
 
+#include "Project/Scene/Entity.h"
+
 namespace BC
 {
 
-    void GeometryEnvironment::AddStaticMesh(MeshRendererComponent &mesh_component)
+    namespace Util
+    {
+        static uint64_t FoldHandle16(AssetHandle handle)
+        {
+            uint64_t value = static_cast<uint64_t>(handle);
+            value ^= value >> 32;
+            value ^= value >> 16;
+            return value & 0xFFFF;
+        }
+
+        uint64_t MakeDrawSortKey(DrawPass pass, GeometryType geom_type, AssetHandle material_handle, AssetHandle mesh_handle, float normalised_depth)
+        {
+            uint64_t depth = static_cast<uint64_t>(std::clamp(normalised_depth, 0.0f, 1.0f) * static_cast<float>(0xFFFFFF)) & 0xFFFFFF;
+            uint64_t pipeline = static_cast<uint64_t>(geom_type) & 0xF;
+            uint64_t material = FoldHandle16(material_handle);
+            uint64_t mesh = FoldHandle16(mesh_handle);
+
+            uint64_t key = static_cast<uint64_t>(pass) << 62;
+
+            if (pass == DrawPass_Transparent)
+                return key | ((0xFFFFFF - depth) << 38) | (pipeline << 34) | (material << 18) | (mesh << 2);
+
+            return key | (pipeline << 58) | (material << 42) | (mesh << 26) | (depth << 2);
+        }
+    }
+
+    void GeometryEnvironment::AddStaticMesh(MeshRendererComponent &mesh_component, const GPUScene& gpu_scene, float normalised_depth)
+    {
+        AddStaticMesh(mesh_component, gpu_scene, normalised_depth, mesh_component.GetMesh());
+    }
+
+    uint32_t GeometryEnvironment::AddStaticMesh(MeshRendererComponent &mesh_component, const GPUScene& gpu_scene, float normalised_depth, AssetHandle mesh_handle, float lod_fade)
     {
         if (!mesh_component.GetActive())
-            return;
+            return 0;
 
         auto& material_handles = mesh_component.GetMaterialHandles();
-        auto static_mesh_asset = AssetManager::GetAsset<StaticMesh>(mesh_component.GetMesh());
+        auto static_mesh_asset = AssetManager::GetAsset<StaticMesh>(mesh_handle);
 
         if (!static_mesh_asset || material_handles.empty())
-            return;
+            return 0;
 
-        int material_index = 0;
-        for (int i = 0; i < static_mesh_asset->GetSubMeshes().size(); ++i)
-        {
-            if (material_index >= material_handles.size())
-                break;
+        Entity entity = mesh_component.GetEntity();
+        uint32_t object_index = gpu_scene.GetObjectIndex(entity);
+        if (object_index == Util::INVALID_GPU_SCENE_INDEX)
+            return 0;
 
-            const auto& sub_mesh = static_mesh_asset->GetSubMeshes()[i];
-            auto material_asset = AssetManager::GetAsset<Material>(material_handles[i]);
-
-            if (!material_asset)
-            {
-                // Will use last material if mis-matched materials to sub meshes
-                if (i <= material_handles.size() - 1)
-                    ++material_index;
+        uint32_t triangle_count = 0;
 
+        // Sub meshes without a matching material are not drawn
+        const auto& sub_meshes = static_mesh_asset->GetSubMeshes();
+        size_t draw_count = std::min(sub_meshes.size(), material_handles.size());
+        for (size_t i = 0; i < draw_count; ++i)
+        {
+            auto material_asset = AssetManager::GetAsset<Material>(material_handles[i]);
+            uint32_t material_index = gpu_scene.GetMaterialIndex(material_handles[i]);
+            if (!material_asset || material_index == Util::INVALID_GPU_SCENE_INDEX)
                 continue;
-            }
-
-            switch (material_asset->GetMaterialRenderType())
-            {
-                case MaterialRenderType_Opaque:
-                {
-                    OpaqueMaterialGeometryMap[material_handles[i]].push_back({});
-                    Util::GeometryData& data = OpaqueMaterialGeometryMap[material_handles[i]].back();
-
-                    data.static_mesh.static_mesh_asset_handle = mesh_component.GetMesh();
-                    data.static_mesh.sub_mesh_index = i;
-                    data.static_mesh.geom_type = Util::GeometryType_Static;
-                    data.static_mesh.casting_shadow = mesh_component.GetCastingShadows();
-
-                    break;
-                }
-                case MaterialRenderType_Mixed:
-                {
-                    MixedMaterialGeometryMap[material_handles[i]].push_back({});
-                    Util::GeometryData& data = MixedMaterialGeometryMap[material_handles[i]].back();
-
-                    data.static_mesh.static_mesh_asset_handle = mesh_component.GetMesh();
-                    data.static_mesh.sub_mesh_index = i;
-                    data.static_mesh.geom_type = Util::GeometryType_Static;
-                    data.static_mesh.casting_shadow = mesh_component.GetCastingShadows();
-
-                    break;
-                }
-                case MaterialRenderType_Transparent:
-                {
-                    TransparentMaterialGeometryMap[material_handles[i]].push_back({});
-                    Util::GeometryData& data = TransparentMaterialGeometryMap[material_handles[i]].back();
-
-                    data.static_mesh.static_mesh_asset_handle = mesh_component.GetMesh();
-                    data.static_mesh.sub_mesh_index = i;
-                    data.static_mesh.geom_type = Util::GeometryType_Static;
-                    data.static_mesh.casting_shadow = mesh_component.GetCastingShadows();
-
-                    break;
-                }
-            }
-
-            // Will use last material if mis-matched materials to sub meshes
-            if (i <= material_handles.size() - 1)
-                ++material_index;
+
+            Util::DrawPass pass = static_cast<Util::DrawPass>(material_asset->GetMaterialRenderType());
+
+            Util::DrawItem& item = DrawItems.emplace_back();
+            item.sort_key = Util::MakeDrawSortKey(pass, Util::GeometryType_Static, material_handles[i], mesh_handle, normalised_depth);
+            item.static_mesh_asset_handle = mesh_handle;
+            item.material_handle = material_handles[i];
+            item.sub_mesh_index = static_cast<uint32_t>(i);
+            item.geom_type = Util::GeometryType_Static;
+            item.casting_shadow = mesh_component.GetCastingShadows();
+            item.object_index = object_index;
+            item.material_index = material_index;
+            item.entity_guid = entity.GetGUID();
+            item.lod_fade = lod_fade;
+
+            triangle_count += sub_meshes[i].GetTriangleCount();
         }
+
+        return triangle_count;
+    }
+
+    void GeometryEnvironment::AddSkinnedMesh(SkinnedMeshRendererComponent &mesh_component, float normalised_depth)
+    {
+
+    }
+
+    void GeometryEnvironment::Clear()
+    {
+        DrawItems.clear();
+    }
+
+    void GeometryEnvironment::Append(const GeometryEnvironment& other)
+    {
+        DrawItems.insert(DrawItems.end(), other.DrawItems.begin(), other.DrawItems.end());
     }
 
-    void GeometryEnvironment::AddSkinnedMesh(SkinnedMeshRendererComponent &mesh_component)
+    void GeometryEnvironment::Sort()
     {
+        BC_PROFILE_SCOPE("GeometryEnvironment::Sort");
+
+        if (DrawItems.size() < 2)
+            return;
+
+        // The keys are sorted with indices rather than moving whole items on
+        // every pass, then the items are gathered once into sorted order
+        SortEntries.resize(DrawItems.size());
+        for (size_t i = 0; i < DrawItems.size(); ++i)
+            SortEntries[i] = { DrawItems[i].sort_key, static_cast<uint32_t>(i) };
+
+        Util::RadixSort(SortEntries, SortScratch);
+
+        SortedDrawItems.resize(DrawItems.size());
+        for (size_t i = 0; i < SortEntries.size(); ++i)
+            SortedDrawItems[i] = DrawItems[SortEntries[i].index];
+
+        DrawItems.swap(SortedDrawItems);
+    }
+
+    std::span<const Util::DrawItem> GeometryEnvironment::GetPassDrawItems(Util::DrawPass pass) const
+    {
+        auto pass_begin = std::partition_point(DrawItems.begin(), DrawItems.end(), [pass](const Util::DrawItem& item)
+        {
+            return (item.sort_key >> 62) < pass;
+        });
+
+        auto pass_end = std::partition_point(pass_begin, DrawItems.end(), [pass](const Util::DrawItem& item)
+        {
+            return (item.sort_key >> 62) == pass;
+        });
 
+        return { pass_begin, pass_end };
     }
-}
\ No newline at end of file
+}
@@ -6,10 +6,16 @@
 #include "Asset/Assets/StaticMesh.h"
 #include "Asset/Assets/Material.h"
 
+#include "GPUScene.h"
+
 #include "Project/Scene/Components/MeshComponents.h"
 
+#include "Util/RadixSort.h"
+
 // C++ Standard Library Headers
-#include <unordered_map>
+#include <memory_resource>
+#include <span>
+#include <vector>
 
 // External Vendor Library Headers
 
@@ -24,56 +30,94 @@ namespace BC
             GeometryType_Skinned
         };
 
-        struct StaticSubMeshData
+        // Same order as MaterialRenderType
+        using DrawPass = uint8_t;
+        enum : DrawPass
         {
-            AssetHandle static_mesh_asset_handle;
-            uint32_t sub_mesh_index;
-            GeometryType geom_type;
-            bool casting_shadow;
-            glm::mat4 transform_matrix;
-            GUID entity_guid;
-            
-            // TODO: Add other requirements
+            DrawPass_Opaque,
+            DrawPass_Mixed,
+            DrawPass_Transparent,
+            DrawPass_Count
         };
-        
-        struct SkinnedSubMeshData
+
+        /// @brief A single sub mesh draw. Handles default to NULL_GUID so items
+        /// can be built from jobs without generating GUIDs.
+        struct DrawItem
         {
-            AssetHandle static_mesh_asset_handle;
-            uint32_t sub_mesh_index;
-            GeometryType geom_type;
-            bool casting_shadow;
-            glm::mat4 transform_matrix;
-            GUID entity_guid;
+            uint64_t sort_key = 0;
+
+            AssetHandle static_mesh_asset_handle = NULL_GUID;
+            AssetHandle material_handle = NULL_GUID;
+            uint32_t sub_mesh_index = 0;
+            GeometryType geom_type = GeometryType_Static;
+            bool casting_shadow = false;
 
-            size_t bone_buffer_offset;  // Offset in bone buffer SSBO where this bones final transformations are stored
+            // Slots of the entity and material in the GPU scene's buffers
+            uint32_t object_index = Util::INVALID_GPU_SCENE_INDEX;
+            uint32_t material_index = Util::INVALID_GPU_SCENE_INDEX;
+
+            GUID entity_guid = NULL_GUID;
+
+            // Below 1.0f the draw is dithered out, e.g., while a LOD cross fades
+            float lod_fade = 1.0f;
+
+            size_t bone_buffer_offset = 0;  // Skinned only, offset in bone buffer SSBO where this bones final transformations are stored
 
             // TODO: Add other requirements
         };
 
-        struct GeometryData
-        {
-            union
-            {
-                StaticSubMeshData static_mesh;
-                SkinnedSubMeshData skinned_mesh;
-            };
-        };
+        /// @brief Builds a DrawItem::sort_key, most significant bits first:
+        ///
+        /// Opaque & Mixed: pass (2) | pipeline (4) | material (16) | mesh (16) | depth (24)
+        /// Transparent:    pass (2) | inverted depth (24) | pipeline (4) | material (16) | mesh (16)
+        ///
+        /// So opaque draws are grouped by state and then front to back, while
+        /// transparent draws are purely back to front. Material and mesh are
+        /// folded handles, a collision only costs an extra state change.
+        /// normalised_depth is the distance along the camera's forward axis
+        /// over its far clip.
+        uint64_t MakeDrawSortKey(DrawPass pass, GeometryType geom_type, AssetHandle material_handle, AssetHandle mesh_handle, float normalised_depth);
     }
 
     struct GeometryEnvironment
     {
-        // Key = Opaque Material Handle, Value = Vector of Geometry Data
-        std::unordered_map<AssetHandle, std::vector<Util::GeometryData>> OpaqueMaterialGeometryMap;
-        
-        // Key = Mixed Transparent Material Handle, Value = Vector of Geometry Data
-        std::unordered_map<AssetHandle, std::vector<Util::GeometryData>> MixedMaterialGeometryMap;
-        
-        // Key = Transparent Material Handle, Value = Vector of Geometry Data
-        std::unordered_map<AssetHandle, std::vector<Util::GeometryData>> TransparentMaterialGeometryMap;
-
-        void AddStaticMesh(MeshRendererComponent& mesh_component);
-
-        void AddSkinnedMesh(SkinnedMeshRendererComponent& mesh_component);
+        // Every draw of the camera, in sort key order once Sort is called
+        std::pmr::vector<Util::DrawItem> DrawItems;
+
+        // Scratch of Sort
+        std::pmr::vector<Util::RadixSortEntry> SortEntries;
+        std::pmr::vector<Util::RadixSortEntry> SortScratch;
+        std::pmr::vector<Util::DrawItem> SortedDrawItems;
+
+        /// @brief Every list allocates from resource, e.g., the FrameArena of
+        /// the snapshot this environment belongs to
+        explicit GeometryEnvironment(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) :
+            DrawItems(resource), SortEntries(resource), SortScratch(resource), SortedDrawItems(resource) {}
+
+        /// @brief Meshes without a slot in gpu_scene are not drawn, see
+        /// GPUScene::Update
+        void AddStaticMesh(MeshRendererComponent& mesh_component, const GPUScene& gpu_scene, float normalised_depth);
+
+        /// @brief Adds mesh_handle in place of the component's mesh, drawn with
+        /// its materials, e.g., a level of a LODMeshComponent. Returns the
+        /// triangles of the sub meshes added.
+        uint32_t AddStaticMesh(MeshRendererComponent& mesh_component, const GPUScene& gpu_scene, float normalised_depth, AssetHandle mesh_handle, float lod_fade = 1.0f);
+
+        void AddSkinnedMesh(SkinnedMeshRendererComponent& mesh_component, float normalised_depth);
+
+        /// @brief Empties every geometry list while keeping their capacity, so
+        /// an environment can be refilled each snapshot
+        void Clear();
+
+        /// @brief Appends every geometry list of another environment, e.g.,
+        /// one filled by a single gather job
+        void Append(const GeometryEnvironment& other);
+
+        /// @brief Orders DrawItems by sort key with a parallel radix sort
+        void Sort();
+
+        /// @brief The contiguous draws of a pass, only valid once sorted
+        std::span<const Util::DrawItem> GetPassDrawItems(Util::DrawPass pass) const;
     };
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,142 @@
+#include "BC_PCH.h"
+#include "InstanceBatcher.h"
+
+namespace BC
+{
+
+    namespace Util
+    {
+        struct InstanceBatchKey
+        {
+            uint64_t static_mesh_asset_handle;
+            uint64_t material_handle;
+            uint32_t sub_mesh_index;
+
+            bool operator==(const InstanceBatchKey& other) const = default;
+        };
+
+        struct InstanceBatchKeyHash
+        {
+            size_t operator()(const InstanceBatchKey& key) const
+            {
+                uint64_t hash = key.static_mesh_asset_handle * 0x9E3779B97F4A7C15ull;
+                hash ^= key.material_handle + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+                hash ^= key.sub_mesh_index + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+                return static_cast<size_t>(hash);
+            }
+        };
+
+        static InstanceBatch MakeBatch(const DrawItem& item, DrawPass pass)
+        {
+            InstanceBatch batch = {};
+            batch.static_mesh_asset_handle = item.static_mesh_asset_handle;
+            batch.material_handle = item.material_handle;
+            batch.sub_mesh_index = item.sub_mesh_index;
+            batch.geom_type = item.geom_type;
+            batch.pass = pass;
+            batch.bone_buffer_offset = item.bone_buffer_offset;
+            return batch;
+        }
+
+        static bool CanMerge(const InstanceBatch& batch, const DrawItem& item)
+        {
+            return
+                batch.geom_type == GeometryType_Static &&
+                item.geom_type == GeometryType_Static &&
+                batch.static_mesh_asset_handle == item.static_mesh_asset_handle &&
+                batch.material_handle == item.material_handle &&
+                batch.sub_mesh_index == item.sub_mesh_index;
+        }
+
+        size_t BuildInstanceBatches(const GeometryEnvironment& geometry, std::pmr::vector<InstanceBatch>& out_batches, std::pmr::vector<InstanceData>& instance_buffer)
+        {
+            BC_PROFILE_SCOPE("Util::BuildInstanceBatches");
+
+            const size_t first_batch = out_batches.size();
+            std::pmr::memory_resource* resource = out_batches.get_allocator().resource();
+
+            // Per draw, the batch it joins
+            std::pmr::vector<uint32_t> draw_batches(resource);
+
+            for (DrawPass pass = DrawPass_Opaque; pass < DrawPass_Count; ++pass)
+            {
+                std::span<const DrawItem> pass_items = geometry.GetPassDrawItems(pass);
+                if (pass_items.empty())
+                    continue;
+
+                const size_t pass_first_batch = out_batches.size();
+                draw_batches.resize(pass_items.size());
+
+                // 1. Assign every draw a batch and count each batch's instances
+                if (pass == DrawPass_Transparent)
+                {
+                    for (size_t i = 0; i < pass_items.size(); ++i)
+                    {
+                        const DrawItem& item = pass_items[i];
+                        if (out_batches.size() == pass_first_batch || !CanMerge(out_batches.back(), item))
+                            out_batches.push_back(MakeBatch(item, pass));
+
+                        out_batches.back().instance_count++;
+                        draw_batches[i] = static_cast<uint32_t>(out_batches.size() - 1);
+                    }
+                }
+                else
+                {
+                    std::pmr::unordered_map<InstanceBatchKey, uint32_t, InstanceBatchKeyHash> batch_lookup(resource);
+                    batch_lookup.reserve(pass_items.size());
+
+                    for (size_t i = 0; i < pass_items.size(); ++i)
+                    {
+                        const DrawItem& item = pass_items[i];
+
+                        uint32_t batch_index = 0;
+                        if (item.geom_type != GeometryType_Static)
+                        {
+                            batch_index = static_cast<uint32_t>(out_batches.size());
+                            out_batches.push_back(MakeBatch(item, pass));
+                        }
+                        else
+                        {
+                            InstanceBatchKey key = { item.static_mesh_asset_handle, item.material_handle, item.sub_mesh_index };
+                            auto [it, inserted] = batch_lookup.try_emplace(key, static_cast<uint32_t>(out_batches.size()));
+                            if (inserted)
+                                out_batches.push_back(MakeBatch(item, pass));
+
+                            batch_index = it->second;
+                        }
+
+                        out_batches[batch_index].instance_count++;
+                        draw_batches[i] = batch_index;
+                    }
+                }
+
+                // 2. Reserve each batch's range of the instance buffer
+                uint32_t instance_offset = static_cast<uint32_t>(instance_buffer.size());
+                for (size_t batch_index = pass_first_batch; batch_index < out_batches.size(); ++batch_index)
+                {
+                    out_batches[batch_index].first_instance = instance_offset;
+                    instance_offset += out_batches[batch_index].instance_count;
+                }
+
+                // 3. Write the instances, reusing instance_count as each batch's
+                // write cursor so draws keep their order within a batch
+                instance_buffer.resize(instance_offset);
+
+                for (size_t batch_index = pass_first_batch; batch_index < out_batches.size(); ++batch_index)
+                    out_batches[batch_index].instance_count = 0;
+
+                for (size_t i = 0; i < pass_items.size(); ++i)
+                {
+                    InstanceBatch& batch = out_batches[draw_batches[i]];
+                    InstanceData& instance = instance_buffer[batch.first_instance + batch.instance_count++];
+                    instance.object_index = pass_items[i].object_index;
+                    instance.material_index = pass_items[i].material_index;
+                    instance.lod_fade = pass_items[i].lod_fade;
+                }
+            }
+
+            return out_batches.size() - first_batch;
+        }
+    }
+
+}
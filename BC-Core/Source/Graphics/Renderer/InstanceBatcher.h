@@ -0,0 +1,61 @@
+#pragma once
+
+// Core Headers
+#include "GeometryEnvironment.h"
+
+// C++ Standard Library Headers
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+// External Vendor Library Headers
+#include <glm/glm.hpp>
+
+namespace BC
+{
+    namespace Util
+    {
+        /// @brief Per instance data, laid out for the frame's instance buffer.
+        /// Transforms and material parameters are read from the GPU scene.
+        struct InstanceData
+        {
+            uint32_t object_index;      //  0-3
+            uint32_t material_index;    //  4-7
+
+            // See DrawItem::lod_fade
+            float lod_fade;             //  8-11
+            float padding0;             // 12-15
+        };
+
+        /// @brief One instanced draw, of instance_count instances starting at
+        /// first_instance in the frame's instance buffer
+        struct InstanceBatch
+        {
+            AssetHandle static_mesh_asset_handle = NULL_GUID;
+            AssetHandle material_handle = NULL_GUID;
+            uint32_t sub_mesh_index = 0;
+            GeometryType geom_type = GeometryType_Static;
+            DrawPass pass = DrawPass_Opaque;
+
+            uint32_t first_instance = 0;
+            uint32_t instance_count = 0;
+
+            // Skinned only, see DrawItem::bone_buffer_offset
+            size_t bone_buffer_offset = 0;
+        };
+
+        /// @brief Groups the sorted draws of a geometry environment into
+        /// instanced draws, appending their GPU scene indices to instance_buffer.
+        ///
+        /// Opaque and mixed draws with the same mesh, sub mesh and material are
+        /// merged wherever they sit in the pass. Batches keep the order of
+        /// their first draw, and instances within a batch stay front to back.
+        /// Transparent draws are only merged with identical neighbours, so
+        /// they remain back to front. Skinned draws are never merged as each
+        /// has its own bones.
+        ///
+        /// Returns the number of batches appended to out_batches.
+        size_t BuildInstanceBatches(const GeometryEnvironment& geometry, std::pmr::vector<InstanceBatch>& out_batches, std::pmr::vector<InstanceData>& instance_buffer);
+    }
+
+}
@@ -0,0 +1,249 @@
+#include "BC_PCH.h"
+#include "LightClusters.h"
+
+#include "CameraContext.h"
+
+namespace BC
+{
+
+    LightClusterGrid::LightClusterGrid(std::pmr::memory_resource* resource) :
+        clusters(resource), light_indices(resource), m_ViewLights(resource), m_ClusterBounds(resource), m_SliceIndices(resource)
+    {
+    }
+
+    void LightClusterGrid::Begin(const CameraContext& context, const LightEnvironment& light_environment)
+    {
+        BC_PROFILE_SCOPE("LightClusterGrid::Begin");
+
+        m_NearClip = std::max(context.near_clip, 0.001f);
+        m_FarClip = std::max(context.far_clip, m_NearClip + 0.001f);
+
+        float log_depth_ratio = std::log(m_FarClip / m_NearClip);
+        slice_scale = static_cast<float>(SLICE_COUNT) / log_depth_ratio;
+        slice_bias = static_cast<float>(SLICE_COUNT) * std::log(m_NearClip) / log_depth_ratio;
+
+        clusters.assign(CLUSTER_COUNT, { 0, 0 });
+        light_indices.clear();
+
+        m_SliceIndices.resize(SLICE_COUNT);
+        for (auto& slice_indices : m_SliceIndices)
+            slice_indices.clear();
+
+        // 1. Cluster bounds. Each tile corner is a view space ray, found by
+        // unprojecting two depths, which works for both projection types.
+        glm::mat4 inverse_projection = glm::inverse(context.projection_matrix);
+        auto unproject = [&inverse_projection](float ndc_x, float ndc_y, float ndc_z)
+        {
+            glm::vec4 view = inverse_projection * glm::vec4(ndc_x, ndc_y, ndc_z, 1.0f);
+            return glm::vec3(view) / view.w;
+        };
+
+        constexpr uint32_t CORNER_COUNT_X = TILE_COUNT_X + 1;
+        constexpr uint32_t CORNER_COUNT_Y = TILE_COUNT_Y + 1;
+
+        std::array<glm::vec3, CORNER_COUNT_X * CORNER_COUNT_Y> ray_origins;
+        std::array<glm::vec3, CORNER_COUNT_X * CORNER_COUNT_Y> ray_directions;
+        for (uint32_t y = 0; y < CORNER_COUNT_Y; ++y)
+        {
+            for (uint32_t x = 0; x < CORNER_COUNT_X; ++x)
+            {
+                float ndc_x = -1.0f + 2.0f * static_cast<float>(x) / TILE_COUNT_X;
+                float ndc_y = -1.0f + 2.0f * static_cast<float>(y) / TILE_COUNT_Y;
+
+                glm::vec3 ray_start = unproject(ndc_x, ndc_y, 0.0f);
+                glm::vec3 ray_end = unproject(ndc_x, ndc_y, 1.0f);
+
+                ray_origins[x + y * CORNER_COUNT_X] = ray_start;
+                ray_directions[x + y * CORNER_COUNT_X] = ray_end - ray_start;
+            }
+        }
+
+        auto corner_at_depth = [&](uint32_t x, uint32_t y, float depth)
+        {
+            const glm::vec3& origin = ray_origins[x + y * CORNER_COUNT_X];
+            const glm::vec3& direction = ray_directions[x + y * CORNER_COUNT_X];
+            return origin + direction * ((-depth - origin.z) / direction.z);
+        };
+
+        m_ClusterBounds.resize(CLUSTER_COUNT);
+        for (uint32_t slice = 0; slice < SLICE_COUNT; ++slice)
+        {
+            float slice_near = m_NearClip * std::pow(m_FarClip / m_NearClip, static_cast<float>(slice) / SLICE_COUNT);
+            float slice_far = m_NearClip * std::pow(m_FarClip / m_NearClip, static_cast<float>(slice + 1) / SLICE_COUNT);
+
+            for (uint32_t y = 0; y < TILE_COUNT_Y; ++y)
+            {
+                for (uint32_t x = 0; x < TILE_COUNT_X; ++x)
+                {
+                    Bounds_AABB bounds = {};
+                    for (uint32_t corner = 0; corner < 8; ++corner)
+                    {
+                        glm::vec3 point = corner_at_depth(x + (corner & 1), y + ((corner >> 1) & 1), (corner & 4) ? slice_far : slice_near);
+                        bounds.BoundsMin = glm::min(bounds.BoundsMin, point);
+                        bounds.BoundsMax = glm::max(bounds.BoundsMax, point);
+                    }
+
+                    m_ClusterBounds[x + y * TILE_COUNT_X + slice * CLUSTERS_PER_SLICE] = bounds;
+                }
+            }
+        }
+
+        // 2. View space bounds of the lights, with the slices and tiles they
+        // can touch
+        auto slice_from_depth = [this](float depth)
+        {
+            float slice = std::floor(std::log(depth) * slice_scale - slice_bias);
+            return static_cast<uint32_t>(std::clamp(slice, 0.0f, static_cast<float>(SLICE_COUNT - 1)));
+        };
+
+        auto tile_from_ndc = [](float ndc, uint32_t tile_count)
+        {
+            float tile = std::floor((ndc * 0.5f + 0.5f) * tile_count);
+            return static_cast<uint32_t>(std::clamp(tile, 0.0f, static_cast<float>(tile_count - 1)));
+        };
+
+        m_ViewLights.clear();
+        for (size_t i = 0; i < light_environment.lights.size(); ++i)
+        {
+            const Util::LightData& light = light_environment.lights[i];
+
+            Bounds_Sphere world_bounds;
+            switch (light.sphere.light_type)
+            {
+                case Util::LightType_Sphere:
+                {
+                    world_bounds = Bounds_Sphere(glm::vec3(light.sphere.position), light.sphere.radius);
+                    break;
+                }
+                case Util::LightType_Cone:
+                {
+                    world_bounds = Bounds_Sphere::FromCone(glm::vec3(light.cone.position), glm::vec3(light.cone.direction), light.cone.range, light.cone.angle);
+                    break;
+                }
+                default:
+                    continue;
+            }
+
+            glm::vec3 centre = glm::vec3(context.view_matrix * glm::vec4(world_bounds.BoundsCentre, 1.0f));
+            float radius = world_bounds.BoundsRadius;
+
+            float depth = -centre.z;
+            if (depth + radius < m_NearClip || depth - radius > m_FarClip)
+                continue;
+
+            ViewLight view_light = {};
+            view_light.view_bounds = Bounds_Sphere(centre, radius);
+            view_light.light_index = static_cast<uint32_t>(i);
+            view_light.min_slice = slice_from_depth(std::max(depth - radius, m_NearClip));
+            view_light.max_slice = slice_from_depth(std::min(depth + radius, m_FarClip));
+
+            // Tiles covered by the projected box around the sphere, every tile
+            // if the box reaches behind the camera
+            view_light.min_tile_x = 0;
+            view_light.max_tile_x = TILE_COUNT_X - 1;
+            view_light.min_tile_y = 0;
+            view_light.max_tile_y = TILE_COUNT_Y - 1;
+
+            glm::vec2 ndc_min = glm::vec2(FLT_MAX);
+            glm::vec2 ndc_max = glm::vec2(-FLT_MAX);
+            bool behind_camera = false;
+            for (uint32_t corner = 0; corner < 8 && !behind_camera; ++corner)
+            {
+                glm::vec3 offset = { (corner & 1) ? radius : -radius, (corner & 2) ? radius : -radius, (corner & 4) ? radius : -radius };
+                glm::vec4 clip = context.projection_matrix * glm::vec4(centre + offset, 1.0f);
+
+                behind_camera = clip.w <= 1e-4f;
+                ndc_min = glm::min(ndc_min, glm::vec2(clip) / clip.w);
+                ndc_max = glm::max(ndc_max, glm::vec2(clip) / clip.w);
+            }
+
+            if (!behind_camera)
+            {
+                if (ndc_max.x < -1.0f || ndc_min.x > 1.0f || ndc_max.y < -1.0f || ndc_min.y > 1.0f)
+                    continue;
+
+                view_light.min_tile_x = tile_from_ndc(ndc_min.x, TILE_COUNT_X);
+                view_light.max_tile_x = tile_from_ndc(ndc_max.x, TILE_COUNT_X);
+                view_light.min_tile_y = tile_from_ndc(ndc_min.y, TILE_COUNT_Y);
+                view_light.max_tile_y = tile_from_ndc(ndc_max.y, TILE_COUNT_Y);
+            }
+
+            m_ViewLights.push_back(view_light);
+        }
+    }
+
+    void LightClusterGrid::AssignSlice(uint32_t slice)
+    {
+        auto& slice_indices = m_SliceIndices[slice];
+        Util::LightCluster* slice_clusters = clusters.data() + slice * CLUSTERS_PER_SLICE;
+        const Bounds_AABB* slice_bounds = m_ClusterBounds.data() + slice * CLUSTERS_PER_SLICE;
+
+        // Cluster and light of every overlap, counted before being grouped
+        std::pmr::vector<std::pair<uint32_t, uint32_t>> overlaps(slice_indices.get_allocator());
+
+        for (const ViewLight& view_light : m_ViewLights)
+        {
+            if (slice < view_light.min_slice || slice > view_light.max_slice)
+                continue;
+
+            const glm::vec3& centre = view_light.view_bounds.BoundsCentre;
+            float radius_squared = view_light.view_bounds.BoundsRadius * view_light.view_bounds.BoundsRadius;
+
+            for (uint32_t y = view_light.min_tile_y; y <= view_light.max_tile_y; ++y)
+            {
+                for (uint32_t x = view_light.min_tile_x; x <= view_light.max_tile_x; ++x)
+                {
+                    uint32_t cluster_index = x + y * TILE_COUNT_X;
+
+                    const Bounds_AABB& bounds = slice_bounds[cluster_index];
+                    glm::vec3 offset = glm::clamp(centre, bounds.BoundsMin, bounds.BoundsMax) - centre;
+                    if (glm::dot(offset, offset) > radius_squared)
+                        continue;
+
+                    slice_clusters[cluster_index].count++;
+                    overlaps.emplace_back(cluster_index, view_light.light_index);
+                }
+            }
+        }
+
+        uint32_t offset = 0;
+        for (uint32_t i = 0; i < CLUSTERS_PER_SLICE; ++i)
+        {
+            slice_clusters[i].offset = offset;
+            offset += slice_clusters[i].count;
+        }
+
+        // Lights keep their order within a cluster
+        slice_indices.resize(overlaps.size());
+        std::array<uint32_t, CLUSTERS_PER_SLICE> cursors;
+        for (uint32_t i = 0; i < CLUSTERS_PER_SLICE; ++i)
+            cursors[i] = slice_clusters[i].offset;
+
+        for (const auto& [cluster_index, light_index] : overlaps)
+            slice_indices[cursors[cluster_index]++] = light_index;
+    }
+
+    void LightClusterGrid::Finalise()
+    {
+        BC_PROFILE_SCOPE("LightClusterGrid::Finalise");
+
+        size_t index_count = 0;
+        for (const auto& slice_indices : m_SliceIndices)
+            index_count += slice_indices.size();
+
+        light_indices.resize(index_count);
+
+        uint32_t slice_offset = 0;
+        for (uint32_t slice = 0; slice < SLICE_COUNT; ++slice)
+        {
+            const auto& slice_indices = m_SliceIndices[slice];
+            std::copy(slice_indices.begin(), slice_indices.end(), light_indices.begin() + slice_offset);
+
+            for (uint32_t i = 0; i < CLUSTERS_PER_SLICE; ++i)
+                clusters[slice * CLUSTERS_PER_SLICE + i].offset += slice_offset;
+
+            slice_offset += static_cast<uint32_t>(slice_indices.size());
+        }
+    }
+
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+// Core Headers
+#include "LightEnvironment.h"
+
+#include "Project/Scene/Bounds/Bounds.h"
+
+// C++ Standard Library Headers
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+// External Vendor Library Headers
+#include <glm/glm.hpp>
+
+namespace BC
+{
+    struct CameraContext;
+
+    namespace Util
+    {
+        /// @brief Where a cluster's lights sit in LightClusterGrid::light_indices
+        struct LightCluster
+        {
+            uint32_t offset;
+            uint32_t count;
+        };
+    }
+
+    /// @brief Sphere and cone lights binned into a camera's froxels, i.e.,
+    /// screen tiles split into exponentially deeper slices between the near
+    /// and far clip, so a fragment only loops over the lights of its cluster.
+    ///
+    /// Tile (0, 0) sits at NDC (-1, -1), matching framebuffer coordinates. A
+    /// fragment at view depth d is in slice floor(log(d) * slice_scale - slice_bias).
+    /// Directional lights light every cluster and are not binned.
+    ///
+    /// Built in three steps so the slices can be binned in parallel: Begin,
+    /// AssignSlice for every slice (from any thread), then Finalise.
+    struct LightClusterGrid
+    {
+        static constexpr uint32_t TILE_COUNT_X = 16;
+        static constexpr uint32_t TILE_COUNT_Y = 9;
+        static constexpr uint32_t SLICE_COUNT = 24;
+        static constexpr uint32_t CLUSTERS_PER_SLICE = TILE_COUNT_X * TILE_COUNT_Y;
+        static constexpr uint32_t CLUSTER_COUNT = CLUSTERS_PER_SLICE * SLICE_COUNT;
+
+        float slice_scale = 0.0f;
+        float slice_bias = 0.0f;
+
+        // Ready for upload, cluster index = x + y * TILE_COUNT_X + slice * CLUSTERS_PER_SLICE
+        std::pmr::vector<Util::LightCluster> clusters;
+
+        // Indices into LightEnvironment::lights
+        std::pmr::vector<uint32_t> light_indices;
+
+        explicit LightClusterGrid(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+        /// @brief Computes the cluster bounds of the camera and the view space
+        /// bounds of every sphere and cone light
+        void Begin(const CameraContext& context, const LightEnvironment& light_environment);
+
+        /// @brief Bins the lights of a single slice, slices may be assigned
+        /// concurrently
+        void AssignSlice(uint32_t slice);
+
+        /// @brief Packs the slices into one compact light index list
+        void Finalise();
+
+    private:
+
+        struct ViewLight
+        {
+            Bounds_Sphere view_bounds;
+            uint32_t light_index;
+
+            uint32_t min_slice, max_slice;
+            uint32_t min_tile_x, max_tile_x;
+            uint32_t min_tile_y, max_tile_y;
+        };
+
+        std::pmr::vector<ViewLight> m_ViewLights;
+
+        // View space bounds of every cluster, indexed as clusters
+        std::pmr::vector<Bounds_AABB> m_ClusterBounds;
+
+        // Each slice's light indices, grouped by cluster with slice relative
+        // offsets until Finalise
+        std::pmr::vector<std::pmr::vector<uint32_t>> m_SliceIndices;
+
+        float m_NearClip = 0.1f;
+        float m_FarClip = 1000.0f;
+
+    };
+
+}
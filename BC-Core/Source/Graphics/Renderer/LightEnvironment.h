@@ -5,6 +5,7 @@
 #include "Project/Scene/Components/LightComponents.h"
 
 // C++ Standard Library Headers
+#include <memory_resource>
 #include <vector>
 
 // External Vendor Library Headers
@@ -14,9 +15,9 @@ namespace BC
 {
     namespace Util
     {
-        constexpr uint8_t MAX_SPHERE_LIGHT = 1024;
-        constexpr uint8_t MAX_CONE_LIGHT = 1024;
-        constexpr uint8_t MAX_DIRECTIONAL_LIGHT = 20;
+        constexpr uint32_t MAX_SPHERE_LIGHT = 1024;
+        constexpr uint32_t MAX_CONE_LIGHT = 1024;
+        constexpr uint32_t MAX_DIRECTIONAL_LIGHT = 20;
 
         using LightType = uint32_t;
         enum : LightType
@@ -68,6 +69,44 @@ namespace BC
             };
         };
 
+        inline LightData MakeSphereLightData(const SphereLightComponent& pl_component)
+        {
+            LightData data = {};
+            data.sphere.light_type = LightType_Sphere;
+            data.sphere.radius = pl_component.GetRadius();
+            data.sphere.shadow_type = pl_component.GetShadowType();
+            data.sphere.colour = pl_component.GetColour();
+            data.sphere.colour.w = pl_component.GetIntensity();
+            data.sphere.position = glm::vec4(pl_component.GetEntity().GetTransform().GetGlobalPosition(), 1.0f);
+            return data;
+        }
+
+        inline LightData MakeConeLightData(const ConeLightComponent& cl_component)
+        {
+            LightData data = {};
+            data.cone.light_type = LightType_Cone;
+            data.cone.angle = cl_component.GetAngle();
+            data.cone.range = cl_component.GetRange();
+            data.cone.shadow_type = cl_component.GetShadowType();
+            data.cone.colour = cl_component.GetColour();
+            data.cone.colour.w = cl_component.GetIntensity();
+            data.cone.position = glm::vec4(cl_component.GetEntity().GetTransform().GetGlobalPosition(), 1.0f);
+            data.cone.direction = glm::vec4(cl_component.GetEntity().GetTransform().GetGlobalForwardDirection(), 1.0f);
+            return data;
+        }
+
+        inline LightData MakeDirectionalLightData(const DirectionalLightComponent& dl_component)
+        {
+            LightData data = {};
+            data.directional.light_type = LightType_Directional;
+            data.directional.shadow_type = dl_component.GetShadowType();
+            data.directional.colour = dl_component.GetColour();
+            data.directional.colour.w = dl_component.GetIntensity();
+            data.directional.position = glm::vec4(dl_component.GetEntity().GetTransform().GetGlobalPosition(), 1.0f);
+            data.directional.direction = glm::vec4(dl_component.GetEntity().GetTransform().GetGlobalForwardDirection(), 1.0f);
+            return data;
+        }
+
     }
 
     struct LightEnvironment
@@ -80,22 +119,25 @@ namespace BC
             uint32_t total_light_count; // optional
         } LightCounts;
 
-        std::vector<Util::LightData> lights;
+        std::pmr::vector<Util::LightData> lights;
+
+        // Entity of each light, in the same order as lights. Not uploaded.
+        std::pmr::vector<Entity> light_entities;
+
+        // Index of each light in the GPU scene's light buffer, in the same
+        // order as lights once sorted
+        std::pmr::vector<uint32_t> light_indices;
+
+        explicit LightEnvironment(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) :
+            LightCounts(), lights(resource), light_entities(resource), light_indices(resource) {}
 
         void AddSphereLight(const SphereLightComponent& pl_component)
         {
             if (!pl_component.GetActive())
                 return;
 
-            lights.push_back({});
-            Util::LightData& data = lights.back();
-
-            data.sphere.light_type = Util::LightType_Sphere;
-            data.sphere.radius = pl_component.GetRadius();
-            data.sphere.shadow_type = pl_component.GetShadowType();
-            data.sphere.colour = pl_component.GetColour();
-            data.sphere.colour.w = pl_component.GetIntensity();
-            data.sphere.position = glm::vec4(pl_component.GetEntity().GetTransform().GetGlobalPosition(), 1.0f);
+            lights.push_back(Util::MakeSphereLightData(pl_component));
+            light_entities.push_back(pl_component.GetEntity());
         }
 
         void AddConeLight(const ConeLightComponent& cl_component)
@@ -103,17 +145,8 @@ namespace BC
             if (!cl_component.GetActive())
                 return;
 
-            lights.push_back({});
-            Util::LightData& data = lights.back();
-
-            data.cone.light_type = Util::LightType_Cone;
-            data.cone.angle = cl_component.GetAngle();
-            data.cone.range = cl_component.GetRange();
-            data.cone.shadow_type = cl_component.GetShadowType();
-            data.cone.colour = cl_component.GetColour();
-            data.cone.colour.w = cl_component.GetIntensity();
-            data.cone.position = glm::vec4(cl_component.GetEntity().GetTransform().GetGlobalPosition(), 1.0f);
-            data.cone.direction = glm::vec4(cl_component.GetEntity().GetTransform().GetGlobalForwardDirection(), 1.0f);
+            lights.push_back(Util::MakeConeLightData(cl_component));
+            light_entities.push_back(cl_component.GetEntity());
         }
 
         void AddDirectionalLight(const DirectionalLightComponent& dl_component)
@@ -121,57 +154,40 @@ namespace BC
             if (!dl_component.GetActive())
                 return;
 
-            lights.push_back({});
-            Util::LightData& data = lights.back();
-            
-            data.directional.light_type = Util::LightType_Directional;
-            data.directional.shadow_type = dl_component.GetShadowType();
-            data.directional.colour = dl_component.GetColour();
-            data.directional.colour.w = dl_component.GetIntensity();
-            data.directional.position = glm::vec4(dl_component.GetEntity().GetTransform().GetGlobalPosition(), 1.0f);
-            data.directional.direction = glm::vec4(dl_component.GetEntity().GetTransform().GetGlobalForwardDirection(), 1.0f);
+            lights.push_back(Util::MakeDirectionalLightData(dl_component));
+            light_entities.push_back(dl_component.GetEntity());
         }
 
         void SortLights()
         {
-            std::vector<Util::LightData> sorted;
+            std::pmr::vector<Util::LightData> sorted(lights.get_allocator());
+            std::pmr::vector<Entity> sorted_entities(light_entities.get_allocator());
             sorted.reserve(lights.size());
+            sorted_entities.reserve(light_entities.size());
 
             LightCounts = {};
 
-            // Sphere Lights
-            for (auto& light : lights)
+            auto move_lights_of_type = [&](Util::LightType light_type, uint32_t& light_count)
             {
-                if (light.sphere.light_type == Util::LightType_Sphere)
+                for (size_t i = 0; i < lights.size(); ++i)
                 {
-                    sorted.emplace_back(std::move(light));
-                    LightCounts.num_sphere_lights++;
-                }
-            }
+                    if (lights[i].sphere.light_type != light_type)
+                        continue;
 
-            // Cone Lights
-            for (auto& light : lights)
-            {
-                if (light.sphere.light_type == Util::LightType_Cone)
-                {
-                    sorted.emplace_back(std::move(light));
-                    LightCounts.num_cone_lights++;
+                    sorted.emplace_back(std::move(lights[i]));
+                    sorted_entities.emplace_back(light_entities[i]);
+                    light_count++;
                 }
-            }
+            };
 
-            // Directional Lights
-            for (auto& light : lights)
-            {
-                if (light.sphere.light_type == Util::LightType_Directional)
-                {
-                    sorted.emplace_back(std::move(light));
-                    LightCounts.num_directional_lights++;
-                }
-            }
+            move_lights_of_type(Util::LightType_Sphere, LightCounts.num_sphere_lights);
+            move_lights_of_type(Util::LightType_Cone, LightCounts.num_cone_lights);
+            move_lights_of_type(Util::LightType_Directional, LightCounts.num_directional_lights);
 
             LightCounts.total_light_count = static_cast<uint32_t>(sorted.size());
 
             lights = std::move(sorted);
+            light_entities = std::move(sorted_entities);
         }
 
     };
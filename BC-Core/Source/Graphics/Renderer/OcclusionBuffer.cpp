@@ -0,0 +1,374 @@
+#include "BC_PCH.h"
+#include "OcclusionBuffer.h"
+
+// SSE2 is part of every x86-64 target, so no runtime dispatch is needed
+#if defined(__x86_64__) || defined(_M_X64)
+    #define BC_OCCLUSION_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace BC
+{
+
+    namespace Util
+    {
+        /// @brief Corners nearer the camera plane than this cannot be
+        /// projected reliably
+        constexpr float MIN_OCCLUSION_CLIP_W = 1e-4f;
+
+        /// @brief Faces seen edge on, twice their area in pixels, are skipped
+        constexpr float MIN_OCCLUDER_FACE_AREA = 1e-2f;
+
+        /// @brief Below this many faces a single thread rasterises every tile
+        /// faster than the tiles can be handed out as jobs
+        constexpr size_t MIN_FACES_PER_PARALLEL_RASTER = 32;
+
+        /// @brief The 4 corners of each face of a box, as indices where bit
+        /// 0, 1 and 2 select the max x, y and z of the box respectively
+        constexpr uint8_t OCCLUDER_BOX_FACES[6][4] =
+        {
+            { 0, 2, 6, 4 }, { 1, 5, 7, 3 },
+            { 0, 4, 5, 1 }, { 2, 3, 7, 6 },
+            { 0, 1, 3, 2 }, { 4, 6, 7, 5 }
+        };
+
+        static glm::vec3 GetBoxCorner(const Bounds_AABB& bounds, uint32_t corner_index)
+        {
+            return
+            {
+                (corner_index & 1) ? bounds.BoundsMax.x : bounds.BoundsMin.x,
+                (corner_index & 2) ? bounds.BoundsMax.y : bounds.BoundsMin.y,
+                (corner_index & 4) ? bounds.BoundsMax.z : bounds.BoundsMin.z
+            };
+        }
+
+        /// @brief Solves depth = a * x + b * y + c through 3 projected points,
+        /// returning twice the area of the triangle they form
+        static float SolveDepthPlane(const glm::vec3& p0, const glm::vec3& p1, const glm::vec3& p2, glm::vec3& out_plane)
+        {
+            glm::vec3 edge_1 = p1 - p0;
+            glm::vec3 edge_2 = p2 - p0;
+
+            float determinant = edge_1.x * edge_2.y - edge_2.x * edge_1.y;
+            if (determinant == 0.0f)
+                return 0.0f;
+
+            out_plane.x = (edge_1.z * edge_2.y - edge_2.z * edge_1.y) / determinant;
+            out_plane.y = (edge_1.x * edge_2.z - edge_2.x * edge_1.z) / determinant;
+            out_plane.z = p0.z - out_plane.x * p0.x - out_plane.y * p0.y;
+            return determinant;
+        }
+    }
+
+    void OcclusionBuffer::Begin(const glm::mat4& view_projection, uint32_t width, uint32_t height)
+    {
+        m_ViewProjection = view_projection;
+
+        m_Width = (std::max(width, 4u) + 3u) & ~3u;
+        m_Height = std::max(height, 1u);
+
+        m_Depth.assign(static_cast<size_t>(m_Width) * m_Height, FLT_MAX);
+
+        m_Faces.clear();
+        m_OccluderCount = 0;
+    }
+
+    bool OcclusionBuffer::AddOccluder(const Bounds_AABB& local_bounds, const glm::mat4& transform)
+    {
+        glm::mat4 clip_transform = m_ViewProjection * transform;
+
+        std::array<glm::vec3, 8> vertices;
+        for (uint32_t i = 0; i < 8; ++i)
+        {
+            glm::vec4 clip = clip_transform * glm::vec4(Util::GetBoxCorner(local_bounds, i), 1.0f);
+
+            // Clipping an occluder against the near plane is not worth it, one
+            // that reaches behind the camera is left out instead
+            if (clip.w <= Util::MIN_OCCLUSION_CLIP_W)
+                return false;
+
+            glm::vec3 ndc = glm::vec3(clip) / clip.w;
+            vertices[i] = { (ndc.x * 0.5f + 0.5f) * m_Width, (0.5f - ndc.y * 0.5f) * m_Height, ndc.z };
+        }
+
+        for (const auto& face_corners : Util::OCCLUDER_BOX_FACES)
+        {
+            glm::vec3 face_vertices[4] =
+            {
+                vertices[face_corners[0]], vertices[face_corners[1]],
+                vertices[face_corners[2]], vertices[face_corners[3]]
+            };
+            AddFace(face_vertices);
+        }
+
+        m_OccluderCount++;
+        return true;
+    }
+
+    void OcclusionBuffer::AddFace(const glm::vec3* vertices)
+    {
+        float twice_area = 0.0f;
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            const glm::vec3& from = vertices[i];
+            const glm::vec3& to = vertices[(i + 1) % 4];
+            twice_area += from.x * to.y - to.x * from.y;
+        }
+
+        if (std::abs(twice_area) < Util::MIN_OCCLUDER_FACE_AREA)
+            return;
+
+        // Flip the edges of clockwise faces so the inside is always positive
+        float winding = twice_area > 0.0f ? 1.0f : -1.0f;
+
+        OccluderFace face = {};
+        face.max_depth = -FLT_MAX;
+
+        glm::vec2 screen_min = glm::vec2(FLT_MAX);
+        glm::vec2 screen_max = glm::vec2(-FLT_MAX);
+
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            const glm::vec3& from = vertices[i];
+            const glm::vec3& to = vertices[(i + 1) % 4];
+
+            float a = (from.y - to.y) * winding;
+            float b = (to.x - from.x) * winding;
+            face.edges[i] = { a, b, -(a * from.x + b * from.y) };
+
+            screen_min = glm::min(screen_min, glm::vec2(from));
+            screen_max = glm::max(screen_max, glm::vec2(from));
+            face.max_depth = std::max(face.max_depth, from.z);
+        }
+
+        // Pixels whose centre lies within the face's screen bounds
+        float first_x = std::max(std::ceil(screen_min.x - 0.5f), 0.0f);
+        float first_y = std::max(std::ceil(screen_min.y - 0.5f), 0.0f);
+        float last_x = std::min(std::floor(screen_max.x - 0.5f), static_cast<float>(m_Width - 1));
+        float last_y = std::min(std::floor(screen_max.y - 0.5f), static_cast<float>(m_Height - 1));
+
+        if (first_x > last_x || first_y > last_y)
+            return;
+
+        face.min_x = static_cast<uint32_t>(first_x);
+        face.min_y = static_cast<uint32_t>(first_y);
+        face.max_x = static_cast<uint32_t>(last_x);
+        face.max_y = static_cast<uint32_t>(last_y);
+
+        // The face is planar, solve its depth from whichever half is larger
+        // as the other may be close to degenerate
+        glm::vec3 plane_a = {};
+        glm::vec3 plane_b = {};
+        float area_a = std::abs(Util::SolveDepthPlane(vertices[0], vertices[1], vertices[2], plane_a));
+        float area_b = std::abs(Util::SolveDepthPlane(vertices[0], vertices[2], vertices[3], plane_b));
+        face.depth_plane = area_a >= area_b ? plane_a : plane_b;
+
+        // Depth is linear across the pixel, so its farthest point is half a
+        // pixel from the centre along both axes
+        face.depth_plane.z += 0.5f * (std::abs(face.depth_plane.x) + std::abs(face.depth_plane.y));
+
+        m_Faces.push_back(face);
+    }
+
+    void OcclusionBuffer::Rasterise()
+    {
+        BC_PROFILE_SCOPE("OcclusionBuffer::Rasterise");
+
+        if (m_Faces.empty())
+            return;
+
+        uint32_t tile_count = (m_Height + TILE_ROWS - 1) / TILE_ROWS;
+        auto rasterise_tile = [this](uint32_t tile_index)
+        {
+            RasteriseRows(tile_index * TILE_ROWS, std::min(m_Height, (tile_index + 1) * TILE_ROWS));
+        };
+
+        JobSystem* job_system = Application::GetJobSystem();
+        if (!job_system || tile_count == 1 || m_Faces.size() < Util::MIN_FACES_PER_PARALLEL_RASTER)
+        {
+            for (uint32_t tile_index = 0; tile_index < tile_count; ++tile_index)
+                rasterise_tile(tile_index);
+            return;
+        }
+
+        // Each tile owns its rows of the buffer, so tiles never write to the
+        // same pixel and need no synchronisation
+        std::vector<std::pair<std::string, JobFunction>> tile_jobs;
+        tile_jobs.reserve(tile_count - 1);
+        for (uint32_t tile_index = 1; tile_index < tile_count; ++tile_index)
+            tile_jobs.emplace_back("Occlusion Culling: Rasterise Tile", [&rasterise_tile, tile_index]() { rasterise_tile(tile_index); });
+
+        JobCounter tile_counter = {};
+        job_system->SubmitJobs(tile_jobs, &tile_counter, JobPriority::High);
+
+        rasterise_tile(0);
+
+        tile_counter.Wait();
+    }
+
+    void OcclusionBuffer::RasteriseRows(uint32_t row_begin, uint32_t row_end)
+    {
+        for (const OccluderFace& face : m_Faces)
+        {
+            uint32_t first_row = std::max(row_begin, face.min_y);
+            uint32_t last_row = std::min(row_end - 1, face.max_y);
+            if (first_row > last_row || row_begin >= row_end)
+                continue;
+
+            // Rows are a multiple of 4 wide, so a group of 4 starting at or
+            // before min_x never runs past the end of the row. Pixels of the
+            // group outside the face fail its edge functions.
+            uint32_t first_column = face.min_x & ~3u;
+
+            for (uint32_t y = first_row; y <= last_row; ++y)
+            {
+                float centre_y = static_cast<float>(y) + 0.5f;
+                float* row = m_Depth.data() + static_cast<size_t>(y) * m_Width;
+
+#ifdef BC_OCCLUSION_SSE2
+                const __m128 zero = _mm_setzero_ps();
+                const __m128 lane_offsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+
+                __m128 edge_a[4];
+                __m128 edge_row[4];
+                for (uint32_t i = 0; i < 4; ++i)
+                {
+                    edge_a[i] = _mm_set1_ps(face.edges[i].x);
+                    edge_row[i] = _mm_set1_ps(face.edges[i].y * centre_y + face.edges[i].z);
+                }
+
+                const __m128 depth_a = _mm_set1_ps(face.depth_plane.x);
+                const __m128 depth_row = _mm_set1_ps(face.depth_plane.y * centre_y + face.depth_plane.z);
+                const __m128 max_depth = _mm_set1_ps(face.max_depth);
+
+                for (uint32_t x = first_column; x <= face.max_x; x += 4)
+                {
+                    __m128 centre_x = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), lane_offsets);
+
+                    __m128 inside = _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edge_a[0], centre_x), edge_row[0]), zero);
+                    inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edge_a[1], centre_x), edge_row[1]), zero));
+                    inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edge_a[2], centre_x), edge_row[2]), zero));
+                    inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edge_a[3], centre_x), edge_row[3]), zero));
+
+                    if (_mm_movemask_ps(inside) == 0)
+                        continue;
+
+                    __m128 depth = _mm_min_ps(_mm_add_ps(_mm_mul_ps(depth_a, centre_x), depth_row), max_depth);
+                    __m128 current = _mm_loadu_ps(row + x);
+                    __m128 nearest = _mm_min_ps(current, depth);
+
+                    _mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearest), _mm_andnot_ps(inside, current)));
+                }
+#else
+                for (uint32_t x = face.min_x; x <= face.max_x; ++x)
+                {
+                    float centre_x = static_cast<float>(x) + 0.5f;
+
+                    bool inside = true;
+                    for (uint32_t i = 0; i < 4 && inside; ++i)
+                        inside = face.edges[i].x * centre_x + face.edges[i].y * centre_y + face.edges[i].z >= 0.0f;
+
+                    if (!inside)
+                        continue;
+
+                    float depth = std::min(face.depth_plane.x * centre_x + face.depth_plane.y * centre_y + face.depth_plane.z, face.max_depth);
+                    row[x] = std::min(row[x], depth);
+                }
+#endif
+            }
+        }
+    }
+
+    bool OcclusionBuffer::IsOccluded(const Bounds_AABB& bounds) const
+    {
+        if (m_Faces.empty())
+            return false;
+
+        glm::vec2 screen_min = glm::vec2(FLT_MAX);
+        glm::vec2 screen_max = glm::vec2(-FLT_MAX);
+        float nearest_depth = FLT_MAX;
+
+        for (uint32_t i = 0; i < 8; ++i)
+        {
+            glm::vec4 clip = m_ViewProjection * glm::vec4(Util::GetBoxCorner(bounds, i), 1.0f);
+            if (clip.w <= Util::MIN_OCCLUSION_CLIP_W)
+                return false;
+
+            glm::vec3 ndc = glm::vec3(clip) / clip.w;
+            glm::vec2 screen = { (ndc.x * 0.5f + 0.5f) * m_Width, (0.5f - ndc.y * 0.5f) * m_Height };
+
+            screen_min = glm::min(screen_min, screen);
+            screen_max = glm::max(screen_max, screen);
+            nearest_depth = std::min(nearest_depth, ndc.z);
+        }
+
+        // Every pixel the bounds touch, grown by a pixel so that pixels only
+        // partly covered along an occluder's edge cannot hide the bounds
+        float first_x = std::max(std::floor(screen_min.x) - 1.0f, 0.0f);
+        float first_y = std::max(std::floor(screen_min.y) - 1.0f, 0.0f);
+        float last_x = std::min(std::floor(screen_max.x) + 1.0f, static_cast<float>(m_Width - 1));
+        float last_y = std::min(std::floor(screen_max.y) + 1.0f, static_cast<float>(m_Height - 1));
+
+        if (first_x > last_x || first_y > last_y)
+            return false;
+
+        uint32_t min_x = static_cast<uint32_t>(first_x);
+        uint32_t max_x = static_cast<uint32_t>(last_x);
+        uint32_t min_y = static_cast<uint32_t>(first_y);
+        uint32_t max_y = static_cast<uint32_t>(last_y);
+
+#ifdef BC_OCCLUSION_SSE2
+        const __m128 bounds_depth = _mm_set1_ps(nearest_depth);
+#endif
+
+        for (uint32_t y = min_y; y <= max_y; ++y)
+        {
+            const float* row = m_Depth.data() + static_cast<size_t>(y) * m_Width;
+
+            uint32_t x = min_x;
+#ifdef BC_OCCLUSION_SSE2
+            for (; x + 3 <= max_x; x += 4)
+            {
+                if (_mm_movemask_ps(_mm_cmpge_ps(_mm_loadu_ps(row + x), bounds_depth)) != 0)
+                    return false;
+            }
+#endif
+            for (; x <= max_x; ++x)
+            {
+                if (row[x] >= nearest_depth)
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    void OcclusionBuffer::WriteDebugImage(std::vector<uint8_t>& out_pixels) const
+    {
+        out_pixels.assign(m_Depth.size(), 0);
+
+        float nearest = FLT_MAX;
+        float farthest = -FLT_MAX;
+        for (float depth : m_Depth)
+        {
+            if (depth == FLT_MAX)
+                continue;
+
+            nearest = std::min(nearest, depth);
+            farthest = std::max(farthest, depth);
+        }
+
+        if (nearest > farthest)
+            return;
+
+        // Covered pixels span 64 -> 255 so the farthest occluder still stands
+        // out from uncovered pixels
+        float range = std::max(farthest - nearest, FLT_EPSILON);
+        for (size_t i = 0; i < m_Depth.size(); ++i)
+        {
+            if (m_Depth[i] != FLT_MAX)
+                out_pixels[i] = static_cast<uint8_t>(255.0f - std::clamp((m_Depth[i] - nearest) / range, 0.0f, 1.0f) * 191.0f);
+        }
+    }
+
+}
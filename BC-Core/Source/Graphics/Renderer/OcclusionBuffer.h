@@ -0,0 +1,125 @@
+#pragma once
+
+// Core Headers
+#include "Project/Scene/Bounds/Bounds.h"
+
+// C++ Standard Library Headers
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+// External Vendor Library Headers
+#include <glm/glm.hpp>
+
+namespace BC
+{
+
+    struct OcclusionCullingStats
+    {
+        uint32_t occluder_count         = 0;
+        uint32_t rasterised_face_count  = 0;
+
+        // Frustum visible candidates tested against the depth buffer, and how
+        // many of those were hidden behind occluders
+        uint32_t tested_count           = 0;
+        uint32_t culled_count           = 0;
+
+        OcclusionCullingStats& operator+=(const OcclusionCullingStats& other)
+        {
+            occluder_count += other.occluder_count;
+            rasterised_face_count += other.rasterised_face_count;
+            tested_count += other.tested_count;
+            culled_count += other.culled_count;
+            return *this;
+        }
+    };
+
+    /// @brief A low resolution depth buffer a camera's occluders are drawn
+    /// into on the CPU, so meshes hidden behind them can be skipped before
+    /// they reach the geometry environment.
+    ///
+    /// Occluders are boxes, e.g., the local bounds of a wall or floor mesh.
+    /// Everything is kept conservative: an occluder's depth is pushed to the
+    /// farthest point of each pixel and a tested bounds is grown by a pixel, so
+    /// a mesh is only culled when it is hidden everywhere.
+    class OcclusionBuffer
+    {
+
+    public:
+
+        static constexpr uint32_t DEFAULT_WIDTH = 256;
+        static constexpr uint32_t DEFAULT_HEIGHT = 128;
+
+        /// @brief Rows rasterised by a single job
+        static constexpr uint32_t TILE_ROWS = 16;
+
+        explicit OcclusionBuffer(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) :
+            m_Depth(resource), m_Faces(resource) {}
+        ~OcclusionBuffer() = default;
+
+        /// @brief Clears the buffer and discards every occluder. The width is
+        /// rounded up to a multiple of 4 so rows can be processed 4 pixels at
+        /// a time.
+        void Begin(const glm::mat4& view_projection, uint32_t width = DEFAULT_WIDTH, uint32_t height = DEFAULT_HEIGHT);
+
+        /// @brief Queues the faces of a box, given in the local space of the
+        /// transform, to be drawn by Rasterise. Boxes which reach behind the
+        /// camera are skipped. Returns true if the box was queued.
+        bool AddOccluder(const Bounds_AABB& local_bounds, const glm::mat4& transform);
+
+        /// @brief Draws every queued occluder, splitting the buffer into bands
+        /// of TILE_ROWS rows which are rasterised in parallel.
+        void Rasterise();
+
+        /// @brief True if the bounds are behind the drawn occluders everywhere
+        /// they cover. Safe to call from several threads once rasterised.
+        bool IsOccluded(const Bounds_AABB& bounds) const;
+
+        /// @brief Converts the buffer into one greyscale byte per pixel, top
+        /// row first. Nearer occluders are brighter, uncovered pixels are 0.
+        void WriteDebugImage(std::vector<uint8_t>& out_pixels) const;
+
+        uint32_t GetWidth() const { return m_Width; }
+        uint32_t GetHeight() const { return m_Height; }
+
+        uint32_t GetOccluderCount() const { return m_OccluderCount; }
+        uint32_t GetFaceCount() const { return static_cast<uint32_t>(m_Faces.size()); }
+
+        const std::pmr::vector<float>& GetDepth() const { return m_Depth; }
+
+    private:
+
+        /// @brief A face of an occluder projected to the buffer
+        struct OccluderFace
+        {
+            // A pixel centre is within the face when every edge function,
+            // a * x + b * y + c, is positive
+            glm::vec3 edges[4];
+
+            // depth = a * x + b * y + c at a pixel centre, offset so it is the
+            // farthest depth of the face within that pixel
+            glm::vec3 depth_plane;
+            float max_depth;
+
+            uint32_t min_x, max_x;
+            uint32_t min_y, max_y;
+        };
+
+        void AddFace(const glm::vec3* vertices);
+        void RasteriseRows(uint32_t row_begin, uint32_t row_end);
+
+        glm::mat4 m_ViewProjection = glm::mat4(1.0f);
+
+        uint32_t m_Width = 0;
+        uint32_t m_Height = 0;
+
+        /// @brief Depth of the nearest occluder of each pixel, FLT_MAX where
+        /// no occluder has been drawn
+        std::pmr::vector<float> m_Depth;
+
+        std::pmr::vector<OccluderFace> m_Faces;
+        uint32_t m_OccluderCount = 0;
+
+    };
+
+}
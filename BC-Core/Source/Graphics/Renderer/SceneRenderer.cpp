@@ -4,6 +4,10 @@
 #include "Asset/Assets/RenderTarget.h"
 #include "Asset/AssetManagerAPI.h"
 
+#include "Project/Scene/Bounds/FrustumCulling.h"
+
+#include "Util/Hash.h"
+
 namespace BC
 {
 
@@ -120,10 +124,359 @@ namespace BC
             cam_ctxs = std::move(final_cameras);
         }
 
+        /// @brief Key of a camera within SceneSnapshot::camera_environments
+        static GUID GetCameraEnvironmentKey(const CameraContext& context)
+        {
+            return context.is_editor_camera ? GUID(PLACEHOLDER_0_GUID) : context.owning_camera_entity;
+        }
+
+        /// @brief How much a light can matter to the snapshot, its intensity
+        /// scaled by the screen area its bounds cover from the nearest camera
+        static float GetLightImportance(const Bounds_Sphere& light_sphere, float intensity, const std::pmr::vector<glm::vec3>& camera_positions)
+        {
+            float nearest_distance = FLT_MAX;
+            for (const glm::vec3& camera_position : camera_positions)
+                nearest_distance = std::min(nearest_distance, glm::length(light_sphere.BoundsCentre - camera_position));
+
+            // A camera within the bounds is covered entirely
+            float screen_size = light_sphere.BoundsRadius / std::max(nearest_distance, light_sphere.BoundsRadius);
+            return intensity * screen_size * screen_size;
+        }
+
+        /// @brief Drops the least important of the visible lights once there
+        /// are more than max_lights, see GetLightImportance
+        static void ApplyLightBudgetHelper(const std::pmr::vector<Bounds_Sphere>& light_spheres, const std::pmr::vector<float>& light_intensities, const std::pmr::vector<glm::vec3>& camera_positions, uint32_t max_lights, std::pmr::vector<uint8_t>& light_visible)
+        {
+            std::pmr::vector<std::pair<float, uint32_t>> visible_lights(light_visible.get_allocator());
+            for (size_t i = 0; i < light_visible.size(); ++i)
+            {
+                if (light_visible[i])
+                    visible_lights.emplace_back(GetLightImportance(light_spheres[i], light_intensities[i], camera_positions), static_cast<uint32_t>(i));
+            }
+
+            if (visible_lights.size() <= max_lights)
+                return;
+
+            std::nth_element(visible_lights.begin(), visible_lights.begin() + max_lights, visible_lights.end(), [](const auto& a, const auto& b)
+            {
+                return a.first > b.first;
+            });
+
+            for (size_t i = max_lights; i < visible_lights.size(); ++i)
+                light_visible[visible_lights[i].second] = 0;
+        }
+
+        /// @brief Key of a light's shadow within the shadow map allocators
+        /// and SceneRenderData::shadow_view_cache
+        static uint64_t GetShadowLightKey(const Entity& entity, LightType light_type)
+        {
+            return static_cast<uint64_t>(entity.GetGUID()) ^ (static_cast<uint64_t>(light_type) << 62);
+        }
+
+        static uint64_t HashCombine(uint64_t hash, const void* data, size_t length)
+        {
+            return (hash ^ HashBytes(data, length)) * 1099511628211ull;
+        }
+
+        /// @brief Fraction of the camera's view height covered by the bounding
+        /// sphere of the bounds
+        static float GetScreenCoverage(const CameraContext& context, const Bounds_AABB& bounds)
+        {
+            float radius = glm::length(bounds.Size()) * 0.5f;
+            if (context.is_orthographic)
+                return 2.0f * radius / std::max(context.orthographic_size, 0.0001f);
+
+            float distance = std::max(glm::length(bounds.Center() - context.GetWorldPosition()), context.near_clip);
+            return radius / (distance * std::tan(glm::radians(context.fov) * 0.5f));
+        }
+
+        /// @brief Adds the levels of a LODMeshComponent a camera sees at
+        /// screen_coverage, two while cross fading, and counts their draws
+        static void AddLODMeshHelper(GeometryEnvironment& geometry, MeshRendererComponent& mesh_component, const GPUScene& gpu_scene, const LODMeshComponent& lod_component, float screen_coverage, float normalised_depth, LODStats& lod_stats)
+        {
+            LODSelection selection = lod_component.SelectLOD(screen_coverage);
+            if (selection.lod_index < 0)
+            {
+                lod_stats.culled_count++;
+                return;
+            }
+
+            auto add_level = [&](int32_t lod_index, float lod_fade)
+            {
+                size_t first_item = geometry.DrawItems.size();
+                uint32_t triangle_count = geometry.AddStaticMesh(mesh_component, gpu_scene, normalised_depth, lod_component.GetLODMesh(lod_index, mesh_component.GetMesh()), lod_fade);
+
+                lod_stats.draw_count[lod_index] += static_cast<uint32_t>(geometry.DrawItems.size() - first_item);
+                lod_stats.triangle_count[lod_index] += triangle_count;
+            };
+
+            add_level(selection.lod_index, selection.lod_fade);
+
+            if (selection.fade_lod_index >= 0)
+            {
+                add_level(selection.fade_lod_index, selection.fade_lod_fade);
+                lod_stats.cross_fade_count++;
+            }
+        }
+
+        /// @brief The mesh shadow views draw for a caster, its LODMeshComponent's
+        /// shadow level when it has one
+        static AssetHandle GetShadowMesh(const Entity& entity, const MeshRendererComponent& mesh_component)
+        {
+            if (auto* lod_component = entity.TryGetComponent<LODMeshComponent>())
+                return lod_component->GetLODMesh(lod_component->GetShadowLODIndex(), mesh_component.GetMesh());
+
+            return mesh_component.GetMesh();
+        }
+
+        /// @brief Reduces the candidates of a shadow's views, as returned once
+        /// each by a multi view query, to the active shadow casting meshes.
+        /// view_masks is kept aligned with the candidates. Returns a hash of
+        /// the casters, their bounds, global transform versions and the views
+        /// that see them, which changes whenever a caster moves, appears, leaves
+        /// or crosses between views. The transform version catches a caster
+        /// rotating or moving within bounds that stay the same.
+        /// Each caster's hash is summed, so the hash does not depend on the
+        /// order the spatial index returned them in.
+        ///
+        /// A skinned caster's pose changes without its bounds doing so, so
+        /// out_has_skinned_casters tells the caller the hash cannot be trusted.
+        static uint64_t GatherShadowCastersHelper(std::vector<SpatialDataSource<Entity>>& candidates, std::vector<SpatialIndex<Entity>::ViewMask>& view_masks, bool& out_has_skinned_casters)
+        {
+            out_has_skinned_casters = false;
+
+            uint64_t hash = 14695981039346656037ull;
+            size_t caster_count = 0;
+            for (size_t i = 0; i < candidates.size(); ++i)
+            {
+                const auto& candidate = candidates[i];
+                if (!candidate.Data)
+                    continue;
+
+                auto* mesh_component = candidate.Data.TryGetComponent<MeshRendererComponent>();
+                auto* skinned_mesh_component = candidate.Data.TryGetComponent<SkinnedMeshRendererComponent>();
+
+                bool casts_static_shadow = mesh_component && mesh_component->GetActive() && mesh_component->GetCastingShadows();
+                bool casts_skinned_shadow = skinned_mesh_component && skinned_mesh_component->GetActive() && skinned_mesh_component->GetCastingShadows();
+                if (!casts_static_shadow && !casts_skinned_shadow)
+                    continue;
+
+                Scene* scene = candidate.Data.GetScene();
+                entt::entity entity_handle = candidate.Data;
+
+                uint64_t caster_hash = HashBytes(&scene, sizeof(scene));
+                caster_hash = HashCombine(caster_hash, &entity_handle, sizeof(entity_handle));
+                caster_hash = HashCombine(caster_hash, &candidate.Bounds.BoundsMin, sizeof(glm::vec3));
+                caster_hash = HashCombine(caster_hash, &candidate.Bounds.BoundsMax, sizeof(glm::vec3));
+                caster_hash = HashCombine(caster_hash, &view_masks[i], sizeof(SpatialIndex<Entity>::ViewMask));
+
+                uint32_t transform_version = candidate.Data.GetTransform().GetGlobalTransformVersion();
+                caster_hash = HashCombine(caster_hash, &transform_version, sizeof(transform_version));
+
+                if (mesh_component)
+                {
+                    AssetHandle shadow_mesh = GetShadowMesh(candidate.Data, *mesh_component);
+                    caster_hash = HashCombine(caster_hash, &shadow_mesh, sizeof(shadow_mesh));
+                }
+
+                out_has_skinned_casters |= casts_skinned_shadow;
+                hash += caster_hash;
+
+                candidates[caster_count] = candidate;
+                view_masks[caster_count] = view_masks[i];
+                ++caster_count;
+            }
+
+            candidates.erase(candidates.begin() + caster_count, candidates.end());
+            view_masks.resize(caster_count);
+
+            return hash;
+        }
+
+        /// @brief Adds the casters to a shadow's geometry, ordered by
+        /// depth_from_light, and sorts it
+        template<typename DepthFunction>
+        static void AddShadowCastersHelper(const std::vector<SpatialDataSource<Entity>>& casters, const GPUScene& gpu_scene, GeometryEnvironment& geometry, DepthFunction depth_from_light)
+        {
+            geometry.Clear();
+
+            for (const auto& caster : casters)
+            {
+                float normalised_depth = depth_from_light(caster.Bounds.Center());
+
+                if (auto* mesh_component = caster.Data.TryGetComponent<MeshRendererComponent>(); mesh_component && mesh_component->GetCastingShadows())
+                    geometry.AddStaticMesh(*mesh_component, gpu_scene, normalised_depth, GetShadowMesh(caster.Data, *mesh_component));
+
+                if (auto* skinned_mesh_component = caster.Data.TryGetComponent<SkinnedMeshRendererComponent>(); skinned_mesh_component && skinned_mesh_component->GetCastingShadows())
+                    geometry.AddSkinnedMesh(*skinned_mesh_component, normalised_depth);
+            }
+
+            geometry.Sort();
+        }
+
+        /// @brief Occluders drawn per camera, the largest on screen are kept
+        constexpr size_t MAX_OCCLUDERS_PER_CAMERA = 64;
+
+        /// @brief Queues the flagged occluders among a camera's frustum
+        /// candidates into its occlusion buffer, ready to be rasterised
+        static void GatherOccludersHelper(const CameraContext& context, const std::vector<SpatialDataSource<Entity>>& candidates, OcclusionBuffer& occlusion_buffer)
+        {
+            BC_PROFILE_SCOPE("SceneRenderer::GatherOccluders");
+
+            struct OccluderCandidate
+            {
+                Entity entity;
+                MeshRendererComponent* mesh_component;
+                float screen_size;
+            };
+
+            std::vector<OccluderCandidate> occluders;
+
+            glm::vec3 camera_position = context.GetWorldPosition();
+            for (const auto& candidate : candidates)
+            {
+                if (!candidate.Data)
+                    continue;
+
+                auto* mesh_component = candidate.Data.TryGetComponent<MeshRendererComponent>();
+                if (!mesh_component || !mesh_component->GetActive() || !mesh_component->GetOccluder())
+                    continue;
+
+                // Half the bounds diagonal over its distance, proportional to
+                // how much of the screen the occluder can cover
+                float radius = glm::length(candidate.Bounds.Size()) * 0.5f;
+                float distance = std::max(glm::length(candidate.Bounds.Center() - camera_position), context.near_clip);
+                occluders.push_back({ candidate.Data, mesh_component, radius / distance });
+            }
+
+            if (occluders.size() > MAX_OCCLUDERS_PER_CAMERA)
+            {
+                std::nth_element(occluders.begin(), occluders.begin() + MAX_OCCLUDERS_PER_CAMERA, occluders.end(), [](const OccluderCandidate& a, const OccluderCandidate& b)
+                {
+                    return a.screen_size > b.screen_size;
+                });
+                occluders.resize(MAX_OCCLUDERS_PER_CAMERA);
+            }
+
+            // Keep the buffer's pixels roughly square to the camera's aspect
+            uint32_t buffer_height = static_cast<uint32_t>(std::clamp(OcclusionBuffer::DEFAULT_WIDTH / std::max(context.aspect_ratio, 0.01f), 16.0f, static_cast<float>(OcclusionBuffer::DEFAULT_WIDTH)));
+            occlusion_buffer.Begin(context.projection_matrix * context.view_matrix, OcclusionBuffer::DEFAULT_WIDTH, buffer_height);
+
+            for (const auto& occluder : occluders)
+            {
+                auto static_mesh_asset = AssetManager::GetAsset<StaticMesh>(occluder.mesh_component->GetMesh());
+                if (!static_mesh_asset)
+                    continue;
+
+                auto& transform = occluder.entity.GetComponent<TransformComponent>();
+                occlusion_buffer.AddOccluder(static_mesh_asset->GetMeshBounds(), transform.GetGlobalMatrix());
+            }
+        }
+
+        /// @brief Runs job_count jobs, the first on the calling thread, and
+        /// waits for all of them to finish
+        static void RunJobsHelper(const std::string& job_name, size_t job_count, const std::function<void(size_t)>& job)
+        {
+            if (job_count == 0)
+                return;
+
+            JobCounter job_counter = {};
+            if (job_count > 1)
+            {
+                std::vector<std::pair<std::string, JobFunction>> jobs;
+                jobs.reserve(job_count - 1);
+                for (size_t job_index = 1; job_index < job_count; ++job_index)
+                    jobs.emplace_back(job_name, [&job, job_index]() { job(job_index); });
+
+                Application::GetJobSystem()->SubmitJobs(jobs, &job_counter, JobPriority::High);
+            }
+
+            job(0);
+
+            job_counter.Wait();
+        }
+
+        /// @brief Frustum candidates tested by a single geometry gather job
+        constexpr size_t MIN_CANDIDATES_PER_GATHER_JOB = 1024;
+
+        static void TransitionImageHelper(VkCommandBuffer cmd, VkImage image, VkImageAspectFlags aspect, VkImageLayout old_layout, VkImageLayout new_layout,
+            VkPipelineStageFlags src_stages, VkAccessFlags src_access, VkPipelineStageFlags dst_stages, VkAccessFlags dst_access)
+        {
+            VkImageMemoryBarrier barrier{};
+            barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.srcAccessMask = src_access;
+            barrier.dstAccessMask = dst_access;
+            barrier.oldLayout = old_layout;
+            barrier.newLayout = new_layout;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image = image;
+            barrier.subresourceRange = { aspect, 0, 1, 0, 1 };
+
+            vkCmdPipelineBarrier(cmd, src_stages, dst_stages, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+        }
+
+        static void SetViewportAndScissorHelper(VkCommandBuffer cmd, VkExtent2D extent)
+        {
+            VkViewport viewport{};
+            viewport.width = static_cast<float>(extent.width);
+            viewport.height = static_cast<float>(extent.height);
+            viewport.maxDepth = 1.0f;
+            vkCmdSetViewport(cmd, 0, 1, &viewport);
+
+            VkRect2D scissor{ { 0, 0 }, extent };
+            vkCmdSetScissor(cmd, 0, 1, &scissor);
+        }
+
+        /// @brief Draws the camera's instance batches of one pass. Batches are
+        /// drawn in the order the batcher built them, so transparent batches
+        /// stay back to front.
+        static void RecordInstanceBatchesHelper(VkCommandBuffer cmd, const CameraEnvironment& cam_env, DrawPass pass, VkPipeline pipeline, VkPipelineLayout layout)
+        {
+            if (pipeline == VK_NULL_HANDLE || cam_env.geometry_environment.GetPassDrawItems(pass).empty())
+                return;
+
+            vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+
+            for (const auto& batch : cam_env.instance_batches)
+            {
+                if (batch.pass != pass || batch.instance_count == 0)
+                    continue;
+
+                auto static_mesh_asset = AssetManager::GetAsset<StaticMesh>(batch.static_mesh_asset_handle);
+                if (!static_mesh_asset || batch.sub_mesh_index >= static_mesh_asset->GetSubMeshes().size())
+                    continue;
+
+                if (batch.geom_type == GeometryType_Skinned && layout != VK_NULL_HANDLE)
+                {
+                    uint32_t bone_buffer_offset = static_cast<uint32_t>(batch.bone_buffer_offset);
+                    vkCmdPushConstants(cmd, layout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(bone_buffer_offset), &bone_buffer_offset);
+                }
+
+                const uint32_t index_count = static_mesh_asset->GetSubMeshes()[batch.sub_mesh_index].GetIndexCount();
+                vkCmdDraw(cmd, index_count, batch.instance_count, 0, batch.first_instance);
+            }
+        }
+
     }
 
     SceneRenderer::SceneRenderData* SceneRenderer::s_Data = nullptr;
 
+    void SceneRenderer::SceneSnapshot::Recycle()
+    {
+        // Containers are replaced rather than cleared, a cleared container
+        // would keep its storage which is about to be handed out again
+        std::pmr::memory_resource* resource = arena.get();
+
+        camera_environments = std::pmr::unordered_map<GUID, CameraEnvironment>(resource);
+        light_environment = LightEnvironment(resource);
+        shadow_environment = ShadowEnvironment(resource);
+        instance_buffer = std::pmr::vector<Util::InstanceData>(resource);
+        gpu_scene_upload = GPUSceneUpload(resource);
+
+        arena->Reset();
+    }
+
 	void SceneRenderer::Init()
 	{
         if (!s_Data)
@@ -131,10 +484,31 @@ namespace BC
         
         s_Data->frames_in_flight.clear();
         s_Data->frames_in_flight.resize(Application::GetVulkanCore()->GetSwapchain().GetImageCount());
+
+        // Signalled so the first recording of each frame slot doesn't wait
+        VkFenceCreateInfo fence_info{};
+        fence_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        fence_info.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+
+        VkDevice device = Application::GetVulkanCore()->GetLogicalDevice();
+        for (auto& frame : s_Data->frames_in_flight)
+        {
+            VkResult result = vkCreateFence(device, &fence_info, nullptr, &frame.render_fence);
+            BC_THROW(result == VK_SUCCESS, "SceneRenderer::Init: Failed to Create Render Fence.");
+        }
 	}
 
 	void SceneRenderer::Shutdown()
 	{
+        VkDevice device = Application::GetVulkanCore()->GetLogicalDevice();
+        s_Data->gpu_scene.Destroy();
+
+        for (auto& frame : s_Data->frames_in_flight)
+        {
+            if (frame.render_fence)
+                vkDestroyFence(device, frame.render_fence, nullptr);
+        }
+
         s_Data->frames_in_flight.clear();
         if (s_Data)
         {
@@ -166,9 +540,13 @@ namespace BC
         auto scene_manager  = Application::GetProject()->GetSceneManager();
 
         auto& frame         = s_Data->frames_in_flight[frame_index];
+        frame.Recycle();
+
+        // Scratch of this snapshot is taken from the frame's arena as well
+        std::pmr::memory_resource* frame_resource = frame.arena.get();
+
         auto& cam_envs      = frame.camera_environments;
         auto& light_env     = frame.light_environment;
-        auto& shadow_env    = frame.shadow_environment;
 
         // 1. Camera Environments
         std::vector<CameraContext> cam_ctxs = camera_overrides;
@@ -183,66 +561,136 @@ namespace BC
             }
         }
 
+        // Persistent scene data first, draws and lights refer to its slots
+        const GPUScene& gpu_scene = s_Data->gpu_scene;
+
+        GPUSceneStats frame_gpu_scene_stats = {};
+        s_Data->gpu_scene.Update(*scene_manager, frame.gpu_scene_upload, frame_gpu_scene_stats);
+
         JobCounter gather_lights = {};
         Application::GetJobSystem()->SubmitJob
         (
             "SnapshotScene - Gather Visible Lights",
             [&]()
             {
-                auto sphere_light_view = scene_manager->GetAllEntitiesWithComponent<SphereLightComponent>();
-                for (const auto& entity : sphere_light_view)
+                LightBudget light_budget = GetLightBudget();
+
+                // Candidates come from each camera's query of the light index.
+                // A light seen by several cameras is only kept once.
+                std::vector<SpatialDataSource<Entity>> camera_lights;
+                std::pmr::vector<Entity> light_entities(frame_resource);
+                for (const auto& context : cam_ctxs)
                 {
-                    auto& component = entity.GetComponent<SphereLightComponent>();
-                    if (!component.GetActive())
-                        continue;
-                    
-                    for (const auto& context : cam_ctxs)
+                    scene_manager->QueryLights(context.camera_frustum, camera_lights);
+                    for (const auto& data_source : camera_lights)
+                        light_entities.push_back(data_source.Data);
+                }
+
+                if (cam_ctxs.size() > 1)
+                {
+                    std::sort(light_entities.begin(), light_entities.end(), [](const Entity& a, const Entity& b)
                     {
-                        if (context.camera_frustum.Contains(Bounds_Sphere{TransformComponent::GetPositionFromMatrix(context.transform_matrix), component.GetRadius()}) != FrustumContainResult::DoesNotContain)
-                        {
-                            light_env.AddSphereLight(component);
-                            break;
-                        }
+                        return std::make_pair(a.GetScene(), static_cast<entt::entity>(a)) < std::make_pair(b.GetScene(), static_cast<entt::entity>(b));
+                    });
+                    light_entities.erase(std::unique(light_entities.begin(), light_entities.end()), light_entities.end());
+                }
+
+                // The index holds boxes around the lights, so the true bounding
+                // spheres are culled again as one batch per camera by the SIMD
+                // culling kernels, then held to the budget
+                std::pmr::vector<FrustumPlanesSoA> camera_planes(frame_resource);
+                std::pmr::vector<glm::vec3> camera_positions(frame_resource);
+                camera_planes.reserve(cam_ctxs.size());
+                camera_positions.reserve(cam_ctxs.size());
+                for (const auto& context : cam_ctxs)
+                {
+                    camera_planes.emplace_back(context.camera_frustum);
+                    camera_positions.push_back(context.GetWorldPosition());
+                }
+
+                std::pmr::vector<FrustumContainResult> cull_results(frame_resource);
+                std::pmr::vector<uint8_t> light_visible(frame_resource);
+
+                auto cull_light_spheres = [&](const std::pmr::vector<Bounds_Sphere>& light_spheres, const std::pmr::vector<float>& light_intensities, uint32_t max_lights)
+                {
+                    cull_results.resize(light_spheres.size());
+                    light_visible.assign(light_spheres.size(), 0);
+
+                    for (const auto& planes : camera_planes)
+                    {
+                        Util::CullSpheres(planes, light_spheres.data(), light_spheres.size(), cull_results.data());
+                        for (size_t i = 0; i < light_spheres.size(); ++i)
+                            light_visible[i] |= cull_results[i] != FrustumContainResult::DoesNotContain;
                     }
+
+                    Util::ApplyLightBudgetHelper(light_spheres, light_intensities, camera_positions, max_lights, light_visible);
+                };
+
+                std::pmr::vector<SphereLightComponent*> sphere_lights(frame_resource);
+                std::pmr::vector<Bounds_Sphere> sphere_light_bounds(frame_resource);
+                std::pmr::vector<float> sphere_light_intensities(frame_resource);
+
+                for (const Entity& entity : light_entities)
+                {
+                    if (!entity)
+                        continue;
+
+                    auto* component = entity.TryGetComponent<SphereLightComponent>();
+                    if (!component || !component->GetActive())
+                        continue;
+                    
+                    const glm::mat4& light_matrix = entity.GetComponent<TransformComponent>().GetGlobalMatrix();
+
+                    sphere_lights.push_back(component);
+                    sphere_light_bounds.emplace_back(TransformComponent::GetPositionFromMatrix(light_matrix), component->GetRadius());
+                    sphere_light_intensities.push_back(component->GetIntensity());
                 }
 
-                auto cone_light_view = scene_manager->GetAllEntitiesWithComponent<ConeLightComponent>();
-                for (const auto& entity : cone_light_view)
+                cull_light_spheres(sphere_light_bounds, sphere_light_intensities, light_budget.max_sphere_lights);
+                for (size_t i = 0; i < sphere_lights.size(); ++i)
                 {
-                    auto& component = entity.GetComponent<ConeLightComponent>();
-                    if (!component.GetActive())
+                    if (light_visible[i])
+                        light_env.AddSphereLight(*sphere_lights[i]);
+                }
+
+                std::pmr::vector<ConeLightComponent*> cone_lights(frame_resource);
+                std::pmr::vector<Bounds_Sphere> cone_light_bounds(frame_resource);
+                std::pmr::vector<float> cone_light_intensities(frame_resource);
+
+                for (const Entity& entity : light_entities)
+                {
+                    if (!entity)
+                        continue;
+
+                    auto* component = entity.TryGetComponent<ConeLightComponent>();
+                    if (!component || !component->GetActive())
                         continue;
                     
-                    for (const auto& context : cam_ctxs)
-                    {
-                        float half_angle = glm::radians(component.GetAngle() * 0.5f);
-                        float cos_penumbra = cos(half_angle);
+                    const glm::mat4& light_matrix = entity.GetComponent<TransformComponent>().GetGlobalMatrix();
 
-                        Bounds_Sphere sphere;
-                        if (half_angle > glm::pi<float>() / 4.0f) 
-                        {
-                            sphere.BoundsCentre = TransformComponent::GetPositionFromMatrix(context.transform_matrix) + cos_penumbra * component.GetRange() * TransformComponent::GetForwardDirectionFromMatrix(context.transform_matrix);
-                            sphere.BoundsRadius = sin(half_angle) * component.GetRange();
-                        }
-                        else
-                        {
-                            sphere.BoundsCentre = TransformComponent::GetPositionFromMatrix(context.transform_matrix) + component.GetRange() / (2.0f * cos_penumbra) * TransformComponent::GetForwardDirectionFromMatrix(context.transform_matrix);
-                            sphere.BoundsRadius = component.GetRange() / (2.0f * cos_penumbra);
-                        }
+                    cone_lights.push_back(component);
+                    cone_light_bounds.push_back(Bounds_Sphere::FromCone
+                    (
+                        TransformComponent::GetPositionFromMatrix(light_matrix),
+                        TransformComponent::GetForwardDirectionFromMatrix(light_matrix),
+                        component->GetRange(),
+                        component->GetAngle()
+                    ));
+                    cone_light_intensities.push_back(component->GetIntensity());
+                }
 
-                        if (context.camera_frustum.Contains(sphere) != FrustumContainResult::DoesNotContain)
-                        {
-                            light_env.AddConeLight(component);
-                            break;
-                        }
-                    }
+                cull_light_spheres(cone_light_bounds, cone_light_intensities, light_budget.max_cone_lights);
+                for (size_t i = 0; i < cone_lights.size(); ++i)
+                {
+                    if (light_visible[i])
+                        light_env.AddConeLight(*cone_lights[i]);
                 }
 
-                int directional_lights_added = 0;
+                uint32_t directional_lights_added = 0;
                 auto directional_light_view = scene_manager->GetAllEntitiesWithComponent<DirectionalLightComponent>();
                 for (const auto& entity : directional_light_view) 
                 {
-                    if (directional_lights_added >= Util::MAX_DIRECTIONAL_LIGHT)
+                    if (directional_lights_added >= light_budget.max_directional_lights)
                         break;
 
                     auto& component = entity.GetComponent<DirectionalLightComponent>();
@@ -252,39 +700,931 @@ namespace BC
                     light_env.AddDirectionalLight(component);
                     directional_lights_added++;
                 }
+
+                // Grouped by type, cluster light indices refer to this order
+                light_env.SortLights();
+
+                light_env.light_indices.reserve(light_env.lights.size());
+                for (size_t i = 0; i < light_env.lights.size(); ++i)
+                    light_env.light_indices.push_back(gpu_scene.GetLightIndex(light_env.light_entities[i], light_env.lights[i].sphere.light_type));
             },
             &gather_lights,
             JobPriority::Low,
             false
         );
 
-        JobCounter gather_shadow_casters = {};
-        Application::GetJobSystem()->SubmitJob
+        // 2. Geometry, gathered in three fanned out passes. Camera environments
+        // are created up front from the frame's arena, as the map cannot be
+        // written to from jobs.
+        bool occlusion_culling = s_Data->occlusion_culling_enabled.load(std::memory_order_relaxed);
+        bool occlusion_debug_view = s_Data->occlusion_debug_view.load(std::memory_order_relaxed);
+
+        std::pmr::vector<CameraEnvironment*> camera_envs(frame_resource);
+        camera_envs.reserve(cam_ctxs.size());
+        for (const auto& context : cam_ctxs)
+            camera_envs.push_back(&cam_envs.try_emplace(Util::GetCameraEnvironmentKey(context), frame_resource).first->second);
+
+        auto& camera_candidates = frame.camera_candidates;
+        camera_candidates.resize(cam_ctxs.size());
+
+        // a. Frustum query and occluders, one job per camera
+        Util::RunJobsHelper
         (
-            "SnapshotScene - Gather Visible Shadows",
-            [&]()
+            "SnapshotScene - Query Camera Geometry",
+            cam_ctxs.size(),
+            [&](size_t camera_index)
+            {
+                const CameraContext& context = cam_ctxs[camera_index];
+                CameraEnvironment& cam_env = *camera_envs[camera_index];
+
+                cam_env.camera_ctx = context;
+                cam_env.geometry_environment.Clear();
+                cam_env.occlusion_stats = {};
+
+                scene_manager->QueryFrustum(context.camera_frustum, camera_candidates[camera_index]);
+
+                if (occlusion_culling)
+                    Util::GatherOccludersHelper(context, camera_candidates[camera_index], cam_env.occlusion_buffer);
+            }
+        );
+
+        // Each rasterise fans out across the buffer's tiles itself
+        if (occlusion_culling)
+        {
+            for (CameraEnvironment* cam_env : camera_envs)
+            {
+                cam_env->occlusion_buffer.Rasterise();
+
+                cam_env->occlusion_stats.occluder_count = cam_env->occlusion_buffer.GetOccluderCount();
+                cam_env->occlusion_stats.rasterised_face_count = cam_env->occlusion_buffer.GetFaceCount();
+            }
+        }
+
+        // b. Candidates split into chunks across every camera, each chunk is
+        // tested and added to its own geometry environment
+        size_t max_chunks_per_camera = static_cast<size_t>(Application::GetJobSystem()->GetWorkerCount()) + 1;
+
+        auto& geometry_chunks = frame.geometry_chunks;
+        size_t chunk_count = 0;
+        for (size_t camera_index = 0; camera_index < cam_ctxs.size(); ++camera_index)
+        {
+            size_t candidate_count = camera_candidates[camera_index].size();
+            size_t camera_chunk_count = std::clamp<size_t>((candidate_count + Util::MIN_CANDIDATES_PER_GATHER_JOB - 1) / Util::MIN_CANDIDATES_PER_GATHER_JOB, 1, max_chunks_per_camera);
+            size_t chunk_size = (candidate_count + camera_chunk_count - 1) / camera_chunk_count;
+
+            for (size_t i = 0; i < camera_chunk_count; ++i)
+            {
+                if (chunk_count == geometry_chunks.size())
+                    geometry_chunks.emplace_back();
+
+                auto& chunk = geometry_chunks[chunk_count++];
+                chunk.camera_index = camera_index;
+                chunk.candidate_begin = std::min(i * chunk_size, candidate_count);
+                chunk.candidate_end = std::min(chunk.candidate_begin + chunk_size, candidate_count);
+            }
+        }
+
+        Util::RunJobsHelper
+        (
+            "SnapshotScene - Gather Camera Geometry",
+            chunk_count,
+            [&](size_t chunk_index)
             {
-                auto light_view = scene_manager->GetAllEntitiesWithComponent<SphereLightComponent, ConeLightComponent, DirectionalLightComponent>();
-                for (const auto& entity : light_view)
+                auto& chunk = geometry_chunks[chunk_index];
+                const auto& candidates = camera_candidates[chunk.camera_index];
+                const CameraContext& context = cam_ctxs[chunk.camera_index];
+                const OcclusionBuffer& occlusion_buffer = camera_envs[chunk.camera_index]->occlusion_buffer;
+
+                glm::vec3 camera_position = context.GetWorldPosition();
+                glm::vec3 camera_forward = context.GetForwardRH();
+                float inverse_far_clip = 1.0f / std::max(context.far_clip, context.near_clip + 0.001f);
+
+                chunk.geometry_environment.Clear();
+                chunk.occlusion_stats = {};
+                chunk.lod_stats = {};
+
+                for (size_t i = chunk.candidate_begin; i < chunk.candidate_end; ++i)
                 {
+                    const auto& candidate = candidates[i];
+                    if (!candidate.Data)
+                        continue;
+
+                    auto* mesh_component = candidate.Data.TryGetComponent<MeshRendererComponent>();
+                    auto* skinned_mesh_component = candidate.Data.TryGetComponent<SkinnedMeshRendererComponent>();
+                    if (!mesh_component && !skinned_mesh_component)
+                        continue;
+
+                    if (occlusion_culling)
+                    {
+                        chunk.occlusion_stats.tested_count++;
+                        if (occlusion_buffer.IsOccluded(candidate.Bounds))
+                        {
+                            chunk.occlusion_stats.culled_count++;
+                            continue;
+                        }
+                    }
+
+                    float normalised_depth = glm::dot(candidate.Bounds.Center() - camera_position, camera_forward) * inverse_far_clip;
+
+                    if (mesh_component)
+                    {
+                        auto* lod_component = candidate.Data.TryGetComponent<LODMeshComponent>();
+                        if (lod_component && !lod_component->GetLODs().empty())
+                            Util::AddLODMeshHelper(chunk.geometry_environment, *mesh_component, gpu_scene, *lod_component, Util::GetScreenCoverage(context, candidate.Bounds), normalised_depth, chunk.lod_stats);
+                        else
+                            chunk.geometry_environment.AddStaticMesh(*mesh_component, gpu_scene, normalised_depth);
+                    }
+
+                    if (skinned_mesh_component)
+                        chunk.geometry_environment.AddSkinnedMesh(*skinned_mesh_component, normalised_depth);
                 }
-            },
-            &gather_shadow_casters,
-            JobPriority::Low,
-            false
+            }
         );
 
-        for (const auto& context : cam_ctxs)
+        // c. Chunks appended in order into their camera's environment, which
+        // is then sorted into draw order. Each sort fans out across the jobs.
+        LODStats frame_lod_stats = {};
+        for (size_t camera_index = 0; camera_index < cam_ctxs.size(); ++camera_index)
         {
+            CameraEnvironment& cam_env = *camera_envs[camera_index];
+            for (size_t chunk_index = 0; chunk_index < chunk_count; ++chunk_index)
+            {
+                const auto& chunk = geometry_chunks[chunk_index];
+                if (chunk.camera_index != camera_index)
+                    continue;
+
+                cam_env.geometry_environment.Append(chunk.geometry_environment);
+                cam_env.occlusion_stats += chunk.occlusion_stats;
+                frame_lod_stats += chunk.lod_stats;
+            }
 
+            cam_env.geometry_environment.Sort();
         }
-    }
 
-    void SceneRenderer::RecordCommandBuffers(uint32_t frame_index)
-    {
-    }
+        // 3. Instancing, every camera's batches share the frame's instance buffer
+        DrawCallStats frame_draw_call_stats = {};
+        for (CameraEnvironment* cam_env : camera_envs)
+        {
+            Util::BuildInstanceBatches(cam_env->geometry_environment, cam_env->instance_batches, frame.instance_buffer);
+
+            frame_draw_call_stats.draw_item_count += static_cast<uint32_t>(cam_env->geometry_environment.DrawItems.size());
+            frame_draw_call_stats.instanced_draw_count += static_cast<uint32_t>(cam_env->instance_batches.size());
+        }
+
+        // 4. Light clusters, each camera's slices are binned in parallel once
+        // the visible lights have been gathered
+        gather_lights.Wait();
+
+        for (size_t camera_index = 0; camera_index < cam_ctxs.size(); ++camera_index)
+            camera_envs[camera_index]->light_clusters.Begin(cam_ctxs[camera_index], light_env);
+
+        Util::RunJobsHelper
+        (
+            "SnapshotScene - Assign Light Clusters",
+            cam_ctxs.size() * LightClusterGrid::SLICE_COUNT,
+            [&](size_t job_index)
+            {
+                size_t camera_index = job_index / LightClusterGrid::SLICE_COUNT;
+                uint32_t slice = static_cast<uint32_t>(job_index % LightClusterGrid::SLICE_COUNT);
+                camera_envs[camera_index]->light_clusters.AssignSlice(slice);
+            }
+        );
+
+        for (CameraEnvironment* cam_env : camera_envs)
+            cam_env->light_clusters.Finalise();
+
+        // 5. Shadow views of the gathered lights
+        GatherShadowViews(frame, cam_ctxs);
+
+        OcclusionCullingStats frame_occlusion_stats = {};
+        for (const CameraEnvironment* cam_env : camera_envs)
+            frame_occlusion_stats += cam_env->occlusion_stats;
+
+        std::vector<uint8_t> occlusion_debug_image;
+        glm::uvec2 occlusion_debug_size = { 0, 0 };
+        if (occlusion_culling && occlusion_debug_view)
+        {
+            const OcclusionBuffer& occlusion_buffer = camera_envs.front()->occlusion_buffer;
+            occlusion_buffer.WriteDebugImage(occlusion_debug_image);
+            occlusion_debug_size = { occlusion_buffer.GetWidth(), occlusion_buffer.GetHeight() };
+        }
+
+        {
+            std::lock_guard<std::mutex> statistics_lock(s_Data->statistics_mutex);
+            s_Data->draw_call_stats = frame_draw_call_stats;
+            s_Data->lod_stats = frame_lod_stats;
+            s_Data->gpu_scene_stats = frame_gpu_scene_stats;
+            s_Data->occlusion_stats = frame_occlusion_stats;
+            if (occlusion_debug_view)
+            {
+                s_Data->occlusion_debug_image = std::move(occlusion_debug_image);
+                s_Data->occlusion_debug_size = occlusion_debug_size;
+            }
+        }
+    }
+
+    void SceneRenderer::GatherShadowViews(SceneSnapshot& frame, const std::vector<CameraContext>& cam_ctxs)
+    {
+        BC_PROFILE_SCOPE("SceneRenderer::GatherShadowViews");
+
+        auto scene_manager = Application::GetProject()->GetSceneManager();
+        std::pmr::memory_resource* frame_resource = frame.arena.get();
+
+        const LightEnvironment& light_env = frame.light_environment;
+        ShadowEnvironment& shadow_env = frame.shadow_environment;
+
+        uint64_t snapshot_index = ++s_Data->shadow_snapshot_count;
+
+        std::pmr::vector<glm::vec3> camera_positions(frame_resource);
+        for (const auto& context : cam_ctxs)
+            camera_positions.push_back(context.GetWorldPosition());
+
+        // 1. Shadow casting lights. Sphere and cone lights compete for the
+        // layers of their shadow map array by importance.
+        std::pmr::vector<uint32_t> sphere_light_indices(frame_resource);
+        std::pmr::vector<uint32_t> cone_light_indices(frame_resource);
+        std::pmr::vector<uint32_t> directional_light_indices(frame_resource);
+        std::pmr::vector<ShadowMapAllocator::Request> sphere_requests(frame_resource);
+        std::pmr::vector<ShadowMapAllocator::Request> cone_requests(frame_resource);
+
+        for (uint32_t i = 0; i < light_env.lights.size(); ++i)
+        {
+            const Util::LightData& light = light_env.lights[i];
+            const Entity& entity = light_env.light_entities[i];
+
+            switch (light.sphere.light_type)
+            {
+                case Util::LightType_Sphere:
+                {
+                    if (light.sphere.shadow_type == ShadowType_None)
+                        break;
+
+                    Bounds_Sphere bounds = Bounds_Sphere(glm::vec3(light.sphere.position), light.sphere.radius);
+                    sphere_light_indices.push_back(i);
+                    sphere_requests.push_back({ Util::GetShadowLightKey(entity, Util::LightType_Sphere), Util::GetLightImportance(bounds, light.sphere.colour.w, camera_positions) });
+                    break;
+                }
+                case Util::LightType_Cone:
+                {
+                    if (light.cone.shadow_type == ShadowType_None)
+                        break;
+
+                    Bounds_Sphere bounds = Bounds_Sphere::FromCone(glm::vec3(light.cone.position), glm::vec3(light.cone.direction), light.cone.range, light.cone.angle);
+                    cone_light_indices.push_back(i);
+                    cone_requests.push_back({ Util::GetShadowLightKey(entity, Util::LightType_Cone), Util::GetLightImportance(bounds, light.cone.colour.w, camera_positions) });
+                    break;
+                }
+                case Util::LightType_Directional:
+                {
+                    if (light.directional.shadow_type != ShadowType_None && directional_light_indices.size() < Util::MAX_DIRECTIONAL_SHADOW_MAPS)
+                        directional_light_indices.push_back(i);
+                    break;
+                }
+            }
+        }
+
+        std::vector<ShadowMapAllocator::Allocation> sphere_allocations;
+        std::vector<ShadowMapAllocator::Allocation> cone_allocations;
+        s_Data->sphere_shadow_maps.Allocate(sphere_requests, sphere_allocations);
+        s_Data->cone_shadow_maps.Allocate(cone_requests, cone_allocations);
+
+        // 2. Views of the lights given a layer, along with their cache entries.
+        // Entries are created here as the cache cannot be written to from jobs.
+        auto& shadow_view_cache = s_Data->shadow_view_cache;
+        std::pmr::vector<Util::CachedShadowView*> sphere_cache_entries(frame_resource);
+        std::pmr::vector<Util::CachedShadowView*> cone_cache_entries(frame_resource);
+
+        shadow_env.sphere_shadows.reserve(s_Data->sphere_shadow_maps.GetAllocatedCount());
+        for (size_t i = 0; i < sphere_light_indices.size(); ++i)
+        {
+            if (sphere_allocations[i].slot == ShadowMapAllocator::INVALID_SLOT)
+                continue;
+
+            const Util::SphereLightData& light = light_env.lights[sphere_light_indices[i]].sphere;
+
+            Util::SphereShadow& shadow = shadow_env.sphere_shadows.emplace_back(frame_resource);
+            shadow.light_index = sphere_light_indices[i];
+            shadow.position = glm::vec3(light.position);
+            shadow.radius = light.radius;
+            shadow.face_view_proj = Util::CalculateCubeFaceViewProjections(shadow.position, shadow.radius);
+            shadow.shadow_map_slot = sphere_allocations[i].slot;
+            shadow.needs_render = sphere_allocations[i].is_new;
+
+            Util::CachedShadowView& cache_entry = shadow_view_cache[sphere_requests[i].light_key];
+            cache_entry.last_snapshot = snapshot_index;
+            sphere_cache_entries.push_back(&cache_entry);
+        }
+
+        shadow_env.cone_shadows.reserve(s_Data->cone_shadow_maps.GetAllocatedCount());
+        for (size_t i = 0; i < cone_light_indices.size(); ++i)
+        {
+            if (cone_allocations[i].slot == ShadowMapAllocator::INVALID_SLOT)
+                continue;
+
+            const Util::ConeLightData& light = light_env.lights[cone_light_indices[i]].cone;
+
+            Util::ConeShadow& shadow = shadow_env.cone_shadows.emplace_back(frame_resource);
+            shadow.light_index = cone_light_indices[i];
+            shadow.position = glm::vec3(light.position);
+            shadow.direction = glm::vec3(light.direction);
+            shadow.view_proj = Util::CalculateConeViewProjection(shadow.position, shadow.direction, light.range, light.angle);
+            shadow.shadow_map_slot = cone_allocations[i].slot;
+            shadow.needs_render = cone_allocations[i].is_new;
+
+            Util::CachedShadowView& cache_entry = shadow_view_cache[cone_requests[i].light_key];
+            cache_entry.last_snapshot = snapshot_index;
+            cone_cache_entries.push_back(&cache_entry);
+        }
+
+        // Cascades are fitted to a perspective camera's frustum splits
+        for (size_t camera_index = 0; camera_index < cam_ctxs.size(); ++camera_index)
+        {
+            const CameraContext& context = cam_ctxs[camera_index];
+            if (context.is_orthographic)
+                continue;
+
+            for (uint32_t light_index : directional_light_indices)
+            {
+                const Util::DirectionalLightData& light = light_env.lights[light_index].directional;
+
+                Util::DirectionalShadow& shadow = shadow_env.directional_shadows.emplace_back(frame_resource);
+                shadow.light_index = light_index;
+                shadow.camera_index = static_cast<uint32_t>(camera_index);
+                shadow.direction = glm::vec3(light.direction);
+                shadow.position = glm::vec3(light.position);
+
+                std::array<float, Util::DIRECTIONAL_CASCADE_COUNT> split_depths = {};
+                auto cascade_matrices = Frustum::CalculateCascadeLightSpaceMatrices(glm::radians(context.fov), context.aspect_ratio, context.near_clip, context.far_clip, context.view_matrix, shadow.direction, split_depths);
+
+                for (uint32_t cascade = 0; cascade < Util::DIRECTIONAL_CASCADE_COUNT; ++cascade)
+                    shadow.cascades.push_back({ cascade_matrices[cascade], split_depths[cascade], cascade });
+            }
+        }
+
+        // 3. Casters of every view, one job each. A sphere or cone view whose
+        // light and casters match its cache entry copies the cached geometry
+        // and keeps the shadow map it rendered before.
+        size_t sphere_count = shadow_env.sphere_shadows.size();
+        size_t cone_count = shadow_env.cone_shadows.size();
+        size_t directional_count = shadow_env.directional_shadows.size();
+
+        // Every view of a light is queried in one walk of each scene's index,
+        // so a caster seen by several cube faces or cascades is found once
+        auto gather_cached_view = [&scene_manager](std::span<const Frustum> frusta, uint64_t light_hash, Util::CachedShadowView& cache_entry, GeometryEnvironment& out_geometry, auto depth_from_light)
+        {
+            std::vector<SpatialDataSource<Entity>> casters;
+            std::vector<SpatialIndex<Entity>::ViewMask> view_masks;
+            scene_manager->QueryFrustums(frusta, casters, view_masks);
+
+            bool has_skinned_casters = false;
+            uint64_t caster_hash = Util::GatherShadowCastersHelper(casters, view_masks, has_skinned_casters);
+
+            // Views with skinned casters are rendered every snapshot
+            bool cache_hit = !has_skinned_casters && cache_entry.is_valid && cache_entry.light_hash == light_hash && cache_entry.caster_hash == caster_hash;
+            if (!cache_hit)
+            {
+                Util::AddShadowCastersHelper(casters, s_Data->gpu_scene, cache_entry.geometry, depth_from_light);
+                cache_entry.light_hash = light_hash;
+                cache_entry.caster_hash = caster_hash;
+                cache_entry.is_valid = true;
+            }
+
+            out_geometry.Append(cache_entry.geometry);
+            return cache_hit;
+        };
+
+        Util::RunJobsHelper
+        (
+            "SnapshotScene - Gather Shadow Casters",
+            sphere_count + cone_count + directional_count,
+            [&](size_t view_index)
+            {
+                if (view_index < sphere_count)
+                {
+                    Util::SphereShadow& shadow = shadow_env.sphere_shadows[view_index];
+
+                    uint64_t light_hash = Util::HashCombine(Util::HashBytes(&shadow.position, sizeof(glm::vec3)), &shadow.radius, sizeof(float));
+
+                    std::array<Frustum, Util::CUBE_FACE_COUNT> frusta;
+                    for (size_t face = 0; face < frusta.size(); ++face)
+                        frusta[face] = Frustum(shadow.face_view_proj[face]);
+
+                    float inverse_radius = 1.0f / std::max(shadow.radius, Util::SHADOW_NEAR_PLANE);
+                    bool cache_hit = gather_cached_view(frusta, light_hash, *sphere_cache_entries[view_index], shadow.geometry, [&](const glm::vec3& caster_centre)
+                    {
+                        return glm::length(caster_centre - shadow.position) * inverse_radius;
+                    });
+
+                    shadow.needs_render |= !cache_hit;
+                    return;
+                }
+
+                if (view_index < sphere_count + cone_count)
+                {
+                    Util::ConeShadow& shadow = shadow_env.cone_shadows[view_index - sphere_count];
+                    const Util::ConeLightData& light = light_env.lights[shadow.light_index].cone;
+
+                    uint64_t light_hash = Util::HashBytes(&shadow.view_proj, sizeof(glm::mat4));
+
+                    float inverse_range = 1.0f / std::max(light.range, Util::SHADOW_NEAR_PLANE);
+                    const Frustum frustum(shadow.view_proj);
+                    bool cache_hit = gather_cached_view(std::span<const Frustum>(&frustum, 1), light_hash, *cone_cache_entries[view_index - sphere_count], shadow.geometry, [&](const glm::vec3& caster_centre)
+                    {
+                        return glm::dot(caster_centre - shadow.position, shadow.direction) * inverse_range;
+                    });
+
+                    shadow.needs_render |= !cache_hit;
+                    return;
+                }
+
+                // Directional cascades move with the camera, so they are not cached
+                Util::DirectionalShadow& shadow = shadow_env.directional_shadows[view_index - sphere_count - cone_count];
+
+                std::vector<Frustum> frusta;
+                frusta.reserve(shadow.cascades.size());
+                for (const Util::DirectionalCascade& cascade : shadow.cascades)
+                    frusta.emplace_back(cascade.view_proj);
+
+                std::vector<SpatialDataSource<Entity>> casters;
+                std::vector<SpatialIndex<Entity>::ViewMask> view_masks;
+                scene_manager->QueryFrustums(frusta, casters, view_masks);
+
+                bool has_skinned_casters = false;
+                Util::GatherShadowCastersHelper(casters, view_masks, has_skinned_casters);
+                Util::AddShadowCastersHelper(casters, s_Data->gpu_scene, shadow.geometry, [](const glm::vec3&) { return 0.0f; });
+            }
+        );
+
+        // 4. Views of lights which lost their layer, or no longer exist, are
+        // dropped from the cache
+        std::erase_if(shadow_view_cache, [snapshot_index](const auto& cache_entry)
+        {
+            return cache_entry.second.last_snapshot != snapshot_index;
+        });
+
+        ShadowStats frame_shadow_stats = {};
+        auto count_view = [&frame_shadow_stats](const GeometryEnvironment& geometry, bool needs_render)
+        {
+            frame_shadow_stats.view_count++;
+            frame_shadow_stats.rendered_view_count += needs_render ? 1 : 0;
+            frame_shadow_stats.caster_draw_count += static_cast<uint32_t>(geometry.DrawItems.size());
+        };
+
+        for (const auto& shadow : shadow_env.sphere_shadows)
+            count_view(shadow.geometry, shadow.needs_render);
+        for (const auto& shadow : shadow_env.cone_shadows)
+            count_view(shadow.geometry, shadow.needs_render);
+        for (const auto& shadow : shadow_env.directional_shadows)
+            count_view(shadow.geometry, true);
+
+        std::lock_guard<std::mutex> statistics_lock(s_Data->statistics_mutex);
+        s_Data->shadow_stats = frame_shadow_stats;
+    }
+
+    ShadowStats SceneRenderer::GetShadowStats()
+    {
+        if (!s_Data)
+            return {};
+
+        std::lock_guard<std::mutex> statistics_lock(s_Data->statistics_mutex);
+        return s_Data->shadow_stats;
+    }
+
+    void SceneRenderer::SetLightBudget(const LightBudget& budget)
+    {
+        if (!s_Data)
+            return;
+
+        std::lock_guard<std::mutex> light_budget_lock(s_Data->light_budget_mutex);
+        s_Data->light_budget.max_sphere_lights = std::min(budget.max_sphere_lights, Util::MAX_SPHERE_LIGHT);
+        s_Data->light_budget.max_cone_lights = std::min(budget.max_cone_lights, Util::MAX_CONE_LIGHT);
+        s_Data->light_budget.max_directional_lights = std::min(budget.max_directional_lights, Util::MAX_DIRECTIONAL_LIGHT);
+    }
+
+    LightBudget SceneRenderer::GetLightBudget()
+    {
+        if (!s_Data)
+            return {};
+
+        std::lock_guard<std::mutex> light_budget_lock(s_Data->light_budget_mutex);
+        return s_Data->light_budget;
+    }
+
+    DrawCallStats SceneRenderer::GetDrawCallStats()
+    {
+        if (!s_Data)
+            return {};
+
+        std::lock_guard<std::mutex> statistics_lock(s_Data->statistics_mutex);
+        return s_Data->draw_call_stats;
+    }
+
+    GPUSceneStats SceneRenderer::GetGPUSceneStats()
+    {
+        if (!s_Data)
+            return {};
+
+        std::lock_guard<std::mutex> statistics_lock(s_Data->statistics_mutex);
+        return s_Data->gpu_scene_stats;
+    }
+
+    LODStats SceneRenderer::GetLODStats()
+    {
+        if (!s_Data)
+            return {};
+
+        std::lock_guard<std::mutex> statistics_lock(s_Data->statistics_mutex);
+        return s_Data->lod_stats;
+    }
+
+    void SceneRenderer::SetOcclusionCullingEnabled(bool enabled)
+    {
+        if (s_Data)
+            s_Data->occlusion_culling_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool SceneRenderer::IsOcclusionCullingEnabled()
+    {
+        return s_Data ? s_Data->occlusion_culling_enabled.load(std::memory_order_relaxed) : false;
+    }
+
+    OcclusionCullingStats SceneRenderer::GetOcclusionStats()
+    {
+        if (!s_Data)
+            return {};
+
+        std::lock_guard<std::mutex> statistics_lock(s_Data->statistics_mutex);
+        return s_Data->occlusion_stats;
+    }
+
+    void SceneRenderer::SetOcclusionDebugView(bool enabled)
+    {
+        if (!s_Data)
+            return;
+
+        s_Data->occlusion_debug_view.store(enabled, std::memory_order_relaxed);
+        if (!enabled)
+        {
+            std::lock_guard<std::mutex> statistics_lock(s_Data->statistics_mutex);
+            s_Data->occlusion_debug_image.clear();
+            s_Data->occlusion_debug_size = { 0, 0 };
+        }
+    }
+
+    bool SceneRenderer::GetOcclusionDebugImage(std::vector<uint8_t>& out_pixels, glm::uvec2& out_size)
+    {
+        if (!s_Data)
+            return false;
+
+        std::lock_guard<std::mutex> statistics_lock(s_Data->statistics_mutex);
+        if (s_Data->occlusion_debug_image.empty())
+            return false;
+
+        out_pixels = s_Data->occlusion_debug_image;
+        out_size = s_Data->occlusion_debug_size;
+        return true;
+    }
+
+    void SceneRenderer::SetScenePipelines(const ScenePipelines& pipelines)
+    {
+        if (!s_Data)
+            return;
+
+        std::lock_guard<std::mutex> pipelines_lock(s_Data->pipelines_mutex);
+        s_Data->pipelines = pipelines;
+    }
+
+    ScenePipelines SceneRenderer::GetScenePipelines()
+    {
+        if (!s_Data)
+            return {};
+
+        std::lock_guard<std::mutex> pipelines_lock(s_Data->pipelines_mutex);
+        return s_Data->pipelines;
+    }
+
+    void SceneRenderer::RecordCommandBuffers(uint32_t frame_index)
+    {
+        BC_PROFILE_SCOPE("SceneRenderer::RecordCommandBuffers");
+
+        auto vulkan_core = Application::GetVulkanCore();
+        auto& frame = s_Data->frames_in_flight[frame_index];
+
+        // The slot's pools are reset wholesale, once the GPU is done with the
+        // command buffers last submitted from them
+        VkResult result = vkWaitForFences(vulkan_core->GetLogicalDevice(), 1, &frame.render_fence, VK_TRUE, UINT64_MAX);
+        if (result != VK_SUCCESS)
+        {
+            BC_CORE_ERROR("SceneRenderer::RecordCommandBuffers: Could Not Wait For Render Fence.");
+            return;
+        }
+
+        vulkan_core->ResetFrameCommandPools(frame_index);
+        frame.primary_command_buffer = VK_NULL_HANDLE;
+
+        if (frame.camera_environments.empty())
+            return;
+
+        const ScenePipelines pipelines = GetScenePipelines();
+
+        // Cameras are executed back most first. Render targets are resolved
+        // here, so a target destroyed since the snapshot only skips its camera.
+        struct CameraRecording
+        {
+            CameraEnvironment* cam_env = nullptr;
+            std::shared_ptr<RenderTarget> render_target;
+        };
+
+        std::vector<CameraRecording> cameras;
+        cameras.reserve(frame.camera_environments.size());
+        for (auto& [camera_guid, cam_env] : frame.camera_environments)
+        {
+            cam_env.secondary_command_buffers = {};
+
+            auto render_target_asset = AssetManager::GetAsset<RenderTarget>(cam_env.camera_ctx.render_target);
+            if (!render_target_asset || !render_target_asset->IsValid())
+                continue;
+
+            cameras.push_back({ &cam_env, std::move(render_target_asset) });
+        }
+
+        std::stable_sort(cameras.begin(), cameras.end(), [](const CameraRecording& a, const CameraRecording& b)
+        {
+            return a.cam_env->camera_ctx.composite_depth < b.cam_env->camera_ctx.composite_depth;
+        });
+
+        // 1. Secondary command buffers, one job per camera and pass. Each job
+        // records from the pool of the thread it runs on. Passes begin their
+        // own rendering, so the buffers inherit no render pass.
+        constexpr size_t PASS_COUNT = 3;
+
+        VkCommandBufferInheritanceInfo inheritance_info{};
+        inheritance_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+
+        VkCommandBufferBeginInfo secondary_begin_info{};
+        secondary_begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        secondary_begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        secondary_begin_info.pInheritanceInfo = &inheritance_info;
+
+        std::atomic<bool> recording_failed = false;
+
+        Util::RunJobsHelper
+        (
+            "RecordCommandBuffers - Record Passes",
+            cameras.size() * PASS_COUNT,
+            [&](size_t job_index)
+            {
+                const CameraRecording& camera = cameras[job_index / PASS_COUNT];
+                const size_t pass_index = job_index % PASS_COUNT;
+
+                // Without depth there is nothing to prepass or cull against
+                const bool has_depth = camera.render_target->GetDepthAttachmentImage() != VK_NULL_HANDLE;
+                if (pass_index != 2 && !has_depth)
+                    return;
+
+                VkCommandBuffer cmd = vulkan_core->AcquireFrameCommandBuffer(frame_index, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+                if (cmd == VK_NULL_HANDLE || vkBeginCommandBuffer(cmd, &secondary_begin_info) != VK_SUCCESS)
+                {
+                    recording_failed = true;
+                    return;
+                }
+
+                auto& secondary_command_buffers = camera.cam_env->secondary_command_buffers;
+                switch (pass_index)
+                {
+                    case 0: RecordDepthPrepass(*camera.cam_env, *camera.render_target, pipelines, cmd);      secondary_command_buffers.depth_prepass_cmd = cmd;      break;
+                    case 1: RecordComputeCulling(*camera.cam_env, *camera.render_target, pipelines, cmd);    secondary_command_buffers.compute_culling_cmd = cmd;    break;
+                    case 2: RecordColourPass(*camera.cam_env, *camera.render_target, pipelines, cmd);        secondary_command_buffers.colour_pass_cmd = cmd;        break;
+                }
+
+                if (vkEndCommandBuffer(cmd) != VK_SUCCESS)
+                    recording_failed = true;
+            }
+        );
+
+        if (recording_failed)
+        {
+            BC_CORE_ERROR("SceneRenderer::RecordCommandBuffers: Failed to Record Secondary Command Buffers.");
+            s_Data->gpu_scene.DiscardUpload();
+            return;
+        }
+
+        // 2. Primary command buffer, uploading the snapshot's changes to the
+        // GPU scene then executing every camera's passes in order
+        VkCommandBuffer primary_cmd = vulkan_core->AcquireFrameCommandBuffer(frame_index, VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+
+        VkCommandBufferBeginInfo primary_begin_info{};
+        primary_begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        primary_begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        result = vkBeginCommandBuffer(primary_cmd, &primary_begin_info);
+        if (result != VK_SUCCESS)
+        {
+            BC_CORE_ERROR("SceneRenderer::RecordCommandBuffers: Could Not Begin Primary Command Buffer.");
+            s_Data->gpu_scene.DiscardUpload();
+            return;
+        }
+
+        s_Data->gpu_scene.RecordUpload(primary_cmd, frame_index, static_cast<uint32_t>(s_Data->frames_in_flight.size()), frame.gpu_scene_upload);
+
+        for (const CameraRecording& camera : cameras)
+        {
+            const auto& secondary_command_buffers = camera.cam_env->secondary_command_buffers;
+            const VkCommandBuffer pass_cmds[PASS_COUNT] =
+            {
+                secondary_command_buffers.depth_prepass_cmd,
+                secondary_command_buffers.compute_culling_cmd,
+                secondary_command_buffers.colour_pass_cmd
+            };
+
+            std::array<VkCommandBuffer, PASS_COUNT> camera_cmds = {};
+            uint32_t camera_cmd_count = 0;
+            for (VkCommandBuffer pass_cmd : pass_cmds)
+            {
+                if (pass_cmd != VK_NULL_HANDLE)
+                    camera_cmds[camera_cmd_count++] = pass_cmd;
+            }
+
+            if (camera_cmd_count > 0)
+                vkCmdExecuteCommands(primary_cmd, camera_cmd_count, camera_cmds.data());
+        }
+
+        result = vkEndCommandBuffer(primary_cmd);
+        if (result != VK_SUCCESS)
+        {
+            BC_CORE_ERROR("SceneRenderer::RecordCommandBuffers: Could Not End Primary Command Buffer.");
+            s_Data->gpu_scene.DiscardUpload();
+            return;
+        }
+
+        frame.primary_command_buffer = primary_cmd;
+    }
+
+    void SceneRenderer::RecordDepthPrepass(const CameraEnvironment& camera_env, const RenderTarget& render_target, const ScenePipelines& pipelines, VkCommandBuffer cmd)
+    {
+        const bool multisampled = render_target.IsMultiSampled();
+        const VkImageAspectFlags depth_aspect = VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+
+        // Last frame's depth is cleared, so its contents need not be kept
+        Util::TransitionImageHelper(cmd, render_target.GetDepthAttachmentImage(multisampled), depth_aspect,
+            VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+            VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT, 0,
+            VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+            VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT);
+
+        VkRenderingAttachmentInfo depth_attachment{};
+        depth_attachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO;
+        depth_attachment.imageView = render_target.GetDepthAttachmentView(multisampled);
+        depth_attachment.imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+        depth_attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        depth_attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        depth_attachment.clearValue.depthStencil = { 1.0f, 0 };
+
+        VkRenderingInfo rendering_info{};
+        rendering_info.sType = VK_STRUCTURE_TYPE_RENDERING_INFO;
+        rendering_info.renderArea = { { 0, 0 }, render_target.GetExtent() };
+        rendering_info.layerCount = 1;
+        rendering_info.pDepthAttachment = &depth_attachment;
+        rendering_info.pStencilAttachment = &depth_attachment;
+
+        vkCmdBeginRendering(cmd, &rendering_info);
+        Util::SetViewportAndScissorHelper(cmd, render_target.GetExtent());
+
+        if (pipelines.scene_descriptor_set != VK_NULL_HANDLE)
+            vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelines.layout, 0, 1, &pipelines.scene_descriptor_set, 0, nullptr);
+
+        // Only fully opaque geometry writes depth ahead of the colour pass,
+        // mixed geometry depends on its alpha
+        Util::RecordInstanceBatchesHelper(cmd, camera_env, Util::DrawPass_Opaque, pipelines.depth_prepass, pipelines.layout);
+
+        vkCmdEndRendering(cmd);
+    }
+
+    void SceneRenderer::RecordComputeCulling(const CameraEnvironment& camera_env, const RenderTarget& render_target, const ScenePipelines& pipelines, VkCommandBuffer cmd)
+    {
+        // Depth is read only from here on, by the culling dispatch and by the
+        // colour pass's depth test
+        Util::TransitionImageHelper(cmd, render_target.GetDepthAttachmentImage(render_target.IsMultiSampled()), VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT,
+            VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL,
+            VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT, VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+            VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT);
+
+        if (pipelines.light_culling == VK_NULL_HANDLE || camera_env.light_clusters.light_indices.empty())
+            return;
+
+        vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, pipelines.light_culling);
+        if (pipelines.scene_descriptor_set != VK_NULL_HANDLE)
+            vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, pipelines.layout, 0, 1, &pipelines.scene_descriptor_set, 0, nullptr);
+
+        // Trims each tile's CPU binned clusters to the depth range it covers
+        vkCmdDispatch(cmd, LightClusterGrid::TILE_COUNT_X, LightClusterGrid::TILE_COUNT_Y, 1);
+
+        VkMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+    }
+
+    void SceneRenderer::RecordColourPass(const CameraEnvironment& camera_env, const RenderTarget& render_target, const ScenePipelines& pipelines, VkCommandBuffer cmd)
+    {
+        const bool multisampled = render_target.IsMultiSampled();
+        const uint32_t colour_count = static_cast<uint32_t>(render_target.GetAttachments().size());
+
+        std::vector<VkRenderingAttachmentInfo> colour_attachments(colour_count);
+        for (uint32_t i = 0; i < colour_count; ++i)
+        {
+            const bool integer_format = render_target.GetAttachments()[i].specification.attachment_format == RenderTargetAttachmentFormat::RED_INTEGER;
+
+            Util::TransitionImageHelper(cmd, render_target.GetColourAttachmentImage(i), VK_IMAGE_ASPECT_COLOR_BIT,
+                VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+                VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT);
+
+            auto& colour_attachment = colour_attachments[i];
+            colour_attachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO;
+            colour_attachment.imageView = render_target.GetColourAttachmentView(i, multisampled);
+            colour_attachment.imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+            colour_attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+            colour_attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+
+            // Multisampled colour only lives until it is resolved, integer
+            // attachments such as entity IDs cannot be averaged
+            if (multisampled)
+            {
+                Util::TransitionImageHelper(cmd, render_target.GetColourAttachmentImage(i, true), VK_IMAGE_ASPECT_COLOR_BIT,
+                    VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                    VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, 0,
+                    VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT);
+
+                colour_attachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                colour_attachment.resolveMode = integer_format ? VK_RESOLVE_MODE_SAMPLE_ZERO_BIT : VK_RESOLVE_MODE_AVERAGE_BIT;
+                colour_attachment.resolveImageView = render_target.GetColourAttachmentView(i);
+                colour_attachment.resolveImageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+            }
+        }
+
+        VkRenderingAttachmentInfo depth_attachment{};
+        depth_attachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO;
+        depth_attachment.imageView = render_target.GetDepthAttachmentView(multisampled);
+        depth_attachment.imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
+        depth_attachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+        depth_attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+
+        const bool has_depth = depth_attachment.imageView != VK_NULL_HANDLE;
+
+        VkRenderingInfo rendering_info{};
+        rendering_info.sType = VK_STRUCTURE_TYPE_RENDERING_INFO;
+        rendering_info.renderArea = { { 0, 0 }, render_target.GetExtent() };
+        rendering_info.layerCount = 1;
+        rendering_info.colorAttachmentCount = colour_count;
+        rendering_info.pColorAttachments = colour_attachments.data();
+        rendering_info.pDepthAttachment = has_depth ? &depth_attachment : nullptr;
+        rendering_info.pStencilAttachment = has_depth ? &depth_attachment : nullptr;
+
+        vkCmdBeginRendering(cmd, &rendering_info);
+        Util::SetViewportAndScissorHelper(cmd, render_target.GetExtent());
+
+        if (pipelines.scene_descriptor_set != VK_NULL_HANDLE)
+            vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelines.layout, 0, 1, &pipelines.scene_descriptor_set, 0, nullptr);
+
+        for (Util::DrawPass pass = Util::DrawPass_Opaque; pass < Util::DrawPass_Count; ++pass)
+            Util::RecordInstanceBatchesHelper(cmd, camera_env, pass, pipelines.colour_pass[pass], pipelines.layout);
+
+        vkCmdEndRendering(cmd);
+
+        // Sampled by the editor's viewports and the final composite
+        for (uint32_t i = 0; i < colour_count; ++i)
+        {
+            Util::TransitionImageHelper(cmd, render_target.GetColourAttachmentImage(i), VK_IMAGE_ASPECT_COLOR_BIT,
+                VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT);
+        }
+    }
 
     void SceneRenderer::SubmitCommandBuffers(uint32_t frame_index)
     {
+        BC_PROFILE_SCOPE("SceneRenderer::SubmitCommandBuffers");
+
+        auto& frame = s_Data->frames_in_flight[frame_index];
+        if (frame.primary_command_buffer == VK_NULL_HANDLE)
+            return;
+
+        auto vulkan_core = Application::GetVulkanCore();
+
+        VkResult result = vkResetFences(vulkan_core->GetLogicalDevice(), 1, &frame.render_fence);
+        BC_THROW(result == VK_SUCCESS, "SceneRenderer::SubmitCommandBuffers: Could Not Reset Render Fence.");
+
+        VkSubmitInfo submit_info{};
+        submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &frame.primary_command_buffer;
+
+        result = vulkan_core->SubmitGraphicsQueue(submit_info, frame.render_fence);
+        BC_THROW(result == VK_SUCCESS, "SceneRenderer::SubmitCommandBuffers: Could Not Submit Command Buffer.");
+
+        frame.primary_command_buffer = VK_NULL_HANDLE;
     }
 }
@@ -4,16 +4,106 @@
 #include "CameraContext.h"
 
 #include "GeometryEnvironment.h"
+#include "GPUScene.h"
 #include "LightEnvironment.h"
 #include "ShadowEnvironment.h"
+#include "ShadowMapAllocator.h"
+#include "FrameArena.h"
+
+#include "Project/Scene/Entity.h"
 
 // C++ Standard Library Headers
+#include <array>
+#include <atomic>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <unordered_map>
 
 // External Vendor Library Headers
+#include <vulkan/vulkan.h>
 
 namespace BC
 {
 
+    class RenderTarget;
+
+    struct DrawCallStats
+    {
+        // Sub mesh draws gathered, and the instanced draws they were batched into
+        uint32_t draw_item_count        = 0;
+        uint32_t instanced_draw_count   = 0;
+    };
+
+    struct LODStats
+    {
+        // Sub mesh draws and triangles of LODMeshComponent meshes per level,
+        // summed over every camera
+        std::array<uint32_t, LODMeshComponent::MAX_LOD_COUNT> draw_count = {};
+        std::array<uint32_t, LODMeshComponent::MAX_LOD_COUNT> triangle_count = {};
+
+        // Meshes too small to draw at any level, and meshes drawn at two
+        // levels while cross fading
+        uint32_t culled_count           = 0;
+        uint32_t cross_fade_count       = 0;
+
+        LODStats& operator+=(const LODStats& other)
+        {
+            for (size_t i = 0; i < draw_count.size(); ++i)
+            {
+                draw_count[i] += other.draw_count[i];
+                triangle_count[i] += other.triangle_count[i];
+            }
+            culled_count += other.culled_count;
+            cross_fade_count += other.cross_fade_count;
+            return *this;
+        }
+    };
+
+    struct ShadowStats
+    {
+        // Shadow views of the snapshot, and how many of them could not reuse
+        // the shadow map rendered for them in an earlier frame
+        uint32_t view_count             = 0;
+        uint32_t rendered_view_count    = 0;
+        uint32_t caster_draw_count      = 0;
+    };
+
+    /// @brief Most lights of each type kept by a snapshot, at most the
+    /// Util::MAX_* limits. Past these the visible lights with the least
+    /// intensity and screen coverage are dropped.
+    struct LightBudget
+    {
+        uint32_t max_sphere_lights      = Util::MAX_SPHERE_LIGHT;
+        uint32_t max_cone_lights        = Util::MAX_CONE_LIGHT;
+        uint32_t max_directional_lights = Util::MAX_DIRECTIONAL_LIGHT;
+    };
+
+    /// @brief Pipelines the scene's passes bind, created and owned by
+    /// whoever builds the scene's shaders. A pass whose pipeline is null still
+    /// clears and transitions its attachments, but draws nothing.
+    struct ScenePipelines
+    {
+        // Shared by every pipeline below. Skinned batches push their
+        // bone_buffer_offset as a uint32_t to the vertex stage.
+        VkPipelineLayout layout = VK_NULL_HANDLE;
+
+        // Set 0 of the layout, holding the GPU scene, instance buffer and
+        // light cluster bindings
+        VkDescriptorSet scene_descriptor_set = VK_NULL_HANDLE;
+
+        // Vertices are pulled from the GPU scene by vertex and instance index,
+        // so no vertex or index buffers are bound
+        VkPipeline depth_prepass = VK_NULL_HANDLE;
+
+        // Indexed by Util::DrawPass. Tests against the prepass depth, which is
+        // read only by then.
+        std::array<VkPipeline, Util::DrawPass_Count> colour_pass = {};
+
+        // Dispatched once per cluster tile against the camera's depth
+        VkPipeline light_culling = VK_NULL_HANDLE;
+    };
+
     class SceneRenderer
     {
 
@@ -29,15 +119,61 @@ namespace BC
 
         struct SceneSnapshot
         {
-            // CommmandBuffer primary_command_buffer;
+            // Backs every environment below, rewound by Recycle. Held by
+            // pointer so the containers' resource survives the snapshot moving.
+            std::unique_ptr<FrameArena> arena;
+
+            // Executes every camera's secondary command buffers, set once
+            // recorded and cleared once submitted
+            VkCommandBuffer primary_command_buffer = VK_NULL_HANDLE;
+
+            // Signalled once the GPU has finished this frame slot's last
+            // submit, so its command pools can be reset
+            VkFence render_fence = VK_NULL_HANDLE;
 
             // Key == Camera GUID
             // Value == Camera Environment
             // Edge Case: if Key == PlaceHolderGUID::PLACEHOLDER_0_GUID == EditorCamera
-            std::unordered_map<GUID, CameraEnvironment> camera_environments;
+            std::pmr::unordered_map<GUID, CameraEnvironment> camera_environments;
 
             LightEnvironment light_environment;
             ShadowEnvironment shadow_environment;
+
+            // GPU scene indices of every camera's instanced draws, uploaded as
+            // one buffer
+            std::pmr::vector<Util::InstanceData> instance_buffer;
+
+            // GPU scene slots changed by this snapshot, copied by its primary
+            // command buffer before any pass
+            GPUSceneUpload gpu_scene_upload;
+
+            SceneSnapshot() :
+                arena(std::make_unique<FrameArena>()),
+                camera_environments(arena.get()),
+                light_environment(arena.get()),
+                shadow_environment(arena.get()),
+                instance_buffer(arena.get()),
+                gpu_scene_upload(arena.get()) {}
+
+            /// @brief Destroys the environments of the last snapshot taken in
+            /// this frame slot and rewinds the arena for the next
+            void Recycle();
+
+            // Scratch of the geometry gather jobs, outside the arena and kept
+            // between snapshots of this frame so their buffers are reused
+            struct GeometryGatherChunk
+            {
+                size_t camera_index = 0;
+                size_t candidate_begin = 0;
+                size_t candidate_end = 0;
+
+                GeometryEnvironment geometry_environment;
+                OcclusionCullingStats occlusion_stats;
+                LODStats lod_stats;
+            };
+
+            std::vector<std::vector<SpatialDataSource<Entity>>> camera_candidates;
+            std::vector<GeometryGatherChunk> geometry_chunks;
         };
 
         struct SceneRenderData
@@ -51,10 +187,45 @@ namespace BC
             AssetHandle sphere_shadow_map_array; 
             AssetHandle cone_shadow_map_array;
             AssetHandle directional_shadow_map_array;
+
+            std::mutex light_budget_mutex;
+            LightBudget light_budget = {};
+
+            std::mutex pipelines_mutex;
+            ScenePipelines pipelines = {};
+
+            // Shadows. Layers and cached views outlive the snapshots, so that
+            // an unchanged view keeps its shadow map between frames. Only
+            // touched by SnapshotScene.
+            ShadowMapAllocator sphere_shadow_maps = ShadowMapAllocator(Util::MAX_SPHERE_SHADOW_MAPS);
+            ShadowMapAllocator cone_shadow_maps = ShadowMapAllocator(Util::MAX_CONE_SHADOW_MAPS);
+            std::unordered_map<uint64_t, Util::CachedShadowView> shadow_view_cache;
+            uint64_t shadow_snapshot_count = 0;
+
+            // Object, light and material data kept on the GPU between frames
+            GPUScene gpu_scene;
+
+            // Occlusion Culling
+            std::atomic<bool> occlusion_culling_enabled = true;
+            std::atomic<bool> occlusion_debug_view = false;
+
+            // Written by SnapshotScene, read by the editor's statistics
+            std::mutex statistics_mutex;
+            DrawCallStats draw_call_stats = {};
+            LODStats lod_stats = {};
+            GPUSceneStats gpu_scene_stats = {};
+            ShadowStats shadow_stats = {};
+            OcclusionCullingStats occlusion_stats = {};
+            std::vector<uint8_t> occlusion_debug_image = {};
+            glm::uvec2 occlusion_debug_size = { 0, 0 };
         };
 
         static SceneRenderData* s_Data;
 
+        /// @brief Builds the shadow views of the snapshot's lights and gathers
+        /// their casters, once the light environment is complete
+        static void GatherShadowViews(SceneSnapshot& frame, const std::vector<CameraContext>& cam_ctxs);
+
     public:
 
         static void Init();
@@ -62,16 +233,55 @@ namespace BC
 
         static void SnapshotScene(uint32_t frame_index, const std::vector<CameraContext>& camera_overrides);
 
+        /// @brief Records every camera's passes of a snapshot as secondary
+        /// command buffers, one job per camera and pass, then the primary
+        /// command buffer uploading the GPU scene and executing them back most
+        /// camera first. Waits for the GPU to finish the frame slot's previous
+        /// submit first, then resets the slot's command pools.
         static void RecordCommandBuffers    (uint32_t frame_index);
-        static void RecordShadowPass        (CameraEnvironment& camera_env);
-        static void RecordDepthPrepass      (CameraEnvironment& camera_env);
-        static void RecordComputeCulling    (CameraEnvironment& camera_env);
-        static void RecordColourPass        (CameraEnvironment& camera_env);
+        static void RecordDepthPrepass      (const CameraEnvironment& camera_env, const RenderTarget& render_target, const ScenePipelines& pipelines, VkCommandBuffer cmd);
+        static void RecordComputeCulling    (const CameraEnvironment& camera_env, const RenderTarget& render_target, const ScenePipelines& pipelines, VkCommandBuffer cmd);
+        static void RecordColourPass        (const CameraEnvironment& camera_env, const RenderTarget& render_target, const ScenePipelines& pipelines, VkCommandBuffer cmd);
 
         static void ResizeScreenSpace(uint32_t width, uint32_t height);
         static const glm::uvec2& GetScreenSpace();
 
+        /// @brief Takes effect from the next snapshot, each limit is clamped
+        /// to its Util::MAX_* constant
+        static void SetLightBudget(const LightBudget& budget);
+        static LightBudget GetLightBudget();
+
+        /// @brief Takes effect from the next recorded frame. The pipelines
+        /// must outlive every frame recorded with them.
+        static void SetScenePipelines(const ScenePipelines& pipelines);
+        static ScenePipelines GetScenePipelines();
+
+        /// @brief Draw totals of every camera in the last snapshot
+        static DrawCallStats GetDrawCallStats();
+
+        /// @brief Level of detail totals of every camera in the last snapshot
+        static LODStats GetLODStats();
+
+        /// @brief Elements and bytes the last snapshot uploaded to the GPU scene
+        static GPUSceneStats GetGPUSceneStats();
+
+        /// @brief Shadow view totals of the last snapshot
+        static ShadowStats GetShadowStats();
+
+        static void SetOcclusionCullingEnabled(bool enabled);
+        static bool IsOcclusionCullingEnabled();
+
+        /// @brief Occlusion culling totals of every camera in the last snapshot
+        static OcclusionCullingStats GetOcclusionStats();
+
+        /// @brief While enabled each snapshot keeps a greyscale copy of the
+        /// first camera's occlusion buffer, see OcclusionBuffer::WriteDebugImage
+        static void SetOcclusionDebugView(bool enabled);
+        static bool GetOcclusionDebugImage(std::vector<uint8_t>& out_pixels, glm::uvec2& out_size);
+
 
+        /// @brief Submits the primary command buffer last recorded for a frame
+        /// slot, if any, to the graphics queue
         static void SubmitCommandBuffers(uint32_t frame_index);
     };
 
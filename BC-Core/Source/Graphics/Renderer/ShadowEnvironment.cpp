@@ -0,0 +1,44 @@
+#include "BC_PCH.h"
+#include "ShadowEnvironment.h"
+
+namespace BC
+{
+
+    namespace Util
+    {
+        std::array<glm::mat4, CUBE_FACE_COUNT> CalculateCubeFaceViewProjections(const glm::vec3& position, float radius)
+        {
+            static const std::array<glm::vec3, CUBE_FACE_COUNT> face_directions =
+            {
+                glm::vec3( 1.0f,  0.0f,  0.0f), glm::vec3(-1.0f,  0.0f,  0.0f),
+                glm::vec3( 0.0f,  1.0f,  0.0f), glm::vec3( 0.0f, -1.0f,  0.0f),
+                glm::vec3( 0.0f,  0.0f,  1.0f), glm::vec3( 0.0f,  0.0f, -1.0f)
+            };
+
+            static const std::array<glm::vec3, CUBE_FACE_COUNT> face_ups =
+            {
+                glm::vec3( 0.0f, -1.0f,  0.0f), glm::vec3( 0.0f, -1.0f,  0.0f),
+                glm::vec3( 0.0f,  0.0f,  1.0f), glm::vec3( 0.0f,  0.0f, -1.0f),
+                glm::vec3( 0.0f, -1.0f,  0.0f), glm::vec3( 0.0f, -1.0f,  0.0f)
+            };
+
+            glm::mat4 projection = glm::perspective(glm::radians(90.0f), 1.0f, SHADOW_NEAR_PLANE, std::max(radius, SHADOW_NEAR_PLANE * 2.0f));
+
+            std::array<glm::mat4, CUBE_FACE_COUNT> face_view_proj;
+            for (uint32_t face = 0; face < CUBE_FACE_COUNT; ++face)
+                face_view_proj[face] = projection * glm::lookAt(position, position + face_directions[face], face_ups[face]);
+
+            return face_view_proj;
+        }
+
+        glm::mat4 CalculateConeViewProjection(const glm::vec3& position, const glm::vec3& direction, float range, float angle)
+        {
+            // Any up vector works as long as it is not along the cone
+            glm::vec3 up = std::abs(direction.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+
+            glm::mat4 projection = glm::perspective(glm::radians(std::clamp(angle, 1.0f, 179.0f)), 1.0f, SHADOW_NEAR_PLANE, std::max(range, SHADOW_NEAR_PLANE * 2.0f));
+            return projection * glm::lookAt(position, position + direction, up);
+        }
+    }
+
+}
@@ -8,6 +8,8 @@
 #include "Project/Scene/Components/LightComponents.h"
 
 // C++ Standard Library Headers
+#include <array>
+#include <memory_resource>
 #include <vector>
 #include <unordered_map>
 
@@ -22,16 +24,31 @@ namespace BC
         constexpr uint8_t MAX_CONE_SHADOW_MAPS      = 32;
         constexpr uint8_t MAX_DIRECTIONAL_SHADOW_MAPS      = 32;
 
+        constexpr uint32_t CUBE_FACE_COUNT = 6;
+        constexpr uint32_t DIRECTIONAL_CASCADE_COUNT = 5;
+
+        /// @brief Near plane of the sphere and cone shadow projections
+        constexpr float SHADOW_NEAR_PLANE = 0.05f;
+
         struct SphereShadow
         {
             uint32_t light_index; // Index into LightEnvironment
             glm::vec3 position;
+            float radius;
+
+            // +X, -X, +Y, -Y, +Z, -Z, matching the layer order of a cube map
+            std::array<glm::mat4, CUBE_FACE_COUNT> face_view_proj;
 
             // Geometry that casts shadows for this light
             GeometryEnvironment geometry;
 
-            // Face index 0–5 will be iterated over when rendering
-            // Render target is pulled from global scene-wide cube shadow map
+            // Cube of the global scene-wide cube shadow map array. The cube
+            // is only rendered again if needs_render, otherwise it still holds
+            // this exact view from an earlier frame.
+            uint32_t shadow_map_slot;
+            bool needs_render;
+
+            explicit SphereShadow(std::pmr::memory_resource* resource) : geometry(resource) {}
         };
 
         struct ConeShadow
@@ -43,7 +60,11 @@ namespace BC
 
             GeometryEnvironment geometry;
 
-            // Render target is a slice in global 2D array shadow map
+            // Slice of the global 2D array shadow map, see SphereShadow
+            uint32_t shadow_map_slot;
+            bool needs_render;
+
+            explicit ConeShadow(std::pmr::memory_resource* resource) : geometry(resource) {}
         };
 
         struct DirectionalCascade
@@ -51,25 +72,57 @@ namespace BC
             glm::mat4 view_proj;
             float split_depth;
             uint32_t cascade_index;
-            AssetHandle shadow_map_handle; // Layered 2D array, local to CameraEnvironment
+            AssetHandle shadow_map_handle = NULL_GUID; // Layered 2D array, local to CameraEnvironment
         };
 
+        /// @brief Cascades follow the camera, so a directional light has a
+        /// shadow per camera which is rendered every frame
         struct DirectionalShadow
         {
             uint32_t light_index;
+            uint32_t camera_index;
             glm::vec3 direction;
             glm::vec3 position;
 
             GeometryEnvironment geometry;
 
-            std::vector<DirectionalCascade> cascades;
+            std::pmr::vector<DirectionalCascade> cascades;
+
+            explicit DirectionalShadow(std::pmr::memory_resource* resource) : geometry(resource), cascades(resource) {}
+        };
+
+        /// @brief The sorted casters of a sphere or cone light's shadow, kept
+        /// between snapshots. Reused while neither the light nor any caster
+        /// within its volume has changed.
+        struct CachedShadowView
+        {
+            uint64_t light_hash = 0;
+            uint64_t caster_hash = 0;
+
+            // Not part of any frame, so it uses the default resource
+            GeometryEnvironment geometry;
+
+            uint64_t last_snapshot = 0;
+            bool is_valid = false;
         };
+
+        /// @brief View projection of each face of a sphere light's cube map
+        std::array<glm::mat4, CUBE_FACE_COUNT> CalculateCubeFaceViewProjections(const glm::vec3& position, float radius);
+
+        /// @brief Perspective view projection covering a cone light, angle is
+        /// the full cone angle in degrees
+        glm::mat4 CalculateConeViewProjection(const glm::vec3& position, const glm::vec3& direction, float range, float angle);
     }
 
     struct ShadowEnvironment
     {
-        std::vector<Util::SphereShadow> sphere_shadows;
-        std::vector<Util::ConeShadow> cone_shadows;
-        std::vector<Util::DirectionalShadow> directional_shadows;
+        // Shadows are emplaced with the environment's resource so their
+        // geometry shares it, e.g., sphere_shadows.emplace_back(resource)
+        std::pmr::vector<Util::SphereShadow> sphere_shadows;
+        std::pmr::vector<Util::ConeShadow> cone_shadows;
+        std::pmr::vector<Util::DirectionalShadow> directional_shadows;
+
+        explicit ShadowEnvironment(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) :
+            sphere_shadows(resource), cone_shadows(resource), directional_shadows(resource) {}
     };
 }
@@ -0,0 +1,58 @@
+#include "BC_PCH.h"
+#include "ShadowMapAllocator.h"
+
+namespace BC
+{
+
+    void ShadowMapAllocator::Allocate(std::span<const Request> requests, std::vector<Allocation>& out_allocations)
+    {
+        out_allocations.assign(requests.size(), {});
+
+        // 1. The most important requests win, ties going to the earlier one
+        m_Order.resize(requests.size());
+        for (uint32_t i = 0; i < m_Order.size(); ++i)
+            m_Order[i] = i;
+
+        size_t winner_count = std::min<size_t>(requests.size(), m_SlotCount);
+        std::partial_sort(m_Order.begin(), m_Order.begin() + winner_count, m_Order.end(), [&requests](uint32_t a, uint32_t b)
+        {
+            if (requests[a].importance != requests[b].importance)
+                return requests[a].importance > requests[b].importance;
+            return a < b;
+        });
+
+        // 2. Winners which already held a slot keep it
+        m_SlotTaken.assign(m_SlotCount, 0);
+        for (size_t i = 0; i < winner_count; ++i)
+        {
+            uint32_t request_index = m_Order[i];
+            if (auto it = m_Slots.find(requests[request_index].light_key); it != m_Slots.end() && it->second < m_SlotCount && !m_SlotTaken[it->second])
+            {
+                out_allocations[request_index].slot = it->second;
+                m_SlotTaken[it->second] = 1;
+            }
+        }
+
+        // 3. The rest take the free slots, and every other light is released
+        uint32_t free_slot = 0;
+        m_Slots.clear();
+        for (size_t i = 0; i < winner_count; ++i)
+        {
+            uint32_t request_index = m_Order[i];
+            Allocation& allocation = out_allocations[request_index];
+
+            if (allocation.slot == INVALID_SLOT)
+            {
+                while (m_SlotTaken[free_slot])
+                    free_slot++;
+
+                allocation.slot = free_slot;
+                allocation.is_new = true;
+                m_SlotTaken[free_slot] = 1;
+            }
+
+            m_Slots[requests[request_index].light_key] = allocation.slot;
+        }
+    }
+
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+// Core Headers
+
+// C++ Standard Library Headers
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+// External Vendor Library Headers
+
+namespace BC
+{
+
+    /// @brief Hands out the fixed layers of a shadow map array to the most
+    /// important shadow casting lights of each snapshot.
+    ///
+    /// A light keeps its layer for as long as it stays within the budget, so
+    /// a shadow map rendered in an earlier frame stays where it was and can
+    /// be reused while its view is unchanged.
+    class ShadowMapAllocator
+    {
+
+    public:
+
+        static constexpr uint32_t INVALID_SLOT = UINT32_MAX;
+
+        struct Request
+        {
+            uint64_t light_key;
+            float importance;
+        };
+
+        struct Allocation
+        {
+            uint32_t slot = INVALID_SLOT;
+
+            // The light did not hold this slot last time, so whatever the
+            // layer holds belongs to another light
+            bool is_new = false;
+        };
+
+        explicit ShadowMapAllocator(uint32_t slot_count) : m_SlotCount(slot_count) {}
+        ~ShadowMapAllocator() = default;
+
+        /// @brief Gives a slot to the slot_count most important requests and
+        /// releases the slots of every other light. out_allocations matches
+        /// the order of requests.
+        void Allocate(std::span<const Request> requests, std::vector<Allocation>& out_allocations);
+
+        uint32_t GetSlotCount() const { return m_SlotCount; }
+        uint32_t GetAllocatedCount() const { return static_cast<uint32_t>(m_Slots.size()); }
+
+    private:
+
+        uint32_t m_SlotCount = 0;
+
+        // Light key to the slot it was given by the last Allocate
+        std::unordered_map<uint64_t, uint32_t> m_Slots;
+
+        // Scratch of Allocate
+        std::vector<uint32_t> m_Order;
+        std::vector<uint8_t> m_SlotTaken;
+
+    };
+
+}
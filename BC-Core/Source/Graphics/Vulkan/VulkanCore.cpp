@@ -108,6 +108,11 @@ namespace BC
             vkDestroyCommandPool(m_LogicalDevice, pool, nullptr);
         m_ThreadUploadPools.clear();
 
+        for (auto& frame_pools : m_ThreadFramePools)
+            for (auto& [tid, thread_pool] : frame_pools)
+                vkDestroyCommandPool(m_LogicalDevice, thread_pool.command_pool, nullptr);
+        m_ThreadFramePools.clear();
+
         if (m_DefaultSampler)
             vkDestroySampler(m_LogicalDevice, m_DefaultSampler, nullptr);
         if (m_StaticDescriptorPool)
@@ -179,7 +184,7 @@ namespace BC
         submit_info.signalSemaphoreCount = 1;
         submit_info.pSignalSemaphores = &frame.render_finished_semaphore;
 
-        result = vkQueueSubmit(m_GraphicsQueue, 1, &submit_info, frame.in_flight_fence);
+        result = SubmitGraphicsQueue(submit_info, frame.in_flight_fence);
         BC_THROW(result == VK_SUCCESS, "VulkanCore::EndFrame: Could Not Submit Command Buffer.");
 
         VkSwapchainKHR swapchain = m_Swapchain->GetSwapchain();
@@ -192,7 +197,10 @@ namespace BC
         present_info.pSwapchains = &swapchain;
         present_info.pImageIndices = &m_CurrentImageIndex;
 
-        result = vkQueuePresentKHR(m_PresentQueue, &present_info);
+        {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            result = vkQueuePresentKHR(m_PresentQueue, &present_info);
+        }
         BC_THROW(result == VK_SUCCESS, "VulkanCore::EndFrame: Could Not Present.");
 
         m_FrameIndex = (m_FrameIndex + 1) % m_SwapChainFramesInFlight.size();
@@ -368,12 +376,91 @@ namespace BC
         submit_info.commandBufferCount = 1;
         submit_info.pCommandBuffers = &cmd;
 
-        vkQueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
-        vkQueueWaitIdle(queue);
+        // Waited on with a fence, so the queue is only locked for the submit
+        VkFenceCreateInfo fence_info{};
+        fence_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+        VkFence fence = VK_NULL_HANDLE;
+        vkCreateFence(m_LogicalDevice, &fence_info, nullptr, &fence);
+
+        {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            vkQueueSubmit(queue, 1, &submit_info, fence);
+        }
+
+        vkWaitForFences(m_LogicalDevice, 1, &fence, VK_TRUE, UINT64_MAX);
+        vkDestroyFence(m_LogicalDevice, fence, nullptr);
 
         vkFreeCommandBuffers(m_LogicalDevice, pool, 1, &cmd);
     }
 
+    VkCommandBuffer VulkanCore::AcquireFrameCommandBuffer(uint32_t frame_index, VkCommandBufferLevel level)
+    {
+        ThreadFrameCommandPool* thread_pool = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_FramePoolMutex);
+            BC_THROW(frame_index < m_ThreadFramePools.size(), "VulkanCore::AcquireFrameCommandBuffer: Invalid Frame Index.");
+
+            auto [it, inserted] = m_ThreadFramePools[frame_index].try_emplace(std::this_thread::get_id());
+            thread_pool = &it->second;
+
+            if (inserted)
+            {
+                // Never reset per command buffer, only wholesale
+                VkCommandPoolCreateInfo pool_info{};
+                pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+                pool_info.queueFamilyIndex = m_QueueFamilyIndices.graphics_family.value();
+                pool_info.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+                VkResult result = vkCreateCommandPool(m_LogicalDevice, &pool_info, nullptr, &thread_pool->command_pool);
+                BC_THROW(result == VK_SUCCESS, "VulkanCore::AcquireFrameCommandBuffer: Failed to Create Command Pool.");
+            }
+        }
+
+        // The pool is only touched by this thread until the frame is reset,
+        // so its command buffers are handed out without the lock
+        size_t level_index = level == VK_COMMAND_BUFFER_LEVEL_PRIMARY ? 0 : 1;
+        auto& command_buffers = thread_pool->command_buffers[level_index];
+        size_t& acquired_count = thread_pool->acquired_count[level_index];
+
+        if (acquired_count == command_buffers.size())
+        {
+            VkCommandBufferAllocateInfo alloc_info{};
+            alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            alloc_info.commandPool = thread_pool->command_pool;
+            alloc_info.level = level;
+            alloc_info.commandBufferCount = 1;
+
+            VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+            VkResult result = vkAllocateCommandBuffers(m_LogicalDevice, &alloc_info, &command_buffer);
+            BC_THROW(result == VK_SUCCESS, "VulkanCore::AcquireFrameCommandBuffer: Failed to Allocate Command Buffer.");
+
+            command_buffers.push_back(command_buffer);
+        }
+
+        return command_buffers[acquired_count++];
+    }
+
+    void VulkanCore::ResetFrameCommandPools(uint32_t frame_index)
+    {
+        std::lock_guard<std::mutex> lock(m_FramePoolMutex);
+        if (frame_index >= m_ThreadFramePools.size())
+            return;
+
+        for (auto& [tid, thread_pool] : m_ThreadFramePools[frame_index])
+        {
+            vkResetCommandPool(m_LogicalDevice, thread_pool.command_pool, 0);
+            thread_pool.acquired_count[0] = 0;
+            thread_pool.acquired_count[1] = 0;
+        }
+    }
+
+    VkResult VulkanCore::SubmitGraphicsQueue(const VkSubmitInfo& submit_info, VkFence fence)
+    {
+        std::lock_guard<std::mutex> lock(m_QueueMutex);
+        return vkQueueSubmit(m_GraphicsQueue, 1, &submit_info, fence);
+    }
+
     VkResult VulkanCore::CreateInstance(const char *app_name)
     {
         if (Util::s_EnableValidationLayer && !Util::CheckValidationLayerSupport()) 
@@ -645,10 +732,19 @@ namespace BC
             VK_KHR_SWAPCHAIN_EXTENSION_NAME
         };
 
+        // The scene's passes are recorded as dynamic rendering instances in
+        // secondary command buffers, core in Vulkan 1.3
+        VkPhysicalDeviceVulkan13Features vulkan_13_features = 
+        {
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES,
+            .pNext = VK_NULL_HANDLE,
+            .dynamicRendering = VK_TRUE
+        };
+
         VkDeviceCreateInfo device_create = 
         {
             .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
-            .pNext = VK_NULL_HANDLE,
+            .pNext = &vulkan_13_features,
             .flags = 0,
             
             .queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size()),
@@ -731,6 +827,7 @@ namespace BC
         BC_ASSERT(m_Swapchain, "VulkanCore::CreateSyncObjects: SwapChain Needs to be Valid.");
 
         m_SwapChainFramesInFlight.resize(m_Swapchain->GetImageCount());
+        m_ThreadFramePools.resize(m_Swapchain->GetImageCount());
 
         VkSemaphoreCreateInfo semaphore_info{};
         semaphore_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
@@ -79,6 +79,20 @@ namespace BC
         VkCommandBuffer BeginSingleUseCommandBuffer(VkCommandPool pool);
         void EndSingleUseCommandBuffer(VkQueue queue, VkCommandPool pool, VkCommandBuffer cmd);
 
+        /// @brief A command buffer from the calling thread's pool for a frame
+        /// in flight, valid until the frame's pools are next reset. Each thread
+        /// records into its own pool, so jobs can record in parallel.
+        VkCommandBuffer AcquireFrameCommandBuffer(uint32_t frame_index, VkCommandBufferLevel level);
+
+        /// @brief Resets every thread's pool of a frame in flight at once,
+        /// returning all of its command buffers to be reacquired. The GPU must
+        /// be done with them and no thread may be recording into them.
+        void ResetFrameCommandPools(uint32_t frame_index);
+
+        /// @brief Submits to the graphics queue, serialised with every other
+        /// submit and present as Vulkan requires of a queue
+        VkResult SubmitGraphicsQueue(const VkSubmitInfo& submit_info, VkFence fence);
+
     private:
 
         VkResult CreateInstance(const char* app_name);
@@ -136,6 +150,21 @@ namespace BC
 
         std::mutex m_UploadPoolMutex;
         std::unordered_map<std::thread::id, VkCommandPool> m_ThreadUploadPools;
+
+        struct ThreadFrameCommandPool
+        {
+            VkCommandPool command_pool = VK_NULL_HANDLE;
+
+            // Allocated once and reused after each reset, indexed by level
+            std::vector<VkCommandBuffer> command_buffers[2];
+            size_t acquired_count[2] = {};
+        };
+
+        // Per frame in flight, the pool of each thread that has recorded into it
+        std::mutex m_FramePoolMutex;
+        std::vector<std::unordered_map<std::thread::id, ThreadFrameCommandPool>> m_ThreadFramePools;
+
+        std::mutex m_QueueMutex;
     };
 
 }
\ No newline at end of file
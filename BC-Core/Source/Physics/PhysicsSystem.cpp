@@ -154,12 +154,8 @@ namespace BC
                     }
                 }
 
-                for (const auto& child_guid : current_entity.GetComponent<MetaComponent>().GetChildrenGUID())
+                for (Entity child_entity : current_entity.GetChildren())
                 {
-                    Entity child_entity = scene_manager->GetEntity(child_guid);
-                    if (!child_entity)
-                        continue;
-                    
                     search_self_children_for_colliders(child_entity);
                 }
             };
@@ -177,44 +173,24 @@ namespace BC
             if (!entity || shape_type == ShapeType_Unknown)
                 continue;
             
-            // Find suitable parent
-            std::function<void(Entity&)> search_self_parents_for_rigidbody;
-            search_self_parents_for_rigidbody = [&](Entity& current_entity)
+            // Find suitable parent, the nearest rigidbody of self or ancestors
+            RigidbodyComponent* rigidbody_component = entity.TryGetComponent<RigidbodyComponent>();
+            if (!rigidbody_component)
             {
-                if (current_entity.HasComponent<RigidbodyComponent>())
+                for (Entity ancestor_entity : entity.GetAncestors())
                 {
-                    // Found suitable parent
-                    auto& rigidbody_component = current_entity.GetComponent<RigidbodyComponent>();
-                    if (!rigidbody_component.GetRigid() || !rigidbody_component.GetRigid()->GetHandle())
-                    {
-                        collider_with_no_rigid_ancestors.emplace_back(entity, shape_type);
-                        return;
-                    }
-
-                    rigidbody_component.GetRigid()->AddShapeReference(entity, shape_type);
+                    if (rigidbody_component = ancestor_entity.TryGetComponent<RigidbodyComponent>(); rigidbody_component)
+                        break;
                 }
-                else
-                {
-                    // Continue searching upwards
-                    auto& meta_component = current_entity.GetComponent<MetaComponent>();
-                    if (!meta_component.HasParent())
-                    {
-                        collider_with_no_rigid_ancestors.emplace_back(entity, shape_type);
-                        return;
-                    }
+            }
 
-                    Entity parent_entity = Application::GetProject()->GetSceneManager()->GetEntity(meta_component.GetParentGUID());
-                    if (!parent_entity)
-                    {
-                        collider_with_no_rigid_ancestors.emplace_back(entity, shape_type);
-                        return;
-                    }
+            if (!rigidbody_component || !rigidbody_component->GetRigid() || !rigidbody_component->GetRigid()->GetHandle())
+            {
+                collider_with_no_rigid_ancestors.emplace_back(entity, shape_type);
+                continue;
+            }
 
-                    search_self_parents_for_rigidbody(parent_entity);
-                }
-            };
-            
-            search_self_parents_for_rigidbody(entity);
+            rigidbody_component->GetRigid()->AddShapeReference(entity, shape_type);
         }
         m_ColliderEntitiesAddedThisFrame.clear();
 
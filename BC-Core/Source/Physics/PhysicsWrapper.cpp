@@ -224,6 +224,37 @@ namespace BC
             m_Handle->wakeUp();
     }
 
+    void RigidDynamic::SetSimulationEnabled(const Entity& entity, bool enabled)
+    {
+        if (!m_Handle)
+            return;
+
+        if (enabled && entity)
+        {
+            glm::vec3 position = entity.GetComponent<TransformComponent>().GetGlobalPosition();
+            glm::quat orientation = entity.GetComponent<TransformComponent>().GetGlobalOrientation();
+
+            m_Handle->setActorFlag(PxActorFlag::eDISABLE_SIMULATION, false);
+            m_Handle->setGlobalPose({ position.x, position.y, position.z, PxQuat(orientation.x, orientation.y, orientation.z, orientation.w) });
+
+            if (!m_Properties.is_kinematic)
+            {
+                m_Handle->setLinearVelocity(PxVec3(0.0f));
+                m_Handle->setAngularVelocity(PxVec3(0.0f));
+            }
+
+            m_DeferredForce.clear();
+            m_DeferredTorque.clear();
+
+            if (!m_Properties.is_kinematic && m_Handle->getScene())
+                m_Handle->wakeUp();
+
+            return;
+        }
+
+        m_Handle->setActorFlag(PxActorFlag::eDISABLE_SIMULATION, !enabled);
+    }
+
     void RigidDynamic::SetPositionConstraint(const glm::bvec3& position_constraint)
     {
         m_Properties.position_constraint = position_constraint;
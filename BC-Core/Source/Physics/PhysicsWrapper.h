@@ -90,6 +90,11 @@ namespace BC
 
         void AddShapeReference(Entity entity, ShapeType shape_type);
 
+        /// @brief Parks or resumes the actor without releasing it. On resume
+        /// the actor is teleported to the entity's global transform and its
+        /// velocities are cleared. Used by prefab pools to recycle instances.
+        void SetSimulationEnabled(const Entity& entity, bool enabled);
+
         const RigidDynamicProperties& GetProperties() const { return m_Properties; }
         void SetProperties(const RigidDynamicProperties& properties) { m_Properties = properties; }
 
@@ -76,6 +76,14 @@ namespace BC
         m_SceneManager->OnStop();
     }
 
+    void Project::SetSceneManager(std::unique_ptr<SceneManager> scene_manager)
+    {
+        Application::Get()->WaitForSceneSnapshot();
+
+        m_SceneManager->OnStop();
+        m_SceneManager = std::move(scene_manager);
+    }
+
     void Project::SaveProject()
     {
         m_SceneManager->SaveAllScenes();
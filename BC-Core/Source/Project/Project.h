@@ -44,7 +44,9 @@ namespace BC
         Project& operator=(Project&& other) = default;
 
         SceneManager* GetSceneManager() const { return m_SceneManager.get(); }
-        void SetSceneManager(std::unique_ptr<SceneManager> scene_manager) { m_SceneManager->OnStop(); m_SceneManager = std::move(scene_manager); }
+        /// @brief Waits for this frame's scene snapshot, which reads the
+        /// current scene manager, before replacing it. Main thread only.
+        void SetSceneManager(std::unique_ptr<SceneManager> scene_manager);
 
         AssetManagerBase* GetAssetManager() const { return m_AssetManager.get(); }
         
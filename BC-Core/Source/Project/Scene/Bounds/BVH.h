@@ -0,0 +1,1371 @@
+#pragma once
+
+// Core Headers
+#include "Debug/Assert.h"
+#include "Debug/Logging.h"
+
+#include "Bounds.h"
+#include "Frustum.h"
+#include "FrustumCulling.h"
+#include "SpatialIndex.h"
+
+// C++ Standard Library Headers
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+// External Vendor Library Headers
+#include <glm/glm.hpp>
+
+namespace BC
+{
+	struct BVHBoundsConfig
+    {
+		/// <summary>
+		/// Data inserted as static is held in its own tree, built by the surface
+		/// area heuristic (SAH), so it is not disturbed by dynamic data moving
+		/// through it. When false, static data is inserted into the dynamic tree.
+		/// </summary>
+		bool SeparateStaticTree = true;
+
+		/// <summary>
+		/// Dynamic leaves are expanded by this margin in every direction, so
+		/// small movements only update the data source's own bounds.
+		/// </summary>
+		float DynamicMargin = 0.25f;
+
+		/// <summary>
+		/// Amount of bins each axis is split into when evaluating SAH splits.
+		/// Clamped between 2 and 32.
+		/// </summary>
+		uint32_t SAHBinCount = 16;
+
+		/// <summary>
+		/// The static tree is rebuilt by SAH after this many incremental inserts,
+		/// removes or refits, as these slowly degrade the quality of the build.
+		/// Zero never rebuilds automatically.
+		/// </summary>
+		uint32_t StaticRebuildThreshold = 256;
+
+		/// <summary>
+		/// A dynamic leaf which has moved out of its margin is refit in place
+		/// unless that would grow its parent's surface area by more than this
+		/// factor, in which case it is reinserted where it now fits best.
+		/// </summary>
+		float RefitGrowthLimit = 2.0f;
+	};
+
+	/// <summary>
+	/// A bounding volume hierarchy over the same data sources as OctreeBounds.
+	///
+	/// Static data is held in a tree built top down with binned SAH. Dynamic
+	/// data is held in a second tree of fattened leaves which is maintained
+	/// incrementally, refitting moved leaves in place and rebalancing with tree
+	/// rotations, reinserting only leaves that have moved far from their
+	/// siblings.
+	/// </summary>
+	template <typename DataType>
+	class BVHBounds : public SpatialIndex<DataType>
+    {
+
+	public:
+
+		using BVHData = SpatialDataSource<DataType>;
+		using typename SpatialIndex<DataType>::ViewMask;
+		using typename SpatialIndex<DataType>::QueryHit;
+		using SpatialIndex<DataType>::MAX_QUERY_VIEWS;
+
+		static constexpr uint32_t NULL_INDEX = std::numeric_limits<uint32_t>::max();
+
+		enum class BVHTreeType : uint8_t
+        {
+			Static = 0,
+			Dynamic = 1
+		};
+
+		struct BVHNode
+        {
+			Bounds_AABB Bounds;
+
+			/// <summary>
+			/// Parent of the node, or the next free node while the node is unused.
+			/// </summary>
+			uint32_t Parent = NULL_INDEX;
+			uint32_t Left = NULL_INDEX;
+			uint32_t Right = NULL_INDEX;
+
+			/// <summary>
+			/// Data slot held by a leaf node.
+			/// </summary>
+			uint32_t Slot = NULL_INDEX;
+
+			/// <summary>
+			/// Zero for leaves, -1 while the node is unused.
+			/// </summary>
+			int32_t Height = 0;
+
+			bool IsLeaf() const { return Left == NULL_INDEX; }
+		};
+
+	public:
+
+		BVHBounds() = default;
+		BVHBounds(const BVHBoundsConfig& config) :
+            m_Config(config) {}
+
+		~BVHBounds() override = default;
+
+		SpatialIndexType GetIndexType() const override { return SpatialIndexType::BVH; }
+
+		// ----------------------------
+		//           Writes
+		// ----------------------------
+
+		/// <summary>
+		/// Inserts a data source which may move into the dynamic tree. Inserting
+		/// data already within the BVH updates its bounds instead.
+		/// </summary>
+		bool Insert(const DataType& data, const Bounds_AABB& bounds) override
+        {
+			return InsertInto(data, bounds, BVHTreeType::Dynamic);
+		}
+
+		/// <summary>
+		/// Inserts a data source which is not expected to move into the static
+		/// tree. Call BuildStatic once a batch of static data has been inserted.
+		/// </summary>
+		bool InsertStatic(const DataType& data, const Bounds_AABB& bounds) override
+        {
+			return InsertInto(data, bounds, m_Config.SeparateStaticTree ? BVHTreeType::Static : BVHTreeType::Dynamic);
+		}
+
+		bool Remove(const DataType& data) override
+        {
+			auto it = m_DataSlots.find(data);
+			if (it == m_DataSlots.end())
+            {
+				BC_CORE_WARN("BVH - Data Not Found in Data Sources.");
+				return false;
+			}
+
+			RemoveSlot(it->second);
+			return true;
+		}
+
+		/// <summary>
+		/// Updates the bounds of a data source. Static data is refit in place,
+		/// dynamic data only touches the tree once it leaves its margin.
+		/// </summary>
+		bool Update(const DataType& data, const Bounds_AABB& bounds) override
+        {
+			auto it = m_DataSlots.find(data);
+			if (it == m_DataSlots.end())
+				return Insert(data, bounds);
+
+			UpdateSlot(it->second, bounds);
+			return true;
+		}
+
+		std::vector<BVHData> UpdateMany(const std::vector<BVHData>& data_sources) override
+        {
+			std::vector<BVHData> remaining_data_sources{};
+			for (const auto& data : data_sources)
+            {
+				if (!Update(data.Data, data.Bounds))
+					remaining_data_sources.push_back(data);
+			}
+			return remaining_data_sources;
+		}
+
+		/// <summary>
+		/// Builds the static tree top down with binned SAH from every static data
+		/// source, e.g., once a scene has finished loading.
+		/// </summary>
+		void BuildStatic()
+        {
+			Tree& tree = GetTree(BVHTreeType::Static);
+
+			std::vector<uint32_t> slots{};
+			slots.reserve(tree.LeafCount);
+			for (uint32_t slot = 0; slot < m_Data.size(); slot++)
+            {
+				if (m_DataTree[slot] == BVHTreeType::Static)
+					slots.push_back(slot);
+			}
+
+			tree.Nodes.clear();
+			tree.FreeList = NULL_INDEX;
+			tree.Root = NULL_INDEX;
+			tree.PendingChanges = 0;
+
+			if (slots.empty())
+				return;
+
+			tree.Nodes.reserve(slots.size() * 2 - 1);
+			tree.Root = BuildRange(tree, slots, 0, static_cast<uint32_t>(slots.size()), NULL_INDEX);
+		}
+
+		/// <summary>
+		/// Replaces every data source, inserting data_sources as static data
+		/// where is_static returns true, then builds the static tree.
+		/// </summary>
+		template<typename IsStaticFunc>
+		void Build(const std::vector<BVHData>& data_sources, IsStaticFunc&& is_static)
+        {
+			Clear();
+			ReserveSlots(data_sources.size());
+
+			for (const auto& data : data_sources)
+				InsertInto(data.Data, data.Bounds, m_Config.SeparateStaticTree && is_static(data.Data) ? BVHTreeType::Static : BVHTreeType::Dynamic, false);
+
+			BuildStatic();
+		}
+
+		void Clear() override
+        {
+			for (auto& tree : m_Trees)
+				tree = {};
+
+			m_Data.clear();
+			m_DataBounds.clear();
+			m_DataLeaf.clear();
+			m_DataTree.clear();
+			m_DataSlots.clear();
+		}
+
+		// ----------------------------
+		//           Reads
+		// ----------------------------
+
+		bool Contains(const DataType& data) const override { return m_DataSlots.find(data) != m_DataSlots.end(); }
+		bool IsEmpty() const override { return m_Data.empty(); }
+		size_t TotalCount() const override { return m_Data.size(); }
+
+		/// <summary>
+		/// This will query the BVH and return a const reference to a static vector.
+		///
+		/// If you do not process or copy the data from this result before the next query,
+		/// the next query will overwrite all data returned from the first query call.
+		/// </summary>
+		const std::vector<BVHData>& Query(const Bounds_AABB& bounds) { return QueryInto(0, bounds); }
+		const std::vector<BVHData>& Query(const Bounds_Sphere& bounds) { return QueryInto(1, bounds); }
+		const std::vector<BVHData>& Query(const Frustum& frustum) { return QueryInto(2, frustum); }
+
+		void Query(const Bounds_AABB& bounds, std::vector<BVHData>& out_results) const override
+        {
+			QueryVisit(bounds, [&](const DataType& data, const Bounds_AABB& data_bounds) { out_results.emplace_back(data, data_bounds); });
+		}
+
+		void Query(const Bounds_Sphere& bounds, std::vector<BVHData>& out_results) const override
+        {
+			QueryVisit(bounds, [&](const DataType& data, const Bounds_AABB& data_bounds) { out_results.emplace_back(data, data_bounds); });
+		}
+
+		void Query(const Frustum& frustum, std::vector<BVHData>& out_results) const override
+        {
+			QueryVisit(frustum, [&](const DataType& data, const Bounds_AABB& data_bounds) { out_results.emplace_back(data, data_bounds); });
+		}
+
+		void QueryRay(const Ray& ray, float max_distance, std::vector<QueryHit>& out_hits, bool first_hit_only = false) const override
+        {
+			typename SpatialIndex<DataType>::RayHitCollector collector(out_hits, max_distance, first_hit_only);
+			QueryRayVisit(ray, max_distance, collector);
+			collector.Finish();
+		}
+
+		/// <summary>
+		/// Walks the nodes of both trees nearest first, stopping once the nearest
+		/// remaining node is farther than every data source kept so far.
+		/// </summary>
+		void QueryNearest(const glm::vec3& point, size_t count, float max_distance, std::vector<QueryHit>& out_hits) const override
+        {
+			if (m_Data.empty() || count == 0)
+				return;
+
+			struct NodeEntry
+            {
+				float DistanceSquared;
+				uint32_t Node;
+				BVHTreeType Tree;
+
+				bool operator>(const NodeEntry& other) const { return DistanceSquared > other.DistanceSquared; }
+			};
+
+			std::priority_queue<NodeEntry, std::vector<NodeEntry>, std::greater<NodeEntry>> nodes{};
+			for (size_t tree_index = 0; tree_index < m_Trees.size(); tree_index++)
+            {
+				if (m_Trees[tree_index].Root != NULL_INDEX)
+					nodes.push({ this->DistanceSquared(point, m_Trees[tree_index].Nodes[m_Trees[tree_index].Root].Bounds), m_Trees[tree_index].Root, static_cast<BVHTreeType>(tree_index) });
+			}
+
+			typename SpatialIndex<DataType>::NearestCollector collector(out_hits, count, max_distance);
+
+			while (!nodes.empty())
+            {
+				NodeEntry entry = nodes.top();
+				nodes.pop();
+
+				if (entry.DistanceSquared > collector.GetBoundSquared())
+					break;
+
+				const Tree& tree = GetTree(entry.Tree);
+				const BVHNode& node = tree.Nodes[entry.Node];
+
+				if (node.IsLeaf())
+                {
+					// Dynamic leaves are fattened, so measure the data's own bounds
+					collector.Offer(m_Data[node.Slot], m_DataBounds[node.Slot], this->DistanceSquared(point, m_DataBounds[node.Slot]));
+					continue;
+				}
+
+				for (uint32_t child : { node.Left, node.Right })
+                {
+					float child_distance_squared = this->DistanceSquared(point, tree.Nodes[child].Bounds);
+					if (child_distance_squared <= collector.GetBoundSquared())
+						nodes.push({ child_distance_squared, child, entry.Tree });
+				}
+			}
+
+			collector.Finish();
+		}
+
+		/// <summary>
+		/// Calls visit(const DataType&, const Bounds_AABB&) for every data source
+		/// within the query bounds, which may be a Bounds_AABB, Bounds_Sphere or
+		/// Frustum. Safe to call from any thread while it is locked, see GetMutex.
+		/// </summary>
+		template<typename QueryShape, typename VisitFunc>
+		void QueryVisit(const QueryShape& query_shape, VisitFunc&& visit) const
+        {
+			if (m_Data.empty())
+				return;
+
+			FrustumPlanesSoA planes{};
+			if constexpr (std::is_same_v<QueryShape, Frustum>)
+				planes = FrustumPlanesSoA(query_shape);
+
+			// Frustum tests of leaves are deferred into batches for the SIMD kernels
+			std::array<uint32_t, CULL_BATCH_SIZE> batch_slots;
+			std::array<Bounds_AABB, CULL_BATCH_SIZE> batch_bounds;
+			std::array<FrustumContainResult, CULL_BATCH_SIZE> batch_results;
+			uint32_t batch_count = 0;
+
+			auto flush_batch = [&]()
+            {
+				Util::CullAABBs(planes, batch_bounds.data(), batch_count, batch_results.data());
+				for (uint32_t i = 0; i < batch_count; i++)
+                {
+					if (batch_results[i] != FrustumContainResult::DoesNotContain)
+						visit(m_Data[batch_slots[i]], m_DataBounds[batch_slots[i]]);
+				}
+				batch_count = 0;
+			};
+
+			std::vector<uint32_t> stack{};
+			stack.reserve(64);
+
+			for (const Tree& tree : m_Trees)
+            {
+				if (tree.Root == NULL_INDEX)
+					continue;
+
+				stack.push_back(tree.Root);
+				while (!stack.empty())
+                {
+					uint32_t node_index = stack.back();
+					stack.pop_back();
+
+					const BVHNode& node = tree.Nodes[node_index];
+
+					switch (ContainsNode(query_shape, node.Bounds))
+                    {
+						case BoundsContainResult::Contains:
+                        {
+							VisitSubtree(tree, node_index, visit);
+							break;
+						}
+
+						case BoundsContainResult::Intersects:
+                        {
+							if (!node.IsLeaf())
+                            {
+								stack.push_back(node.Left);
+								stack.push_back(node.Right);
+								break;
+							}
+
+							if constexpr (std::is_same_v<QueryShape, Frustum>)
+                            {
+								batch_slots[batch_count] = node.Slot;
+								batch_bounds[batch_count] = m_DataBounds[node.Slot];
+								if (++batch_count == CULL_BATCH_SIZE)
+									flush_batch();
+							}
+							else if (ContainsData(query_shape, m_DataBounds[node.Slot]))
+                            {
+								visit(m_Data[node.Slot], m_DataBounds[node.Slot]);
+							}
+							break;
+						}
+
+						default:
+							break;
+					}
+				}
+			}
+
+			if (batch_count > 0)
+				flush_batch();
+		}
+
+		/// <summary>
+		/// Calls visit(const DataType&, const Bounds_AABB&, float distance) for
+		/// every data source the ray enters within max_distance, in no particular
+		/// order. The visitor returns the new max distance, e.g., the hit distance
+		/// to only look for nearer hits, or max_distance to find every hit.
+		/// </summary>
+		template<typename VisitFunc>
+		void QueryRayVisit(const Ray& ray, float max_distance, VisitFunc&& visit) const
+        {
+			std::vector<uint32_t> stack{};
+			stack.reserve(64);
+
+			for (const Tree& tree : m_Trees)
+            {
+				if (tree.Root == NULL_INDEX)
+					continue;
+
+				stack.push_back(tree.Root);
+				while (!stack.empty())
+                {
+					uint32_t node_index = stack.back();
+					stack.pop_back();
+
+					const BVHNode& node = tree.Nodes[node_index];
+
+					float distance = 0.0f;
+					if (!node.Bounds.IntersectsRay(ray, max_distance, distance))
+						continue;
+
+					if (!node.IsLeaf())
+                    {
+						stack.push_back(node.Left);
+						stack.push_back(node.Right);
+						continue;
+					}
+
+					// Dynamic leaves are fattened, so the data's own bounds decide the hit
+					if (m_DataBounds[node.Slot].IntersectsRay(ray, max_distance, distance))
+						max_distance = std::min(max_distance, static_cast<float>(visit(m_Data[node.Slot], m_DataBounds[node.Slot], distance)));
+				}
+			}
+		}
+
+		/// <summary>
+		/// This will walk both trees once for several views, e.g., every camera
+		/// and shadow view of a frame, rather than once per view. Safe to call
+		/// from any thread while it is locked, see GetMutex.
+		/// </summary>
+		void QueryFrustums(std::span<const Frustum> frustums, std::vector<BVHData>& out_results, std::vector<ViewMask>& out_view_masks) const override
+        {
+			if (m_Data.empty() || frustums.empty())
+				return;
+
+			if (frustums.size() > MAX_QUERY_VIEWS)
+            {
+				BC_CORE_WARN("BVH - Multi View Query Only Supports {0} Views, Ignoring the Remaining {1}.", MAX_QUERY_VIEWS, frustums.size() - MAX_QUERY_VIEWS);
+				frustums = frustums.first(MAX_QUERY_VIEWS);
+			}
+
+			struct StackEntry
+            {
+				uint32_t Node;
+				ViewMask Active;	// Views yet to reject or fully contain the node
+				ViewMask Contained;	// Views that fully contain the node
+			};
+
+			ViewMask all_views = frustums.size() == MAX_QUERY_VIEWS ? ~ViewMask(0) : (ViewMask(1) << frustums.size()) - 1;
+			std::vector<FrustumPlanesSoA> view_planes(frustums.begin(), frustums.end());
+
+			// Leaves still tested by any view are gathered into a batch, then
+			// each view runs once over the whole batch
+			std::array<uint32_t, CULL_BATCH_SIZE> batch_slots;
+			std::array<Bounds_AABB, CULL_BATCH_SIZE> batch_bounds;
+			std::array<ViewMask, CULL_BATCH_SIZE> batch_active;
+			std::array<ViewMask, CULL_BATCH_SIZE> batch_views;
+			std::array<FrustumContainResult, CULL_BATCH_SIZE> batch_results;
+			uint32_t batch_count = 0;
+
+			auto flush_batch = [&]()
+            {
+				ViewMask batch_union = 0;
+				for (uint32_t i = 0; i < batch_count; i++)
+					batch_union |= batch_active[i];
+
+				for (ViewMask views = batch_union; views; views &= views - 1)
+                {
+					uint32_t view = static_cast<uint32_t>(std::countr_zero(views));
+					ViewMask view_bit = ViewMask(1) << view;
+
+					Util::CullAABBs(view_planes[view], batch_bounds.data(), batch_count, batch_results.data());
+					for (uint32_t i = 0; i < batch_count; i++)
+                    {
+						if ((batch_active[i] & view_bit) && batch_results[i] != FrustumContainResult::DoesNotContain)
+							batch_views[i] |= view_bit;
+					}
+				}
+
+				for (uint32_t i = 0; i < batch_count; i++)
+                {
+					if (batch_views[i])
+                    {
+						out_results.emplace_back(m_Data[batch_slots[i]], m_DataBounds[batch_slots[i]]);
+						out_view_masks.push_back(batch_views[i]);
+					}
+				}
+				batch_count = 0;
+			};
+
+			std::vector<StackEntry> stack{};
+			stack.reserve(64);
+
+			for (const Tree& tree : m_Trees)
+            {
+				if (tree.Root == NULL_INDEX)
+					continue;
+
+				stack.push_back({ tree.Root, all_views, 0 });
+				while (!stack.empty())
+                {
+					StackEntry entry = stack.back();
+					stack.pop_back();
+
+					const BVHNode& node = tree.Nodes[entry.Node];
+
+					for (ViewMask views = entry.Active; views; views &= views - 1)
+                    {
+						uint32_t view = static_cast<uint32_t>(std::countr_zero(views));
+						switch (ContainsNode(frustums[view], node.Bounds))
+                        {
+							case BoundsContainResult::Contains:			entry.Contained |= ViewMask(1) << view; [[fallthrough]];
+							case BoundsContainResult::DoesNotContain:	entry.Active &= ~(ViewMask(1) << view); break;
+							default:									break;
+						}
+					}
+
+					if (!entry.Active && !entry.Contained)
+						continue;
+
+					if (!node.IsLeaf())
+                    {
+						stack.push_back({ node.Left, entry.Active, entry.Contained });
+						stack.push_back({ node.Right, entry.Active, entry.Contained });
+						continue;
+					}
+
+					batch_slots[batch_count] = node.Slot;
+					batch_bounds[batch_count] = m_DataBounds[node.Slot];
+					batch_active[batch_count] = entry.Active;
+					batch_views[batch_count] = entry.Contained;
+					if (++batch_count == CULL_BATCH_SIZE)
+						flush_batch();
+				}
+			}
+
+			if (batch_count > 0)
+				flush_batch();
+		}
+
+		/// <summary>
+		/// This will deep copy both trees without rebuilding them, passing the
+		/// data of each data source through remap_data.
+		/// </summary>
+		template<typename RemapFunc>
+		std::shared_ptr<BVHBounds<DataType>> Clone(RemapFunc&& remap_data) const
+        {
+			auto bvh = std::make_shared<BVHBounds<DataType>>(m_Config);
+
+			bvh->m_Trees = m_Trees;
+
+			bvh->m_Data.reserve(m_Data.capacity());
+			for (const auto& data : m_Data)
+				bvh->m_Data.push_back(remap_data(data));
+
+			bvh->m_DataBounds = m_DataBounds;
+			bvh->m_DataLeaf = m_DataLeaf;
+			bvh->m_DataTree = m_DataTree;
+
+			bvh->m_DataSlots.reserve(bvh->m_Data.size());
+			for (uint32_t slot = 0; slot < bvh->m_Data.size(); slot++)
+				bvh->m_DataSlots.emplace(bvh->m_Data[slot], slot);
+
+			return bvh;
+		}
+
+		std::shared_ptr<SpatialIndex<DataType>> CloneIndex(const std::function<DataType(const DataType&)>& remap_data) const override
+        {
+			return Clone(remap_data);
+		}
+
+		/// <summary>
+		/// Writes both trees and the data slots as they are, so ReadLayout can
+		/// restore the BVH without an SAH build or any rotations.
+		/// </summary>
+		void WriteLayout(std::vector<uint8_t>& out_bytes, const std::function<uint64_t(const DataType&)>& data_to_id) const override
+        {
+			Util::SpatialLayoutWriter writer(out_bytes);
+			writer.Write(SpatialIndexType::BVH);
+			writer.Write(LAYOUT_VERSION);
+			writer.Write(m_Config);
+
+			for (const Tree& tree : m_Trees)
+            {
+				writer.WriteArray(tree.Nodes);
+				writer.Write(tree.Root);
+				writer.Write(tree.FreeList);
+				writer.Write(tree.LeafCount);
+				writer.Write(tree.PendingChanges);
+			}
+
+			writer.WriteArray(m_DataBounds);
+			writer.WriteArray(m_DataLeaf);
+			writer.WriteArray(m_DataTree);
+
+			std::vector<uint64_t> data_ids;
+			data_ids.reserve(m_Data.size());
+			for (const auto& data : m_Data)
+				data_ids.push_back(data_to_id(data));
+
+			writer.WriteArray(data_ids);
+		}
+
+		bool ReadLayout(std::span<const uint8_t> bytes, const std::function<std::optional<DataType>(uint64_t)>& id_to_data) override
+        {
+			Util::SpatialLayoutReader reader(bytes);
+
+			SpatialIndexType index_type = SpatialIndexType::BVH;
+			uint32_t version = 0;
+			BVHBoundsConfig config{};
+			std::array<Tree, 2> trees{};
+			std::vector<Bounds_AABB> data_bounds;
+			std::vector<uint32_t> data_leaf;
+			std::vector<BVHTreeType> data_tree;
+			std::vector<uint64_t> data_ids;
+
+			bool read =
+				reader.Read(index_type) && index_type == SpatialIndexType::BVH &&
+				reader.Read(version) && version == LAYOUT_VERSION &&
+				reader.Read(config);
+
+			for (Tree& tree : trees)
+            {
+				read = read &&
+					reader.ReadArray(tree.Nodes) &&
+					reader.Read(tree.Root) &&
+					reader.Read(tree.FreeList) &&
+					reader.Read(tree.LeafCount) &&
+					reader.Read(tree.PendingChanges);
+			}
+
+			read = read &&
+				reader.ReadArray(data_bounds) &&
+				reader.ReadArray(data_leaf) &&
+				reader.ReadArray(data_tree) &&
+				reader.ReadArray(data_ids) &&
+				reader.IsAtEnd();
+
+			if (!read || !IsLayoutValid(trees, data_leaf, data_tree, data_bounds.size(), data_ids.size()))
+				return false;
+
+			m_Config = config;
+			m_Trees = std::move(trees);
+			m_DataBounds = std::move(data_bounds);
+			m_DataLeaf = std::move(data_leaf);
+			m_DataTree = std::move(data_tree);
+
+			m_Data.assign(data_ids.size(), DataType{});
+			m_DataSlots.clear();
+			m_DataSlots.reserve(data_ids.size());
+
+			std::vector<uint32_t> unresolved_slots;
+			for (uint32_t slot = 0; slot < data_ids.size(); slot++)
+            {
+				std::optional<DataType> data = id_to_data(data_ids[slot]);
+				if (data && m_DataSlots.try_emplace(*data, slot).second)
+					m_Data[slot] = *data;
+				else
+					unresolved_slots.push_back(slot);
+			}
+
+			// Removing from the back means the slot moved into each hole has
+			// already been resolved
+			for (auto it = unresolved_slots.rbegin(); it != unresolved_slots.rend(); ++it)
+				RemoveSlot(*it);
+
+			return true;
+		}
+
+		bool TryGetBounds(const DataType& data, Bounds_AABB& out_bounds) const override
+        {
+			auto it = m_DataSlots.find(data);
+			if (it == m_DataSlots.end())
+				return false;
+
+			out_bounds = m_DataBounds[it->second];
+			return true;
+		}
+
+		const BVHBoundsConfig& GetConfig() const { return m_Config; }
+		void SetConfig(const BVHBoundsConfig& config) { m_Config = config; }
+
+		const std::vector<DataType>& GetAllBVHData() const { return m_Data; }
+		const std::vector<Bounds_AABB>& GetAllBVHDataBounds() const { return m_DataBounds; }
+
+		/// <summary>
+		/// This will return the bounds of every node in use by either tree.
+		/// </summary>
+		std::vector<Bounds_AABB> GetAllBVHBounds() const
+        {
+			std::vector<Bounds_AABB> bounds_vector;
+			for (const Tree& tree : m_Trees)
+            {
+				for (const BVHNode& node : tree.Nodes)
+                {
+					if (node.Height >= 0)
+						bounds_vector.push_back(node.Bounds);
+				}
+			}
+			return bounds_vector;
+		}
+
+		/// <summary>
+		/// Height of the tallest tree, zero when empty.
+		/// </summary>
+		int32_t GetHeight() const
+        {
+			int32_t height = 0;
+			for (const Tree& tree : m_Trees)
+            {
+				if (tree.Root != NULL_INDEX)
+					height = std::max(height, tree.Nodes[tree.Root].Height);
+			}
+			return height;
+		}
+
+	private:
+
+		struct Tree
+        {
+			std::vector<BVHNode> Nodes{};
+			uint32_t Root = NULL_INDEX;
+			uint32_t FreeList = NULL_INDEX;
+			uint32_t LeafCount = 0;
+
+			/// <summary>
+			/// Incremental changes since the last SAH build.
+			/// </summary>
+			uint32_t PendingChanges = 0;
+		};
+
+		static constexpr uint32_t CULL_BATCH_SIZE = 64;
+		static constexpr uint32_t MAX_SAH_BINS = 32;
+
+		/// <summary>
+		/// Bumped whenever the node or slot layout changes, so layouts written by
+		/// an older BVH are rebuilt rather than restored.
+		/// </summary>
+		static constexpr uint32_t LAYOUT_VERSION = 1;
+
+		/// <summary>
+		/// Checks every link of a layout read by ReadLayout points within its
+		/// tree before any of it is used.
+		/// </summary>
+		static bool IsLayoutValid(const std::array<Tree, 2>& trees, const std::vector<uint32_t>& data_leaf, const std::vector<BVHTreeType>& data_tree, size_t data_bounds_count, size_t data_id_count)
+        {
+			size_t data_count = data_leaf.size();
+			if (data_tree.size() != data_count || data_bounds_count != data_count || data_id_count != data_count)
+				return false;
+
+			auto is_link_valid = [](uint32_t index, size_t count) { return index == NULL_INDEX || index < count; };
+
+			for (const Tree& tree : trees)
+            {
+				size_t node_count = tree.Nodes.size();
+				if (!is_link_valid(tree.Root, node_count) || !is_link_valid(tree.FreeList, node_count))
+					return false;
+
+				for (const BVHNode& node : tree.Nodes)
+                {
+					if (!is_link_valid(node.Parent, node_count) || !is_link_valid(node.Left, node_count) || !is_link_valid(node.Right, node_count) || !is_link_valid(node.Slot, data_count))
+						return false;
+				}
+			}
+
+			for (size_t slot = 0; slot < data_count; slot++)
+            {
+				if (data_tree[slot] != BVHTreeType::Static && data_tree[slot] != BVHTreeType::Dynamic)
+					return false;
+
+				if (data_leaf[slot] >= trees[static_cast<size_t>(data_tree[slot])].Nodes.size())
+					return false;
+			}
+
+			return true;
+		}
+
+		Tree& GetTree(BVHTreeType type) { return m_Trees[static_cast<size_t>(type)]; }
+		const Tree& GetTree(BVHTreeType type) const { return m_Trees[static_cast<size_t>(type)]; }
+
+		void ReserveSlots(size_t count)
+        {
+			m_Data.reserve(count);
+			m_DataBounds.reserve(count);
+			m_DataLeaf.reserve(count);
+			m_DataTree.reserve(count);
+			m_DataSlots.reserve(count);
+		}
+
+		Bounds_AABB FattenBounds(const Bounds_AABB& bounds) const
+        {
+			return Bounds_AABB(bounds.BoundsMin - glm::vec3(m_Config.DynamicMargin), bounds.BoundsMax + glm::vec3(m_Config.DynamicMargin));
+		}
+
+		bool InsertInto(const DataType& data, const Bounds_AABB& bounds, BVHTreeType type, bool allow_static_rebuild = true)
+        {
+			auto [it, inserted] = m_DataSlots.try_emplace(data, static_cast<uint32_t>(m_Data.size()));
+			if (!inserted)
+            {
+				UpdateSlot(it->second, bounds);
+				return true;
+			}
+
+			uint32_t slot = it->second;
+			m_Data.push_back(data);
+			m_DataBounds.push_back(bounds);
+			m_DataLeaf.push_back(NULL_INDEX);
+			m_DataTree.push_back(type);
+
+			Tree& tree = GetTree(type);
+			uint32_t leaf = AllocateNode(tree);
+			tree.Nodes[leaf].Bounds = type == BVHTreeType::Dynamic ? FattenBounds(bounds) : bounds;
+			tree.Nodes[leaf].Slot = slot;
+			tree.LeafCount++;
+
+			m_DataLeaf[slot] = leaf;
+			InsertLeaf(tree, leaf);
+
+			if (type == BVHTreeType::Static && allow_static_rebuild)
+				NoteStaticChange();
+
+			return true;
+		}
+
+		void UpdateSlot(uint32_t slot, const Bounds_AABB& bounds)
+        {
+			m_DataBounds[slot] = bounds;
+
+			Tree& tree = GetTree(m_DataTree[slot]);
+			uint32_t leaf = m_DataLeaf[slot];
+
+			if (m_DataTree[slot] == BVHTreeType::Static)
+            {
+				// Refit only, rotations would undo the SAH build
+				tree.Nodes[leaf].Bounds = bounds;
+				RefitUpwards(tree, tree.Nodes[leaf].Parent);
+				NoteStaticChange();
+				return;
+			}
+
+			// Still within its margin, the tree does not need to change
+			if (tree.Nodes[leaf].Bounds.Contains(bounds) == BoundsContainResult::Contains)
+				return;
+
+			Bounds_AABB fat_bounds = FattenBounds(bounds);
+
+			uint32_t parent = tree.Nodes[leaf].Parent;
+			if (parent != NULL_INDEX)
+            {
+				uint32_t sibling = tree.Nodes[parent].Left == leaf ? tree.Nodes[parent].Right : tree.Nodes[parent].Left;
+
+				float current_area = tree.Nodes[parent].Bounds.SurfaceArea();
+				float refit_area = Bounds_AABB::Merge(fat_bounds, tree.Nodes[sibling].Bounds).SurfaceArea();
+
+				if (refit_area > current_area * m_Config.RefitGrowthLimit)
+                {
+					RemoveLeaf(tree, leaf);
+					tree.Nodes[leaf].Bounds = fat_bounds;
+					InsertLeaf(tree, leaf);
+					return;
+				}
+			}
+
+			tree.Nodes[leaf].Bounds = fat_bounds;
+			FixUpwards(tree, parent);
+		}
+
+		void RemoveSlot(uint32_t slot)
+        {
+			BVHTreeType type = m_DataTree[slot];
+			Tree& tree = GetTree(type);
+
+			uint32_t leaf = m_DataLeaf[slot];
+			RemoveLeaf(tree, leaf);
+			FreeNode(tree, leaf);
+			tree.LeafCount--;
+
+			m_DataSlots.erase(m_Data[slot]);
+
+			// Fill the hole with the last slot so the data arrays stay dense
+			uint32_t last_slot = static_cast<uint32_t>(m_Data.size()) - 1;
+			if (slot != last_slot)
+            {
+				m_Data[slot] = std::move(m_Data[last_slot]);
+				m_DataBounds[slot] = m_DataBounds[last_slot];
+				m_DataLeaf[slot] = m_DataLeaf[last_slot];
+				m_DataTree[slot] = m_DataTree[last_slot];
+
+				GetTree(m_DataTree[slot]).Nodes[m_DataLeaf[slot]].Slot = slot;
+				m_DataSlots[m_Data[slot]] = slot;
+			}
+
+			m_Data.pop_back();
+			m_DataBounds.pop_back();
+			m_DataLeaf.pop_back();
+			m_DataTree.pop_back();
+
+			if (type == BVHTreeType::Static)
+				NoteStaticChange();
+		}
+
+		void NoteStaticChange()
+        {
+			Tree& tree = GetTree(BVHTreeType::Static);
+			if (m_Config.StaticRebuildThreshold > 0 && ++tree.PendingChanges >= m_Config.StaticRebuildThreshold)
+				BuildStatic();
+		}
+
+		// ----------------------------
+		//          Node Pool
+		// ----------------------------
+
+		uint32_t AllocateNode(Tree& tree)
+        {
+			uint32_t node_index = tree.FreeList;
+			if (node_index != NULL_INDEX)
+            {
+				tree.FreeList = tree.Nodes[node_index].Parent;
+			}
+			else
+            {
+				node_index = static_cast<uint32_t>(tree.Nodes.size());
+				tree.Nodes.emplace_back();
+			}
+
+			tree.Nodes[node_index] = {};
+			return node_index;
+		}
+
+		void FreeNode(Tree& tree, uint32_t node_index)
+        {
+			tree.Nodes[node_index] = {};
+			tree.Nodes[node_index].Parent = tree.FreeList;
+			tree.Nodes[node_index].Height = -1;
+			tree.FreeList = node_index;
+		}
+
+		// ----------------------------
+		//       Incremental Tree
+		// ----------------------------
+
+		/// <summary>
+		/// Descends towards the sibling which least increases the surface area
+		/// of the tree, then pairs the leaf with it under a new parent.
+		/// </summary>
+		void InsertLeaf(Tree& tree, uint32_t leaf)
+        {
+			if (tree.Root == NULL_INDEX)
+            {
+				tree.Root = leaf;
+				tree.Nodes[leaf].Parent = NULL_INDEX;
+				return;
+			}
+
+			Bounds_AABB leaf_bounds = tree.Nodes[leaf].Bounds;
+
+			uint32_t sibling = tree.Root;
+			while (!tree.Nodes[sibling].IsLeaf())
+            {
+				const BVHNode& node = tree.Nodes[sibling];
+
+				float area = node.Bounds.SurfaceArea();
+				float combined_area = Bounds_AABB::Merge(node.Bounds, leaf_bounds).SurfaceArea();
+
+				// Cost of pairing the leaf with this node under a new parent
+				float cost = 2.0f * combined_area;
+
+				// Minimum cost pushed onto every node below this one
+				float inheritance_cost = 2.0f * (combined_area - area);
+
+				auto descend_cost = [&](uint32_t child)
+                {
+					const BVHNode& child_node = tree.Nodes[child];
+					float merged_area = Bounds_AABB::Merge(leaf_bounds, child_node.Bounds).SurfaceArea();
+					return (child_node.IsLeaf() ? merged_area : merged_area - child_node.Bounds.SurfaceArea()) + inheritance_cost;
+				};
+
+				float left_cost = descend_cost(node.Left);
+				float right_cost = descend_cost(node.Right);
+
+				if (cost < left_cost && cost < right_cost)
+					break;
+
+				sibling = left_cost < right_cost ? node.Left : node.Right;
+			}
+
+			uint32_t old_parent = tree.Nodes[sibling].Parent;
+			uint32_t new_parent = AllocateNode(tree);
+
+			BVHNode& parent_node = tree.Nodes[new_parent];
+			parent_node.Parent = old_parent;
+			parent_node.Bounds = Bounds_AABB::Merge(leaf_bounds, tree.Nodes[sibling].Bounds);
+			parent_node.Height = tree.Nodes[sibling].Height + 1;
+			parent_node.Left = sibling;
+			parent_node.Right = leaf;
+
+			tree.Nodes[sibling].Parent = new_parent;
+			tree.Nodes[leaf].Parent = new_parent;
+
+			if (old_parent == NULL_INDEX)
+				tree.Root = new_parent;
+			else if (tree.Nodes[old_parent].Left == sibling)
+				tree.Nodes[old_parent].Left = new_parent;
+			else
+				tree.Nodes[old_parent].Right = new_parent;
+
+			FixUpwards(tree, tree.Nodes[leaf].Parent);
+		}
+
+		/// <summary>
+		/// Detaches the leaf, replacing its parent with its sibling. The leaf
+		/// node itself is left allocated.
+		/// </summary>
+		void RemoveLeaf(Tree& tree, uint32_t leaf)
+        {
+			if (leaf == tree.Root)
+            {
+				tree.Root = NULL_INDEX;
+				return;
+			}
+
+			uint32_t parent = tree.Nodes[leaf].Parent;
+			uint32_t grand_parent = tree.Nodes[parent].Parent;
+			uint32_t sibling = tree.Nodes[parent].Left == leaf ? tree.Nodes[parent].Right : tree.Nodes[parent].Left;
+
+			tree.Nodes[sibling].Parent = grand_parent;
+			tree.Nodes[leaf].Parent = NULL_INDEX;
+
+			if (grand_parent == NULL_INDEX)
+            {
+				tree.Root = sibling;
+				FreeNode(tree, parent);
+				return;
+			}
+
+			if (tree.Nodes[grand_parent].Left == parent)
+				tree.Nodes[grand_parent].Left = sibling;
+			else
+				tree.Nodes[grand_parent].Right = sibling;
+
+			FreeNode(tree, parent);
+			FixUpwards(tree, grand_parent);
+		}
+
+		/// <summary>
+		/// Rebalances and refits every ancestor from the node up to the root.
+		/// </summary>
+		void FixUpwards(Tree& tree, uint32_t node_index)
+        {
+			while (node_index != NULL_INDEX)
+            {
+				node_index = Balance(tree, node_index);
+
+				BVHNode& node = tree.Nodes[node_index];
+				node.Height = 1 + std::max(tree.Nodes[node.Left].Height, tree.Nodes[node.Right].Height);
+				node.Bounds = Bounds_AABB::Merge(tree.Nodes[node.Left].Bounds, tree.Nodes[node.Right].Bounds);
+
+				node_index = node.Parent;
+			}
+		}
+
+		/// <summary>
+		/// Refits every ancestor from the node up to the root without changing
+		/// the shape of the tree.
+		/// </summary>
+		void RefitUpwards(Tree& tree, uint32_t node_index)
+        {
+			while (node_index != NULL_INDEX)
+            {
+				BVHNode& node = tree.Nodes[node_index];
+				node.Bounds = Bounds_AABB::Merge(tree.Nodes[node.Left].Bounds, tree.Nodes[node.Right].Bounds);
+				node_index = node.Parent;
+			}
+		}
+
+		/// <summary>
+		/// If one child of the node is more than one level taller than the other,
+		/// rotates the taller child up into the node's place.
+		/// </summary>
+		/// <returns>The node now at the top of the rotated subtree.</returns>
+		uint32_t Balance(Tree& tree, uint32_t a)
+        {
+			auto& nodes = tree.Nodes;
+			if (nodes[a].IsLeaf() || nodes[a].Height < 2)
+				return a;
+
+			uint32_t b = nodes[a].Left;
+			uint32_t c = nodes[a].Right;
+			int32_t balance = nodes[c].Height - nodes[b].Height;
+
+			if (balance > 1)
+				return Rotate(tree, a, c, false);
+
+			if (balance < -1)
+				return Rotate(tree, a, b, true);
+
+			return a;
+		}
+
+		/// <summary>
+		/// Swaps node a with its child, which takes a's place. The shorter child
+		/// of the promoted node moves down to a, keeping the taller beside a.
+		/// </summary>
+		uint32_t Rotate(Tree& tree, uint32_t a, uint32_t promoted, bool promoted_is_left)
+        {
+			auto& nodes = tree.Nodes;
+
+			uint32_t other = promoted_is_left ? nodes[a].Right : nodes[a].Left;
+			uint32_t f = nodes[promoted].Left;
+			uint32_t g = nodes[promoted].Right;
+
+			// The promoted node takes a's place under a's parent
+			nodes[promoted].Parent = nodes[a].Parent;
+			nodes[a].Parent = promoted;
+
+			if (nodes[promoted].Parent == NULL_INDEX)
+				tree.Root = promoted;
+			else if (nodes[nodes[promoted].Parent].Left == a)
+				nodes[nodes[promoted].Parent].Left = promoted;
+			else
+				nodes[nodes[promoted].Parent].Right = promoted;
+
+			uint32_t kept = nodes[f].Height > nodes[g].Height ? f : g;
+			uint32_t moved = kept == f ? g : f;
+
+			nodes[promoted].Left = a;
+			nodes[promoted].Right = kept;
+
+			if (promoted_is_left)
+				nodes[a].Left = moved;
+			else
+				nodes[a].Right = moved;
+			nodes[moved].Parent = a;
+
+			nodes[a].Bounds = Bounds_AABB::Merge(nodes[other].Bounds, nodes[moved].Bounds);
+			nodes[a].Height = 1 + std::max(nodes[other].Height, nodes[moved].Height);
+
+			nodes[promoted].Bounds = Bounds_AABB::Merge(nodes[a].Bounds, nodes[kept].Bounds);
+			nodes[promoted].Height = 1 + std::max(nodes[a].Height, nodes[kept].Height);
+
+			return promoted;
+		}
+
+		// ----------------------------
+		//          SAH Build
+		// ----------------------------
+
+		/// <summary>
+		/// Builds the subtree over slots [begin, end), splitting each range where
+		/// the binned surface area heuristic is cheapest.
+		/// </summary>
+		uint32_t BuildRange(Tree& tree, std::vector<uint32_t>& slots, uint32_t begin, uint32_t end, uint32_t parent)
+        {
+			uint32_t node_index = AllocateNode(tree);
+			tree.Nodes[node_index].Parent = parent;
+
+			if (end - begin == 1)
+            {
+				uint32_t slot = slots[begin];
+				tree.Nodes[node_index].Slot = slot;
+				tree.Nodes[node_index].Bounds = m_DataBounds[slot];
+				m_DataLeaf[slot] = node_index;
+				return node_index;
+			}
+
+			Bounds_AABB centroid_bounds{};
+			for (uint32_t i = begin; i < end; i++)
+            {
+				glm::vec3 centre = m_DataBounds[slots[i]].Center();
+				centroid_bounds.BoundsMin = glm::min(centroid_bounds.BoundsMin, centre);
+				centroid_bounds.BoundsMax = glm::max(centroid_bounds.BoundsMax, centre);
+			}
+
+			glm::vec3 centroid_extent = centroid_bounds.Size();
+			int axis = centroid_extent.x > centroid_extent.y ? (centroid_extent.x > centroid_extent.z ? 0 : 2) : (centroid_extent.y > centroid_extent.z ? 1 : 2);
+
+			uint32_t mid = begin + (end - begin) / 2;
+			bool split_found = false;
+
+			if (centroid_extent[axis] > 0.0f)
+            {
+				struct Bin
+                {
+					Bounds_AABB Bounds{};
+					uint32_t Count = 0;
+				};
+
+				uint32_t bin_count = std::clamp(m_Config.SAHBinCount, 2u, MAX_SAH_BINS);
+				float bin_scale = static_cast<float>(bin_count) / centroid_extent[axis];
+
+				auto bin_of = [&](uint32_t slot)
+                {
+					float offset = (m_DataBounds[slot].Center()[axis] - centroid_bounds.BoundsMin[axis]) * bin_scale;
+					return std::min(bin_count - 1, static_cast<uint32_t>(offset));
+				};
+
+				std::array<Bin, MAX_SAH_BINS> bins{};
+				for (uint32_t i = begin; i < end; i++)
+                {
+					Bin& bin = bins[bin_of(slots[i])];
+					bin.Bounds = Bounds_AABB::Merge(bin.Bounds, m_DataBounds[slots[i]]);
+					bin.Count++;
+				}
+
+				// Sweep from the right to find the cost of everything right of each split
+				std::array<float, MAX_SAH_BINS> right_cost{};
+				Bounds_AABB right_bounds{};
+				uint32_t right_count = 0;
+				for (uint32_t i = bin_count - 1; i > 0; i--)
+                {
+					right_bounds = Bounds_AABB::Merge(right_bounds, bins[i].Bounds);
+					right_count += bins[i].Count;
+					right_cost[i - 1] = right_count > 0 ? right_bounds.SurfaceArea() * right_count : 0.0f;
+				}
+
+				// Then from the left, splitting after bin i
+				float best_cost = std::numeric_limits<float>::max();
+				uint32_t best_split = 0;
+				Bounds_AABB left_bounds{};
+				uint32_t left_count = 0;
+				for (uint32_t i = 0; i < bin_count - 1; i++)
+                {
+					left_bounds = Bounds_AABB::Merge(left_bounds, bins[i].Bounds);
+					left_count += bins[i].Count;
+
+					float cost = (left_count > 0 ? left_bounds.SurfaceArea() * left_count : 0.0f) + right_cost[i];
+					if (left_count > 0 && left_count < end - begin && cost < best_cost)
+                    {
+						best_cost = cost;
+						best_split = i;
+					}
+				}
+
+				if (best_cost < std::numeric_limits<float>::max())
+                {
+					auto split_it = std::partition(slots.begin() + begin, slots.begin() + end, [&](uint32_t slot) { return bin_of(slot) <= best_split; });
+					mid = static_cast<uint32_t>(std::distance(slots.begin(), split_it));
+					split_found = mid > begin && mid < end;
+				}
+			}
+
+			// Every centroid shares a bin, fall back to splitting at the median
+			if (!split_found)
+            {
+				mid = begin + (end - begin) / 2;
+				std::nth_element(slots.begin() + begin, slots.begin() + mid, slots.begin() + end, [&](uint32_t a, uint32_t b)
+                {
+					return m_DataBounds[a].Center()[axis] < m_DataBounds[b].Center()[axis];
+				});
+			}
+
+			uint32_t left = BuildRange(tree, slots, begin, mid, node_index);
+			uint32_t right = BuildRange(tree, slots, mid, end, node_index);
+
+			BVHNode& node = tree.Nodes[node_index];
+			node.Left = left;
+			node.Right = right;
+			node.Bounds = Bounds_AABB::Merge(tree.Nodes[left].Bounds, tree.Nodes[right].Bounds);
+			node.Height = 1 + std::max(tree.Nodes[left].Height, tree.Nodes[right].Height);
+
+			return node_index;
+		}
+
+		// ----------------------------
+		//           Queries
+		// ----------------------------
+
+		template<typename QueryShape>
+		const std::vector<BVHData>& QueryInto(size_t query_index, const QueryShape& query_shape)
+        {
+			auto& result = m_QueryReturnVectors[query_index];
+			result.clear();
+			Query(query_shape, result);
+			return result;
+		}
+
+		template<typename VisitFunc>
+		void VisitSubtree(const Tree& tree, uint32_t node_index, VisitFunc& visit) const
+        {
+			const BVHNode& node = tree.Nodes[node_index];
+			if (node.IsLeaf())
+            {
+				visit(m_Data[node.Slot], m_DataBounds[node.Slot]);
+				return;
+			}
+
+			VisitSubtree(tree, node.Left, visit);
+			VisitSubtree(tree, node.Right, visit);
+		}
+
+		static BoundsContainResult ContainsNode(const Bounds_AABB& bounds, const Bounds_AABB& node_bounds) { return bounds.Contains(node_bounds); }
+		static BoundsContainResult ContainsNode(const Bounds_Sphere& bounds, const Bounds_AABB& node_bounds) { return bounds.Contains(node_bounds); }
+		static BoundsContainResult ContainsNode(const Frustum& frustum, const Bounds_AABB& node_bounds)
+		{
+			switch (frustum.Contains(node_bounds))
+			{
+				case FrustumContainResult::Contains:	return BoundsContainResult::Contains;
+				case FrustumContainResult::Intersects:	return BoundsContainResult::Intersects;
+				default:								return BoundsContainResult::DoesNotContain;
+			}
+		}
+
+		static bool ContainsData(const Bounds_AABB& bounds, const Bounds_AABB& data_bounds) { return bounds.Contains(data_bounds) != BoundsContainResult::DoesNotContain; }
+		static bool ContainsData(const Bounds_Sphere& bounds, const Bounds_AABB& data_bounds) { return bounds.Contains(data_bounds) != BoundsContainResult::DoesNotContain; }
+
+		BVHBoundsConfig m_Config{};
+
+		/// <summary>
+		/// Indexed by BVHTreeType.
+		/// </summary>
+		std::array<Tree, 2> m_Trees{};
+
+		// Data sources stored as parallel arrays indexed by slot, kept dense
+		// by moving the last slot into the place of a removed one
+		std::vector<DataType> m_Data{};
+		std::vector<Bounds_AABB> m_DataBounds{};
+		std::vector<uint32_t> m_DataLeaf{};
+		std::vector<BVHTreeType> m_DataTree{};
+
+		std::unordered_map<DataType, uint32_t> m_DataSlots{};
+
+		std::array<std::vector<BVHData>, 3> m_QueryReturnVectors{};
+
+	};
+}
@@ -5,8 +5,15 @@
 // C++ Standard Library Headers
 
 // External Vendor Library Headers
+#include <glm/gtc/constants.hpp>
 #include <glm/gtx/norm.hpp>
 
+// SSE2 is part of every x86-64 target, so no runtime dispatch is needed
+#if defined(__x86_64__) || defined(_M_X64)
+	#define BC_BOUNDS_SSE2
+	#include <emmintrin.h>
+#endif
+
 namespace BC 
 {
 
@@ -63,18 +70,16 @@ namespace BC
 			return BoundsContainResult::DoesNotContain;
 		}
 
-		// Check if the sphere contains the entire AABB
-		bool contains = true;
-		for (int i = 0; i < 3; ++i) 
+		// The sphere contains the entire AABB when it contains the AABB's furthest corner,
+		// being within the sphere's bounding box is not enough
+		float furthestDistanceSquared = 0.0f;
+		for (int i = 0; i < 3; ++i)
         {
-			if (aabb.BoundsMin[i] < BoundsCentre[i] - temp_radius || aabb.BoundsMax[i] > BoundsCentre[i] + temp_radius) 
-            {
-				contains = false;
-				break;
-			}
+			float distance = std::max(BoundsCentre[i] - aabb.BoundsMin[i], aabb.BoundsMax[i] - BoundsCentre[i]);
+			furthestDistanceSquared += distance * distance;
 		}
 
-		if (contains) 
+		if (furthestDistanceSquared <= temp_radius * temp_radius)
         {
 			return BoundsContainResult::Contains;
 		}
@@ -82,6 +87,19 @@ namespace BC
 		return BoundsContainResult::Intersects;
 	}
 
+	Bounds_Sphere Bounds_Sphere::FromCone(const glm::vec3& apex, const glm::vec3& direction, float range, float angle)
+	{
+		float half_angle = glm::radians(angle * 0.5f);
+		float cos_half_angle = cos(half_angle);
+
+		// Past 45 degrees the base circle is the widest part of the cone
+		if (half_angle > glm::pi<float>() / 4.0f)
+			return Bounds_Sphere(apex + cos_half_angle * range * direction, sin(half_angle) * range);
+
+		float radius = range / (2.0f * cos_half_angle);
+		return Bounds_Sphere(apex + radius * direction, radius);
+	}
+
 #pragma endregion
 
 #pragma region AABB
@@ -204,6 +222,111 @@ namespace BC
 		return closest_point;
 	}
 
+	float Bounds_AABB::SurfaceArea() const
+	{
+		glm::vec3 size = glm::max(Size(), glm::vec3(0.0f));
+		return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+	}
+
+	Bounds_AABB Bounds_AABB::Merge(const Bounds_AABB& a, const Bounds_AABB& b)
+	{
+		return Bounds_AABB(glm::min(a.BoundsMin, b.BoundsMin), glm::max(a.BoundsMax, b.BoundsMax));
+	}
+
+	bool Bounds_AABB::IntersectsRay(const Ray& ray, float max_distance, float& out_distance) const
+	{
+		// Division by a zero direction component gives +/- infinity, which the 
+		// min/max below handle as a ray parallel to that slab
+		glm::vec3 inverse_direction = 1.0f / ray.Direction;
+
+		glm::vec3 t_near = (BoundsMin - ray.Origin) * inverse_direction;
+		glm::vec3 t_far = (BoundsMax - ray.Origin) * inverse_direction;
+
+		glm::vec3 t_min = glm::min(t_near, t_far);
+		glm::vec3 t_max = glm::max(t_near, t_far);
+
+		float t_enter = glm::max(glm::max(t_min.x, t_min.y), glm::max(t_min.z, 0.0f));
+		float t_exit = glm::min(glm::min(t_max.x, t_max.y), glm::min(t_max.z, max_distance));
+
+		if (t_enter > t_exit)
+			return false;
+
+		out_distance = t_enter;
+		return true;
+	}
+
+	Bounds_AABB Bounds_AABB::Transformed(const glm::mat4& transform) const
+	{
+		glm::vec3 centre = glm::vec3(transform * glm::vec4(Center(), 1.0f));
+
+		// Each world axis extent is the sum of the local extents projected onto it
+		glm::vec3 extent = Size() * 0.5f;
+		glm::vec3 transformed_extent = 
+			glm::abs(glm::vec3(transform[0])) * extent.x + 
+			glm::abs(glm::vec3(transform[1])) * extent.y + 
+			glm::abs(glm::vec3(transform[2])) * extent.z;
+
+		return Bounds_AABB(centre - transformed_extent, centre + transformed_extent);
+	}
+
+#pragma endregion
+
+#pragma region Batch
+
+	namespace Util
+	{
+		void TransformAABBs(const glm::mat4* transforms, const Bounds_AABB* bounds, size_t count, Bounds_AABB* out_bounds)
+		{
+#ifdef BC_BOUNDS_SSE2
+			const __m128 half = _mm_set1_ps(0.5f);
+			const __m128 sign_mask = _mm_set1_ps(-0.0f);
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const float* matrix = &transforms[i][0][0];
+				__m128 column_0 = _mm_loadu_ps(matrix);
+				__m128 column_1 = _mm_loadu_ps(matrix + 4);
+				__m128 column_2 = _mm_loadu_ps(matrix + 8);
+				__m128 column_3 = _mm_loadu_ps(matrix + 12);
+
+				const Bounds_AABB& aabb = bounds[i];
+				__m128 bounds_min = _mm_setr_ps(aabb.BoundsMin.x, aabb.BoundsMin.y, aabb.BoundsMin.z, 0.0f);
+				__m128 bounds_max = _mm_setr_ps(aabb.BoundsMax.x, aabb.BoundsMax.y, aabb.BoundsMax.z, 0.0f);
+
+				__m128 centre = _mm_mul_ps(_mm_add_ps(bounds_min, bounds_max), half);
+				__m128 extent = _mm_mul_ps(_mm_sub_ps(bounds_max, bounds_min), half);
+
+				// Broadcast each component so the columns can be scaled and summed
+				__m128 centre_x = _mm_shuffle_ps(centre, centre, _MM_SHUFFLE(0, 0, 0, 0));
+				__m128 centre_y = _mm_shuffle_ps(centre, centre, _MM_SHUFFLE(1, 1, 1, 1));
+				__m128 centre_z = _mm_shuffle_ps(centre, centre, _MM_SHUFFLE(2, 2, 2, 2));
+				__m128 extent_x = _mm_shuffle_ps(extent, extent, _MM_SHUFFLE(0, 0, 0, 0));
+				__m128 extent_y = _mm_shuffle_ps(extent, extent, _MM_SHUFFLE(1, 1, 1, 1));
+				__m128 extent_z = _mm_shuffle_ps(extent, extent, _MM_SHUFFLE(2, 2, 2, 2));
+
+				__m128 transformed_centre = _mm_add_ps(
+					_mm_add_ps(_mm_mul_ps(column_0, centre_x), _mm_mul_ps(column_1, centre_y)),
+					_mm_add_ps(_mm_mul_ps(column_2, centre_z), column_3));
+
+				__m128 transformed_extent = _mm_add_ps(
+					_mm_add_ps(_mm_mul_ps(_mm_andnot_ps(sign_mask, column_0), extent_x), _mm_mul_ps(_mm_andnot_ps(sign_mask, column_1), extent_y)),
+					_mm_mul_ps(_mm_andnot_ps(sign_mask, column_2), extent_z));
+
+				alignas(16) float new_min[4];
+				alignas(16) float new_max[4];
+				_mm_store_ps(new_min, _mm_sub_ps(transformed_centre, transformed_extent));
+				_mm_store_ps(new_max, _mm_add_ps(transformed_centre, transformed_extent));
+
+				out_bounds[i].BoundsMin = glm::vec3(new_min[0], new_min[1], new_min[2]);
+				out_bounds[i].BoundsMax = glm::vec3(new_max[0], new_max[1], new_max[2]);
+			}
+#else
+			for (size_t i = 0; i < count; ++i)
+				out_bounds[i] = bounds[i].Transformed(transforms[i]);
+#endif
+		}
+	}
+
 #pragma endregion
 
 }
\ No newline at end of file
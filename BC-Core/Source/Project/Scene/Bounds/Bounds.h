@@ -3,6 +3,7 @@
 // Core Headers
 
 // C++ Standard Library Headers
+#include <cstddef>
 
 // External Vendor Library Headers
 #include <glm/glm.hpp>
@@ -21,6 +22,16 @@ namespace BC
 	struct Bounds_Sphere;
 	struct Bounds_AABB;
 
+	struct Ray 
+    {
+		glm::vec3 Origin = glm::vec3(0.0f);
+
+		/// <summary>
+		/// Expected to be normalised, so distances along the ray are in world units.
+		/// </summary>
+		glm::vec3 Direction = glm::vec3(0.0f, 0.0f, -1.0f);
+	};
+
 	struct Bounds_Sphere 
     {
 		glm::vec3 BoundsCentre = glm::vec3(0.0f);
@@ -29,7 +40,9 @@ namespace BC
 		Bounds_Sphere() = default;
 		Bounds_Sphere(const glm::vec3& centre, const float& radius) : BoundsCentre(centre), BoundsRadius(radius) {}
 		Bounds_Sphere(const Bounds_Sphere&) = default;
-		Bounds_Sphere(Bounds_Sphere&&) = default;
+		Bounds_Sphere(Bounds_Sphere&&) noexcept = default;
+		Bounds_Sphere& operator=(const Bounds_Sphere&) = default;
+		Bounds_Sphere& operator=(Bounds_Sphere&&) noexcept = default;
 		~Bounds_Sphere() = default;
 
 		/// <summary>
@@ -47,6 +60,16 @@ namespace BC
 		/// <param name="looseness">This is a multiplier. 1.0f = Normal Radius, 2.0f = Test Against Current Radius Expanded by 2.0f.</param>
 		/// <returns>An enum holding the result of the function.</returns>
 		BoundsContainResult Contains(const Bounds_AABB& aabb, float looseness = 1.0f) const;
+
+		/// <summary>
+		/// Bounding sphere of a cone. Wide cones are bounded by their base,
+		/// narrow ones by the sphere through the apex and the rim of the base.
+		/// </summary>
+		/// <param name="apex">The tip of the cone.</param>
+		/// <param name="direction">The normalised axis from the apex towards the base.</param>
+		/// <param name="range">The length of the cone along its axis.</param>
+		/// <param name="angle">The full opening angle of the cone in degrees.</param>
+		static Bounds_Sphere FromCone(const glm::vec3& apex, const glm::vec3& direction, float range, float angle);
 	};
 
 	struct Bounds_AABB 
@@ -140,6 +163,39 @@ namespace BC
 		BoundsContainResult Contains(const glm::vec3& point, float looseness = 1.0f) const;
 
 		glm::vec3 ClosestPoint(const glm::vec3& point_location) const;
+
+		/// <summary>
+		/// Surface area of the AABB, the cost metric of the BVH builds.
+		/// </summary>
+		float SurfaceArea() const;
+
+		/// <summary>
+		/// The smallest AABB enclosing both AABBs.
+		/// </summary>
+		static Bounds_AABB Merge(const Bounds_AABB& a, const Bounds_AABB& b);
+
+		/// <summary>
+		/// Slab test of the ray against this AABB.
+		/// </summary>
+		/// <param name="out_distance">Distance along the ray the AABB is entered, 0.0f if the ray starts inside.</param>
+		/// <returns>True if the AABB is hit within max_distance.</returns>
+		bool IntersectsRay(const Ray& ray, float max_distance, float& out_distance) const;
+
+		/// <summary>
+		/// The AABB enclosing this AABB once transformed. Transforms the centre 
+		/// and projects the extents onto each axis rather than transforming all 
+		/// 8 corners.
+		/// </summary>
+		Bounds_AABB Transformed(const glm::mat4& transform) const;
 	};
 
+	namespace Util
+    {
+		/// <summary>
+		/// Transforms a batch of AABBs, the same as Bounds_AABB::Transformed,
+		/// one AABB per SIMD register where supported.
+		/// </summary>
+		void TransformAABBs(const glm::mat4* transforms, const Bounds_AABB* bounds, size_t count, Bounds_AABB* out_bounds);
+	}
+
 }
\ No newline at end of file
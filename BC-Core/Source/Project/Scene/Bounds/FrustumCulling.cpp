@@ -0,0 +1,399 @@
+#include "BC_PCH.h"
+#include "FrustumCulling.h"
+
+// Core Headers
+
+// C++ Standard Library Headers
+
+// External Vendor Library Headers
+#if defined(__x86_64__) || defined(_M_X64)
+	#define BC_CULLING_X86
+	#include <immintrin.h>
+
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+		// MSVC allows any intrinsic without changing the target of the whole file
+		#define BC_TARGET_SSE4
+		#define BC_TARGET_AVX2
+	#else
+		#define BC_TARGET_SSE4 __attribute__((target("sse4.1")))
+		#define BC_TARGET_AVX2 __attribute__((target("avx2")))
+	#endif
+#endif
+
+namespace BC
+{
+
+	FrustumPlanesSoA::FrustumPlanesSoA(const Frustum& frustum)
+	{
+		for (size_t i = 0; i < 6; ++i)
+		{
+			NormalX[i] = frustum.planes[i].normal.x;
+			NormalY[i] = frustum.planes[i].normal.y;
+			NormalZ[i] = frustum.planes[i].normal.z;
+			Distance[i] = frustum.planes[i].distance;
+		}
+	}
+
+	namespace Util
+	{
+
+#pragma region Scalar
+
+		// Both kernels follow Frustum::Contains operation for operation, the
+		// SIMD paths then follow these, so every path agrees on edge cases
+
+		static FrustumContainResult CullAABBScalar(const FrustumPlanesSoA& planes, const Bounds_AABB& bounds)
+		{
+			bool all_inside = true;
+
+			for (size_t i = 0; i < 6; ++i)
+			{
+				glm::vec3 positive_vertex = bounds.BoundsMin;
+				glm::vec3 negative_vertex = bounds.BoundsMax;
+
+				if (planes.NormalX[i] >= 0) { positive_vertex.x = bounds.BoundsMax.x; negative_vertex.x = bounds.BoundsMin.x; }
+				if (planes.NormalY[i] >= 0) { positive_vertex.y = bounds.BoundsMax.y; negative_vertex.y = bounds.BoundsMin.y; }
+				if (planes.NormalZ[i] >= 0) { positive_vertex.z = bounds.BoundsMax.z; negative_vertex.z = bounds.BoundsMin.z; }
+
+				float distance_to_positive = planes.NormalX[i] * positive_vertex.x + planes.NormalY[i] * positive_vertex.y + planes.NormalZ[i] * positive_vertex.z + planes.Distance[i];
+				float distance_to_negative = planes.NormalX[i] * negative_vertex.x + planes.NormalY[i] * negative_vertex.y + planes.NormalZ[i] * negative_vertex.z + planes.Distance[i];
+
+				if (distance_to_positive < 0 && distance_to_negative < 0)
+					return FrustumContainResult::DoesNotContain;
+
+				if (!(distance_to_positive >= 0 && distance_to_negative >= 0))
+					all_inside = false;
+			}
+
+			return all_inside ? FrustumContainResult::Contains : FrustumContainResult::Intersects;
+		}
+
+		static FrustumContainResult CullSphereScalar(const FrustumPlanesSoA& planes, const Bounds_Sphere& bounds)
+		{
+			bool all_inside = true;
+			bool intersects = false;
+
+			for (size_t i = 0; i < 6; ++i)
+			{
+				float distance_to_center = planes.NormalX[i] * bounds.BoundsCentre.x + planes.NormalY[i] * bounds.BoundsCentre.y + planes.NormalZ[i] * bounds.BoundsCentre.z + planes.Distance[i];
+
+				if (distance_to_center < -bounds.BoundsRadius)
+					return FrustumContainResult::DoesNotContain;
+
+				if (distance_to_center < bounds.BoundsRadius)
+					intersects = true;
+
+				if (distance_to_center <= 0)
+					all_inside = false;
+			}
+
+			if (all_inside)
+				return FrustumContainResult::Contains;
+
+			return intersects ? FrustumContainResult::Intersects : FrustumContainResult::DoesNotContain;
+		}
+
+		/// <summary>
+		/// Expands the lane masks of one SIMD iteration into results.
+		/// </summary>
+		static void WriteLaneResults(uint32_t lane_count, int outside_mask, int not_inside_mask, int intersects_mask, FrustumContainResult* out_results)
+		{
+			for (uint32_t lane = 0; lane < lane_count; ++lane)
+			{
+				if (outside_mask & (1 << lane))
+					out_results[lane] = FrustumContainResult::DoesNotContain;
+				else if (!(not_inside_mask & (1 << lane)))
+					out_results[lane] = FrustumContainResult::Contains;
+				else if (intersects_mask & (1 << lane))
+					out_results[lane] = FrustumContainResult::Intersects;
+				else
+					out_results[lane] = FrustumContainResult::DoesNotContain;
+			}
+		}
+
+#pragma endregion
+
+#if defined(BC_CULLING_X86)
+
+#pragma region SSE4
+
+		BC_TARGET_SSE4 static void CullAABBsSSE4(const FrustumPlanesSoA& planes, const Bounds_AABB* bounds, size_t count, FrustumContainResult* out_results)
+		{
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				alignas(16) float lanes[6][4];
+				for (size_t lane = 0; lane < 4; ++lane)
+				{
+					const Bounds_AABB& aabb = bounds[i + lane];
+					lanes[0][lane] = aabb.BoundsMin.x; lanes[1][lane] = aabb.BoundsMin.y; lanes[2][lane] = aabb.BoundsMin.z;
+					lanes[3][lane] = aabb.BoundsMax.x; lanes[4][lane] = aabb.BoundsMax.y; lanes[5][lane] = aabb.BoundsMax.z;
+				}
+
+				__m128 min_x = _mm_load_ps(lanes[0]), min_y = _mm_load_ps(lanes[1]), min_z = _mm_load_ps(lanes[2]);
+				__m128 max_x = _mm_load_ps(lanes[3]), max_y = _mm_load_ps(lanes[4]), max_z = _mm_load_ps(lanes[5]);
+
+				__m128 zero = _mm_setzero_ps();
+				__m128 outside = zero;
+				__m128 not_inside = zero;
+
+				for (size_t p = 0; p < 6; ++p)
+				{
+					__m128 normal_x = _mm_set1_ps(planes.NormalX[p]);
+					__m128 normal_y = _mm_set1_ps(planes.NormalY[p]);
+					__m128 normal_z = _mm_set1_ps(planes.NormalZ[p]);
+					__m128 distance = _mm_set1_ps(planes.Distance[p]);
+
+					// The plane is the same for every lane, so picking the
+					// positive and negative vertex is a single branch per axis
+					__m128 positive_x = planes.NormalX[p] >= 0 ? max_x : min_x, negative_x = planes.NormalX[p] >= 0 ? min_x : max_x;
+					__m128 positive_y = planes.NormalY[p] >= 0 ? max_y : min_y, negative_y = planes.NormalY[p] >= 0 ? min_y : max_y;
+					__m128 positive_z = planes.NormalZ[p] >= 0 ? max_z : min_z, negative_z = planes.NormalZ[p] >= 0 ? min_z : max_z;
+
+					__m128 distance_to_positive = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(normal_x, positive_x), _mm_mul_ps(normal_y, positive_y)), _mm_mul_ps(normal_z, positive_z)), distance);
+					__m128 distance_to_negative = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(normal_x, negative_x), _mm_mul_ps(normal_y, negative_y)), _mm_mul_ps(normal_z, negative_z)), distance);
+
+					outside = _mm_or_ps(outside, _mm_and_ps(_mm_cmplt_ps(distance_to_positive, zero), _mm_cmplt_ps(distance_to_negative, zero)));
+					not_inside = _mm_or_ps(not_inside, _mm_or_ps(_mm_cmpnge_ps(distance_to_positive, zero), _mm_cmpnge_ps(distance_to_negative, zero)));
+				}
+
+				WriteLaneResults(4, _mm_movemask_ps(outside), _mm_movemask_ps(not_inside), 0xF, out_results + i);
+			}
+
+			for (; i < count; ++i)
+				out_results[i] = CullAABBScalar(planes, bounds[i]);
+		}
+
+		BC_TARGET_SSE4 static void CullSpheresSSE4(const FrustumPlanesSoA& planes, const Bounds_Sphere* bounds, size_t count, FrustumContainResult* out_results)
+		{
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				alignas(16) float lanes[4][4];
+				for (size_t lane = 0; lane < 4; ++lane)
+				{
+					const Bounds_Sphere& sphere = bounds[i + lane];
+					lanes[0][lane] = sphere.BoundsCentre.x; lanes[1][lane] = sphere.BoundsCentre.y; lanes[2][lane] = sphere.BoundsCentre.z;
+					lanes[3][lane] = sphere.BoundsRadius;
+				}
+
+				__m128 centre_x = _mm_load_ps(lanes[0]), centre_y = _mm_load_ps(lanes[1]), centre_z = _mm_load_ps(lanes[2]);
+				__m128 radius = _mm_load_ps(lanes[3]);
+				__m128 negative_radius = _mm_xor_ps(radius, _mm_set1_ps(-0.0f));
+
+				__m128 zero = _mm_setzero_ps();
+				__m128 outside = zero;
+				__m128 not_inside = zero;
+				__m128 intersects = zero;
+
+				for (size_t p = 0; p < 6; ++p)
+				{
+					__m128 distance_to_center = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+						_mm_mul_ps(_mm_set1_ps(planes.NormalX[p]), centre_x),
+						_mm_mul_ps(_mm_set1_ps(planes.NormalY[p]), centre_y)),
+						_mm_mul_ps(_mm_set1_ps(planes.NormalZ[p]), centre_z)),
+						_mm_set1_ps(planes.Distance[p]));
+
+					outside = _mm_or_ps(outside, _mm_cmplt_ps(distance_to_center, negative_radius));
+					intersects = _mm_or_ps(intersects, _mm_cmplt_ps(distance_to_center, radius));
+					not_inside = _mm_or_ps(not_inside, _mm_cmple_ps(distance_to_center, zero));
+				}
+
+				WriteLaneResults(4, _mm_movemask_ps(outside), _mm_movemask_ps(not_inside), _mm_movemask_ps(intersects), out_results + i);
+			}
+
+			for (; i < count; ++i)
+				out_results[i] = CullSphereScalar(planes, bounds[i]);
+		}
+
+#pragma endregion
+
+#pragma region AVX2
+
+		BC_TARGET_AVX2 static void CullAABBsAVX2(const FrustumPlanesSoA& planes, const Bounds_AABB* bounds, size_t count, FrustumContainResult* out_results)
+		{
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				alignas(32) float lanes[6][8];
+				for (size_t lane = 0; lane < 8; ++lane)
+				{
+					const Bounds_AABB& aabb = bounds[i + lane];
+					lanes[0][lane] = aabb.BoundsMin.x; lanes[1][lane] = aabb.BoundsMin.y; lanes[2][lane] = aabb.BoundsMin.z;
+					lanes[3][lane] = aabb.BoundsMax.x; lanes[4][lane] = aabb.BoundsMax.y; lanes[5][lane] = aabb.BoundsMax.z;
+				}
+
+				__m256 min_x = _mm256_load_ps(lanes[0]), min_y = _mm256_load_ps(lanes[1]), min_z = _mm256_load_ps(lanes[2]);
+				__m256 max_x = _mm256_load_ps(lanes[3]), max_y = _mm256_load_ps(lanes[4]), max_z = _mm256_load_ps(lanes[5]);
+
+				__m256 zero = _mm256_setzero_ps();
+				__m256 outside = zero;
+				__m256 not_inside = zero;
+
+				for (size_t p = 0; p < 6; ++p)
+				{
+					__m256 normal_x = _mm256_set1_ps(planes.NormalX[p]);
+					__m256 normal_y = _mm256_set1_ps(planes.NormalY[p]);
+					__m256 normal_z = _mm256_set1_ps(planes.NormalZ[p]);
+					__m256 distance = _mm256_set1_ps(planes.Distance[p]);
+
+					__m256 positive_x = planes.NormalX[p] >= 0 ? max_x : min_x, negative_x = planes.NormalX[p] >= 0 ? min_x : max_x;
+					__m256 positive_y = planes.NormalY[p] >= 0 ? max_y : min_y, negative_y = planes.NormalY[p] >= 0 ? min_y : max_y;
+					__m256 positive_z = planes.NormalZ[p] >= 0 ? max_z : min_z, negative_z = planes.NormalZ[p] >= 0 ? min_z : max_z;
+
+					// Kept as separate multiplies and adds, fusing them would round
+					// differently to the scalar path
+					__m256 distance_to_positive = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(normal_x, positive_x), _mm256_mul_ps(normal_y, positive_y)), _mm256_mul_ps(normal_z, positive_z)), distance);
+					__m256 distance_to_negative = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(normal_x, negative_x), _mm256_mul_ps(normal_y, negative_y)), _mm256_mul_ps(normal_z, negative_z)), distance);
+
+					outside = _mm256_or_ps(outside, _mm256_and_ps(_mm256_cmp_ps(distance_to_positive, zero, _CMP_LT_OQ), _mm256_cmp_ps(distance_to_negative, zero, _CMP_LT_OQ)));
+					not_inside = _mm256_or_ps(not_inside, _mm256_or_ps(_mm256_cmp_ps(distance_to_positive, zero, _CMP_NGE_UQ), _mm256_cmp_ps(distance_to_negative, zero, _CMP_NGE_UQ)));
+				}
+
+				WriteLaneResults(8, _mm256_movemask_ps(outside), _mm256_movemask_ps(not_inside), 0xFF, out_results + i);
+			}
+
+			CullAABBsSSE4(planes, bounds + i, count - i, out_results + i);
+		}
+
+		BC_TARGET_AVX2 static void CullSpheresAVX2(const FrustumPlanesSoA& planes, const Bounds_Sphere* bounds, size_t count, FrustumContainResult* out_results)
+		{
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				alignas(32) float lanes[4][8];
+				for (size_t lane = 0; lane < 8; ++lane)
+				{
+					const Bounds_Sphere& sphere = bounds[i + lane];
+					lanes[0][lane] = sphere.BoundsCentre.x; lanes[1][lane] = sphere.BoundsCentre.y; lanes[2][lane] = sphere.BoundsCentre.z;
+					lanes[3][lane] = sphere.BoundsRadius;
+				}
+
+				__m256 centre_x = _mm256_load_ps(lanes[0]), centre_y = _mm256_load_ps(lanes[1]), centre_z = _mm256_load_ps(lanes[2]);
+				__m256 radius = _mm256_load_ps(lanes[3]);
+				__m256 negative_radius = _mm256_xor_ps(radius, _mm256_set1_ps(-0.0f));
+
+				__m256 zero = _mm256_setzero_ps();
+				__m256 outside = zero;
+				__m256 not_inside = zero;
+				__m256 intersects = zero;
+
+				for (size_t p = 0; p < 6; ++p)
+				{
+					__m256 distance_to_center = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+						_mm256_mul_ps(_mm256_set1_ps(planes.NormalX[p]), centre_x),
+						_mm256_mul_ps(_mm256_set1_ps(planes.NormalY[p]), centre_y)),
+						_mm256_mul_ps(_mm256_set1_ps(planes.NormalZ[p]), centre_z)),
+						_mm256_set1_ps(planes.Distance[p]));
+
+					outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance_to_center, negative_radius, _CMP_LT_OQ));
+					intersects = _mm256_or_ps(intersects, _mm256_cmp_ps(distance_to_center, radius, _CMP_LT_OQ));
+					not_inside = _mm256_or_ps(not_inside, _mm256_cmp_ps(distance_to_center, zero, _CMP_LE_OQ));
+				}
+
+				WriteLaneResults(8, _mm256_movemask_ps(outside), _mm256_movemask_ps(not_inside), _mm256_movemask_ps(intersects), out_results + i);
+			}
+
+			CullSpheresSSE4(planes, bounds + i, count - i, out_results + i);
+		}
+
+#pragma endregion
+
+#endif
+
+#pragma region Dispatch
+
+		static CullingInstructionSet DetectCullingInstructionSet()
+		{
+#if defined(BC_CULLING_X86)
+	#if defined(_MSC_VER)
+			int cpu_info[4] = {};
+			__cpuid(cpu_info, 0);
+			int max_leaf = cpu_info[0];
+
+			__cpuid(cpu_info, 1);
+			bool sse41 = (cpu_info[2] & (1 << 19)) != 0;
+			bool os_saves_avx = (cpu_info[2] & (1 << 27)) != 0 && (cpu_info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+
+			bool avx2 = false;
+			if (max_leaf >= 7 && os_saves_avx)
+			{
+				__cpuidex(cpu_info, 7, 0);
+				avx2 = (cpu_info[1] & (1 << 5)) != 0;
+			}
+	#else
+			__builtin_cpu_init();
+			bool sse41 = __builtin_cpu_supports("sse4.1");
+			bool avx2 = __builtin_cpu_supports("avx2");
+	#endif
+			if (avx2)
+				return CullingInstructionSet::AVX2;
+
+			if (sse41)
+				return CullingInstructionSet::SSE4;
+#endif
+			return CullingInstructionSet::Scalar;
+		}
+
+		CullingInstructionSet GetCullingInstructionSet()
+		{
+			static const CullingInstructionSet s_InstructionSet = DetectCullingInstructionSet();
+			return s_InstructionSet;
+		}
+
+		void CullAABBs(CullingInstructionSet instruction_set, const FrustumPlanesSoA& planes, const Bounds_AABB* bounds, size_t count, FrustumContainResult* out_results)
+		{
+			if (static_cast<uint8_t>(instruction_set) > static_cast<uint8_t>(GetCullingInstructionSet()))
+				instruction_set = CullingInstructionSet::Scalar;
+
+			switch (instruction_set)
+			{
+#if defined(BC_CULLING_X86)
+				case CullingInstructionSet::AVX2:	CullAABBsAVX2(planes, bounds, count, out_results); return;
+				case CullingInstructionSet::SSE4:	CullAABBsSSE4(planes, bounds, count, out_results); return;
+#endif
+				default:
+				{
+					for (size_t i = 0; i < count; ++i)
+						out_results[i] = CullAABBScalar(planes, bounds[i]);
+					return;
+				}
+			}
+		}
+
+		void CullSpheres(CullingInstructionSet instruction_set, const FrustumPlanesSoA& planes, const Bounds_Sphere* bounds, size_t count, FrustumContainResult* out_results)
+		{
+			if (static_cast<uint8_t>(instruction_set) > static_cast<uint8_t>(GetCullingInstructionSet()))
+				instruction_set = CullingInstructionSet::Scalar;
+
+			switch (instruction_set)
+			{
+#if defined(BC_CULLING_X86)
+				case CullingInstructionSet::AVX2:	CullSpheresAVX2(planes, bounds, count, out_results); return;
+				case CullingInstructionSet::SSE4:	CullSpheresSSE4(planes, bounds, count, out_results); return;
+#endif
+				default:
+				{
+					for (size_t i = 0; i < count; ++i)
+						out_results[i] = CullSphereScalar(planes, bounds[i]);
+					return;
+				}
+			}
+		}
+
+		void CullAABBs(const FrustumPlanesSoA& planes, const Bounds_AABB* bounds, size_t count, FrustumContainResult* out_results)
+		{
+			CullAABBs(GetCullingInstructionSet(), planes, bounds, count, out_results);
+		}
+
+		void CullSpheres(const FrustumPlanesSoA& planes, const Bounds_Sphere* bounds, size_t count, FrustumContainResult* out_results)
+		{
+			CullSpheres(GetCullingInstructionSet(), planes, bounds, count, out_results);
+		}
+
+#pragma endregion
+
+	}
+
+}
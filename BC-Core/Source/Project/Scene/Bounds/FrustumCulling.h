@@ -0,0 +1,63 @@
+#pragma once
+
+// Core Headers
+#include "Bounds.h"
+#include "Frustum.h"
+
+// C++ Standard Library Headers
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// External Vendor Library Headers
+
+namespace BC
+{
+
+	/// <summary>
+	/// The planes of a frustum split into one array per component, so each
+	/// component can be broadcast across the lanes of a SIMD register.
+	/// </summary>
+	struct FrustumPlanesSoA
+    {
+		alignas(32) std::array<float, 6> NormalX{};
+		alignas(32) std::array<float, 6> NormalY{};
+		alignas(32) std::array<float, 6> NormalZ{};
+		alignas(32) std::array<float, 6> Distance{};
+
+		FrustumPlanesSoA() = default;
+		explicit FrustumPlanesSoA(const Frustum& frustum);
+	};
+
+	enum class CullingInstructionSet : uint8_t
+	{
+		Scalar,
+		SSE4,
+		AVX2
+	};
+
+	namespace Util
+    {
+		/// <summary>
+		/// The widest instruction set supported by the running CPU, detected
+		/// once and used by every batch culling call.
+		/// </summary>
+		CullingInstructionSet GetCullingInstructionSet();
+
+		/// <summary>
+		/// Tests a batch of bounds against a frustum, 8 at a time with AVX2 or 4
+		/// at a time with SSE4, writing one result per bounds. The results match
+		/// Frustum::Contains exactly whichever instruction set is used.
+		/// </summary>
+		void CullAABBs(const FrustumPlanesSoA& planes, const Bounds_AABB* bounds, size_t count, FrustumContainResult* out_results);
+		void CullSpheres(const FrustumPlanesSoA& planes, const Bounds_Sphere* bounds, size_t count, FrustumContainResult* out_results);
+
+		/// <summary>
+		/// Forces an instruction set, e.g., to compare a SIMD path against the
+		/// scalar path. Falls back to the scalar path if the CPU does not support it.
+		/// </summary>
+		void CullAABBs(CullingInstructionSet instruction_set, const FrustumPlanesSoA& planes, const Bounds_AABB* bounds, size_t count, FrustumContainResult* out_results);
+		void CullSpheres(CullingInstructionSet instruction_set, const FrustumPlanesSoA& planes, const Bounds_Sphere* bounds, size_t count, FrustumContainResult* out_results);
+	}
+
+}
@@ -10,11 +10,22 @@
 
 #include "Bounds.h"
 #include "Frustum.h"
+#include "FrustumCulling.h"
+#include "SpatialIndex.h"
 
 // C++ Standard Library Headers
 #include <memory>
 #include <vector>
 #include <array>
+#include <atomic>
+#include <bit>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include <queue>
 
 // External Vendor Library Headers
 #include <glm/glm.hpp>
@@ -85,780 +96,80 @@ namespace BC
 	};
 
 	template <typename DataType>
-	struct OctreeDataSource 
-    {
-		DataType Data;
-		Bounds_AABB Bounds;
-
-		OctreeDataSource() = delete;
-		OctreeDataSource(DataType data, Bounds_AABB bounds) : Data(data), Bounds(bounds) { }
-
-		OctreeDataSource(const OctreeDataSource& other) = default;
-		OctreeDataSource& operator=(const OctreeDataSource& other) = default;
-
-		OctreeDataSource(OctreeDataSource&& other) = default;
-		OctreeDataSource& operator=(OctreeDataSource&& other) = default;
-	};
-
-	template <typename DataType>
-	class OctreeBounds 
-    {
-
-	private:
-
-		class OctreeBoundsNode 
-        {
-
-		private:
-
-			using OctreeNode = std::shared_ptr<OctreeBoundsNode>;
-			using OctreeData = std::shared_ptr<OctreeDataSource<DataType>>;
-			friend class OctreeBounds;
-
-		public:
-
-			// Constructor and Destructor
-			OctreeBoundsNode() = default;
-			OctreeBoundsNode(Bounds_AABB node_bounds, OctreeBounds<DataType>* octree) : m_NodeBounds(node_bounds), m_Octree(octree){
-
-				m_LifeMax = m_Octree ? m_Octree->m_Config.MaxLifeIfEmpty : 8;
-
-				m_NodeMat4 = m_NodeBounds.GetGlobalBoundsMat4();
-				m_ChildrenBounds = this->CalculateChildBounds();
-			}
-			~OctreeBoundsNode() = default;
-
-			// COPY
-			OctreeBoundsNode(const OctreeBoundsNode&) = default;
-			OctreeBoundsNode& operator=(const OctreeBoundsNode&) = default;
-
-			// MOVE
-			OctreeBoundsNode(OctreeBoundsNode&&) = default;
-			OctreeBoundsNode& operator=(OctreeBoundsNode&&) = default;
-
-			/// <summary>
-			/// This will attempt to insert a data source within the Octree.
-			/// </summary>
-			bool Insert(OctreeData data, size_t node_data_start_position, bool already_checked_contains = false) {
-
-				// 1. Set the position of the Node's data source start index
-				m_DataSourceIndex = node_data_start_position;
-
-				// 2. Have we already checked if this node contains the data source?
-				if (!already_checked_contains) {
-					// No we haven't so we will perform the check now!
-					if (m_NodeBounds.Contains(data->Bounds, m_Octree->m_Config.Looseness) != BoundsContainResult::Contains) {
-						// The data does not fit in the current node, return it to the caller :'( OR :D ... depends what node you're in ;)
-						return false;
-					}
-				}
-
-				// 3. First Insert Check: check if the current node has less than the suggested max data_sources
-				// or pass this check if the node has already been split.
-				if (m_DataSourceSize < m_Octree->m_Config.PreferredDataSourceLimit && !IsNodeSplit()) {
-					
-					InsertDataToNode(data);
-					return true;
-				}
-
-				// 4. Second Insert Check: are we able to split the node? 
-				
-				// If the children nodes will be smaller than the defined minimum size, we 
-				// will simply add to this node and return true.
-				glm::vec3 child_bounds_size = m_ChildrenBounds[0].Size();
-				if (child_bounds_size.x < m_Octree->m_Config.MinNodeSize || child_bounds_size.y < m_Octree->m_Config.MinNodeSize || child_bounds_size.z < m_Octree->m_Config.MinNodeSize) {
-
-					InsertDataToNode(data);
-					return true;
-				}
-
-				// Split the node as we should not place into the current node YET
-				if(!IsNodeSplit())
-					SplitNode();
-
-				// 5. Third Insert Check: Attempt insert into child node
-				size_t child_data_start = m_DataSourceIndex + m_DataSourceSize;
-				for (int i = 0; i < m_ChildrenBounds.size(); i++) {
-
-					if (m_ChildrenBounds[i].Contains(data->Bounds, m_Octree->m_Config.Looseness) == BoundsContainResult::Contains) {
-
-						if (!m_ChildrenNodes[i]) {
-							m_ChildrenNodes[i] = std::make_shared<OctreeBoundsNode>(m_ChildrenBounds[i], m_Octree);
-							m_IsNodeSplit = true;
-						}
-
-						if (m_ChildrenNodes[i]->Insert(data, child_data_start, true)) {
-							m_TotalNodeDataSourceSize++;
-							return true;
-						}
-						else { 
-							break; 
-						}
-
-					}
-
-					if(m_ChildrenNodes[i])
-						child_data_start += m_ChildrenNodes[i]->TotalCount();
-				}
-
-				// 6. Fourth Insert Check: If the data_source could not be inserted into a child
-				// or for some reason there was an error, we will just insert into this node.
-
-				InsertDataToNode(data);
-				return true;
-			}
-
-			/// <summary>
-			/// This will find the node that holds this data_position, and 
-			/// remove this data source from the Octree Storage, and update
-			/// the node size and all parent total node size.
-			/// </summary>
-			bool Remove(size_t data_position) {
-
-				// 1. Check if data position out of TOTAL node data bounds
-				size_t end = m_TotalNodeDataSourceSize > 0 ? m_DataSourceIndex + m_TotalNodeDataSourceSize - 1 : m_DataSourceIndex;
-				if (data_position < m_DataSourceIndex || data_position > end || m_TotalNodeDataSourceSize == 0)
-					return false;
-
-				// 2. Check if data position out of CURRENT node data bounds, we need to check children
-				end = m_DataSourceSize > 0 ? m_DataSourceIndex + m_DataSourceSize - 1 : 0;
-				if (data_position > end || m_DataSourceSize == 0) 
-                {
-					for (int i = 0; i < m_ChildrenNodes.size(); i++) 
-                    {
-						if (m_ChildrenNodes[i]) {
-							if (m_ChildrenNodes[i]->Remove(data_position)) 
-                            {
-								m_TotalNodeDataSourceSize--;
-								return true;
-							}
-						}
-					}
-
-					BC_CORE_WARN("Octree - Data Misalignment: Data Source Could Not Be Removed From Children.");
-					return false; // If this could not be removed from children, what the heck has happened here?
-				}
-
-				if (!m_Octree)
-					return false;
-
-				m_Octree->m_DataSources.erase(m_Octree->m_DataSources.begin() + data_position);
-				
-				if (m_DataSourceSize > 0)
-					m_DataSourceSize--;
-				
-				if (m_TotalNodeDataSourceSize > 0) 
-					m_TotalNodeDataSourceSize--;
-				
-				return true;
-			}
-
-			/// <summary>
-			/// Query a particular region and return a result.
-			/// </summary>
-			void Query(const Bounds_AABB& query_bounds, std::vector<OctreeData>& result, bool& should_delete_node) {
-
-				// If there are no data sources in itself or children 
-				// why bother testing this node?
-				if (TotalCount() == 0) {
-					should_delete_node = CheckShouldDeleteNode();
-					return;
-				}
-
-				switch (query_bounds.Contains(m_NodeBounds)) {
-
-				case BoundsContainResult::Contains: {
-
-					// Mmmm grab all of our contiguous data in one fell swoop, yummy
-					result.insert(
-						result.end(),
-						m_Octree->m_DataSources.begin() + m_DataSourceIndex,
-						m_Octree->m_DataSources.begin() + m_DataSourceIndex + TotalCount()
-					);
-					break;
-				}
-
-				case BoundsContainResult::Intersects: {
-
-					// Test intersection of each data source pertaining to this node
-					for (int i = 0; i < m_DataSourceSize; i++) {
-						try {
-							const auto& data = m_Octree->m_DataSources.at(m_DataSourceIndex + i);
-							if (query_bounds.Contains(data->Bounds) != BoundsContainResult::DoesNotContain)
-								result.push_back(data);
-						}
-						catch (const std::out_of_range& ex) {
-							BC_CORE_ERROR("Octree Query - Data Out of Range Could Not Test Intersection.");
-							BC_CORE_ERROR(ex.what());
-						}
-					}
-
-					// If Node is not split, just break
-					if (!IsNodeSplit())
-						break;
-
-					// Query children
-					for (int i = 0; i < m_ChildrenNodes.size(); i++) {
-
-						if (m_ChildrenNodes[i])
-						{
-							bool should_delete = false;
-							m_ChildrenNodes[i]->Query(query_bounds, result, should_delete);
-							if (should_delete && !m_ChildrenNodes[i]->IsRootNode()) {
-								m_ChildrenNodes[i]->Clear();
-								m_ChildrenNodes[i].reset();
-								m_ChildrenNodes[i] = nullptr;
-							}
-						}
-
-					}
-
-					break;
-				}
-
-				}
-			}
-
-			/// <summary>
-			/// Query a particular region and return a result.
-			/// </summary>
-			void Query(const Bounds_Sphere& query_bounds, std::vector<OctreeData>& result, bool& should_delete_node) {
-
-				// If there are no data sources in itself or children 
-				// why bother testing this node?
-				if (TotalCount() == 0) {
-					should_delete_node = CheckShouldDeleteNode();
-					return;
-				}
-
-				switch (query_bounds.Contains(m_NodeBounds)) {
-
-				case BoundsContainResult::Contains: {
-
-					// Mmmm grab all of our contiguous data in one fell swoop, yummy
-					result.insert(
-						result.end(),
-						m_Octree->m_DataSources.begin() + m_DataSourceIndex,
-						m_Octree->m_DataSources.begin() + m_DataSourceIndex + TotalCount()
-					);
-					break;
-				}
-
-				case BoundsContainResult::Intersects: {
-
-					// Test intersection of each data source pertaining to this node
-					for (int i = 0; i < m_DataSourceSize; i++) {
-						try {
-							const auto& data = m_Octree->m_DataSources.at(m_DataSourceIndex + i);
-							if (data && query_bounds.Contains(data->Bounds) != BoundsContainResult::DoesNotContain)
-								result.push_back(data);
-						}
-						catch (const std::out_of_range& ex) {
-							BC_CORE_ERROR("Octree Query - Data Out of Range Could Not Test Intersection.");
-							BC_CORE_ERROR(ex.what());
-						}
-					}
-
-					// If Node is not split, just break
-					if (!IsNodeSplit())
-						break;
-
-					// Query children
-					for (int i = 0; i < m_ChildrenNodes.size(); i++) {
-
-						if (m_ChildrenNodes[i])
-						{
-							bool should_delete = false;
-							m_ChildrenNodes[i]->Query(query_bounds, result, should_delete);
-							if (should_delete && !m_ChildrenNodes[i]->IsRootNode()) {
-								m_ChildrenNodes[i]->Clear();
-								m_ChildrenNodes[i].reset();
-								m_ChildrenNodes[i] = nullptr;
-							}
-						}
-
-					}
-
-					break;
-				}
-
-				}
-			}
-
-			/// <summary>
-			/// Query a particular region and return a result.
-			/// </summary>
-			void Query(const Frustum& frustum, std::vector<OctreeData>& result, bool& should_delete_node) {
-
-				// If there are no data sources in itself or children 
-				// why bother testing this node?
-				if (TotalCount() == 0) {
-					should_delete_node = CheckShouldDeleteNode();
-					return;
-				}
-				
-				switch (frustum.Contains(m_NodeBounds * m_Octree->m_Config.Looseness)) {
-
-					case FrustumContainResult::Contains: {
-						
-						// Mmmm grab all of our contiguous data in one fell swoop, yummy
-						result.insert(
-							result.end(),
-							m_Octree->m_DataSources.begin() + m_DataSourceIndex,
-							m_Octree->m_DataSources.begin() + m_DataSourceIndex + TotalCount()
-						);
-						break;
-					}
-
-					case FrustumContainResult::Intersects: {
-
-						// Test intersection of each data source pertaining to this node
-						for (int i = 0; i < m_DataSourceSize; i++) {
-							try {
-								const auto& data = m_Octree->m_DataSources.at(m_DataSourceIndex + i);
-								if (frustum.Contains(data->Bounds) != FrustumContainResult::DoesNotContain)
-									result.push_back(data);
-							}
-							catch (const std::out_of_range& ex) {
-								BC_CORE_ERROR("Octree Query - Data Out of Range Could Not Test Intersection.");
-								BC_CORE_ERROR(ex.what());
-							}
-						}
-
-						// If Node is not split, just break
-						if (!IsNodeSplit())
-							break;
-
-						// Query children
-						for (int i = 0; i < m_ChildrenNodes.size(); i++) {
-
-							if (m_ChildrenNodes[i])
-							{
-								bool should_delete = false;
-								m_ChildrenNodes[i]->Query(frustum, result, should_delete);
-								if (should_delete) {
-									m_ChildrenNodes[i].reset();
-									m_ChildrenNodes[i] = nullptr;
-								}
-							}
-
-						}
-
-						break;
-					}
-
-				}
-			}
-
-			/// <summary>
-			/// This should be called any time we make any changes 
-			/// to the Octree Data Storage to ensure all nodes point
-			/// to the valid index of where their data starts.
-			/// </summary>
-			void RevalidateNodes(size_t start_index) {
-
-				BC_ASSERT(start_index + m_DataSourceSize <= m_Octree->m_DataSources.size(), "Octree - Index Out Of Bounds!");
-
-				m_DataSourceIndex = start_index;
-
-				if (!IsNodeSplit()) {
-					return;
-				}
-
-				start_index += m_DataSourceSize;
-
-				for (int i = 0; i < m_ChildrenNodes.size(); i++) {
-					if (!m_ChildrenNodes[i])
-						continue;
-
-					m_ChildrenNodes[i]->RevalidateNodes(start_index);
-					start_index += m_ChildrenNodes[i]->TotalCount();
-				}
-
-				m_TotalNodeDataSourceSize = start_index - m_DataSourceIndex;
-			}
-
-			/// <summary>
-			/// Get count of node's data.
-			/// </summary>
-			/// <returns></returns>
-			const size_t& Count() const {
-				return m_DataSourceSize;
-			}
-
-			/// <summary>
-			/// Get count of node's data including children
-			/// data sources.
-			/// </summary>
-			size_t TotalCount() const {
-				return m_TotalNodeDataSourceSize;
-			}
-
-			/// <summary>
-			/// Manual recursive approach to getting the true
-			/// size of self and all child nodes data count.
-			/// </summary>
-			size_t ForceTotalCount() {
-
-				size_t count = m_DataSourceSize;
-
-				for (const auto& child_node : m_ChildrenNodes)
-					if (child_node)
-						count += child_node->ForceTotalCount();
-
-				m_TotalNodeDataSourceSize = count;
-
-				return count;
-			}
-
-			/// <summary>
-			/// This will clear all data sources in this and all children nodes.
-			/// </summary>
-			void Clear() {
-				// Clear data sources
-				m_Octree->m_DataSources.erase(m_Octree->m_DataSources.begin() + m_DataSourceIndex, m_Octree->m_DataSources.begin() + m_DataSourceIndex + TotalCount());
-				m_DataSourceSize = 0;
-				m_TotalNodeDataSourceSize = 0;
-
-				// Recursively clear child nodes
-				for (auto& child_node : m_ChildrenNodes) {
-					if (child_node) {
-						child_node.reset();
-						child_node = nullptr;
-					}
-				}
-
-				m_Octree->m_RootNode->RevalidateNodes(0);
-
-				// Reset split status
-				m_IsNodeSplit = false;
-			}
-
-			/// <summary>
-			/// This will tell us if our node has been split into children.
-			/// </summary>
-			bool IsNodeSplit() const {
-				return m_IsNodeSplit;
-			}
-
-			/// <summary>
-			/// This will tell us if we are in the root node or not.
-			/// </summary>
-			bool IsRootNode() const {
-
-				if (!m_Octree) {
-					BC_CORE_ERROR("Octree - Node Does Not Contain Valid Reference to Octree.");
-					return false;
-				}
-
-				if (m_Octree->GetRootNode().get() == this)
-					return true;
-				return false;
-			}
-
-			/// <summary>
-			/// This assigns a child node to this parent node.
-			/// </summary>
-			bool SetChildNode(int index, OctreeNode node) {
-				if (index >= 8 || index < 0)
-					return false;
-
-				m_ChildrenNodes[index] = node;
-				m_TotalNodeDataSourceSize += node->m_TotalNodeDataSourceSize;
-				m_IsNodeSplit = true;
-				return true;
-			}
-			
-			/// <summary>
-			/// This finds which child node a particular point would fit in best.
-			/// </summary>
-			int BestFitChild(const glm::vec3& point) {
-				for (int i = 0; i < m_ChildrenBounds.size(); i++) {
-					if (m_ChildrenBounds[i].Contains(point) == BoundsContainResult::Contains)
-						return i;
-				}
-				return -1; // Unsuccessful
-			}
-
-			/// <summary>
-			/// This will get the node bounds of the children directly relative to 
-			/// this node only, and not children of children.
-			/// </summary>
-			const std::array<Bounds_AABB, 8>& GetNodeChildBounds() const { return m_ChildrenBounds; }
-
-			/// <summary>
-			/// This will get the node bounds for this and all child nodes.
-			/// </summary>
-			std::vector<Bounds_AABB> GetRecursiveChildBounds() {
-				std::vector<Bounds_AABB> bounds_vector;
-				bounds_vector.push_back(GetNodeBounds());
-				
-				// Base case: if no children, return this nodes bounds
-				if (!IsNodeSplit()) {
-					return bounds_vector;
-				}
-
-				// Recursively gather bounds from child nodes
-				for (const auto& child : m_ChildrenNodes) {
-					if (child) {
-
-						// Recursively call this on children
-						if(std::vector<Bounds_AABB> child_bounds_vector = child->GetRecursiveChildBounds(); !child_bounds_vector.empty()) {
-							bounds_vector.insert(bounds_vector.end(), child_bounds_vector.begin(), child_bounds_vector.end());
-						}
-					}
-				}
-
-				return bounds_vector;
-			}
-
-			/// <summary>
-			/// This will get the node bounds glm::mat4 for this and all child nodes.
-			/// </summary>
-			std::vector<glm::mat4> GetRecursiveChildBoundsMat4() {
-				std::vector<glm::mat4> transforms_vector;
-				transforms_vector.push_back(GetNodeBoundsMat4());
-
-				// Base case: if no children, return this nodes mat4
-				if (!IsNodeSplit()) {
-					return transforms_vector;
-				}
-
-				// Recursively gather transforms from child nodes
-				for (const auto& child : m_ChildrenNodes) {
-					if (child) {
-
-						// Recursively call this on children
-						if (std::vector<glm::mat4> child_transforms_vector = child->GetRecursiveChildBoundsMat4(); !child_transforms_vector.empty()) {
-							transforms_vector.insert(transforms_vector.end(), child_transforms_vector.begin(), child_transforms_vector.end());
-						}
-
-					}
-				}
-
-				return transforms_vector;
-			}
-
-			/// <summary>
-			/// This will get the node bounds for this node only.
-			/// </summary>
-			const Bounds_AABB& GetNodeBounds() { return m_NodeBounds; }
-
-			/// <summary>
-			/// This will get the node bounds glm::mat4 for this node only.
-			/// </summary>
-			const glm::mat4& GetNodeBoundsMat4() { return m_NodeMat4; }
-
-		private:
-
-			/// <summary>
-			/// This will split the node and distribute it's children into
-			/// child nodes.
-			/// </summary>
-			void SplitNode() {
-
-				if (m_DataSourceSize == 0)
-					return;
-
-				std::vector<OctreeData> data_sources{};
-				data_sources.reserve(m_DataSourceSize);
-
-				// Move from global Octree and put into temporary storage to distribute data_sources
-				data_sources.insert(data_sources.begin(), m_Octree->m_DataSources.begin() + m_DataSourceIndex, m_Octree->m_DataSources.begin() + m_DataSourceIndex + m_DataSourceSize);
-				m_Octree->m_DataSources.erase(m_Octree->m_DataSources.begin() + m_DataSourceIndex, m_Octree->m_DataSources.begin() + m_DataSourceIndex + m_DataSourceSize);
-
-				m_DataSourceSize = 0;
-
-				size_t child_data_start = m_DataSourceIndex;
-
-				// Iterate through m_ChildrenBounds and see if can be placed in different children
-				for (int i = 0; i < m_ChildrenBounds.size(); i++) {
-
-					auto it = data_sources.begin();
-					while (it != data_sources.end()) {
-
-						if (m_ChildrenBounds[i].Contains((*it)->Bounds, m_Octree->m_Config.Looseness) == BoundsContainResult::Contains) {
-
-							if (!m_ChildrenNodes[i]) {
-								m_ChildrenNodes[i] = std::make_shared<OctreeBoundsNode>(m_ChildrenBounds[i], m_Octree);
-								m_ChildrenNodes[i]->m_DataSourceIndex = child_data_start;
-								m_IsNodeSplit = true;
-							}
-							m_ChildrenNodes[i]->m_DataSourceSize++;
-							m_ChildrenNodes[i]->m_TotalNodeDataSourceSize++;
-
-							m_Octree->m_DataSources.insert(m_Octree->m_DataSources.begin() + child_data_start, *it);
-							child_data_start++;
-
-							// Erase data from temporary vector, and ensure the while loop 
-							// iterator is no invalidated
-							it = data_sources.erase(it);
-							continue;
-						}
-						++it; // Continue to next element
-					}
-
-				}
-
-				for (auto& data_source : data_sources) {
-					size_t insert_position = m_DataSourceIndex + m_DataSourceSize;
-					m_Octree->m_DataSources.insert(m_Octree->m_DataSources.begin() + insert_position, data_source);
-					m_DataSourceSize++;
-				}
+	using OctreeDataSource = SpatialDataSource<DataType>;
 
-				// Revalidate child node start positions
-				for (int i = 0; i < m_ChildrenNodes.size(); i++) {
-					if (m_ChildrenNodes[i]) {
-						m_ChildrenNodes[i]->m_DataSourceIndex += m_DataSourceSize;
-					}
-				}
-			}
-
-			/// <summary>
-			/// This checks if this node should be deleted by its parent 
-			/// during a query.
-			/// </summary>
-			bool CheckShouldDeleteNode() {
-
-				// Set a roof of 64 queries it can be empty for before deletion
-				if (m_LifeCount < 64)
-					m_LifeCount++;
-
-				return (m_LifeCount > m_LifeMax);
-			}
-
-			/// <summary>
-			/// This will actually insert the data into the Octree Data Storage
-			/// when we have determined if something fits inside this node.
-			/// </summary>
-			void InsertDataToNode(OctreeData data) {
-
-				if (m_LifeCount > 0 || TotalCount() == 0) {
-					m_LifeCount = 0;
-					m_LifeMax = glm::min(m_LifeMax * 2, 64);
-				}
-
-				// 1. Determine the insert location for the data source.
-				size_t insert_position = m_DataSourceIndex + m_DataSourceSize;
-
-				// 2. Insert the new data source into the specified location, the global vector
-				// has already checked if there is enough room to insert, and allocated sufficient
-				// so storage we are safe to raw dog the insertion.
-				m_Octree->m_DataSources.insert(m_Octree->m_DataSources.begin() + insert_position, data);
-
-				// 3. Increment the current nodes data size by 1 because we successfully placed 
-				// this data in this node's memory location!
-				m_DataSourceSize++;
-				m_TotalNodeDataSourceSize++;
-			}
-
-			/// <summary>
-			/// This function will calculate the bounding regions for 8 children.
-			/// </summary>
-			/// <returns></returns>
-			std::array<Bounds_AABB, 8> CalculateChildBounds() const {
-				std::array<Bounds_AABB, 8> childBounds{};
-
-				// Calculate the size of each child node's bounding box (half the size of the current node)
-				glm::vec3 halfSize = m_NodeBounds.Size() * 0.5f;
-
-				// Calculate the center of the current node
-				glm::vec3 center = m_NodeBounds.Center();
-
-				// Generate the eight child bounding boxes
-				for (int i = 0; i < 8; ++i) {
-					glm::vec3 offset(
-						(i & 1 ? 0.5f : -0.5f) * halfSize.x,
-						(i & 2 ? 0.5f : -0.5f) * halfSize.y,
-						(i & 4 ? 0.5f : -0.5f) * halfSize.z
-					);
-
-					glm::vec3 childCenter = center + offset;
-
-					childBounds[i].BoundsMin = childCenter - halfSize * 0.5f;
-					childBounds[i].BoundsMax = childCenter + halfSize * 0.5f;
-				}
-
-				return childBounds;
-			}
-
-			/// <summary>
-			/// This is the index of the start of the DataSourceIndex in 
-			/// the Octree Data storage.
-			/// </summary>
-			size_t m_DataSourceIndex = 0;
 
-			/// <summary>
-			/// This is the size of how many DataSources are contained in 
-			/// this Node at the DataSourceIndex in the Octree Data Storage.
-			/// </summary>
-			size_t m_DataSourceSize = 0;
+	template <typename DataType>
+	class OctreeBounds : public SpatialIndex<DataType>
+    {
 
-			/// <summary>
-			/// The current size of self including all child data sources.
-			/// </summary>
-			size_t m_TotalNodeDataSourceSize = 0;
+	public:
 
-			/// <summary>
-			/// Array of pointers to 8 (oct) child nodes of this node.
-			/// </summary>
-			std::array<OctreeNode, 8> m_ChildrenNodes{ nullptr };
+		using OctreeData = OctreeDataSource<DataType>;
+		using typename SpatialIndex<DataType>::ViewMask;
+		using typename SpatialIndex<DataType>::QueryHit;
+		using SpatialIndex<DataType>::MAX_QUERY_VIEWS;
 
-			/// <summary>
-			/// Array of 8 (oct) child nodes bounding regions for this node.
-			/// </summary>
-			std::array<Bounds_AABB, 8> m_ChildrenBounds{};
+		/// <summary>
+		/// Nodes and data sources refer to each other by 32-bit index, so the
+		/// pools can grow without invalidating any links.
+		/// </summary>
+		static constexpr uint32_t NULL_INDEX = std::numeric_limits<uint32_t>::max();
 
-			/// <summary>
-			/// This tells us if this node has been split into child nodes or not.
-			/// </summary>
-			bool m_IsNodeSplit = false;
+		/// <summary>
+		/// The root node always lives at the front of the node pool.
+		/// </summary>
+		static constexpr uint32_t ROOT_NODE = 0;
 
+		/// <summary>
+		/// A node of the Octree, stored by value in the node pool. The 8 children
+		/// of a split node are allocated together as one contiguous block, so a
+		/// node only needs the index of the first child.
+		/// </summary>
+		struct OctreeNode 
+        {
 			/// <summary>
 			/// The actual bounds of the node unaffected by the looseness.
 			/// 
-			/// Please note, this is not varied when looseness changes. This 
-			/// will always be the actual bounds of the current node.
-			/// 
 			/// The looseness will ONLY be taken into account when attempting 
 			/// to insert a Data Source, or querying a particular node.
 			/// </summary>
-			Bounds_AABB m_NodeBounds;
+			Bounds_AABB Bounds;
+
+			uint32_t Parent = NULL_INDEX;
 
 			/// <summary>
-			/// This is the mat4 in worldspace of this current node. This is
-			/// useful for when we want to draw the debug version of the octree
-			/// and to save on performance, we calculate this once when the 
-			/// node is created, opposed to every frame.
+			/// Index of the first of the 8 child nodes, NULL_INDEX if this node
+			/// has not been split.
 			/// </summary>
-			glm::mat4 m_NodeMat4;
+			uint32_t ChildBlock = NULL_INDEX;
 
 			/// <summary>
-			/// Pointer to the Octree holding class that contains the root node.
+			/// Head of the list of data slots held directly by this node.
 			/// </summary>
-			OctreeBounds<DataType>* m_Octree;
+			uint32_t FirstData = NULL_INDEX;
 
 			/// <summary>
-			/// This is the max amount of times a node can be queried whilst itself 
-			/// and its children have no data sources.
+			/// Data sources held directly by this node.
 			/// </summary>
-			uint8_t m_LifeMax;
+			uint32_t DataCount = 0;
 
 			/// <summary>
-			/// This is the death counter, it will start at 0 and work its way up to 
-			/// Life Max each time this node is queried. If it reaches LifeMax it 
-			/// will delete the current node and all its children. If the node is 
-			/// saved and something is placed in it, then the LifeMax of the node 
-			/// is doubled.
+			/// Data sources held by this node and all of its descendants.
 			/// </summary>
-			uint8_t m_LifeCount = 0;
-		};
-		
-        using OctreeNode = std::shared_ptr<OctreeBoundsNode>;
+			uint32_t TotalDataCount = 0;
 
-	public:
+			/// <summary>
+			/// This is the max amount of times a node can be queried whilst its 
+			/// children have no data sources before the children are released. 
+			/// It is doubled each time the node is saved by something being 
+			/// placed in it, up to 64.
+			/// </summary>
+			uint8_t LifeMax = 8;
+			uint8_t LifeCount = 0;
 
-		using OctreeData = std::shared_ptr<OctreeDataSource<DataType>>;
+			bool IsSplit() const { return ChildBlock != NULL_INDEX; }
+		};
 
 	public:
 
@@ -879,12 +190,7 @@ namespace BC
 			BuildOctree(data_sources);
 		};
 
-		~OctreeBounds() 
-        {
-			m_DataSources.clear();
-			m_RootNode.reset();
-			m_RootNode = nullptr;
-		};
+		~OctreeBounds() override = default;
 		
 		OctreeBounds(const OctreeBounds& other) = default;
 		OctreeBounds& operator=(const OctreeBounds& other) = default;
@@ -893,96 +199,46 @@ namespace BC
 		OctreeBounds& operator=(OctreeBounds&& other) = default;
 
 		/// <summary>
-		/// This will attempt to insert a data source which has  been
-		/// created into a shared_ptr already.
+		/// This will attempt to insert a data source into the Octree.
 		/// </summary>
-		bool Insert(OctreeData data_source) 
+		bool Insert(const OctreeData& data_source) 
         {
-			if (!m_RootNode) 
-            {
-				BC_CORE_ERROR("Octree - Root Node Invalid or Octree Not Built - Cannot Insert Data Source.");
-				return false;
-			}
-
-			int octree_growth_attempts = 0;
-			const int max_attempts = 20; // We are expanding to infinity if we even get close to this number....
-			std::array<Bounds_AABB, max_attempts> parent_node_bounding_region{};
-
-			OctreeNode old_root_node_for_if_fail = m_RootNode;
-			while (!m_RootNode->Insert(data_source, 0, false)) 
-            {
-				if (octree_growth_attempts < max_attempts) 
-                {
-					GrowOctree(data_source->Bounds.Center() - m_RootNode->GetNodeBounds().Center());
-				}
-				else 
-                {
-					BC_CORE_WARN("Octree - Could Not Grow the Octree to Fit Data Source.");
-					m_RootNode = old_root_node_for_if_fail;
-					return false;
-				}
-
-				octree_growth_attempts++;
-			}
-
-			// Revalidate the entire tree as we have successfully inserted the data source, this
-			// is because when we insert something, all following node data source index start
-			// positions will need to be shifted by 1
-			m_RootNode->RevalidateNodes(0);
-
-			return true;
+			return Insert(data_source.Data, data_source.Bounds);
 		}
 
 		/// <summary>
-		/// This will attempt to insert a data source which has not been
-		/// created into a shared_ptr yet.
+		/// This will attempt to insert a data source into the Octree, growing
+		/// the Octree if the data source lies outside of the root node.
+		/// 
+		/// Each data value is held once, inserting data already within the 
+		/// Octree will update its bounds instead.
 		/// </summary>
-		bool Insert(const DataType& data, const Bounds_AABB& bounds) 
+		bool Insert(const DataType& data, const Bounds_AABB& bounds) override
         {
-			if (m_DataSources.size() + 1 >= m_DataSources.capacity())
-				m_DataSources.reserve(m_DataSources.capacity() * 2);
-
-			auto data_source = std::make_shared<OctreeDataSource<DataType>>(data, bounds);
-
-			if (!Insert(data_source)) 
+			if (m_Nodes.empty()) 
             {
-				data_source.reset();
-				data_source = nullptr;
+				BC_CORE_ERROR("Octree - Root Node Invalid or Octree Not Built - Cannot Insert Data Source.");
 				return false;
 			}
-			return true;
-		}
 
-		/// <summary>
-		/// This will attempt to insert an entire vector of data sources 
-		/// into the Octree that have not been made into shared_ptr's yet.
-		/// </summary>
-		/// <returns>
-		/// If anything is returned, these are the data sources
-		/// that could not be inserted into the Octree. Deal with these
-		/// remaining data sources as you see fit.
-		/// </returns>
-		std::vector<OctreeDataSource<DataType>> InsertVector(const std::vector<OctreeDataSource<DataType>>& data_sources) 
-        {
-			// These are data sources that are out of bounds
-			std::vector<OctreeDataSource<DataType>> remaining_data_sources{};
-			remaining_data_sources.reserve(data_sources.size());
+			auto [it, inserted] = m_DataSlots.try_emplace(data, static_cast<uint32_t>(m_Data.size()));
+			if (!inserted)
+				return UpdateSlot(it->second, bounds);
 
-			if (m_DataSources.size() + data_sources.size() >= m_DataSources.capacity())
-				m_DataSources.reserve(m_DataSources.capacity() * 2);
+			uint32_t slot = it->second;
+			m_Data.push_back(data);
+			m_DataBounds.push_back(bounds);
+			m_DataNode.push_back(NULL_INDEX);
+			m_DataPrev.push_back(NULL_INDEX);
+			m_DataNext.push_back(NULL_INDEX);
 
-			for (const auto& data : data_sources) 
+			if (!InsertSlot(slot)) 
             {
-				auto data_shared = std::make_shared<OctreeDataSource<DataType>>(data);
-				if (!Insert(data_shared)) 
-                {
-					remaining_data_sources.push_back(data);
-					data_shared.reset();
-					data_shared = nullptr;
-				}
+				m_DataSlots.erase(it);
+				PopSlot();
+				return false;
 			}
-
-			return remaining_data_sources;
+			return true;
 		}
 
 		/// <summary>
@@ -998,10 +254,8 @@ namespace BC
         {
 			// These are data sources that are out of bounds
 			std::vector<OctreeData> remaining_data_sources{};
-			remaining_data_sources.reserve(data_sources.size());
 
-			if (m_DataSources.size() + data_sources.size() >= m_DataSources.capacity())
-				m_DataSources.reserve(m_DataSources.capacity() * 2);
+			ReserveSlots(m_Data.size() + data_sources.size());
 			
 			for (const auto& data : data_sources) 
             {
@@ -1015,52 +269,75 @@ namespace BC
 		/// <summary>
 		/// This will attempt to remove the data source from the Octree.
 		/// </summary>
-		bool Remove(const DataType& data) 
+		bool Remove(const DataType& data) override
         {
-			if (!m_RootNode)
+			if (m_Nodes.empty())
 				return false;
 
-			auto it = std::find_if(m_DataSources.begin(), m_DataSources.end(),
-				[&data](const OctreeData& storedData) {
-					return storedData->Data == data;
-			});
-			
-			if (it == m_DataSources.end()) 
+			auto it = m_DataSlots.find(data);
+			if (it == m_DataSlots.end()) 
             {
 				BC_CORE_WARN("Octree - Data Not Found in Data Sources.");
 				return false;
 			}
 
-			// Remove the data from the octree node
-			size_t position = std::distance(m_DataSources.begin(), it);
-			
-			if (!m_RootNode->Remove(position)) 
-            {
-				BC_CORE_ERROR("Octree - Data Not Actually Contained Within Octree.");
-				return false;
-			}
-
-			m_RootNode->RevalidateNodes(0);
+			RemoveSlot(it->second);
 			return true;
 		}
 
 		/// <summary>
-		/// This will update a data source within the current Octree. It will first
-		/// remove it from the Octree, then Insert into the Octree.
+		/// This will update the bounds of a data source within the current Octree.
+		/// 
+		/// The data source is left where it is while the new bounds still fit the 
+		/// loose bounds of its node, otherwise it climbs to the nearest ancestor 
+		/// which contains it and is placed again from there.
 		/// 
 		/// If the data source is not within the current Octree, it will just insert
 		/// it into the Octree.
 		/// </summary>
-		bool Update(const DataType& data, const Bounds_AABB& bounds) 
+		bool Update(const DataType& data, const Bounds_AABB& bounds) override
         {
-			if (!m_RootNode)
+			if (m_Nodes.empty())
 				return false;
 
-			Remove(data);
+			if (auto it = m_DataSlots.find(data); it != m_DataSlots.end()) 
+            {
+				return UpdateSlot(it->second, bounds);
+			}
 				
 			return Insert(data, bounds);
 		}
 
+		/// <summary>
+		/// This will update every data source moved during a frame in one batch.
+		/// </summary>
+		/// <returns>
+		/// If anything is returned, these are the data sources that could not be
+		/// placed and have been removed from the Octree.
+		/// </returns>
+		std::vector<OctreeData> UpdateMany(const std::vector<OctreeData>& data_sources) override
+        {
+			std::vector<OctreeData> remaining_data_sources{};
+
+			if (m_Nodes.empty())
+				return data_sources;
+
+			ReserveSlots(m_Data.size() + data_sources.size());
+
+			for (const auto& data : data_sources) 
+            {
+				if (!Update(data.Data, data.Bounds))
+					remaining_data_sources.push_back(data);
+			}
+
+			return remaining_data_sources;
+		}
+
+		bool Contains(const DataType& data) const override
+        { 
+			return m_DataSlots.find(data) != m_DataSlots.end(); 
+		}
+
 		/// <summary>
 		/// This will query the octree and return a const reference to a static vector.
 		/// 
@@ -1073,22 +350,9 @@ namespace BC
 		/// <param name="frustum">Bounds AABB Range to Query</param>
 		const std::vector<OctreeData>& Query(const Bounds_AABB& bounds) 
         {
-			if (m_QueryReturnVectors[0].capacity() == 0 || m_QueryReturnVectors[0].capacity() < m_DataSources.size()) 
-            {
-				m_QueryReturnVectors[0].reserve(m_DataSources.empty() ? 1024 : m_DataSources.size());
-			}
-
-			m_QueryReturnVectors[0].clear();
-
-			if (m_DataSources.empty())
-				return m_QueryReturnVectors[0];
-
-			if (m_RootNode) 
-            {
-				bool should_delete = false;
-				m_RootNode->Query(bounds, m_QueryReturnVectors[0], should_delete);
-			}
-			return m_QueryReturnVectors[0];
+			auto& result = PrepareQueryResult(0);
+			QueryNodes(result, bounds);
+			return result;
 		}
 
 		/// <summary>
@@ -1103,22 +367,9 @@ namespace BC
 		/// <param name="frustum">Bounds Sphere Range to Query</param>
 		const std::vector<OctreeData>& Query(const Bounds_Sphere& bounds) 
         {
-			if (m_QueryReturnVectors[1].capacity() == 0 || m_QueryReturnVectors[1].capacity() < m_DataSources.size()) 
-            {
-				m_QueryReturnVectors[1].reserve(m_DataSources.empty() ? 1024 : m_DataSources.size());
-			}
-
-			m_QueryReturnVectors[1].clear();
-
-			if (m_DataSources.empty())
-				return m_QueryReturnVectors[1];
-
-			if (m_RootNode) 
-            {
-				bool should_delete = false;
-				m_RootNode->Query(bounds, m_QueryReturnVectors[1], should_delete);
-			}
-			return m_QueryReturnVectors[1];
+			auto& result = PrepareQueryResult(1);
+			QueryNodes(result, bounds);
+			return result;
 		}
 
 		/// <summary>
@@ -1133,30 +384,428 @@ namespace BC
 		/// <param name="frustum">Camera Frustum to Query</param>
 		const std::vector<OctreeData>& Query(const Frustum& frustum) 
         {
-			if (m_QueryReturnVectors[2].capacity() == 0 || m_QueryReturnVectors[2].capacity() < m_DataSources.size()) 
+			auto& result = PrepareQueryResult(2);
+			QueryNodes(result, frustum);
+			return result;
+		}
+
+		// ----------------------------
+		//      Reentrant Queries
+		// ----------------------------
+
+		/// <summary>
+		/// Appends every data source within the query bounds to a buffer owned by 
+		/// the caller. These queries do not modify the Octree, so whoever holds
+		/// its mutex may fan them out across threads, see GetMutex.
+		/// 
+		/// Unlike the queries above, these never release empty child nodes.
+		/// </summary>
+		void Query(const Bounds_AABB& bounds, std::vector<OctreeData>& out_results) const override
+        {
+			QueryVisit(bounds, [&](const DataType& data, const Bounds_AABB& data_bounds) { out_results.emplace_back(data, data_bounds); });
+		}
+
+		void Query(const Bounds_Sphere& bounds, std::vector<OctreeData>& out_results) const override
+        {
+			QueryVisit(bounds, [&](const DataType& data, const Bounds_AABB& data_bounds) { out_results.emplace_back(data, data_bounds); });
+		}
+
+		void Query(const Frustum& frustum, std::vector<OctreeData>& out_results) const override
+        {
+			QueryVisit(frustum, [&](const DataType& data, const Bounds_AABB& data_bounds) { out_results.emplace_back(data, data_bounds); });
+		}
+
+		/// <summary>
+		/// Calls visit(const DataType&, const Bounds_AABB&) for every data source 
+		/// within the query bounds, which may be a Bounds_AABB, Bounds_Sphere or 
+		/// Frustum. Safe to call from any thread while it is locked, see GetMutex.
+		/// </summary>
+		template<typename QueryShape, typename VisitFunc>
+		void QueryVisit(const QueryShape& query_shape, VisitFunc&& visit) const 
+        {
+			if (m_Data.empty())
+				return;
+
+			FrustumPlanesSoA planes{};
+			if constexpr (std::is_same_v<QueryShape, Frustum>)
+				planes = FrustumPlanesSoA(query_shape);
+
+			std::vector<uint32_t> stack{};
+			stack.reserve(64);
+			stack.push_back(ROOT_NODE);
+
+			while (!stack.empty())
+			{
+				uint32_t node_index = stack.back();
+				stack.pop_back();
+
+				const OctreeNode& node = m_Nodes[node_index];
+
+				switch (ContainsNode(query_shape, node.Bounds * m_Config.Looseness)) 
+                {
+					case BoundsContainResult::Contains: 
+                    {
+						VisitSubtree(node_index, visit);
+						break;
+					}
+
+					case BoundsContainResult::Intersects: 
+                    {
+						VisitNodeData(query_shape, planes, node, visit);
+
+						if (node.IsSplit())
+						{
+							for (uint32_t i = 0; i < 8; i++)
+							{
+								if (m_Nodes[node.ChildBlock + i].TotalDataCount > 0)
+									stack.push_back(node.ChildBlock + i);
+							}
+						}
+						break;
+					}
+
+					default:
+						break;
+				}
+			}
+		}
+
+		/// <summary>
+		/// This will walk the Octree once for several views, e.g., every camera 
+		/// and shadow view of a frame, rather than once per view. Nodes are only 
+		/// tested against views that can still see them, and views which fully 
+		/// contain a node are not tested again below it.
+		/// 
+		/// Every data source visible to at least one view is appended to 
+		/// out_results, with the views that see it at the same index of out_view_masks.
+		/// Safe to call from any thread while it is locked, see GetMutex.
+		/// </summary>
+		void QueryFrustums(std::span<const Frustum> frustums, std::vector<OctreeData>& out_results, std::vector<ViewMask>& out_view_masks) const override
+        {
+			if (m_Data.empty() || frustums.empty())
+				return;
+
+			if (frustums.size() > MAX_QUERY_VIEWS) 
             {
-				m_QueryReturnVectors[2].reserve(m_DataSources.empty() ? 1024 : m_DataSources.size());
+				BC_CORE_WARN("Octree - Multi View Query Only Supports {0} Views, Ignoring the Remaining {1}.", MAX_QUERY_VIEWS, frustums.size() - MAX_QUERY_VIEWS);
+				frustums = frustums.first(MAX_QUERY_VIEWS);
+			}
+
+			struct StackEntry 
+            {
+				uint32_t Node;
+				ViewMask Active;	// Views yet to reject or fully contain the node
+				ViewMask Contained;	// Views that fully contain the node
+			};
+
+			ViewMask all_views = frustums.size() == MAX_QUERY_VIEWS ? ~ViewMask(0) : (ViewMask(1) << frustums.size()) - 1;
+
+			std::vector<FrustumPlanesSoA> view_planes(frustums.begin(), frustums.end());
+			std::array<FrustumContainResult, CULL_BATCH_SIZE> batch_results;
+			std::array<ViewMask, CULL_BATCH_SIZE> batch_views;
+
+			std::vector<StackEntry> stack{};
+			stack.reserve(64);
+			stack.push_back({ ROOT_NODE, all_views, 0 });
+
+			while (!stack.empty())
+			{
+				StackEntry entry = stack.back();
+				stack.pop_back();
+
+				const OctreeNode& node = m_Nodes[entry.Node];
+				Bounds_AABB loose_bounds = node.Bounds * m_Config.Looseness;
+
+				for (ViewMask views = entry.Active; views; views &= views - 1)
+				{
+					uint32_t view = static_cast<uint32_t>(std::countr_zero(views));
+					switch (ContainsNode(frustums[view], loose_bounds))
+					{
+						case BoundsContainResult::Contains:			entry.Contained |= ViewMask(1) << view; [[fallthrough]];
+						case BoundsContainResult::DoesNotContain:	entry.Active &= ~(ViewMask(1) << view); break;
+						default:									break;
+					}
+				}
+
+				if (!entry.Active && !entry.Contained)
+					continue;
+
+				ForEachDataBatch(node, [&](const uint32_t* slots, const Bounds_AABB* bounds, uint32_t count)
+				{
+					std::fill_n(batch_views.begin(), count, entry.Contained);
+
+					for (ViewMask views = entry.Active; views; views &= views - 1)
+					{
+						uint32_t view = static_cast<uint32_t>(std::countr_zero(views));
+						Util::CullAABBs(view_planes[view], bounds, count, batch_results.data());
+
+						for (uint32_t i = 0; i < count; i++)
+						{
+							if (batch_results[i] != FrustumContainResult::DoesNotContain)
+								batch_views[i] |= ViewMask(1) << view;
+						}
+					}
+
+					for (uint32_t i = 0; i < count; i++)
+					{
+						if (batch_views[i])
+						{
+							out_results.emplace_back(m_Data[slots[i]], m_DataBounds[slots[i]]);
+							out_view_masks.push_back(batch_views[i]);
+						}
+					}
+				});
+
+				if (node.IsSplit())
+				{
+					for (uint32_t i = 0; i < 8; i++)
+					{
+						if (m_Nodes[node.ChildBlock + i].TotalDataCount > 0)
+							stack.push_back({ node.ChildBlock + i, entry.Active, entry.Contained });
+					}
+				}
+			}
+		}
+
+		/// <summary>
+		/// Calls visit(const DataType&, const Bounds_AABB&, float distance) for
+		/// every data source the ray enters within max_distance, in no particular
+		/// order. The visitor returns the new max distance, e.g., the hit distance
+		/// to only look for nearer hits, or max_distance to find every hit.
+		/// </summary>
+		template<typename VisitFunc>
+		void QueryRayVisit(const Ray& ray, float max_distance, VisitFunc&& visit) const
+		{
+			if (m_Data.empty())
+				return;
+
+			std::vector<uint32_t> stack{};
+			stack.reserve(64);
+			stack.push_back(ROOT_NODE);
+
+			while (!stack.empty())
+			{
+				uint32_t node_index = stack.back();
+				stack.pop_back();
+
+				const OctreeNode& node = m_Nodes[node_index];
+
+				float distance = 0.0f;
+				if (!(node.Bounds * m_Config.Looseness).IntersectsRay(ray, max_distance, distance))
+					continue;
+
+				for (uint32_t slot = node.FirstData; slot != NULL_INDEX; slot = m_DataNext[slot])
+				{
+					if (m_DataBounds[slot].IntersectsRay(ray, max_distance, distance))
+						max_distance = std::min(max_distance, static_cast<float>(visit(m_Data[slot], m_DataBounds[slot], distance)));
+				}
+
+				if (node.IsSplit())
+				{
+					for (uint32_t i = 0; i < 8; i++)
+					{
+						if (m_Nodes[node.ChildBlock + i].TotalDataCount > 0)
+							stack.push_back(node.ChildBlock + i);
+					}
+				}
+			}
+		}
+
+		void QueryRay(const Ray& ray, float max_distance, std::vector<QueryHit>& out_hits, bool first_hit_only = false) const override
+		{
+			typename SpatialIndex<DataType>::RayHitCollector collector(out_hits, max_distance, first_hit_only);
+			QueryRayVisit(ray, max_distance, collector);
+			collector.Finish();
+		}
+
+		/// <summary>
+		/// Walks the nodes nearest first, stopping once the nearest remaining 
+		/// node is farther than every data source kept so far.
+		/// </summary>
+		void QueryNearest(const glm::vec3& point, size_t count, float max_distance, std::vector<QueryHit>& out_hits) const override
+		{
+			if (m_Data.empty() || count == 0)
+				return;
+
+			using NodeEntry = std::pair<float, uint32_t>;
+			std::priority_queue<NodeEntry, std::vector<NodeEntry>, std::greater<NodeEntry>> nodes{};
+			nodes.emplace(this->DistanceSquared(point, m_Nodes[ROOT_NODE].Bounds * m_Config.Looseness), ROOT_NODE);
+
+			typename SpatialIndex<DataType>::NearestCollector collector(out_hits, count, max_distance);
+
+			while (!nodes.empty())
+			{
+				auto [node_distance_squared, node_index] = nodes.top();
+				nodes.pop();
+
+				if (node_distance_squared > collector.GetBoundSquared())
+					break;
+
+				const OctreeNode& node = m_Nodes[node_index];
+
+				for (uint32_t slot = node.FirstData; slot != NULL_INDEX; slot = m_DataNext[slot])
+					collector.Offer(m_Data[slot], m_DataBounds[slot], this->DistanceSquared(point, m_DataBounds[slot]));
+
+				if (node.IsSplit())
+				{
+					for (uint32_t i = 0; i < 8; i++)
+					{
+						const OctreeNode& child = m_Nodes[node.ChildBlock + i];
+						if (child.TotalDataCount == 0)
+							continue;
+
+						float child_distance_squared = this->DistanceSquared(point, child.Bounds * m_Config.Looseness);
+						if (child_distance_squared <= collector.GetBoundSquared())
+							nodes.emplace(child_distance_squared, node.ChildBlock + i);
+					}
+				}
 			}
 
-			m_QueryReturnVectors[2].clear();
+			collector.Finish();
+		}
+
+		/// <summary>
+		/// This will deep copy the built octree without reinserting anything. The
+		/// node pool and data slots are copied as is, and each data source's data 
+		/// is passed through remap_data, e.g., to point an Entity at the same 
+		/// entity within a cloned scene.
+		/// </summary>
+		template<typename RemapFunc>
+		std::shared_ptr<OctreeBounds<DataType>> Clone(RemapFunc&& remap_data) const
+		{
+			auto octree = std::make_shared<OctreeBounds<DataType>>(m_Config);
+
+			octree->m_Nodes = m_Nodes;
+			octree->m_FreeChildBlocks = m_FreeChildBlocks;
+
+			octree->m_Data.clear();
+			octree->m_Data.reserve(m_Data.capacity());
+			for (const auto& data : m_Data)
+				octree->m_Data.push_back(remap_data(data));
+
+			octree->m_DataBounds = m_DataBounds;
+			octree->m_DataNode = m_DataNode;
+			octree->m_DataPrev = m_DataPrev;
+			octree->m_DataNext = m_DataNext;
+
+			octree->m_DataSlots.clear();
+			octree->m_DataSlots.reserve(octree->m_Data.size());
+			for (uint32_t slot = 0; slot < octree->m_Data.size(); slot++)
+				octree->m_DataSlots.emplace(octree->m_Data[slot], slot);
+
+			return octree;
+		}
+
+		std::shared_ptr<SpatialIndex<DataType>> CloneIndex(const std::function<DataType(const DataType&)>& remap_data) const override
+		{
+			return Clone(remap_data);
+		}
+
+		/// <summary>
+		/// Writes the node pool and data slots as they are, so ReadLayout can 
+		/// restore the octree without splitting or placing anything again.
+		/// </summary>
+		void WriteLayout(std::vector<uint8_t>& out_bytes, const std::function<uint64_t(const DataType&)>& data_to_id) const override
+		{
+			Util::SpatialLayoutWriter writer(out_bytes);
+			writer.Write(SpatialIndexType::Octree);
+			writer.Write(LAYOUT_VERSION);
+			writer.Write(m_Config);
+
+			writer.WriteArray(m_Nodes);
+			writer.WriteArray(m_FreeChildBlocks);
+			writer.WriteArray(m_DataBounds);
+			writer.WriteArray(m_DataNode);
+			writer.WriteArray(m_DataPrev);
+			writer.WriteArray(m_DataNext);
+
+			std::vector<uint64_t> data_ids;
+			data_ids.reserve(m_Data.size());
+			for (const auto& data : m_Data)
+				data_ids.push_back(data_to_id(data));
+
+			writer.WriteArray(data_ids);
+		}
 
-			if (m_DataSources.empty())
-				return m_QueryReturnVectors[2];
+		bool ReadLayout(std::span<const uint8_t> bytes, const std::function<std::optional<DataType>(uint64_t)>& id_to_data) override
+		{
+			Util::SpatialLayoutReader reader(bytes);
+
+			SpatialIndexType index_type = SpatialIndexType::Octree;
+			uint32_t version = 0;
+			OctreeBoundsConfig config{};
+			std::vector<OctreeNode> nodes;
+			std::vector<uint32_t> free_child_blocks;
+			std::vector<Bounds_AABB> data_bounds;
+			std::vector<uint32_t> data_node;
+			std::vector<uint32_t> data_prev;
+			std::vector<uint32_t> data_next;
+			std::vector<uint64_t> data_ids;
+
+			bool read =
+				reader.Read(index_type) && index_type == SpatialIndexType::Octree &&
+				reader.Read(version) && version == LAYOUT_VERSION &&
+				reader.Read(config) &&
+				reader.ReadArray(nodes) &&
+				reader.ReadArray(free_child_blocks) &&
+				reader.ReadArray(data_bounds) &&
+				reader.ReadArray(data_node) &&
+				reader.ReadArray(data_prev) &&
+				reader.ReadArray(data_next) &&
+				reader.ReadArray(data_ids) &&
+				reader.IsAtEnd();
+
+			if (!read || !IsLayoutValid(nodes, free_child_blocks, data_node, data_prev, data_next, data_bounds.size(), data_ids.size()))
+				return false;
 
-			if (m_RootNode) 
-            {
-				bool should_delete = false;
-				m_RootNode->Query(frustum, m_QueryReturnVectors[2], should_delete);
+			m_Config = config;
+			m_Nodes = std::move(nodes);
+			m_FreeChildBlocks = std::move(free_child_blocks);
+			m_DataBounds = std::move(data_bounds);
+			m_DataNode = std::move(data_node);
+			m_DataPrev = std::move(data_prev);
+			m_DataNext = std::move(data_next);
+
+			m_Data.assign(data_ids.size(), DataType{});
+			m_DataSlots.clear();
+			m_DataSlots.reserve(data_ids.size());
+
+			std::vector<uint32_t> unresolved_slots;
+			for (uint32_t slot = 0; slot < data_ids.size(); slot++)
+			{
+				std::optional<DataType> data = id_to_data(data_ids[slot]);
+				if (data && m_DataSlots.try_emplace(*data, slot).second)
+					m_Data[slot] = *data;
+				else
+					unresolved_slots.push_back(slot);
 			}
-			return m_QueryReturnVectors[2];
+
+			// Removing from the back means the slot moved into each hole has
+			// already been resolved
+			for (auto it = unresolved_slots.rbegin(); it != unresolved_slots.rend(); ++it)
+				RemoveSlot(*it);
+
+			return true;
+		}
+
+		bool TryGetBounds(const DataType& data, Bounds_AABB& out_bounds) const override
+		{
+			auto it = m_DataSlots.find(data);
+			if (it == m_DataSlots.end())
+				return false;
+
+			out_bounds = m_DataBounds[it->second];
+			return true;
 		}
 
+		SpatialIndexType GetIndexType() const override { return SpatialIndexType::Octree; }
+
 		/// <summary>
 		/// This will rebuild the octree with all its current data sources.
 		/// </summary>
 		void RebuildOctree() 
         {
-			std::unique_lock lock(m_OctreeMutex);
+			std::unique_lock lock(this->GetMutex());
 			BuildOctree();
 		}
 
@@ -1166,7 +815,7 @@ namespace BC
 		/// </summary>
 		void RebuildOctree(const OctreeBoundsConfig& new_config) 
         {
-			std::unique_lock lock(m_OctreeMutex);
+			std::unique_lock lock(this->GetMutex());
 			m_Config = new_config;
 			BuildOctree();
 		}
@@ -1177,41 +826,44 @@ namespace BC
 		/// <returns></returns>
 		size_t Count() const 
         { 
-			return m_RootNode ? m_RootNode->Count() : 0; 
+			return m_Nodes.empty() ? 0 : m_Nodes[ROOT_NODE].DataCount; 
 		}
 
 		/// <summary>
 		/// This will return the 'lazy' approach count which tracks the
 		/// total count of its data sources and sub nodes data sources.
 		/// </summary>
-		size_t TotalCount() const 
+		size_t TotalCount() const override
         {
-			return m_RootNode ? m_RootNode->TotalCount() : 0;
+			return m_Nodes.empty() ? 0 : m_Nodes[ROOT_NODE].TotalDataCount;
 		}
 
 		/// <summary>
 		/// This will force a manual recursive count of all the Octree's node
 		/// data sources to ensure accuracy.
 		/// </summary>
-		size_t ForceTotalCount() const 
+		size_t ForceTotalCount() 
         {
-			return m_RootNode ? m_RootNode->ForceTotalCount() : 0;
+			return m_Nodes.empty() ? 0 : RecountNode(ROOT_NODE);
 		}
 
-		void Clear() 
+		void Clear() override
         { 
-			if (m_RootNode) 
-				m_RootNode->Clear(); 
+			if (m_Nodes.empty())
+				return;
+
+			Bounds_AABB root_bounds = m_Nodes[ROOT_NODE].Bounds;
+			ResetPools(root_bounds);
 		}
 
-		bool IsEmpty() const 
+		bool IsEmpty() const override
         { 
 			return TotalCount() == 0; 
 		}
 
-		OctreeNode GetRootNode() const 
+		const OctreeNode& GetRootNode() const 
         { 
-			return m_RootNode; 
+			return m_Nodes[ROOT_NODE]; 
 		}
 
 		/// <summary>
@@ -1220,33 +872,74 @@ namespace BC
 		/// </summary>
 		void TryShrinkOctree() 
         {
-			if(auto node = ShrinkOctree(); node && m_RootNode != node) 
+			if (m_Nodes.empty())
+				return;
+
+			const OctreeNode& root = m_Nodes[ROOT_NODE];
+			if (!root.IsSplit() || root.DataCount > 0)
+				return;
+
+			uint32_t child_block = root.ChildBlock;
+			uint32_t populated_child = NULL_INDEX;
+			for (uint32_t i = 0; i < 8; i++) 
+            {
+				if (m_Nodes[child_block + i].TotalDataCount == 0)
+					continue;
+
+				if (populated_child != NULL_INDEX)
+					return;
+
+				populated_child = child_block + i;
+			}
+
+			if (populated_child == NULL_INDEX)
+				return;
+
+			for (uint32_t i = 0; i < 8; i++) 
             {
-				m_RootNode = node;
-				m_RootNode->RevalidateNodes(0);
+				if (child_block + i != populated_child)
+					FreeChildBlock(child_block + i);
 			}
+
+			// The populated child takes over the root slot, its own children
+			// and data sources are pointed back at it
+			m_Nodes[ROOT_NODE] = m_Nodes[populated_child];
+			m_Nodes[ROOT_NODE].Parent = NULL_INDEX;
+			RelinkNode(ROOT_NODE);
+
+			m_FreeChildBlocks.push_back(child_block);
 		}
 
 		void SetConfig(const OctreeBoundsConfig& config) { m_Config = config; }
 		const OctreeBoundsConfig& GetConfig() const { return m_Config; }
 
 		/// <summary>
-		/// Use this to lock the octree when doing any updates in a separate thread.
+		/// The data of every data source, unordered. GetAllOctreeDataBounds
+		/// holds the bounds of each at the same index.
 		/// </summary>
-		std::mutex& GetOctreeMutex() { return m_OctreeMutex; }
-
-		const std::vector<OctreeData>& GetAllOctreeDataSources() const { return m_DataSources; }
+		const std::vector<DataType>& GetAllOctreeData() const { return m_Data; }
+		const std::vector<Bounds_AABB>& GetAllOctreeDataBounds() const { return m_DataBounds; }
 
 		/// <summary>
 		/// This will return a vector of AABB bounds of the entire Octree's node's recursively.
 		/// </summary>
 		/// <returns></returns>
-		std::vector<Bounds_AABB> GetAllOctreeBounds() const { return m_RootNode ? m_RootNode->GetRecursiveChildBounds() : std::vector<Bounds_AABB>(); }
+		std::vector<Bounds_AABB> GetAllOctreeBounds() const 
+		{ 
+			std::vector<Bounds_AABB> bounds_vector;
+			VisitNodes([&](const OctreeNode& node) { bounds_vector.push_back(node.Bounds); });
+			return bounds_vector;
+		}
 
 		/// <summary>
 		/// This will return a vector of glm::mat4 matricies of the entire Octree's node bounds recursively.
 		/// </summary>
-		std::vector<glm::mat4> GetAllOctreeBoundsMat4() const { return m_RootNode ? m_RootNode->GetRecursiveChildBoundsMat4() : std::vector<glm::mat4>(); }
+		std::vector<glm::mat4> GetAllOctreeBoundsMat4() const 
+		{ 
+			std::vector<glm::mat4> transforms_vector;
+			VisitNodes([&](const OctreeNode& node) { transforms_vector.push_back(node.Bounds.GetGlobalBoundsMat4()); });
+			return transforms_vector;
+		}
 
 	private:
 
@@ -1261,18 +954,14 @@ namespace BC
 		/// </param>
 		void BuildOctree(std::vector<OctreeData> data_sources = {}) 
         {
-			// 1. Delete old Octree
-			if (m_RootNode) 
+			// 1. Gather the current data if rebuilding in place
+			if (data_sources.empty() && !m_Data.empty()) 
             {
-				if (data_sources.empty() && !m_DataSources.empty())
-					data_sources = m_DataSources;
-
-				m_RootNode.reset();
-				m_RootNode = nullptr;
+				data_sources.reserve(m_Data.size());
+				for (size_t i = 0; i < m_Data.size(); i++)
+					data_sources.emplace_back(m_Data[i], m_DataBounds[i]);
 			}
 
-			m_DataSources.clear();
-
 			// 2. Calculate Initial Bounds of New Octree
 			if (!data_sources.empty()) 
             {
@@ -1281,11 +970,8 @@ namespace BC
 
 				for (const auto& data : data_sources) 
                 {
-					if (data) 
-                    {
-						m_Config.InitialBounds.BoundsMin = glm::min(data->Bounds.BoundsMin, m_Config.InitialBounds.BoundsMin);
-						m_Config.InitialBounds.BoundsMax = glm::max(data->Bounds.BoundsMax, m_Config.InitialBounds.BoundsMax);
-					}
+					m_Config.InitialBounds.BoundsMin = glm::min(data.Bounds.BoundsMin, m_Config.InitialBounds.BoundsMin);
+					m_Config.InitialBounds.BoundsMax = glm::max(data.Bounds.BoundsMax, m_Config.InitialBounds.BoundsMax);
 				}
 
 				// Step 1: Calculate the initial center and extent
@@ -1302,10 +988,12 @@ namespace BC
 				m_Config.InitialBounds.BoundsMin = center - halfExtent;
 				m_Config.InitialBounds.BoundsMax = center + halfExtent;
 
-				// Optional: Apply a scaling factor to add some padding around the entire scene
+				// Optional: Apply a scaling factor to add some padding around the entire scene.
+				// Padded about the centre, scaling about the origin would shift bounds far from
+				// the origin (e.g., world partition cells) off the data entirely
 				float scaleFactor = 1.1f;
-				m_Config.InitialBounds.BoundsMin *= scaleFactor;
-				m_Config.InitialBounds.BoundsMax *= scaleFactor;
+				m_Config.InitialBounds.BoundsMin = center - halfExtent * scaleFactor;
+				m_Config.InitialBounds.BoundsMax = center + halfExtent * scaleFactor;
 
 			}
 			else 
@@ -1314,16 +1002,190 @@ namespace BC
 				m_Config.InitialBounds.BoundsMax = glm::vec3(1000.0f);
 			}
 
-			// 3. Pre-allocate the global data vector
-			size_t dataSourceCount = data_sources.size();
-			size_t initialCapacity = static_cast<size_t>(std::max(1024.0, std::pow(2.0, std::ceil(std::log2(dataSourceCount)))));
-			m_DataSources.reserve(initialCapacity);
+			// 3. Reset the pools and create the root node
+			ResetPools(m_Config.InitialBounds);
+			ReserveSlots(data_sources.size());
+
+			for (const auto& data : data_sources)
+				Insert(data.Data, data.Bounds);
+		}
+
+		/// <summary>
+		/// Drops every node and data source, leaving a single empty root node.
+		/// </summary>
+		void ResetPools(const Bounds_AABB& root_bounds)
+		{
+			m_Nodes.clear();
+			m_FreeChildBlocks.clear();
+
+			m_Nodes.emplace_back();
+			m_Nodes[ROOT_NODE].Bounds = root_bounds;
+			m_Nodes[ROOT_NODE].LifeMax = m_Config.MaxLifeIfEmpty;
+
+			m_Data.clear();
+			m_DataBounds.clear();
+			m_DataNode.clear();
+			m_DataPrev.clear();
+			m_DataNext.clear();
+			m_DataSlots.clear();
+		}
+
+		void ReserveSlots(size_t count)
+		{
+			m_Data.reserve(count);
+			m_DataBounds.reserve(count);
+			m_DataNode.reserve(count);
+			m_DataPrev.reserve(count);
+			m_DataNext.reserve(count);
+			m_DataSlots.reserve(count);
+		}
+
+		// ----------------------------
+		//          Node Pool
+		// ----------------------------
+
+		/// <summary>
+		/// Splits the node by allocating its block of 8 children, reusing a
+		/// released block where possible.
+		/// </summary>
+		uint32_t AllocateChildBlock(uint32_t node_index)
+		{
+			uint32_t child_block = NULL_INDEX;
+			if (!m_FreeChildBlocks.empty())
+			{
+				child_block = m_FreeChildBlocks.back();
+				m_FreeChildBlocks.pop_back();
+			}
+			else
+			{
+				child_block = static_cast<uint32_t>(m_Nodes.size());
+				m_Nodes.resize(m_Nodes.size() + 8);
+			}
+
+			// Calculate the size of each child node's bounding box (half the size of the current node)
+			glm::vec3 halfSize = m_Nodes[node_index].Bounds.Size() * 0.5f;
+
+			// Calculate the center of the current node
+			glm::vec3 center = m_Nodes[node_index].Bounds.Center();
+
+			for (uint32_t i = 0; i < 8; i++) 
+            {
+				glm::vec3 offset(
+					(i & 1 ? 0.5f : -0.5f) * halfSize.x,
+					(i & 2 ? 0.5f : -0.5f) * halfSize.y,
+					(i & 4 ? 0.5f : -0.5f) * halfSize.z
+				);
+
+				glm::vec3 childCenter = center + offset;
+
+				OctreeNode& child = m_Nodes[child_block + i];
+				child = {};
+				child.Bounds.BoundsMin = childCenter - halfSize * 0.5f;
+				child.Bounds.BoundsMax = childCenter + halfSize * 0.5f;
+				child.Parent = node_index;
+				child.LifeMax = m_Config.MaxLifeIfEmpty;
+			}
+
+			m_Nodes[node_index].ChildBlock = child_block;
+			return child_block;
+		}
+
+		/// <summary>
+		/// Releases the children of an empty subtree back to the pool.
+		/// </summary>
+		void FreeChildBlock(uint32_t node_index)
+		{
+			uint32_t child_block = m_Nodes[node_index].ChildBlock;
+			if (child_block == NULL_INDEX)
+				return;
+
+			BC_ASSERT(m_Nodes[node_index].TotalDataCount == m_Nodes[node_index].DataCount, "Octree - Cannot Release Child Nodes Which Still Hold Data Sources.");
+
+			m_Nodes[node_index].ChildBlock = NULL_INDEX;
+			for (uint32_t i = 0; i < 8; i++)
+				FreeChildBlock(child_block + i);
+
+			m_FreeChildBlocks.push_back(child_block);
+		}
+
+		/// <summary>
+		/// Points the children and data sources of a node at its index after
+		/// the node has been moved within the pool.
+		/// </summary>
+		void RelinkNode(uint32_t node_index)
+		{
+			const OctreeNode& node = m_Nodes[node_index];
+
+			if (node.IsSplit())
+			{
+				for (uint32_t i = 0; i < 8; i++)
+					m_Nodes[node.ChildBlock + i].Parent = node_index;
+			}
+
+			for (uint32_t slot = node.FirstData; slot != NULL_INDEX; slot = m_DataNext[slot])
+				m_DataNode[slot] = node_index;
+		}
+
+		bool CanSplit(uint32_t node_index) const
+		{
+			// If the children nodes will be smaller than the defined minimum size, 
+			// the node will not be split
+			glm::vec3 child_bounds_size = m_Nodes[node_index].Bounds.Size() * 0.5f;
+			return child_bounds_size.x >= m_Config.MinNodeSize && child_bounds_size.y >= m_Config.MinNodeSize && child_bounds_size.z >= m_Config.MinNodeSize;
+		}
+
+		/// <summary>
+		/// This finds the child of a split node which contains the bounds within
+		/// its loose bounds, NULL_INDEX if none do.
+		/// </summary>
+		uint32_t FindContainingChild(uint32_t node_index, const Bounds_AABB& bounds) const
+		{
+			const OctreeNode& node = m_Nodes[node_index];
+
+			// The octant holding the centre of the bounds is the only candidate
+			// of a tight octree, so it is tested first
+			glm::vec3 node_center = node.Bounds.Center();
+			glm::vec3 data_center = bounds.Center();
+			uint32_t best_fit = (data_center.x >= node_center.x ? 1 : 0) | (data_center.y >= node_center.y ? 2 : 0) | (data_center.z >= node_center.z ? 4 : 0);
+
+			if (m_Nodes[node.ChildBlock + best_fit].Bounds.Contains(bounds, m_Config.Looseness) == BoundsContainResult::Contains)
+				return node.ChildBlock + best_fit;
+
+			if (m_Config.Looseness <= 1.0f)
+				return NULL_INDEX;
+
+			for (uint32_t i = 0; i < 8; i++) 
+            {
+				if (i != best_fit && m_Nodes[node.ChildBlock + i].Bounds.Contains(bounds, m_Config.Looseness) == BoundsContainResult::Contains)
+					return node.ChildBlock + i;
+			}
+
+			return NULL_INDEX;
+		}
 
-			// 4. Create Root Octree Node
-			m_RootNode = std::make_shared<OctreeBoundsNode>(m_Config.InitialBounds, this);
+		/// <summary>
+		/// This will split the node and distribute its data sources into the
+		/// child nodes that contain them.
+		/// </summary>
+		void SplitNode(uint32_t node_index)
+		{
+			AllocateChildBlock(node_index);
+
+			uint32_t slot = m_Nodes[node_index].FirstData;
+			while (slot != NULL_INDEX)
+			{
+				uint32_t next_slot = m_DataNext[slot];
+
+				uint32_t child_index = FindContainingChild(node_index, m_DataBounds[slot]);
+				if (child_index != NULL_INDEX)
+				{
+					UnlinkData(slot);
+					LinkData(slot, child_index);
+					m_Nodes[child_index].TotalDataCount++;
+				}
 
-			if (!data_sources.empty())
-				InsertVector(data_sources);
+				slot = next_slot;
+			}
 		}
 
 		/// <summary>
@@ -1337,11 +1199,13 @@ namespace BC
 			int yDirection = direction.y >= 0 ? 1 : -1;
 			int zDirection = direction.z >= 0 ? 1 : -1;
 
+			OctreeNode old_root_node = m_Nodes[ROOT_NODE];
+
 			// 2. Calculate the half size of the current root node.
-			glm::vec3 halfSize = m_RootNode->GetNodeBounds().Size() * 0.5f;
+			glm::vec3 halfSize = old_root_node.Bounds.Size() * 0.5f;
 
 			// 3. Calculate the new center for the expanded root node.
-			glm::vec3 newCenter = m_RootNode->GetNodeBounds().Center() + glm::vec3(
+			glm::vec3 newCenter = old_root_node.Bounds.Center() + glm::vec3(
 				xDirection * halfSize.x,
 				yDirection * halfSize.y,
 				zDirection * halfSize.z
@@ -1350,93 +1214,527 @@ namespace BC
 			// 4. Calculate the new size (double the current size).
 			glm::vec3 newHalfSize = halfSize * 2.0f;
 
-			// 5. Create new bounding region based on the new center and new size.
-			Bounds_AABB new_bounds;
-			new_bounds.BoundsMin = newCenter - newHalfSize;
-			new_bounds.BoundsMax = newCenter + newHalfSize;
+			// 5. The new root takes the root slot and is split straight away
+			OctreeNode& new_root_node = m_Nodes[ROOT_NODE];
+			new_root_node = {};
+			new_root_node.Bounds.BoundsMin = newCenter - newHalfSize;
+			new_root_node.Bounds.BoundsMax = newCenter + newHalfSize;
+			new_root_node.TotalDataCount = old_root_node.TotalDataCount;
+			new_root_node.LifeMax = m_Config.MaxLifeIfEmpty;
 
-			// 6. Store old root node and create new root node
-			OctreeNode old_root_node = m_RootNode;
-			OctreeNode new_root_node = std::make_shared<OctreeBoundsNode>(new_bounds, this);
+			uint32_t child_block = AllocateChildBlock(ROOT_NODE);
 
-			// 7. Get the node index of the new root node which holds the old root node
-			int child_index = new_root_node->BestFitChild(m_RootNode->GetNodeBounds().Center());
-			if (child_index == -1) 
-            {
-				BC_CORE_ERROR("Octree - Could Not Determine Child Region for Old Root Node.");
+			// 6. The old root node sits in the octant opposite to the growth direction
+			uint32_t child_index = (xDirection < 0 ? 1 : 0) | (yDirection < 0 ? 2 : 0) | (zDirection < 0 ? 4 : 0);
+
+			m_Nodes[child_block + child_index] = old_root_node;
+			m_Nodes[child_block + child_index].Parent = ROOT_NODE;
+			RelinkNode(child_block + child_index);
+
+			return true;
+		}
+
+		/// <summary>
+		/// Recalculates the total count of the node and its descendants.
+		/// </summary>
+		size_t RecountNode(uint32_t node_index)
+		{
+			size_t count = m_Nodes[node_index].DataCount;
+
+			if (m_Nodes[node_index].IsSplit())
+			{
+				for (uint32_t i = 0; i < 8; i++)
+					count += RecountNode(m_Nodes[node_index].ChildBlock + i);
+			}
+
+			m_Nodes[node_index].TotalDataCount = static_cast<uint32_t>(count);
+			return count;
+		}
+
+		template<typename VisitFunc>
+		void VisitNodes(VisitFunc&& visit) const
+		{
+			if (m_Nodes.empty())
+				return;
+
+			std::vector<uint32_t> stack = { ROOT_NODE };
+			while (!stack.empty())
+			{
+				uint32_t node_index = stack.back();
+				stack.pop_back();
+
+				const OctreeNode& node = m_Nodes[node_index];
+				visit(node);
+
+				if (node.IsSplit())
+				{
+					for (uint32_t i = 0; i < 8; i++)
+						stack.push_back(node.ChildBlock + i);
+				}
+			}
+		}
+
+		// ----------------------------
+		//         Data Slots
+		// ----------------------------
+
+		void LinkData(uint32_t slot, uint32_t node_index)
+		{
+			OctreeNode& node = m_Nodes[node_index];
+
+			m_DataNode[slot] = node_index;
+			m_DataPrev[slot] = NULL_INDEX;
+			m_DataNext[slot] = node.FirstData;
+
+			if (node.FirstData != NULL_INDEX)
+				m_DataPrev[node.FirstData] = slot;
+
+			node.FirstData = slot;
+			node.DataCount++;
+		}
+
+		void UnlinkData(uint32_t slot)
+		{
+			OctreeNode& node = m_Nodes[m_DataNode[slot]];
+
+			if (m_DataPrev[slot] != NULL_INDEX)
+				m_DataNext[m_DataPrev[slot]] = m_DataNext[slot];
+			else
+				node.FirstData = m_DataNext[slot];
+
+			if (m_DataNext[slot] != NULL_INDEX)
+				m_DataPrev[m_DataNext[slot]] = m_DataPrev[slot];
+
+			node.DataCount--;
+
+			m_DataNode[slot] = NULL_INDEX;
+			m_DataPrev[slot] = NULL_INDEX;
+			m_DataNext[slot] = NULL_INDEX;
+		}
+
+		/// <summary>
+		/// Adds to the total count of the node and every ancestor. Anything
+		/// placed beneath a node also saves it from having its children released.
+		/// </summary>
+		void AdjustTotalCount(uint32_t node_index, int32_t delta)
+		{
+			for (; node_index != NULL_INDEX; node_index = m_Nodes[node_index].Parent)
+			{
+				m_Nodes[node_index].TotalDataCount += delta;
+				if (delta > 0)
+					m_Nodes[node_index].LifeCount = 0;
+			}
+		}
+
+		/// <summary>
+		/// Places a stored data slot in the deepest node that contains it.
+		/// Returns false if it does not fit within the root node.
+		/// </summary>
+		bool PlaceData(uint32_t slot, uint32_t start_node = ROOT_NODE)
+		{
+			if (m_Nodes[start_node].Bounds.Contains(m_DataBounds[slot], m_Config.Looseness) != BoundsContainResult::Contains)
 				return false;
+
+			uint32_t node_index = start_node;
+			while (true)
+			{
+				if (!m_Nodes[node_index].IsSplit())
+				{
+					// Stay in this node whilst under the preferred limit, or
+					// if its children would be smaller than the minimum size
+					if (m_Nodes[node_index].DataCount < static_cast<uint32_t>(std::max(m_Config.PreferredDataSourceLimit, 0)) || !CanSplit(node_index))
+						break;
+
+					SplitNode(node_index);
+				}
+
+				uint32_t child_index = FindContainingChild(node_index, m_DataBounds[slot]);
+				if (child_index == NULL_INDEX)
+					break;
+
+				node_index = child_index;
 			}
 
-			// 8. Set the root node to the new root node, and set the child at the appropriate index to the old root node
-			if (new_root_node->SetChildNode(child_index, old_root_node)) 
+			OctreeNode& node = m_Nodes[node_index];
+			if (node.LifeCount > 0 || node.TotalDataCount == 0) 
             {
-				m_RootNode = new_root_node;
+				node.LifeMax = static_cast<uint8_t>(glm::min(node.LifeMax * 2, 64));
 			}
-			else 
+
+			LinkData(slot, node_index);
+			AdjustTotalCount(node_index, 1);
+			return true;
+		}
+
+		/// <summary>
+		/// Places the slot, growing the octree towards it until it fits.
+		/// </summary>
+		bool InsertSlot(uint32_t slot)
+		{
+			int octree_growth_attempts = 0;
+			const int max_attempts = 20; // We are expanding to infinity if we even get close to this number....
+
+			while (!PlaceData(slot)) 
             {
-				BC_CORE_ERROR("Octree - Could Not Set Old Root Node as Child to New Root Node - Invalid Index.");
-				return false;
+				if (octree_growth_attempts >= max_attempts) 
+                {
+					BC_CORE_WARN("Octree - Could Not Grow the Octree to Fit Data Source.");
+					return false;
+				}
+
+				GrowOctree(m_DataBounds[slot].Center() - m_Nodes[ROOT_NODE].Bounds.Center());
+				octree_growth_attempts++;
 			}
+
 			return true;
 		}
 
 		/// <summary>
-		/// This checks if the root node should be shrunk
+		/// Moves the slot to its new bounds, only leaving its node when the 
+		/// node's loose bounds no longer contain it. Slots that cannot be placed 
+		/// again are removed.
 		/// </summary>
-		bool ShouldShrink() 
-        {
-			if (!m_RootNode->IsNodeSplit())
-				return false;
+		bool UpdateSlot(uint32_t slot, const Bounds_AABB& bounds)
+		{
+			m_DataBounds[slot] = bounds;
+
+			uint32_t node_index = m_DataNode[slot];
+			if (m_Nodes[node_index].Bounds.Contains(bounds, m_Config.Looseness) == BoundsContainResult::Contains)
+				return true;
+
+			UnlinkData(slot);
+			AdjustTotalCount(node_index, -1);
+
+			uint32_t ancestor_index = m_Nodes[node_index].Parent;
+			while (ancestor_index != NULL_INDEX && m_Nodes[ancestor_index].Bounds.Contains(bounds, m_Config.Looseness) != BoundsContainResult::Contains)
+				ancestor_index = m_Nodes[ancestor_index].Parent;
+
+			if (ancestor_index != NULL_INDEX ? PlaceData(slot, ancestor_index) : InsertSlot(slot))
+				return true;
+
+			RemoveSlot(slot);
+			return false;
+		}
+
+		/// <summary>
+		/// Bumped whenever the pools change shape, so layouts written by an older
+		/// octree are rebuilt rather than restored.
+		/// </summary>
+		static constexpr uint32_t LAYOUT_VERSION = 1;
 
-			if (m_RootNode->m_DataSourceSize > 0)
+		/// <summary>
+		/// Checks every link of a layout read by ReadLayout points within its 
+		/// pool before any of it is used.
+		/// </summary>
+		static bool IsLayoutValid(const std::vector<OctreeNode>& nodes, const std::vector<uint32_t>& free_child_blocks, const std::vector<uint32_t>& data_node, const std::vector<uint32_t>& data_prev, const std::vector<uint32_t>& data_next, size_t data_bounds_count, size_t data_id_count)
+		{
+			size_t node_count = nodes.size();
+			size_t data_count = data_node.size();
+
+			if (node_count == 0 || data_prev.size() != data_count || data_next.size() != data_count || data_bounds_count != data_count || data_id_count != data_count)
 				return false;
 
-			bool found_one_child_with_data = false;
-			for (const auto& child : m_RootNode->m_ChildrenNodes) {
+			auto is_link_valid = [](uint32_t index, size_t count) { return index == NULL_INDEX || index < count; };
+			auto is_block_valid = [node_count](uint32_t block) { return block != ROOT_NODE && block <= node_count && node_count - block >= 8; };
 
-				if (!child)
-					continue;
+			for (const OctreeNode& node : nodes)
+			{
+				if (!is_link_valid(node.Parent, node_count) || !is_link_valid(node.FirstData, data_count))
+					return false;
 
-				if (child->TotalCount() == 0)
-					continue;
+				if (node.IsSplit() && !is_block_valid(node.ChildBlock))
+					return false;
+			}
 
-				if (found_one_child_with_data)
+			for (uint32_t block : free_child_blocks)
+			{
+				if (!is_block_valid(block))
 					return false;
+			}
 
-				found_one_child_with_data = true;
+			for (size_t slot = 0; slot < data_count; slot++)
+			{
+				if (!is_link_valid(data_node[slot], node_count) || !is_link_valid(data_prev[slot], data_count) || !is_link_valid(data_next[slot], data_count))
+					return false;
 			}
 
 			return true;
 		}
 
 		/// <summary>
-		/// This will return the most appropriate root node
+		/// Removes the slot from its node, then fills the hole with the last
+		/// slot so the data arrays stay dense.
+		/// </summary>
+		void RemoveSlot(uint32_t slot)
+		{
+			uint32_t node_index = m_DataNode[slot];
+			if (node_index != NULL_INDEX)
+			{
+				UnlinkData(slot);
+				AdjustTotalCount(node_index, -1);
+			}
+
+			m_DataSlots.erase(m_Data[slot]);
+
+			uint32_t last_slot = static_cast<uint32_t>(m_Data.size()) - 1;
+			if (slot != last_slot)
+				MoveSlot(last_slot, slot);
+
+			PopSlot();
+		}
+
+		void MoveSlot(uint32_t from_slot, uint32_t to_slot)
+		{
+			m_Data[to_slot] = std::move(m_Data[from_slot]);
+			m_DataBounds[to_slot] = m_DataBounds[from_slot];
+			m_DataNode[to_slot] = m_DataNode[from_slot];
+			m_DataPrev[to_slot] = m_DataPrev[from_slot];
+			m_DataNext[to_slot] = m_DataNext[from_slot];
+
+			m_DataSlots[m_Data[to_slot]] = to_slot;
+
+			if (m_DataNode[to_slot] == NULL_INDEX)
+				return;
+
+			if (m_DataPrev[to_slot] != NULL_INDEX)
+				m_DataNext[m_DataPrev[to_slot]] = to_slot;
+			else
+				m_Nodes[m_DataNode[to_slot]].FirstData = to_slot;
+
+			if (m_DataNext[to_slot] != NULL_INDEX)
+				m_DataPrev[m_DataNext[to_slot]] = to_slot;
+		}
+
+		void PopSlot()
+		{
+			m_Data.pop_back();
+			m_DataBounds.pop_back();
+			m_DataNode.pop_back();
+			m_DataPrev.pop_back();
+			m_DataNext.pop_back();
+		}
+
+		// ----------------------------
+		//           Queries
+		// ----------------------------
+
+		std::vector<OctreeData>& PrepareQueryResult(size_t query_index)
+		{
+			auto& result = m_QueryReturnVectors[query_index];
+			if (result.capacity() < m_Data.size())
+				result.reserve(m_Data.size());
+
+			result.clear();
+			return result;
+		}
+
+		/// <summary>
+		/// Visits every data source of the node and its descendants without
+		/// testing any of them.
+		/// </summary>
+		template<typename VisitFunc>
+		void VisitSubtree(uint32_t node_index, VisitFunc& visit) const
+		{
+			const OctreeNode& node = m_Nodes[node_index];
+			if (node.TotalDataCount == 0)
+				return;
+
+			for (uint32_t slot = node.FirstData; slot != NULL_INDEX; slot = m_DataNext[slot])
+				visit(m_Data[slot], m_DataBounds[slot]);
+
+			if (node.IsSplit())
+			{
+				for (uint32_t i = 0; i < 8; i++)
+					VisitSubtree(node.ChildBlock + i, visit);
+			}
+		}
+
+		/// <summary>
+		/// Data sources of a node are gathered into batches of this size for 
+		/// the SIMD culling kernels.
+		/// </summary>
+		static constexpr uint32_t CULL_BATCH_SIZE = 64;
+
+		/// <summary>
+		/// Copies the bounds held directly by the node into contiguous batches,
+		/// calling batch_func(slots, bounds, count) for each batch.
 		/// </summary>
-		OctreeNode ShrinkOctree() {
+		template<typename BatchFunc>
+		void ForEachDataBatch(const OctreeNode& node, BatchFunc&& batch_func) const
+		{
+			std::array<uint32_t, CULL_BATCH_SIZE> batch_slots;
+			std::array<Bounds_AABB, CULL_BATCH_SIZE> batch_bounds;
+
+			uint32_t slot = node.FirstData;
+			while (slot != NULL_INDEX)
+			{
+				uint32_t batch_count = 0;
+				for (; slot != NULL_INDEX && batch_count < CULL_BATCH_SIZE; slot = m_DataNext[slot], batch_count++)
+				{
+					batch_slots[batch_count] = slot;
+					batch_bounds[batch_count] = m_DataBounds[slot];
+				}
 
-			if (!m_RootNode)
-				return nullptr;
+				batch_func(batch_slots.data(), batch_bounds.data(), batch_count);
+			}
+		}
 
-			if (!ShouldShrink())
-				return m_RootNode;
+		/// <summary>
+		/// Visits the data sources held directly by a node that the query shape
+		/// contains. Frustums are tested a batch at a time rather than per data 
+		/// source.
+		/// </summary>
+		template<typename QueryShape, typename VisitFunc>
+		void VisitNodeData(const QueryShape& query_shape, const FrustumPlanesSoA& planes, const OctreeNode& node, VisitFunc& visit) const
+		{
+			if constexpr (std::is_same_v<QueryShape, Frustum>)
+			{
+				std::array<FrustumContainResult, CULL_BATCH_SIZE> batch_results;
+				ForEachDataBatch(node, [&](const uint32_t* slots, const Bounds_AABB* bounds, uint32_t count)
+				{
+					Util::CullAABBs(planes, bounds, count, batch_results.data());
+					for (uint32_t i = 0; i < count; i++)
+					{
+						if (batch_results[i] != FrustumContainResult::DoesNotContain)
+							visit(m_Data[slots[i]], m_DataBounds[slots[i]]);
+					}
+				});
+			}
+			else
+			{
+				for (uint32_t slot = node.FirstData; slot != NULL_INDEX; slot = m_DataNext[slot])
+				{
+					if (ContainsData(query_shape, m_DataBounds[slot]))
+						visit(m_Data[slot], m_DataBounds[slot]);
+				}
+			}
+		}
 
-			for (int i = 0; i < m_RootNode->m_ChildrenNodes.size(); i++) {
-				if (m_RootNode->m_ChildrenNodes[i] && m_RootNode->m_ChildrenNodes[i]->TotalCount() > 0)
-					return m_RootNode->m_ChildrenNodes[i];
+		static BoundsContainResult ContainsNode(const Bounds_AABB& bounds, const Bounds_AABB& node_bounds) { return bounds.Contains(node_bounds); }
+		static BoundsContainResult ContainsNode(const Bounds_Sphere& bounds, const Bounds_AABB& node_bounds) { return bounds.Contains(node_bounds); }
+		static BoundsContainResult ContainsNode(const Frustum& frustum, const Bounds_AABB& node_bounds) 
+		{ 
+			switch (frustum.Contains(node_bounds))
+			{
+				case FrustumContainResult::Contains:	return BoundsContainResult::Contains;
+				case FrustumContainResult::Intersects:	return BoundsContainResult::Intersects;
+				default:								return BoundsContainResult::DoesNotContain;
 			}
+		}
+
+		static bool ContainsData(const Bounds_AABB& bounds, const Bounds_AABB& data_bounds) { return bounds.Contains(data_bounds) != BoundsContainResult::DoesNotContain; }
+		static bool ContainsData(const Bounds_Sphere& bounds, const Bounds_AABB& data_bounds) { return bounds.Contains(data_bounds) != BoundsContainResult::DoesNotContain; }
+		static bool ContainsData(const Frustum& frustum, const Bounds_AABB& data_bounds) { return frustum.Contains(data_bounds) != FrustumContainResult::DoesNotContain; }
+
+		/// <summary>
+		/// Walks the node pool testing the loose bounds of each node. Data
+		/// sources may extend past the actual bounds of the node holding them,
+		/// so culling against the loose bounds never misses any.
+		/// 
+		/// Nodes whose children have held nothing for longer than their life
+		/// release their children back to the pool.
+		/// </summary>
+		template<typename QueryShape>
+		void QueryNodes(std::vector<OctreeData>& result, const QueryShape& query_shape)
+		{
+			if (m_Data.empty())
+				return;
+
+			auto gather = [&](const DataType& data, const Bounds_AABB& data_bounds) { result.emplace_back(data, data_bounds); };
+
+			FrustumPlanesSoA planes{};
+			if constexpr (std::is_same_v<QueryShape, Frustum>)
+				planes = FrustumPlanesSoA(query_shape);
+
+			m_QueryStack.clear();
+			m_QueryStack.push_back(ROOT_NODE);
+
+			while (!m_QueryStack.empty())
+			{
+				uint32_t node_index = m_QueryStack.back();
+				m_QueryStack.pop_back();
+
+				OctreeNode& node = m_Nodes[node_index];
+
+				if (node.IsSplit() && node.TotalDataCount == node.DataCount)
+				{
+					// Set a roof of 64 queries it can be empty for before deletion
+					if (node.LifeCount < 64)
+						node.LifeCount++;
+
+					if (node.LifeCount > node.LifeMax) 
+                    {
+						FreeChildBlock(node_index);
+					}
+				}
 
-			return m_RootNode;
+				if (node.TotalDataCount == 0)
+					continue;
+
+				switch (ContainsNode(query_shape, node.Bounds * m_Config.Looseness)) 
+                {
+					case BoundsContainResult::Contains: 
+                    {
+						VisitSubtree(node_index, gather);
+						break;
+					}
+
+					case BoundsContainResult::Intersects: 
+                    {
+						// Test intersection of each data source pertaining to this node
+						VisitNodeData(query_shape, planes, node, gather);
+
+						if (node.IsSplit())
+						{
+							for (uint32_t i = 0; i < 8; i++)
+							{
+								if (m_Nodes[node.ChildBlock + i].TotalDataCount > 0)
+									m_QueryStack.push_back(node.ChildBlock + i);
+							}
+						}
+						break;
+					}
+
+					default:
+						break;
+				}
+			}
 		}
 
 		OctreeBoundsConfig m_Config{};
 
-		OctreeNode m_RootNode;
+		/// <summary>
+		/// Every node of the Octree, the root node is always at ROOT_NODE.
+		/// </summary>
+		std::vector<OctreeNode> m_Nodes{};
+
+		/// <summary>
+		/// First index of each released block of 8 child nodes.
+		/// </summary>
+		std::vector<uint32_t> m_FreeChildBlocks{};
+
+		// Data sources stored as parallel arrays indexed by slot, so the
+		// bounds tested during queries are tightly packed. Slots are kept
+		// dense, removing a slot moves the last slot into its place.
+		std::vector<DataType> m_Data{};
+		std::vector<Bounds_AABB> m_DataBounds{};
+
+		/// <summary>
+		/// The node holding each slot, and the neighbouring slots held by the 
+		/// same node.
+		/// </summary>
+		std::vector<uint32_t> m_DataNode{};
+		std::vector<uint32_t> m_DataPrev{};
+		std::vector<uint32_t> m_DataNext{};
 
-		std::vector<OctreeData> m_DataSources{};
+		/// <summary>
+		/// The slot holding each data value, so data sources can be found 
+		/// without searching.
+		/// </summary>
+		std::unordered_map<DataType, uint32_t> m_DataSlots{};
 
 		std::array<std::vector<OctreeData>, 3> m_QueryReturnVectors{};
-
-		std::mutex m_OctreeMutex{};
+		std::vector<uint32_t> m_QueryStack{};
 
 	};
-}
\ No newline at end of file
+}
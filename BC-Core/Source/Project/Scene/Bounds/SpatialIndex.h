@@ -0,0 +1,445 @@
+#pragma once
+
+// Core Headers
+#include "Bounds.h"
+#include "Frustum.h"
+
+// C++ Standard Library Headers
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// External Vendor Library Headers
+#include <glm/glm.hpp>
+
+namespace BC
+{
+
+	template<typename DataType>
+	struct SpatialDataSource
+    {
+		DataType Data;
+		Bounds_AABB Bounds;
+
+		SpatialDataSource() = delete;
+		SpatialDataSource(const DataType& data, const Bounds_AABB& bounds) :
+            Data(data), Bounds(bounds) {}
+
+		SpatialDataSource(const SpatialDataSource& other) = default;
+		SpatialDataSource& operator=(const SpatialDataSource& other) = default;
+
+		SpatialDataSource(SpatialDataSource&& other) = default;
+		SpatialDataSource& operator=(SpatialDataSource&& other) = default;
+	};
+
+	template<typename DataType>
+	struct SpatialQueryHit
+    {
+		DataType Data;
+		Bounds_AABB Bounds;
+
+		/// <summary>
+		/// Distance along the ray to where the bounds are entered, or from the 
+		/// query point to the nearest point of the bounds.
+		/// </summary>
+		float Distance = 0.0f;
+
+		SpatialQueryHit() = delete;
+		SpatialQueryHit(const DataType& data, const Bounds_AABB& bounds, float distance) :
+            Data(data), Bounds(bounds), Distance(distance) {}
+	};
+
+	enum class SpatialIndexType : uint8_t
+	{
+		Octree,
+		BVH
+	};
+
+	namespace Util
+    {
+		inline const char* SpatialIndexTypeToString(SpatialIndexType type)
+        {
+			switch (type)
+            {
+				case SpatialIndexType::BVH:		return "BVH";
+				default:						return "Octree";
+			}
+		}
+
+		inline SpatialIndexType SpatialIndexTypeFromString(const std::string& type_string)
+        {
+			return type_string == "BVH" ? SpatialIndexType::BVH : SpatialIndexType::Octree;
+		}
+
+		/// <summary>
+		/// Appends the pools of a spatial index to a byte buffer as they are in
+		/// memory, so they can be read back without rebuilding anything.
+		/// </summary>
+		class SpatialLayoutWriter
+        {
+		public:
+			explicit SpatialLayoutWriter(std::vector<uint8_t>& out_bytes) :
+                m_Bytes(out_bytes) {}
+
+			template<typename T>
+			void Write(const T& value)
+            {
+				static_assert(std::is_trivially_copyable_v<T>, "Spatial Layout - Only Trivially Copyable Types Can Be Written.");
+
+				const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+				m_Bytes.insert(m_Bytes.end(), bytes, bytes + sizeof(T));
+			}
+
+			template<typename T>
+			void WriteArray(const std::vector<T>& values)
+            {
+				static_assert(std::is_trivially_copyable_v<T>, "Spatial Layout - Only Trivially Copyable Types Can Be Written.");
+
+				Write<uint64_t>(values.size());
+				if (values.empty())
+					return;
+
+				const uint8_t* bytes = reinterpret_cast<const uint8_t*>(values.data());
+				m_Bytes.insert(m_Bytes.end(), bytes, bytes + values.size() * sizeof(T));
+			}
+
+		private:
+			std::vector<uint8_t>& m_Bytes;
+		};
+
+		/// <summary>
+		/// Reads back what a SpatialLayoutWriter wrote. Every read is bounds 
+		/// checked and returns false once the bytes run out.
+		/// </summary>
+		class SpatialLayoutReader
+        {
+		public:
+			explicit SpatialLayoutReader(std::span<const uint8_t> bytes) :
+                m_Bytes(bytes) {}
+
+			template<typename T>
+			bool Read(T& out_value)
+            {
+				static_assert(std::is_trivially_copyable_v<T>, "Spatial Layout - Only Trivially Copyable Types Can Be Read.");
+
+				if (m_Bytes.size() - m_Offset < sizeof(T))
+					return false;
+
+				std::memcpy(&out_value, m_Bytes.data() + m_Offset, sizeof(T));
+				m_Offset += sizeof(T);
+				return true;
+			}
+
+			template<typename T>
+			bool ReadArray(std::vector<T>& out_values)
+            {
+				static_assert(std::is_trivially_copyable_v<T>, "Spatial Layout - Only Trivially Copyable Types Can Be Read.");
+
+				uint64_t count = 0;
+				if (!Read(count) || count > (m_Bytes.size() - m_Offset) / sizeof(T))
+					return false;
+
+				out_values.resize(static_cast<size_t>(count));
+				if (count == 0)
+					return true;
+
+				std::memcpy(out_values.data(), m_Bytes.data() + m_Offset, out_values.size() * sizeof(T));
+				m_Offset += out_values.size() * sizeof(T);
+				return true;
+			}
+
+			bool IsAtEnd() const { return m_Offset == m_Bytes.size(); }
+
+		private:
+			std::span<const uint8_t> m_Bytes;
+			size_t m_Offset = 0;
+		};
+	}
+
+	/// <summary>
+	/// Common surface of the spatial indices a Scene can hold its renderable
+	/// bounds in. Each index keeps its own templated queries (e.g., visitors)
+	/// for callers that know the concrete type.
+	///
+	/// An index is not synchronised internally. Any thread reading or writing
+	/// an index that other threads can reach must hold its mutex, shared to
+	/// read and exclusively to write, see GetMutex.
+	/// </summary>
+	template<typename DataType>
+	class SpatialIndex
+    {
+
+	public:
+
+		using DataSource = SpatialDataSource<DataType>;
+		using QueryHit = SpatialQueryHit<DataType>;
+
+		/// <summary>
+		/// Views each frustum sees within a multi view query, bit N is set when
+		/// the data source is visible to frustum N.
+		/// </summary>
+		using ViewMask = uint64_t;
+		static constexpr size_t MAX_QUERY_VIEWS = sizeof(ViewMask) * 8;
+
+		SpatialIndex() = default;
+		virtual ~SpatialIndex() = default;
+
+		SpatialIndex(const SpatialIndex&) = delete;
+		SpatialIndex& operator=(const SpatialIndex&) = delete;
+
+		virtual SpatialIndexType GetIndexType() const = 0;
+
+		// ----------------------------
+		//           Writes
+		// ----------------------------
+
+		virtual bool Insert(const DataType& data, const Bounds_AABB& bounds) = 0;
+
+		/// <summary>
+		/// Inserts data that is not expected to move. Indices which do not
+		/// separate static and dynamic data treat this the same as Insert.
+		/// </summary>
+		virtual bool InsertStatic(const DataType& data, const Bounds_AABB& bounds) { return Insert(data, bounds); }
+
+		virtual bool Remove(const DataType& data) = 0;
+		virtual bool Update(const DataType& data, const Bounds_AABB& bounds) = 0;
+
+		/// <returns>
+		/// The data sources that could not be placed and have been removed.
+		/// </returns>
+		virtual std::vector<DataSource> UpdateMany(const std::vector<DataSource>& data_sources) = 0;
+
+		virtual void Clear() = 0;
+
+		// ----------------------------
+		//           Reads
+		// ----------------------------
+
+		virtual bool Contains(const DataType& data) const = 0;
+		virtual bool IsEmpty() const = 0;
+		virtual size_t TotalCount() const = 0;
+
+		/// <summary>
+		/// Appends every data source within the query bounds to a buffer owned
+		/// by the caller.
+		/// </summary>
+		virtual void Query(const Bounds_AABB& bounds, std::vector<DataSource>& out_results) const = 0;
+		virtual void Query(const Bounds_Sphere& bounds, std::vector<DataSource>& out_results) const = 0;
+		virtual void Query(const Frustum& frustum, std::vector<DataSource>& out_results) const = 0;
+
+		/// <summary>
+		/// Queries up to MAX_QUERY_VIEWS frustums in one walk of the index. Each
+		/// data source visible to at least one view is appended to out_results,
+		/// with the views that see it at the same index of out_view_masks.
+		/// </summary>
+		virtual void QueryFrustums(std::span<const Frustum> frustums, std::vector<DataSource>& out_results, std::vector<ViewMask>& out_view_masks) const = 0;
+
+		/// <summary>
+		/// Appends every data source whose bounds the ray enters within 
+		/// max_distance, nearest first. With first_hit_only, only the nearest is
+		/// appended and farther parts of the index are skipped once it is found.
+		/// </summary>
+		virtual void QueryRay(const Ray& ray, float max_distance, std::vector<QueryHit>& out_hits, bool first_hit_only = false) const = 0;
+
+		/// <summary>
+		/// Appends up to count data sources nearest to the point, within 
+		/// max_distance of it, nearest first. Distances are to the nearest point
+		/// of each data source's bounds, zero if the point is inside them.
+		/// </summary>
+		virtual void QueryNearest(const glm::vec3& point, size_t count, float max_distance, std::vector<QueryHit>& out_hits) const = 0;
+
+		/// <summary>
+		/// Same as QueryRay, for the segment between two points.
+		/// </summary>
+		void QuerySegment(const glm::vec3& start, const glm::vec3& end, std::vector<QueryHit>& out_hits, bool first_hit_only = false) const
+		{
+			glm::vec3 offset = end - start;
+			float length = glm::length(offset);
+			if (length <= 0.0f)
+				return;
+
+			QueryRay(Ray{ start, offset / length }, length, out_hits, first_hit_only);
+		}
+
+		/// <summary>
+		/// Appends every data source within radius of the point, nearest first.
+		/// </summary>
+		void QueryRadius(const glm::vec3& point, float radius, std::vector<QueryHit>& out_hits) const
+		{
+			QueryNearest(point, std::numeric_limits<size_t>::max(), radius, out_hits);
+		}
+
+		/// <summary>
+		/// Deep copies the index, passing the data of each data source through
+		/// remap_data, e.g., to point an Entity at the same entity within a
+		/// cloned scene.
+		/// </summary>
+		virtual std::shared_ptr<SpatialIndex<DataType>> CloneIndex(const std::function<DataType(const DataType&)>& remap_data) const = 0;
+
+		// ----------------------------
+		//         Persistence
+		// ----------------------------
+
+		/// <summary>
+		/// Appends the built layout of the index to out_bytes, writing each data
+		/// source's data as the id returned by data_to_id, e.g., an entity GUID.
+		/// </summary>
+		virtual void WriteLayout(std::vector<uint8_t>& out_bytes, const std::function<uint64_t(const DataType&)>& data_to_id) const = 0;
+
+		/// <summary>
+		/// Replaces the index with a layout written by WriteLayout, without 
+		/// reinserting anything. Data sources whose id id_to_data cannot resolve
+		/// are removed. Returns false, leaving the index unchanged, if the layout 
+		/// is malformed or was written by a different type or version of index.
+		/// </summary>
+		virtual bool ReadLayout(std::span<const uint8_t> bytes, const std::function<std::optional<DataType>(uint64_t)>& id_to_data) = 0;
+
+		/// <summary>
+		/// The bounds the data source was last inserted or updated with.
+		/// </summary>
+		virtual bool TryGetBounds(const DataType& data, Bounds_AABB& out_bounds) const = 0;
+
+		// ----------------------------
+		//         Thread Safety
+		// ----------------------------
+
+		/// <summary>
+		/// Held for the duration of every query and write made while other
+		/// threads can reach the index, e.g., by Scene's queries and
+		/// UpdateSpatialIndex. Const queries only need it shared, so any number
+		/// of threads may query at once, and one caller may fan a query out
+		/// across jobs while holding it. Writes hold it exclusively.
+		/// </summary>
+		std::shared_mutex& GetMutex() { return m_Mutex; }
+
+	protected:
+
+		/// <summary>
+		/// Gathers hits for QueryRay from a ray visitor of an index, which takes 
+		/// the returned distance as its new max distance.
+		/// </summary>
+		class RayHitCollector
+        {
+		public:
+			RayHitCollector(std::vector<QueryHit>& out_hits, float max_distance, bool first_hit_only) :
+                m_Hits(out_hits), m_First(out_hits.size()), m_MaxDistance(max_distance), m_FirstHitOnly(first_hit_only) {}
+
+			float operator()(const DataType& data, const Bounds_AABB& bounds, float distance)
+            {
+				if (!m_FirstHitOnly)
+                {
+					m_Hits.emplace_back(data, bounds, distance);
+					return m_MaxDistance;
+				}
+
+				// Only nearer hits are visited from here on, so each replaces the last
+				if (m_Hits.size() == m_First)
+					m_Hits.emplace_back(data, bounds, distance);
+				else
+					m_Hits[m_First] = QueryHit(data, bounds, distance);
+
+				return distance;
+			}
+
+			/// <summary>
+			/// Sorts the hits appended by this collector nearest first.
+			/// </summary>
+			void Finish()
+            {
+				SortHits(m_Hits, m_First);
+			}
+
+		private:
+			std::vector<QueryHit>& m_Hits;
+			size_t m_First = 0;
+			float m_MaxDistance = 0.0f;
+			bool m_FirstHitOnly = false;
+		};
+
+		/// <summary>
+		/// Keeps the nearest count data sources offered by a best first walk of
+		/// an index. Parts of the index farther than GetBoundSquared can be skipped.
+		/// </summary>
+		class NearestCollector
+        {
+		public:
+			NearestCollector(std::vector<QueryHit>& out_hits, size_t count, float max_distance) :
+                m_Hits(out_hits), m_First(out_hits.size()), m_Count(count), m_BoundSquared(max_distance * max_distance) {}
+
+			/// <summary>
+			/// Distance squared a data source must be within to be kept.
+			/// </summary>
+			float GetBoundSquared() const { return m_BoundSquared; }
+
+			void Offer(const DataType& data, const Bounds_AABB& bounds, float distance_squared)
+            {
+				if (m_Count == 0 || distance_squared > m_BoundSquared)
+					return;
+
+				// The hits appended by this collector are a max heap on distance
+				// squared until Finish, so the farthest is replaced first
+				auto farther = [](const QueryHit& a, const QueryHit& b) { return a.Distance < b.Distance; };
+
+				if (m_Hits.size() - m_First == m_Count)
+                {
+					std::pop_heap(m_Hits.begin() + m_First, m_Hits.end(), farther);
+					m_Hits.back() = QueryHit(data, bounds, distance_squared);
+				}
+				else
+                {
+					m_Hits.emplace_back(data, bounds, distance_squared);
+				}
+				std::push_heap(m_Hits.begin() + m_First, m_Hits.end(), farther);
+
+				if (m_Hits.size() - m_First == m_Count)
+					m_BoundSquared = m_Hits[m_First].Distance;
+			}
+
+			/// <summary>
+			/// Converts the kept hits to distances and sorts them nearest first.
+			/// </summary>
+			void Finish()
+            {
+				for (size_t i = m_First; i < m_Hits.size(); i++)
+					m_Hits[i].Distance = std::sqrt(m_Hits[i].Distance);
+
+				SortHits(m_Hits, m_First);
+			}
+
+		private:
+			std::vector<QueryHit>& m_Hits;
+			size_t m_First = 0;
+			size_t m_Count = 0;
+			float m_BoundSquared = 0.0f;
+		};
+
+		static void SortHits(std::vector<QueryHit>& hits, size_t first)
+		{
+			std::sort(hits.begin() + first, hits.end(), [](const QueryHit& a, const QueryHit& b) { return a.Distance < b.Distance; });
+		}
+
+		static float DistanceSquared(const glm::vec3& point, const Bounds_AABB& bounds)
+		{
+			glm::vec3 offset = point - glm::clamp(point, bounds.BoundsMin, bounds.BoundsMax);
+			return glm::dot(offset, offset);
+		}
+
+	private:
+
+		std::shared_mutex m_Mutex{};
+
+	};
+
+}
@@ -2,6 +2,7 @@
 #include "CoreComponents.h"
 
 #include "MeshComponents.h"
+#include "LightComponents.h"
 #include "PhysicsComponents.h"
 
 #include <yaml-cpp/yaml.h>
@@ -38,6 +39,8 @@ namespace BC
 
         m_StateFlags = TransformFlag_PropertiesUpdated | TransformFlag_GlobalTransformUpdated;
         other.m_StateFlags = TransformFlag_PropertiesUpdated | TransformFlag_GlobalTransformUpdated;
+
+        m_GlobalTransformVersion = other.m_GlobalTransformVersion;
     }
 
     TransformComponent& TransformComponent::operator=(const TransformComponent& other)
@@ -54,6 +57,8 @@ namespace BC
 
         m_StateFlags = TransformFlag_PropertiesUpdated | TransformFlag_GlobalTransformUpdated;
 
+        m_GlobalTransformVersion = std::max(m_GlobalTransformVersion, other.m_GlobalTransformVersion) + 1;
+
         return *this;
     }
 
@@ -74,6 +79,8 @@ namespace BC
         m_StateFlags = TransformFlag_PropertiesUpdated | TransformFlag_GlobalTransformUpdated;
         other.m_StateFlags = TransformFlag_PropertiesUpdated | TransformFlag_GlobalTransformUpdated;
 
+        m_GlobalTransformVersion = std::max(m_GlobalTransformVersion, other.m_GlobalTransformVersion) + 1;
+
         return *this;
     }
 
@@ -123,8 +130,22 @@ namespace BC
             return;
         }
 
+        MarkGlobalTransformDirty(entity, scale_updated);
+
+        // Walk the subtree through the relationship links rather than
+        // recursing through GUID lookups
+        // TODO: Jobify
+        for (Entity descendant_entity : entity.GetDescendants())
+        {
+            descendant_entity.GetTransform().MarkGlobalTransformDirty(descendant_entity, false);
+        }
+    }
+
+    void TransformComponent::MarkGlobalTransformDirty(const Entity& entity, bool scale_updated)
+    {
         // Set the Global Transform Updated Flag
         AddFlag(TransformFlag_GlobalTransformUpdated);
+        m_GlobalTransformVersion++;
 
         if (entity.HasComponent<MeshRendererComponent>()) 
         {
@@ -141,6 +162,12 @@ namespace BC
             component.UpdateBoundingBox();
         }
 
+        if (auto* component = entity.TryGetComponent<SphereLightComponent>(); component)
+            component->UpdateSpatialBounds();
+
+        if (auto* component = entity.TryGetComponent<ConeLightComponent>(); component)
+            component->UpdateSpatialBounds();
+
         // Do this inside OnTransformUpdate as it recurses down the hierarchy
         if (auto project = Application::GetProject(); project && project->GetSceneManager()->GetPhysicsSystem() && !entity.HasComponent<RigidbodyComponent>())
         {
@@ -196,25 +223,6 @@ namespace BC
                 }
             }
         }
-
-        // Recursive down the tree
-        // TODO: Jobify
-        
-        auto project = Application::GetProject();
-        if (!project)
-            return;
-
-        for (const auto& child_guid : entity.GetComponent<MetaComponent>().GetChildrenGUID()) 
-        {
-            Entity child_entity = project->GetSceneManager()->GetEntity(child_guid);
-            if (!child_entity)
-            {
-                continue;
-            }
-
-            child_entity.GetTransform().OnTransformUpdated();
-        }
-        
     }
 
 #pragma endregion
@@ -239,7 +247,9 @@ namespace BC
                 return;
             }
 
-            auto parent_entity = Application::GetProject()->GetSceneManager()->GetEntity(meta_component.GetParentGUID());
+            Entity parent_entity = entity.GetParent();
+            if (!parent_entity)
+                parent_entity = Application::GetProject()->GetSceneManager()->GetEntity(meta_component.GetParentGUID());
             if (!parent_entity)
             {
                 BC_CORE_WARN("TransformComponent::SetPosition: Could Not Set Position - Parent Entity is Not Null But Is Invalid.");
@@ -301,7 +311,9 @@ namespace BC
                 return;
             }
 
-            auto parent_entity = Application::GetProject()->GetSceneManager()->GetEntity(meta_component.GetParentGUID());
+            Entity parent_entity = entity.GetParent();
+            if (!parent_entity)
+                parent_entity = Application::GetProject()->GetSceneManager()->GetEntity(meta_component.GetParentGUID());
             if (!parent_entity)
             {
                 BC_CORE_WARN("TransformComponent::SetOrientation: Could Not Set Orientation - Parent Entity is Not Null But Is Invalid.");
@@ -371,7 +383,9 @@ namespace BC
                 return;
             }
 
-            auto parent_entity = Application::GetProject()->GetSceneManager()->GetEntity(meta_component.GetParentGUID());
+            Entity parent_entity = entity.GetParent();
+            if (!parent_entity)
+                parent_entity = Application::GetProject()->GetSceneManager()->GetEntity(meta_component.GetParentGUID());
             if (!parent_entity)
             {
                 BC_CORE_WARN("TransformComponent::SetScale: Could Not Set Scale - Parent Entity is Not Null But Is Invalid.");
@@ -572,7 +586,9 @@ namespace BC
                 return;
             }
 
-            auto parent_entity = Application::GetProject()->GetSceneManager()->GetEntity(meta_component.GetParentGUID());
+            Entity parent_entity = entity.GetParent();
+            if (!parent_entity)
+                parent_entity = Application::GetProject()->GetSceneManager()->GetEntity(meta_component.GetParentGUID());
             if (!parent_entity)
             {
                 BC_CORE_WARN("TransformComponent::SetMatrix: Could Not Set Matrix - Parent Entity is Not Null But Is Invalid.");
@@ -725,16 +741,22 @@ namespace BC
                 return m_GlobalMatrix;
             }
 
-            auto& meta_component = entity.GetComponent<MetaComponent>();
-            auto project = Application::GetProject();
-            if (!project)
+            Entity parent_entity = entity.GetParent();
+
+            // Parents in another scene are not linked, resolve those by GUID
+            if (auto& meta_component = entity.GetComponent<MetaComponent>(); !parent_entity && meta_component.HasParent())
             {
-                BC_CORE_ERROR("TransformComponent::GetGlobalMatrix: Cannot GetGlobalMatrix - Project Is Invalid.");
-                m_GlobalMatrix = m_LocalMatrix;
-                return m_GlobalMatrix;
+                auto project = Application::GetProject();
+                if (!project)
+                {
+                    BC_CORE_ERROR("TransformComponent::GetGlobalMatrix: Cannot GetGlobalMatrix - Project Is Invalid.");
+                    m_GlobalMatrix = m_LocalMatrix;
+                    return m_GlobalMatrix;
+                }
+
+                parent_entity = project->GetSceneManager()->GetEntity(meta_component.GetParentGUID());
             }
-            
-            Entity parent_entity = project->GetSceneManager()->GetEntity(meta_component.GetParentGUID());
+
             if (!parent_entity)
             {
                 m_GlobalMatrix = m_LocalMatrix;
@@ -918,6 +940,102 @@ namespace BC
 
 #pragma endregion
 
+#pragma region Relationship Component
+
+    namespace Util
+    {
+        void LinkRelationship(entt::registry& registry, entt::entity child, entt::entity parent, entt::entity before_sibling)
+        {
+            auto& storage = registry.storage<RelationshipComponent>();
+
+            auto& child_relationship = storage.get(child);
+            auto& parent_relationship = storage.get(parent);
+
+            BC_ASSERT(child_relationship.Parent == entt::null, "Util::LinkRelationship: Child Must Be Unlinked Before Linking To A New Parent.");
+
+            child_relationship.Parent = parent;
+
+            if (before_sibling == entt::null)
+            {
+                child_relationship.PreviousSibling = parent_relationship.LastChild;
+                child_relationship.NextSibling = entt::null;
+
+                if (parent_relationship.LastChild != entt::null)
+                    storage.get(parent_relationship.LastChild).NextSibling = child;
+                else
+                    parent_relationship.FirstChild = child;
+
+                parent_relationship.LastChild = child;
+            }
+            else
+            {
+                auto& sibling_relationship = storage.get(before_sibling);
+
+                child_relationship.PreviousSibling = sibling_relationship.PreviousSibling;
+                child_relationship.NextSibling = before_sibling;
+
+                if (sibling_relationship.PreviousSibling != entt::null)
+                    storage.get(sibling_relationship.PreviousSibling).NextSibling = child;
+                else
+                    parent_relationship.FirstChild = child;
+
+                sibling_relationship.PreviousSibling = child;
+            }
+
+            parent_relationship.ChildCount++;
+        }
+
+        void UnlinkRelationship(entt::registry& registry, entt::entity entity)
+        {
+            auto& storage = registry.storage<RelationshipComponent>();
+            if (!storage.contains(entity))
+                return;
+
+            auto& relationship = storage.get(entity);
+            if (relationship.Parent == entt::null)
+                return;
+
+            auto& parent_relationship = storage.get(relationship.Parent);
+
+            if (relationship.PreviousSibling != entt::null)
+                storage.get(relationship.PreviousSibling).NextSibling = relationship.NextSibling;
+            else
+                parent_relationship.FirstChild = relationship.NextSibling;
+
+            if (relationship.NextSibling != entt::null)
+                storage.get(relationship.NextSibling).PreviousSibling = relationship.PreviousSibling;
+            else
+                parent_relationship.LastChild = relationship.PreviousSibling;
+
+            parent_relationship.ChildCount--;
+
+            relationship.Parent = entt::null;
+            relationship.PreviousSibling = entt::null;
+            relationship.NextSibling = entt::null;
+        }
+
+        void RefreshRelationshipDepth(entt::registry& registry, entt::entity entity)
+        {
+            auto& storage = registry.storage<RelationshipComponent>();
+            if (!storage.contains(entity))
+                return;
+
+            auto& relationship = storage.get(entity);
+            relationship.Depth = relationship.Parent != entt::null ? storage.get(relationship.Parent).Depth + 1 : 0;
+
+            // Parents are always visited before their children, so each
+            // descendant can take its depth straight from its parent
+            HierarchyIterator<HierarchyWalk::Descendants> it(&storage, nullptr, relationship.FirstChild, entity);
+            for (; it != HierarchyIterator<HierarchyWalk::Descendants>{}; ++it)
+            {
+                auto& descendant_relationship = storage.get(it.GetEntityHandle());
+                descendant_relationship.Depth = storage.get(descendant_relationship.Parent).Depth + 1;
+            }
+        }
+    }
+
+#pragma endregion
+
 #pragma region Meta Component
 
     MetaComponent::MetaComponent(const MetaComponent &other)
@@ -1001,20 +1119,14 @@ namespace BC
             Entity parent_entity = project->GetSceneManager()->GetEntity(m_Parent);
             if (parent_entity) 
             {
-                for (const auto& child_guid : parent_entity.GetComponent<MetaComponent>().GetChildrenGUID()) 
+                for (Entity child_entity : parent_entity.GetChildren()) 
                 {
-                    if (child_guid == m_EntityID)
+                    const MetaComponent& child_meta = child_entity.GetComponent<MetaComponent>();
+                    if (child_meta.m_EntityID == m_EntityID)
                     {
                         continue;
                     }
 
-                    Entity child_entity = Application::GetProject()->GetSceneManager()->GetEntity(child_guid);
-                    if (!child_entity)
-                    {
-                        continue; // Ensure entity is valid
-                    }
-
-                    const MetaComponent& child_meta = child_entity.GetComponent<MetaComponent>();
                     if (child_meta.m_Name == test_name)
                     {
                         return true;
@@ -1077,20 +1189,28 @@ namespace BC
             return;
         }
 
-        for (const auto& child_uuid : m_Children) 
+        Entity new_parent_entity = Application::GetProject()->GetSceneManager()->GetEntity(new_parent_guid);
+        if (new_parent_entity == entity)
         {
-            if (child_uuid == new_parent_guid) 
-            {
-                BC_CORE_WARN("MetaComponent::AttachParent: Cannot Attach Child Entity As New Parent!");
-                return;
-            }
+            BC_CORE_WARN("MetaComponent::AttachParent: Cannot Attach Self as Parent!");
+            return;
         }
 
-        for (auto& child_entity : GetComponentsInChildren<MetaComponent>()) 
+        // Global transforms, their propagation and serialised children all
+        // follow the relationship links, which only reach within a scene
+        if (new_parent_entity && new_parent_entity.GetScene() != entity.GetScene())
         {
-            for (const auto& child_uuid : child_entity.GetComponent<MetaComponent>().GetChildrenGUID())
+            BC_CORE_WARN("MetaComponent::AttachParent: Cannot Attach Entity({0}) to Entity({1}) - Parent Must Be In The Same Scene!", entity.GetName(), new_parent_entity.GetName());
+            return;
+        }
+
+        // A descendant of this entity can not become its parent, this is an
+        // ancestor walk of the new parent rather than a search of the subtree
+        if (new_parent_entity)
+        {
+            for (Entity ancestor_entity : new_parent_entity.GetAncestors())
             {
-                if (child_uuid == new_parent_guid) 
+                if (ancestor_entity == entity) 
                 {
                     BC_CORE_WARN("MetaComponent::AttachParent: Cannot Attach Ancestor to Descendent!");
                     return;
@@ -1107,14 +1227,12 @@ namespace BC
         if (HasParent())
             DetachParent();
 
-        Entity new_parent_entity = Application::GetProject()->GetSceneManager()->GetEntity(new_parent_guid);
         if (!new_parent_entity) 
         {
             BC_CORE_ERROR("MetaComponent::AttachParent: Cannot Attach Parent - Parent Entity Is Invalid! Entity({0}) will be at the root of the scene now.", entity.GetName());
             return;
         }
-        
-        // TODO: If New Parent is in another scene we need to MOVE this from one scene to the other
+
 
         // 2. Convert Current Global Transform to Local Transform relative to new parent
         // Get references to the relevant components
@@ -1167,7 +1285,10 @@ namespace BC
         }
 
         m_Parent = new_parent_guid;
-        new_parent_entity.GetComponent<MetaComponent>().m_Children.push_back(entity.GetGUID());
+
+        entt::registry& registry = *entity.GetScene()->GetRegistry();
+        Util::LinkRelationship(registry, entity, new_parent_entity);
+        Util::RefreshRelationshipDepth(registry, entity);
     }
 
     void MetaComponent::DetachParent()
@@ -1210,28 +1331,25 @@ namespace BC
         {
             std::unordered_set<Entity> children_colliders_no_rigidbody{};
 
-            std::function<void(Entity&)> get_child_colliders_without_rigidbody;
-            get_child_colliders_without_rigidbody = [&](Entity& current_child_entity)
+            // Subtrees below a rigidbody are owned by that rigidbody, so
+            // they are not descended into
+            std::vector<Entity> pending_entities = { entity };
+            while (!pending_entities.empty())
             {
+                Entity current_child_entity = pending_entities.back();
+                pending_entities.pop_back();
+
                 if (current_child_entity.HasComponent<RigidbodyComponent>())
-                    return;
+                    continue;
                 
                 if (current_child_entity.HasAnyComponent<BoxColliderComponent, SphereColliderComponent, CapsuleColliderComponent, ConvexMeshColliderComponent, HeightFieldColliderComponent, TriangleMeshColliderComponent>())
                 {
                     children_colliders_no_rigidbody.insert(current_child_entity);
                 }
 
-                for (const auto& child_guid : current_child_entity.GetComponent<MetaComponent>().GetChildrenGUID())
-                {
-                    Entity child_entity = Application::GetProject()->GetSceneManager()->GetEntity(child_guid);
-                    if (!child_entity)
-                        continue;
-                    
-                    get_child_colliders_without_rigidbody(child_entity);
-                }
-            };
-
-            get_child_colliders_without_rigidbody(entity);
+                for (Entity child_entity : current_child_entity.GetChildren())
+                    pending_entities.push_back(child_entity);
+            }
 
             // 2. Flag all children with Collider Components without Rigidbodies to update
             //    rigidbody reference in the physics system
@@ -1270,23 +1388,42 @@ namespace BC
 
         if (HasParent()) 
         {
-            Entity old_parent_entity = Application::GetProject()->GetSceneManager()->GetEntity(m_Parent);
-            if (old_parent_entity)
-            {
-                auto& parent_children = old_parent_entity.GetComponent<MetaComponent>().m_Children;
-
-                // Remove the child from the parent's children list
-                parent_children.erase(
-                    std::remove(parent_children.begin(), parent_children.end(), entity.GetGUID()),
-                    parent_children.end()
-                );
-            }
+            entt::registry& registry = *entity.GetScene()->GetRegistry();
+            Util::UnlinkRelationship(registry, entity);
+            Util::RefreshRelationshipDepth(registry, entity);
         }
 
         // Clear the parent ID
         m_Parent = NULL_GUID;
     }
 
+    void MetaComponent::MoveBeforeSibling(GUID sibling_guid)
+    {
+        Entity entity = GetEntity();
+        if (!entity) 
+        {
+            BC_CORE_ERROR("MetaComponent::MoveBeforeSibling: Cannot Move Entity - Current Entity Is Invalid!");
+            return;
+        }
+
+        Entity sibling_entity = entity.GetScene()->GetEntity(sibling_guid);
+        if (!sibling_entity || sibling_entity == entity)
+            return;
+
+        Entity parent_entity = entity.GetParent();
+        if (!parent_entity || sibling_entity.GetParent() != parent_entity)
+        {
+            BC_CORE_WARN("MetaComponent::MoveBeforeSibling: Cannot Move Entity - Sibling Does Not Share The Same Parent.");
+            return;
+        }
+
+        entt::registry& registry = *entity.GetScene()->GetRegistry();
+        Util::UnlinkRelationship(registry, entity);
+        Util::LinkRelationship(registry, entity, parent_entity, sibling_entity);
+
+        entity.GetScene()->MarkHierarchyDirty();
+    }
+
     void MetaComponent::DetachChildren()
     {
         Entity entity = GetEntity();
@@ -1296,20 +1433,16 @@ namespace BC
             return;
         }
 
-        for (const auto& child_guid : m_Children) 
-        {
-            Entity child = Application::GetProject()->GetSceneManager()->GetEntity(child_guid);
-            if (!child || !child.HasComponent<MetaComponent>())
-            {
-                continue;
-            }
+        // Copied as detaching unlinks each child from the list being walked
+        auto children = entity.GetChildren();
+        std::vector<Entity> child_entities(children.begin(), children.end());
 
+        for (Entity& child : child_entities) 
+        {
             child.GetComponent<MetaComponent>().DetachParent();
         }
 
-        BC_CORE_TRACE("MetaComponent::DetachChildren: Detached {0} Children From Entity({1}).", m_Children.size(), entity.GetName());
-
-        m_Children.clear();
+        BC_CORE_TRACE("MetaComponent::DetachChildren: Detached {0} Children From Entity({1}).", child_entities.size(), entity.GetName());
     }
 
     void MetaComponent::RehomeChildren(GUID new_parent_guid)
@@ -1328,20 +1461,15 @@ namespace BC
             return;
         }
 
-        for (const auto& child_guid : m_Children) 
-        {
-            Entity child = Application::GetProject()->GetSceneManager()->GetEntity(child_guid);
-            if (!child || !child.HasComponent<MetaComponent>())
-            {
-                continue;
-            }
+        auto children = entity.GetChildren();
+        std::vector<Entity> child_entities(children.begin(), children.end());
 
+        for (Entity& child : child_entities) 
+        {
             child.GetComponent<MetaComponent>().AttachParent(new_parent_guid);
         }
 
-        BC_CORE_TRACE("Rehomed {0} Children From Entity({1}) to Entity({2}).", m_Children.size(), entity.GetName(), new_parent_entity.GetName());
-
-        m_Children.clear();
+        BC_CORE_TRACE("Rehomed {0} Children From Entity({1}) to Entity({2}).", child_entities.size(), entity.GetName(), new_parent_entity.GetName());
     }
 
     Entity MetaComponent::FindChild(GUID child_guid) const
@@ -1363,36 +1491,11 @@ namespace BC
         if (!found_child)
             return Entity{};
 
-        std::function<bool(Entity)> recurse_children;
-        recurse_children = [&](Entity current_entity) -> bool
-        {            
-            auto& meta_component = current_entity.GetComponent<MetaComponent>();
-            for (GUID _child_guid : meta_component.GetChildrenGUID())
-            {
-                if (_child_guid == child_guid)
-                {
-                    found_child = Application::GetProject()->GetSceneManager()->GetEntity(child_guid);
-                    return true;
-                }
-            }
-
-            for (GUID _child_guid : meta_component.GetChildrenGUID())
-            {
-                Entity _child_entity = Application::GetProject()->GetSceneManager()->GetEntity(_child_guid);
-                if (!_child_entity || !_child_entity.HasComponent<MetaComponent>())
-                    continue;
-                
-                if (recurse_children(_child_entity))
-                    return true;
-            }
-
-            return false;
-        };
-
-        bool found = recurse_children(entity);
-        if (found && found_child)
+        // The child is below this entity if this entity is one of its ancestors
+        for (Entity ancestor_entity : found_child.GetAncestors())
         {
-            return found_child;
+            if (ancestor_entity == entity)
+                return found_child;
         }
 
         return Entity{};
@@ -1413,44 +1516,10 @@ namespace BC
             return Entity{};
         }
 
-        Entity found_child = Application::GetProject()->GetSceneManager()->GetEntity(child_name);
-        if (!found_child)
-            return Entity{};
-        
-        std::function<bool(Entity)> recurse_children;
-        recurse_children = [&](Entity current_entity) -> bool
+        for (Entity descendant_entity : entity.GetDescendants())
         {
-            auto& meta_component = current_entity.GetComponent<MetaComponent>();
-
-            std::vector<Entity> cached_entities = {};
-            cached_entities.reserve(meta_component.GetChildrenGUID().size());
-
-            for (GUID _child_guid : meta_component.GetChildrenGUID())
-            {
-                Entity _child_entity = Application::GetProject()->GetSceneManager()->GetEntity(_child_guid);
-                cached_entities.push_back(_child_entity);
-
-                if (!_child_entity || !_child_entity.HasComponent<MetaComponent>())
-                    continue;
-
-                if (_child_entity.GetName() == child_name)
-                {
-                    return true;
-                }
-            }
-
-            for (Entity _child_entity : cached_entities)
-            {                
-                if (recurse_children(_child_entity))
-                    return true;
-            }
-
-            return false;
-        };
-
-        if (recurse_children(entity) && found_child)
-        {
-            return found_child;
+            if (descendant_entity.GetName() == child_name)
+                return descendant_entity;
         }
         
         return Entity{};
@@ -1458,23 +1527,38 @@ namespace BC
 
     GUID MetaComponent::GetRootParentGUID() const
     {
-        auto parent_components = GetComponentsInParents<MetaComponent>();
+        auto entity = GetEntity();
+        if (!entity)
+            return NULL_GUID;
 
-        for (auto it = parent_components.rbegin(); it != parent_components.rend(); ++it)
-        {
-            Entity& parent = *it;
-            if (!parent)
-                continue;
+        Entity root_entity = entity;
+        for (Entity ancestor_entity : entity.GetAncestors())
+            root_entity = ancestor_entity;
 
-            if (!parent.GetComponent<MetaComponent>().HasParent())
-                return parent.GetGUID();
-        }
+        return root_entity.GetGUID();
+    }
 
+    bool MetaComponent::HasChildren() const
+    {
         auto entity = GetEntity();
         if (!entity)
-            return NULL_GUID;
+            return false;
+
+        return !entity.GetChildren().empty();
+    }
+
+    std::vector<GUID> MetaComponent::GetChildrenGUID() const
+    {
+        std::vector<GUID> children_guid;
+
+        auto entity = GetEntity();
+        if (!entity)
+            return children_guid;
+
+        for (Entity child_entity : entity.GetChildren())
+            children_guid.push_back(child_entity.GetGUID());
 
-        return entity.GetGUID();
+        return children_guid;
     }
 
 #pragma region Serialisation
@@ -1491,7 +1575,7 @@ namespace BC
 
             out << YAML::Key << "Children" << YAML::Value;
             out << YAML::BeginSeq;
-            for (GUID child_guid : m_Children) 
+            for (GUID child_guid : GetChildrenGUID()) 
             {
                 out << YAML::BeginMap;
                 out << YAML::Key << "ChildGUID" << YAML::Value << child_guid;
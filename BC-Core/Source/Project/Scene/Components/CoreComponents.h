@@ -12,6 +12,8 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 
+#include <entt/entt.hpp>
+
 namespace YAML 
 {
 	class Emitter;
@@ -47,6 +49,9 @@ namespace BC
     #pragma region General Methods
 
         void UpdateLocalMatrix(bool scale_updated = false);
+
+        /// @brief Flags this transform and every descendant as requiring
+        /// their global transform to be recalculated
         void OnTransformUpdated(bool scale_updated = false);
 
     #pragma endregion
@@ -130,6 +135,10 @@ namespace BC
         bool NoFlagsSet() const;
 
         TransformComponentFlag GetFlags() const;
+
+        /// @brief Changes whenever the global transform is marked dirty, e.g.,
+        /// so the GPU scene can skip uploading unmoved objects
+        uint32_t GetGlobalTransformVersion() const { return m_GlobalTransformVersion; }
     
     #pragma endregion
     
@@ -159,11 +168,51 @@ namespace BC
         glm::mat4 m_GlobalMatrix        = glm::mat4(1.0f);
 
         TransformComponentFlag m_StateFlags     = TransformFlag_PropertiesUpdated | TransformFlag_GlobalTransformUpdated;
+        uint32_t m_GlobalTransformVersion       = 0;
+
+        /// @brief Per entity part of OnTransformUpdated, does not recurse
+        void MarkGlobalTransformDirty(const Entity& entity, bool scale_updated);
 
         friend struct MetaComponent;
 
     };
 
+    /// @brief Handle based links of the entity hierarchy within a scene.
+    ///
+    /// Present on every entity and maintained by MetaComponent when parents
+    /// are attached or detached. Hierarchy walks follow these links, the
+    /// GUIDs held by MetaComponent are what is persisted to file.
+    struct RelationshipComponent
+    {
+        entt::entity Parent             = entt::null;
+        entt::entity FirstChild         = entt::null;
+        entt::entity LastChild          = entt::null;
+        entt::entity PreviousSibling    = entt::null;
+        entt::entity NextSibling        = entt::null;
+
+        uint32_t ChildCount = 0;
+
+        /// @brief Zero for entities at the root of the scene
+        uint32_t Depth = 0;
+    };
+
+    namespace Util
+    {
+        /// @brief Links the child under the parent, immediately before the
+        /// given sibling or as the last child if the sibling is null. The
+        /// child must not currently be linked to a parent. Depth is not
+        /// updated, see RefreshRelationshipDepth.
+        void LinkRelationship(entt::registry& registry, entt::entity child, entt::entity parent, entt::entity before_sibling = entt::null);
+
+        /// @brief Unlinks the entity from its parent and siblings, its own
+        /// children remain attached to it
+        void UnlinkRelationship(entt::registry& registry, entt::entity entity);
+
+        /// @brief Recalculates the depth of the entity from its parent, then
+        /// of every descendant
+        void RefreshRelationshipDepth(entt::registry& registry, entt::entity entity);
+    }
+
     struct MetaComponent : public ComponentBase
     {
     
@@ -190,11 +239,17 @@ namespace BC
         
         // --- Hierarchy ---
         bool HasParent() const { return m_Parent != NULL_GUID; }
-        bool HasChildren() const { return !m_Children.empty(); }
+        bool HasChildren() const;
         
+        /// @brief Keeps the entity's global transform. The parent must be in
+        /// the same scene, any other parent is rejected with a warning.
         void AttachParent(GUID new_parent_guid);
         void DetachParent();
 
+        /// @brief Moves this entity within its parent's children so that it
+        /// is placed immediately before the sibling
+        void MoveBeforeSibling(GUID sibling_guid);
+
         void DetachChildren();
         void RehomeChildren(GUID new_parent_guid);
 
@@ -203,7 +258,10 @@ namespace BC
 
         GUID GetRootParentGUID() const;
         GUID GetParentGUID() const { return m_Parent; }
-        const std::vector<GUID>& GetChildrenGUID() const { return m_Children; }
+
+        /// @brief Built from the relationship links, prefer iterating
+        /// Entity::GetChildren where the GUIDs are not needed
+        std::vector<GUID> GetChildrenGUID() const;
         
         // --- Scripts ---
 
@@ -320,7 +378,9 @@ namespace BC
         /// @brief The GUID of the parent entity which this entity is attached to
         GUID m_Parent = NULL_GUID;
 
-        /// @brief A vector of children GUID's attached to this entity
+        /// @brief Child GUIDs read from file, only held until the scene links
+        /// its hierarchy. Children are otherwise found through the entity's
+        /// RelationshipComponent.
         std::vector<GUID> m_Children = {};
 
         /// @brief A vector of scripts attached to this entity and their active status. First = script name, Second = active status
@@ -329,6 +389,7 @@ namespace BC
         /// @brief This is the source asset handle of the prefab that this object is created from and linked to
         AssetHandle m_PrefabSourceHandle = NULL_GUID;
 
+        friend class Scene;
         friend class HierarchyPanel;
 
     };
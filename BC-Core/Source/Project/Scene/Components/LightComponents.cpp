@@ -28,6 +28,7 @@ namespace BC
         m_Intensity = other.m_Intensity;
         m_ShadowType = other.m_ShadowType;
         m_Active = other.m_Active;
+        m_DataVersion = other.m_DataVersion;
 
         other.m_Radius = 10.0f;
         other.m_Intensity = 1.0f;
@@ -46,6 +47,10 @@ namespace BC
         m_ShadowType = other.m_ShadowType;
         m_Active = other.m_Active;
 
+        m_SpatialNeedsUpdate = true;
+
+        m_DataVersion = std::max(m_DataVersion, other.m_DataVersion) + 1;
+
         return *this;
     }
 
@@ -62,11 +67,15 @@ namespace BC
         m_ShadowType = other.m_ShadowType;
         m_Active = other.m_Active;
 
+        m_SpatialNeedsUpdate = true;
+
         other.m_Radius = 10.0f;
         other.m_Intensity = 1.0f;
         other.m_ShadowType = ShadowType_None;
         other.m_Active = true;
 
+        m_DataVersion = std::max(m_DataVersion, other.m_DataVersion) + 1;
+
         return *this;
     }
 
@@ -109,6 +118,7 @@ namespace BC
         m_Intensity = other.m_Intensity;
         m_ShadowType = other.m_ShadowType;
         m_Active = other.m_Active;
+        m_DataVersion = other.m_DataVersion;
 
         other.m_Angle = 90.0f;
         other.m_Range = 20.0f;
@@ -130,6 +140,10 @@ namespace BC
         m_ShadowType = other.m_ShadowType;
         m_Active = other.m_Active;
 
+        m_SpatialNeedsUpdate = true;
+
+        m_DataVersion = std::max(m_DataVersion, other.m_DataVersion) + 1;
+
         return *this;
     }
 
@@ -147,12 +161,16 @@ namespace BC
         m_ShadowType = other.m_ShadowType;
         m_Active = other.m_Active;
 
+        m_SpatialNeedsUpdate = true;
+
         other.m_Angle = 90.0f;
         other.m_Range = 20.0f;
         other.m_Intensity = 1.0f;
         other.m_ShadowType = ShadowType_None;
         other.m_Active = true;
 
+        m_DataVersion = std::max(m_DataVersion, other.m_DataVersion) + 1;
+
         return *this;
     }
 
@@ -191,6 +209,7 @@ namespace BC
         m_Intensity = other.m_Intensity;
         m_ShadowType = other.m_ShadowType;
         m_Active = other.m_Active;
+        m_DataVersion = other.m_DataVersion;
 
         other.m_Intensity = 1.0f;
         other.m_ShadowType = ShadowType_None;
@@ -207,6 +226,8 @@ namespace BC
         m_ShadowType = other.m_ShadowType;
         m_Active = other.m_Active;
 
+        m_DataVersion = std::max(m_DataVersion, other.m_DataVersion) + 1;
+
         return *this;
     }
 
@@ -226,6 +247,8 @@ namespace BC
         other.m_ShadowType = ShadowType_None;
         other.m_Active = true;
 
+        m_DataVersion = std::max(m_DataVersion, other.m_DataVersion) + 1;
+
         return *this;
     }
 
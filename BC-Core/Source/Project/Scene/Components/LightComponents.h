@@ -50,11 +50,21 @@ namespace BC
         bool GetActive() const { return m_Active; }
 
         // Setters
-        void SetColour(const glm::vec4& colour) { m_Colour = colour; }
-        void SetRadius(float radius) { m_Radius = radius; }
-        void SetIntensity(float intensity) { m_Intensity = intensity; }
-        void SetShadowType(ShadowType shadow_type) { m_ShadowType = shadow_type; }
-        void SetActive(bool active) { m_Active = active; }
+        void SetColour(const glm::vec4& colour) { m_Colour = colour; m_DataVersion++; }
+        void SetRadius(float radius) { m_Radius = radius; m_SpatialNeedsUpdate = true; m_DataVersion++; }
+        void SetIntensity(float intensity) { m_Intensity = intensity; m_DataVersion++; }
+        void SetShadowType(ShadowType shadow_type) { m_ShadowType = shadow_type; m_DataVersion++; }
+        void SetActive(bool active) { m_Active = active; m_DataVersion++; }
+
+        /// @brief Flags the light to be placed again in its scene's light
+        /// index, e.g., after its transform changed
+        void UpdateSpatialBounds() { m_SpatialNeedsUpdate = true; }
+        bool NeedsSpatialUpdate() const { return m_SpatialNeedsUpdate; }
+        void ClearSpatialUpdate() { m_SpatialNeedsUpdate = false; }
+
+        /// @brief Changes whenever a property of the light changes, so the
+        /// GPU scene only uploads lights which have
+        uint32_t GetDataVersion() const { return m_DataVersion; }
 
     private:
         
@@ -64,6 +74,9 @@ namespace BC
         ShadowType m_ShadowType = ShadowType_None;
         bool m_Active = true;
 
+        bool m_SpatialNeedsUpdate = true;
+        uint32_t m_DataVersion = 0;
+
     };
 
     struct ConeLightComponent : public ComponentBase
@@ -93,12 +106,22 @@ namespace BC
         bool GetActive() const { return m_Active; }
 
         // Setters
-        void SetColour(const glm::vec4& colour) { m_Colour = colour; }
-        void SetAngle(float angle) { m_Angle = angle; }
-        void SetRange(float range) { m_Range = range; }
-        void SetIntensity(float intensity) { m_Intensity = intensity; }
-        void SetShadowType(ShadowType shadow_type) { m_ShadowType = shadow_type; }
-        void SetActive(bool active) { m_Active = active; }
+        void SetColour(const glm::vec4& colour) { m_Colour = colour; m_DataVersion++; }
+        void SetAngle(float angle) { m_Angle = angle; m_SpatialNeedsUpdate = true; m_DataVersion++; }
+        void SetRange(float range) { m_Range = range; m_SpatialNeedsUpdate = true; m_DataVersion++; }
+        void SetIntensity(float intensity) { m_Intensity = intensity; m_DataVersion++; }
+        void SetShadowType(ShadowType shadow_type) { m_ShadowType = shadow_type; m_DataVersion++; }
+        void SetActive(bool active) { m_Active = active; m_DataVersion++; }
+
+        /// @brief Flags the light to be placed again in its scene's light
+        /// index, e.g., after its transform changed
+        void UpdateSpatialBounds() { m_SpatialNeedsUpdate = true; }
+        bool NeedsSpatialUpdate() const { return m_SpatialNeedsUpdate; }
+        void ClearSpatialUpdate() { m_SpatialNeedsUpdate = false; }
+
+        /// @brief Changes whenever a property of the light changes, so the
+        /// GPU scene only uploads lights which have
+        uint32_t GetDataVersion() const { return m_DataVersion; }
 
     private:
 
@@ -109,6 +132,9 @@ namespace BC
         ShadowType m_ShadowType = ShadowType_None;
         bool m_Active = true;     
 
+        bool m_SpatialNeedsUpdate = true;
+        uint32_t m_DataVersion = 0;
+
     };
 
     struct DirectionalLightComponent : public ComponentBase
@@ -136,10 +162,14 @@ namespace BC
         bool GetActive() const { return m_Active; }
 
         // Setters
-        void SetColour(const glm::vec4& colour) { m_Colour = colour; }
-        void SetIntensity(float intensity) { m_Intensity = intensity; }
-        void SetShadowType(ShadowType shadow_type) { m_ShadowType = shadow_type; }
-        void SetActive(bool active) { m_Active = active; }
+        void SetColour(const glm::vec4& colour) { m_Colour = colour; m_DataVersion++; }
+        void SetIntensity(float intensity) { m_Intensity = intensity; m_DataVersion++; }
+        void SetShadowType(ShadowType shadow_type) { m_ShadowType = shadow_type; m_DataVersion++; }
+        void SetActive(bool active) { m_Active = active; m_DataVersion++; }
+
+        /// @brief Changes whenever a property of the light changes, so the
+        /// GPU scene only uploads lights which have
+        uint32_t GetDataVersion() const { return m_DataVersion; }
 
     private:
         
@@ -148,6 +178,8 @@ namespace BC
         ShadowType m_ShadowType = ShadowType_None;
         bool m_Active = true;
 
+        uint32_t m_DataVersion = 0;
+
     };
 
 }
\ No newline at end of file
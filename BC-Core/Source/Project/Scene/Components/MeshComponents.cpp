@@ -14,13 +14,26 @@ namespace BC
     
     LODMeshComponent::LODMeshComponent(const LODMeshComponent& other)
     {
-
+        m_LODs = other.m_LODs;
+        m_LODBias = other.m_LODBias;
+        m_CrossFade = other.m_CrossFade;
+        m_CrossFadeWidth = other.m_CrossFadeWidth;
+        m_ShadowLOD = other.m_ShadowLOD;
     }
 
     LODMeshComponent::LODMeshComponent(LODMeshComponent&& other) noexcept
     {
 		m_Entity = std::move(other.m_Entity); other.m_Entity = nullptr;
 
+        m_LODs = std::move(other.m_LODs);
+        m_LODBias = other.m_LODBias;
+        m_CrossFade = other.m_CrossFade;
+        m_CrossFadeWidth = other.m_CrossFadeWidth;
+        m_ShadowLOD = other.m_ShadowLOD;
+
+        other.m_LODBias = 1.0f;
+        other.m_CrossFade = false;
+        other.m_ShadowLOD = 0;
     }
 
     LODMeshComponent& LODMeshComponent::operator=(const LODMeshComponent& other)
@@ -28,6 +41,12 @@ namespace BC
         if (this == &other)
             return *this;
 
+        m_LODs = other.m_LODs;
+        m_LODBias = other.m_LODBias;
+        m_CrossFade = other.m_CrossFade;
+        m_CrossFadeWidth = other.m_CrossFadeWidth;
+        m_ShadowLOD = other.m_ShadowLOD;
+
         return *this;
     }
 
@@ -38,6 +57,16 @@ namespace BC
 
 		m_Entity = std::move(other.m_Entity); other.m_Entity = nullptr;
 
+        m_LODs = std::move(other.m_LODs);
+        m_LODBias = other.m_LODBias;
+        m_CrossFade = other.m_CrossFade;
+        m_CrossFadeWidth = other.m_CrossFadeWidth;
+        m_ShadowLOD = other.m_ShadowLOD;
+
+        other.m_LODBias = 1.0f;
+        other.m_CrossFade = false;
+        other.m_ShadowLOD = 0;
+
         return *this;
     }
 
@@ -46,14 +75,117 @@ namespace BC
         out << YAML::Key << Util::ComponentTypeToString(GetType()) << YAML::Value;
 		out << YAML::BeginMap;
 		{
-            
+            out << YAML::Key << "LOD Bias" << YAML::Value << m_LODBias;
+            out << YAML::Key << "Cross Fade" << YAML::Value << m_CrossFade;
+            out << YAML::Key << "Cross Fade Width" << YAML::Value << m_CrossFadeWidth;
+            out << YAML::Key << "Shadow LOD" << YAML::Value << m_ShadowLOD;
+
+            out << YAML::Key << "LODs" << YAML::Value;
+            out << YAML::BeginSeq;
+            for (const auto& lod : m_LODs)
+            {
+                out << YAML::BeginMap;
+                out << YAML::Key << "Mesh Handle" << YAML::Value << static_cast<uint64_t>(lod.mesh_handle);
+                out << YAML::Key << "Screen Coverage" << YAML::Value << lod.screen_coverage;
+                out << YAML::EndMap;
+            }
+            out << YAML::EndSeq;
         }
 		out << YAML::EndMap;
     }
 
     bool LODMeshComponent::SceneDeserialise(const YAML::Node& data)
     {
-        return false;
+        if (data["LOD Bias"])
+            SetLODBias(data["LOD Bias"].as<float>());
+
+        if (data["Cross Fade"])
+            m_CrossFade = data["Cross Fade"].as<bool>();
+
+        if (data["Cross Fade Width"])
+            SetCrossFadeWidth(data["Cross Fade Width"].as<float>());
+
+        if (data["Shadow LOD"])
+            m_ShadowLOD = data["Shadow LOD"].as<uint32_t>();
+
+        if (data["LODs"])
+        {
+            std::vector<Util::LODLevel> lods;
+            for (const auto& lod_node : data["LODs"])
+            {
+                Util::LODLevel& lod = lods.emplace_back();
+                if (lod_node["Mesh Handle"])
+                    lod.mesh_handle = lod_node["Mesh Handle"].as<uint64_t>();
+                if (lod_node["Screen Coverage"])
+                    lod.screen_coverage = lod_node["Screen Coverage"].as<float>();
+            }
+            SetLODs(std::move(lods));
+        }
+
+        return true;
+    }
+
+    void LODMeshComponent::SetLODs(std::vector<Util::LODLevel> lods)
+    {
+        for (auto& lod : lods)
+            lod.screen_coverage = std::max(lod.screen_coverage, 0.0f);
+
+        std::stable_sort(lods.begin(), lods.end(), [](const Util::LODLevel& a, const Util::LODLevel& b)
+        {
+            return a.screen_coverage > b.screen_coverage;
+        });
+
+        if (lods.size() > MAX_LOD_COUNT)
+            lods.resize(MAX_LOD_COUNT);
+
+        m_LODs = std::move(lods);
+    }
+
+    Util::LODSelection LODMeshComponent::SelectLOD(float screen_coverage) const
+    {
+        Util::LODSelection selection = {};
+        if (m_LODs.empty())
+        {
+            selection.lod_index = 0;
+            return selection;
+        }
+
+        float coverage = screen_coverage * m_LODBias;
+
+        int32_t lod_count = static_cast<int32_t>(m_LODs.size());
+        for (int32_t i = 0; i < lod_count; ++i)
+        {
+            float threshold = m_LODs[i].screen_coverage;
+            if (coverage < threshold)
+                continue;
+
+            selection.lod_index = i;
+
+            // Just above the threshold the level fades out, into the next
+            // coarser level or, for the last level, into nothing
+            float fade_band = threshold * m_CrossFadeWidth;
+            if (m_CrossFade && fade_band > 0.0f && coverage < threshold + fade_band)
+            {
+                selection.lod_fade = (coverage - threshold) / fade_band;
+                if (i + 1 < lod_count)
+                {
+                    selection.fade_lod_index = i + 1;
+                    selection.fade_lod_fade = 1.0f - selection.lod_fade;
+                }
+            }
+
+            return selection;
+        }
+
+        return selection;
+    }
+
+    AssetHandle LODMeshComponent::GetLODMesh(uint32_t lod_index, AssetHandle fallback_mesh) const
+    {
+        if (lod_index >= m_LODs.size() || m_LODs[lod_index].mesh_handle == NULL_GUID)
+            return fallback_mesh;
+
+        return m_LODs[lod_index].mesh_handle;
     }
 
 #pragma endregion
@@ -66,6 +198,7 @@ namespace BC
         m_MaterialHandles = other.m_MaterialHandles;
         m_Active = other.m_Active;
         m_CastingShadow = other.m_CastingShadow;
+        m_Occluder = other.m_Occluder;
         m_TransformedAABB = other.m_TransformedAABB;
         m_OctreeNeedsUpdate = other.m_OctreeNeedsUpdate;
         m_BoundingBoxNeedsUpdate = other.m_BoundingBoxNeedsUpdate;
@@ -80,6 +213,7 @@ namespace BC
         m_MaterialHandles = std::move(other.m_MaterialHandles);
         m_Active = other.m_Active;
         m_CastingShadow = other.m_CastingShadow;
+        m_Occluder = other.m_Occluder;
         m_TransformedAABB = std::move(other.m_TransformedAABB);
         m_OctreeNeedsUpdate = other.m_OctreeNeedsUpdate;
         m_BoundingBoxNeedsUpdate = other.m_BoundingBoxNeedsUpdate;
@@ -88,6 +222,7 @@ namespace BC
         other.m_StaticMeshHandle = NULL_GUID;
         other.m_Active = false;
         other.m_CastingShadow = false;
+        other.m_Occluder = false;
         other.m_OctreeNeedsUpdate = true;
         other.m_BoundingBoxNeedsUpdate = true;
         other.m_DisplayDebugAABB = false;
@@ -102,6 +237,7 @@ namespace BC
         m_MaterialHandles = other.m_MaterialHandles;
         m_Active = other.m_Active;
         m_CastingShadow = other.m_CastingShadow;
+        m_Occluder = other.m_Occluder;
         m_TransformedAABB = other.m_TransformedAABB;
         m_OctreeNeedsUpdate = other.m_OctreeNeedsUpdate;
         m_BoundingBoxNeedsUpdate = other.m_BoundingBoxNeedsUpdate;
@@ -121,6 +257,7 @@ namespace BC
         m_MaterialHandles = std::move(other.m_MaterialHandles);
         m_Active = other.m_Active;
         m_CastingShadow = other.m_CastingShadow;
+        m_Occluder = other.m_Occluder;
         m_TransformedAABB = std::move(other.m_TransformedAABB);
         m_OctreeNeedsUpdate = other.m_OctreeNeedsUpdate;
         m_BoundingBoxNeedsUpdate = other.m_BoundingBoxNeedsUpdate;
@@ -129,6 +266,7 @@ namespace BC
         other.m_StaticMeshHandle = NULL_GUID;
         other.m_Active = false;
         other.m_CastingShadow = false;
+        other.m_Occluder = false;
         other.m_OctreeNeedsUpdate = true;
         other.m_BoundingBoxNeedsUpdate = true;
         other.m_DisplayDebugAABB = false;
@@ -165,37 +303,8 @@ namespace BC
 
 		if (auto mesh_asset = AssetManager::GetAsset<StaticMesh>(m_StaticMeshHandle); mesh_asset) 
         {
-			// Define the 8 corner points of the AABB
-            const auto& bounds = mesh_asset->GetMeshBounds();
-			std::array<glm::vec3, 8> corners = 
-            {
-				mesh_asset->GetMeshBounds().BoundsMin,
-				glm::vec3(bounds.BoundsMax.x, bounds.BoundsMin.y, bounds.BoundsMin.z),
-				glm::vec3(bounds.BoundsMax.x, bounds.BoundsMax.y, bounds.BoundsMin.z),
-				glm::vec3(bounds.BoundsMin.x, bounds.BoundsMax.y, bounds.BoundsMin.z),
-				glm::vec3(bounds.BoundsMin.x, bounds.BoundsMin.y, bounds.BoundsMax.z),
-				glm::vec3(bounds.BoundsMax.x, bounds.BoundsMin.y, bounds.BoundsMax.z),
-				glm::vec3(bounds.BoundsMax.x, bounds.BoundsMax.y, bounds.BoundsMax.z),
-				glm::vec3(bounds.BoundsMin.x, bounds.BoundsMax.y, bounds.BoundsMax.z)
-			};
-
-			// Transform the corner points
 			const glm::mat4& global_transform = GetComponent<TransformComponent>().GetGlobalMatrix();
-			for (int i = 0; i < 8; ++i) 
-            {
-				glm::vec4 transformed_corner = global_transform * glm::vec4(corners[i], 1.0f);
-				corners[i] = glm::vec3(transformed_corner);
-			}
-
-			// Find the new BoundsMin and BoundsMax
-			glm::vec3 new_min = corners[0];
-			glm::vec3 new_max = corners[0];
-			for (int i = 1; i < 8; ++i) {
-				new_min = glm::min(new_min, corners[i]);
-				new_max = glm::max(new_max, corners[i]);
-			}
-			m_TransformedAABB.BoundsMin = new_min;
-			m_TransformedAABB.BoundsMax = new_max;
+			m_TransformedAABB = mesh_asset->GetMeshBounds().Transformed(global_transform);
 
 			m_BoundingBoxNeedsUpdate = false;
 		}
@@ -324,37 +433,8 @@ namespace BC
 
 		if (auto mesh_asset = AssetManager::GetAsset<StaticMesh>(m_SkinnedMeshHandle); mesh_asset) 
         {
-			// Define the 8 corner points of the AABB
-            const auto& bounds = mesh_asset->GetMeshBounds();
-			std::array<glm::vec3, 8> corners = 
-            {
-				mesh_asset->GetMeshBounds().BoundsMin,
-				glm::vec3(bounds.BoundsMax.x, bounds.BoundsMin.y, bounds.BoundsMin.z),
-				glm::vec3(bounds.BoundsMax.x, bounds.BoundsMax.y, bounds.BoundsMin.z),
-				glm::vec3(bounds.BoundsMin.x, bounds.BoundsMax.y, bounds.BoundsMin.z),
-				glm::vec3(bounds.BoundsMin.x, bounds.BoundsMin.y, bounds.BoundsMax.z),
-				glm::vec3(bounds.BoundsMax.x, bounds.BoundsMin.y, bounds.BoundsMax.z),
-				glm::vec3(bounds.BoundsMax.x, bounds.BoundsMax.y, bounds.BoundsMax.z),
-				glm::vec3(bounds.BoundsMin.x, bounds.BoundsMax.y, bounds.BoundsMax.z)
-			};
-
-			// Transform the corner points
 			const glm::mat4& global_transform = GetComponent<TransformComponent>().GetGlobalMatrix();
-			for (int i = 0; i < 8; ++i) 
-            {
-				glm::vec4 transformed_corner = global_transform * glm::vec4(corners[i], 1.0f);
-				corners[i] = glm::vec3(transformed_corner);
-			}
-
-			// Find the new BoundsMin and BoundsMax
-			glm::vec3 new_min = corners[0];
-			glm::vec3 new_max = corners[0];
-			for (int i = 1; i < 8; ++i) {
-				new_min = glm::min(new_min, corners[i]);
-				new_max = glm::max(new_max, corners[i]);
-			}
-			m_TransformedAABB.BoundsMin = new_min;
-			m_TransformedAABB.BoundsMax = new_max;
+			m_TransformedAABB = mesh_asset->GetMeshBounds().Transformed(global_transform);
 
 			m_BoundingBoxNeedsUpdate = false;
 		}
@@ -8,6 +8,10 @@
 #include "Project/Scene/Bounds/Bounds.h"
 
 // C++ Standard Library Headers
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
 
 // External Vendor Library Headers
 
@@ -20,6 +24,33 @@ namespace YAML
 namespace BC
 {
 
+    namespace Util
+    {
+        inline const std::vector<AssetHandle> EMPTY_MATERIAL_HANDLES = {};
+
+        /// @brief A level of detail of a LODMeshComponent, drawn while the
+        /// mesh's bounding sphere covers at least screen_coverage of the
+        /// view's height. A NULL_GUID mesh draws the MeshRendererComponent's.
+        struct LODLevel
+        {
+            AssetHandle mesh_handle = NULL_GUID;
+            float screen_coverage = 0.0f;
+        };
+
+        /// @brief The levels a view draws, see LODMeshComponent::SelectLOD
+        struct LODSelection
+        {
+            // -1 when the mesh is too small to draw
+            int32_t lod_index = -1;
+            float lod_fade = 1.0f;
+
+            // The next coarser level while cross fading, -1 otherwise. Both
+            // levels are drawn, their fades summing to 1.0f.
+            int32_t fade_lod_index = -1;
+            float fade_lod_fade = 0.0f;
+        };
+    }
+
     struct LODMeshComponent : public ComponentBase
     {
     
@@ -38,8 +69,51 @@ namespace BC
         void SceneSerialise(YAML::Emitter& out) const override;
         bool SceneDeserialise(const YAML::Node& data) override;
 
+        static constexpr uint32_t MAX_LOD_COUNT = 8;
+
+        /// @brief Levels are kept finest first, i.e., sorted by descending
+        /// screen coverage, and at most MAX_LOD_COUNT are kept. Below the last
+        /// level's coverage the mesh is not drawn, so a last coverage of 0.0f
+        /// keeps it drawn at any distance.
+        void SetLODs(std::vector<Util::LODLevel> lods);
+        void SetLODBias(float lod_bias) { m_LODBias = std::max(lod_bias, 0.01f); }
+        void SetCrossFade(bool cross_fade) { m_CrossFade = cross_fade; }
+        void SetCrossFadeWidth(float cross_fade_width) { m_CrossFadeWidth = std::clamp(cross_fade_width, 0.0f, 1.0f); }
+        void SetShadowLOD(uint32_t shadow_lod) { m_ShadowLOD = shadow_lod; }
+
+        const std::vector<Util::LODLevel>& GetLODs() const { return m_LODs; }
+        float GetLODBias() const { return m_LODBias; }
+        bool GetCrossFade() const { return m_CrossFade; }
+        float GetCrossFadeWidth() const { return m_CrossFadeWidth; }
+        uint32_t GetShadowLOD() const { return m_ShadowLOD; }
+
+        /// @brief Chooses the levels to draw for a bounding sphere covering
+        /// screen_coverage of a view's height, before the LOD bias is applied
+        Util::LODSelection SelectLOD(float screen_coverage) const;
+
+        /// @brief The level shadow views draw, clamped to the last level
+        uint32_t GetShadowLODIndex() const { return m_LODs.empty() ? 0 : std::min(m_ShadowLOD, static_cast<uint32_t>(m_LODs.size() - 1)); }
+
+        /// @brief The mesh of a level, or fallback_mesh if the level has none
+        AssetHandle GetLODMesh(uint32_t lod_index, AssetHandle fallback_mesh) const;
+
     private:
-        
+
+        std::vector<Util::LODLevel> m_LODs = {};
+
+        /// @brief Scales the screen coverage before selection, above 1.0f
+        /// keeps finer levels for longer
+        float m_LODBias = 1.0f;
+
+        /// @brief Dithers between a level and the next coarser one while the
+        /// coverage is within m_CrossFadeWidth of the threshold, given as a
+        /// fraction of the threshold, rather than popping between them
+        bool m_CrossFade = false;
+        float m_CrossFadeWidth = 0.1f;
+
+        /// @brief Level drawn into shadow views regardless of distance, so
+        /// casters can use a coarser mesh than the cameras see
+        uint32_t m_ShadowLOD = 0;
 
     };
     
@@ -64,28 +138,47 @@ namespace BC
         void SetActive(bool active) { m_Active = active; }
         void SetMesh(AssetHandle mesh_handle) { m_StaticMeshHandle = mesh_handle; }
         void SetCastingShadows(bool cast_shadows) { m_CastingShadow = cast_shadows; }
+        void SetOccluder(bool occluder) { m_Occluder = occluder; }
+        void SetMaterialHandles(std::vector<AssetHandle> material_handles) { m_MaterialHandles = std::make_shared<const std::vector<AssetHandle>>(std::move(material_handles)); }
         void SetDrawDebug(bool draw_debug) { m_DisplayDebugAABB = draw_debug; }
 
         bool GetActive() const { return m_Active; }
         AssetHandle GetMesh() const { return m_StaticMeshHandle; }
         bool GetCastingShadows() const { return m_CastingShadow; }
-        std::vector<AssetHandle>& GetMaterialHandles() { return m_MaterialHandles; }
+        bool GetOccluder() const { return m_Occluder; }
+        const std::vector<AssetHandle>& GetMaterialHandles() const { return m_MaterialHandles ? *m_MaterialHandles : Util::EMPTY_MATERIAL_HANDLES; }
         bool GetDrawDebug() const { return m_DisplayDebugAABB; }
 
         void UpdateOctree()         { m_OctreeNeedsUpdate = true; }
         void UpdateBoundingBox()    { m_BoundingBoxNeedsUpdate = true; }
 
+        /// @brief True once the transform has changed since the scene's
+        /// spatial index last took this component's bounds
+        bool NeedsSpatialUpdate() const { return m_OctreeNeedsUpdate || m_BoundingBoxNeedsUpdate; }
+
         void UpdateTransformedAABB();
         const Bounds_AABB& GetTransformedAABB() const { return m_TransformedAABB; }
 
+        /// @brief Takes bounds computed by the scene's batched spatial update
+        /// and clears both dirty flags
+        void SetTransformedAABB(const Bounds_AABB& transformed_aabb) { m_TransformedAABB = transformed_aabb; m_OctreeNeedsUpdate = false; m_BoundingBoxNeedsUpdate = false; }
+
     private:
 
         AssetHandle m_StaticMeshHandle = NULL_GUID;
-        std::vector<AssetHandle> m_MaterialHandles = {};
+
+        /// @brief Immutable once set, copies of this component (e.g., prefab
+        /// instances) share the same list rather than duplicating it
+        std::shared_ptr<const std::vector<AssetHandle>> m_MaterialHandles = nullptr;
 
         bool m_Active = false;
         bool m_CastingShadow = false;
 
+        /// @brief Drawn into each camera's occlusion buffer to hide the meshes
+        /// behind it. The mesh's local bounds stand in for its geometry, so
+        /// this should only be set on solid, box like meshes such as walls.
+        bool m_Occluder = false;
+
 		Bounds_AABB m_TransformedAABB = {};
         
         bool m_OctreeNeedsUpdate = true;
@@ -116,28 +209,39 @@ namespace BC
         void SetMesh(AssetHandle mesh_handle) { m_SkinnedMeshHandle = mesh_handle; }
         void SetSkeleton(AssetHandle skeleton_handle) { m_SkeletonHandle = skeleton_handle; }
         void SetCastingShadows(bool cast_shadows) { m_CastingShadow = cast_shadows; }
+        void SetMaterialHandles(std::vector<AssetHandle> material_handles) { m_MaterialHandles = std::make_shared<const std::vector<AssetHandle>>(std::move(material_handles)); }
         void SetDrawDebug(bool draw_debug) { m_DisplayDebugAABB = draw_debug; }
 
         bool GetActive() const { return m_Active; }
         AssetHandle GetMesh() const { return m_SkinnedMeshHandle; }
         AssetHandle GetSkeleton() const { return m_SkeletonHandle; }
         bool GetCastingShadows() const { return m_CastingShadow; }
-        std::vector<AssetHandle>& GetMaterialHandles() { return m_MaterialHandles; }
+        const std::vector<AssetHandle>& GetMaterialHandles() const { return m_MaterialHandles ? *m_MaterialHandles : Util::EMPTY_MATERIAL_HANDLES; }
         bool GetDrawDebug() const { return m_DisplayDebugAABB; }
 
         void UpdateOctree()         { m_OctreeNeedsUpdate = true; }
         void UpdateBoundingBox()    { m_BoundingBoxNeedsUpdate = true; }
 
+        /// @brief True once the transform has changed since the scene's
+        /// spatial index last took this component's bounds
+        bool NeedsSpatialUpdate() const { return m_OctreeNeedsUpdate || m_BoundingBoxNeedsUpdate; }
+
         void UpdateTransformedAABB();
         const Bounds_AABB& GetTransformedAABB() const { return m_TransformedAABB; }
 
+        /// @brief Takes bounds computed by the scene's batched spatial update
+        /// and clears both dirty flags
+        void SetTransformedAABB(const Bounds_AABB& transformed_aabb) { m_TransformedAABB = transformed_aabb; m_OctreeNeedsUpdate = false; m_BoundingBoxNeedsUpdate = false; }
+
         std::unordered_map<GUID, GUID>* GetBoneMapping() { return &m_SkeletonBoneMapping; }
         std::vector<glm::mat4>* GetFinalTransformations() { return &m_FinalBoneTransformations; }
 
     private:
 
         AssetHandle m_SkinnedMeshHandle = NULL_GUID;
-        std::vector<AssetHandle> m_MaterialHandles = {};
+
+        /// @brief Shared between copies, see MeshRendererComponent
+        std::shared_ptr<const std::vector<AssetHandle>> m_MaterialHandles = nullptr;
         
 		AssetHandle m_SkeletonHandle = NULL_GUID;
 		std::unordered_map<GUID, GUID> m_SkeletonBoneMapping = {};
@@ -53,14 +53,30 @@ namespace BC
 
         GetComponent<T>().Shutdown();
         
-        // Ensure the Octree Job Does Not Access Component After Removed
+        // Ensure the Spatial Index Job Does Not Access Component After Removed
         if constexpr (std::is_same_v<T, MeshRendererComponent> || std::is_same_v<T, SkinnedMeshRendererComponent>)
         {
-            std::unique_lock<std::mutex> scene_octree_lock(m_Scene->m_Octree->GetOctreeMutex());
+            std::unique_lock<std::shared_mutex> scene_index_lock(m_Scene->m_SpatialIndex->GetMutex());
             m_Scene->m_Registry.remove<T>(m_EntityHandle);
             return;
         }
 
+        // A light stays in the light index while the entity has another light
+        if constexpr (std::is_same_v<T, SphereLightComponent> || std::is_same_v<T, ConeLightComponent>)
+        {
+            std::unique_lock<std::shared_mutex> light_index_lock(m_Scene->m_LightIndex->GetMutex());
+            m_Scene->m_Registry.remove<T>(m_EntityHandle);
+
+            if (auto* sphere_light_component = TryGetComponent<SphereLightComponent>(); sphere_light_component)
+                sphere_light_component->UpdateSpatialBounds();
+            else if (auto* cone_light_component = TryGetComponent<ConeLightComponent>(); cone_light_component)
+                cone_light_component->UpdateSpatialBounds();
+            else if (m_Scene->m_LightIndex->Contains(*this))
+                m_Scene->m_LightIndex->Remove(*this);
+
+            return;
+        }
+
         m_Scene->m_Registry.remove<T>(m_EntityHandle);
 
         return;
@@ -103,32 +119,10 @@ namespace BC
     template<typename T>
     T& Entity::GetComponentInParent() const
     {
-        std::function<T&(Entity)> recursive_parent_search;
-        recursive_parent_search = [&](const Entity& current_entity) -> T&
-        {
-            // If the current entity has the component, return it
-            if (current_entity.HasComponent<T>())
-            {
-                return current_entity.GetComponent<T>();
-            }
-
-            BC_ASSERT(current_entity.HasComponent<MetaComponent>(), std::format("Entity::GetComponentInParent<{}>: Entity Does Not Have MetaData Component - All Entities Must Have This Component.", typeid(T).name()));
-            MetaComponent& meta_component = current_entity.GetComponent<MetaComponent>();
-            const Entity& parent_entity = Application::GetProject()->GetSceneManager()->GetEntity(meta_component.GetParentGUID());
-            if (parent_entity)  // If a parent exists, continue searching
-            {
-                return recursive_parent_search(parent_entity);
-            }
-
-            return GetBlankComponent<T>();
-        };
-
-        BC_ASSERT(HasComponent<MetaComponent>(), std::format("Entity::GetComponentInParent<{}>: Entity Does Not Have MetaData Component - All Entities Must Have This Component.", typeid(T).name()));
-        MetaComponent& meta_component = GetComponent<MetaComponent>();
-        const Entity& parent_entity = Application::GetProject()->GetSceneManager()->GetEntity(meta_component.GetParentGUID());
-        if (parent_entity)  // If a parent exists, continue searching
+        for (Entity ancestor_entity : GetAncestors())
         {
-            return recursive_parent_search(parent_entity);
+            if (T* component = ancestor_entity.TryGetComponent<T>(); component)
+                return *component;
         }
 
         return GetBlankComponent<T>();
@@ -137,44 +131,21 @@ namespace BC
     template<typename T>
     T& Entity::GetComponentInChild() const
     {
-        std::function<T& (Entity)> recursive_child_search;
-        recursive_child_search = [&](const Entity&  current_entity) -> T&
+        // Direct children are checked before descending any further
+        for (Entity child_entity : GetChildren())
         {
-            BC_ASSERT(current_entity.HasComponent<MetaComponent>(), std::format("Entity::GetComponentInChild<{}>: Entity Does Not Have MetaData Component - All Entities Must Have This Component.", typeid(T).name()));
-            const MetaComponent& meta_component = current_entity.GetComponent<MetaComponent>();
-
-            if (meta_component.HasChildren())
-            {
-                const auto& children = meta_component.GetChildrenGUID();
-
-                // 1. Check all direct children for the component
-                for (const auto& child_guid : children)
-                {
-                    Entity child_entity = Application::GetProject()->GetSceneManager()->GetEntity(child_guid);
-                    if (child_entity && child_entity.HasComponent<T>())
-                    {
-                        return child_entity.GetComponent<T>();
-                    }
-                }
-
-                // 2. If not found, recurse into children
-                for (const auto& child_guid : children)
-                {
-                    Entity child_entity = Application::GetProject()->GetSceneManager()->GetEntity(child_guid);
-                    if (!child_entity) continue;  // Ensure entity is valid before recursing
-
-                    T& found_component = recursive_child_search(child_entity);
-                    if (&found_component != &GetBlankComponent<T>())  // Component found in a child
-                    {
-                        return found_component;
-                    }
-                }
-            }
+            if (T* component = child_entity.TryGetComponent<T>(); component)
+                return *component;
+        }
 
-            return GetBlankComponent<T>();
-        };
+        for (Entity child_entity : GetChildren())
+        {
+            T& found_component = child_entity.GetComponentInChild<T>();
+            if (&found_component != &GetBlankComponent<T>())
+                return found_component;
+        }
 
-        return recursive_child_search(*this);
+        return GetBlankComponent<T>();
     }
         
     template<typename T>
@@ -182,29 +153,10 @@ namespace BC
     {
 		std::vector<Entity> entities_with_component;
 
-		std::function<void(Entity)> recursive_parent_search;
-		recursive_parent_search = [&](const Entity& current_entity)
-		{
-			if (current_entity.HasComponent<T>())
-			{
-				entities_with_component.push_back(current_entity);
-			}
-
-			BC_ASSERT(current_entity.HasComponent<MetaComponent>(), std::format("Entity::GetComponentsInParents<{}>: Entity Does Not Have MetaData Component - All Entities Must Have This Component.", typeid(T).name()));
-			MetaComponent& meta_component = current_entity.GetComponent<MetaComponent>();
-        	const Entity& parent_entity = Application::GetProject()->GetSceneManager()->GetEntity(meta_component.GetParentGUID());
-			if (parent_entity)
-			{
-				recursive_parent_search(parent_entity);
-			}
-		};
-
-		BC_ASSERT(HasComponent<MetaComponent>(), std::format("Entity::GetComponentsInParents<{}>: Entity Does Not Have MetaData Component - All Entities Must Have This Component.", typeid(T).name()));
-		MetaComponent& meta_component = GetComponent<MetaComponent>();
-		const Entity& parent_entity = Application::GetProject()->GetSceneManager()->GetEntity(meta_component.GetParentGUID());
-		if (parent_entity)
+		for (Entity ancestor_entity : GetAncestors())
 		{
-			recursive_parent_search(parent_entity);
+			if (ancestor_entity.HasComponent<T>())
+				entities_with_component.push_back(ancestor_entity);
 		}
 
 		return entities_with_component;
@@ -214,40 +166,17 @@ namespace BC
     std::vector<Entity> Entity::GetComponentsInChildren() const
     {
 		std::vector<Entity> entities_with_component;
-		std::function<void(Entity)> recursive_child_search;
 
-		recursive_child_search = [&](Entity current_entity)
+		auto& storage = m_Scene->m_Registry.storage<T>();
+		if (storage.empty())
+			return entities_with_component;
+
+		for (Entity descendant_entity : GetDescendants())
 		{
-			BC_ASSERT(HasComponent<MetaComponent>(), std::format("Entity::GetComponentsInChildren<{}>: Entity Does Not Have MetaData Component - All Entities Must Have This Component.", typeid(T).name()));
-			const MetaComponent& meta_component = current_entity.GetComponent<MetaComponent>();
-
-			if (meta_component.HasChildren())
-			{
-				const auto& children = meta_component.GetChildrenGUID();
-
-				// 1. Check all direct children for the component
-				for (const auto& child_guid : children)
-				{
-					Entity child_entity = Application::GetProject()->GetSceneManager()->GetEntity(child_guid);
-					if (child_entity && child_entity.HasComponent<T>())
-					{
-						entities_with_component.push_back(child_entity);
-					}
-				}
-
-				// 2. Recurse into children
-				for (const auto& child_guid : children)
-				{
-					Entity child_entity = Application::GetProject()->GetSceneManager()->GetEntity(child_guid);
-					if (child_entity)
-					{
-						recursive_child_search(child_entity);
-					}
-				}
-			}
-		};
-
-		recursive_child_search(*this);
+			if (storage.contains(descendant_entity))
+				entities_with_component.push_back(descendant_entity);
+		}
+
 		return entities_with_component;
     }
     
@@ -17,6 +17,7 @@
 #include <memory>
 #include <typeindex>
 #include <unordered_map>
+#include <iterator>
 
 // External Vendor Library Headers
 #include <entt/entt.hpp>
@@ -24,6 +25,42 @@
 namespace BC
 {
 
+    enum class HierarchyWalk : uint8_t
+    {
+        Children,
+        Ancestors,
+
+        /// @brief Depth first, pre-order, excluding the entity itself
+        Descendants
+    };
+
+    template<HierarchyWalk Walk>
+    class HierarchyIterator;
+
+    template<typename Iterator>
+    class HierarchyRange
+    {
+
+    public:
+
+        HierarchyRange(Iterator begin, Iterator end) : m_Begin(begin), m_End(end) { }
+
+        Iterator begin() const { return m_Begin; }
+        Iterator end() const { return m_End; }
+
+        bool empty() const { return m_Begin == m_End; }
+
+    private:
+
+        Iterator m_Begin;
+        Iterator m_End;
+
+    };
+
+    using EntityChildRange      = HierarchyRange<HierarchyIterator<HierarchyWalk::Children>>;
+    using EntityAncestorRange   = HierarchyRange<HierarchyIterator<HierarchyWalk::Ancestors>>;
+    using EntityDescendantRange = HierarchyRange<HierarchyIterator<HierarchyWalk::Descendants>>;
+
     class Entity
     {
     
@@ -87,6 +124,21 @@ namespace BC
 
 #pragma endregion
 
+#pragma region Hierarchy
+
+		/// @brief Direct children in sibling order
+		EntityChildRange GetChildren() const;
+
+		/// @brief Parent first, up to the root of the scene
+		EntityAncestorRange GetAncestors() const;
+
+		/// @brief Every entity below this one, depth first
+		EntityDescendantRange GetDescendants() const;
+
+		Entity GetParent() const;
+
+#pragma endregion
+
 #pragma region Validation
 
 		template <typename T>
@@ -124,6 +176,121 @@ namespace BC
     
 }
 
+namespace BC
+{
+
+    /// @brief Follows the RelationshipComponent links of a single registry,
+    /// each step is a direct storage access rather than a GUID lookup
+    template<HierarchyWalk Walk>
+    class HierarchyIterator
+    {
+
+    public:
+
+        using RelationshipStorage = entt::storage_for_t<RelationshipComponent>;
+
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = Entity;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = Entity;
+
+        HierarchyIterator() = default;
+        HierarchyIterator(const RelationshipStorage* storage, Scene* scene, entt::entity current, entt::entity root = entt::null) :
+            m_Storage(storage), m_Scene(scene), m_Current(current), m_Root(root) { }
+
+        Entity operator*() const { return Entity{ m_Current, m_Scene }; }
+
+        entt::entity GetEntityHandle() const { return m_Current; }
+
+        HierarchyIterator& operator++()
+        {
+            const RelationshipComponent& relationship = m_Storage->get(m_Current);
+
+            if constexpr (Walk == HierarchyWalk::Children)
+            {
+                m_Current = relationship.NextSibling;
+            }
+            else if constexpr (Walk == HierarchyWalk::Ancestors)
+            {
+                m_Current = relationship.Parent;
+            }
+            else
+            {
+                if (relationship.FirstChild != entt::null)
+                {
+                    m_Current = relationship.FirstChild;
+                    return *this;
+                }
+
+                // Climb until a sibling is found, stopping at the root
+                entt::entity current = m_Current;
+                while (current != m_Root && current != entt::null)
+                {
+                    const RelationshipComponent& current_relationship = m_Storage->get(current);
+                    if (current_relationship.NextSibling != entt::null)
+                    {
+                        m_Current = current_relationship.NextSibling;
+                        return *this;
+                    }
+                    current = current_relationship.Parent;
+                }
+
+                m_Current = entt::null;
+            }
+
+            return *this;
+        }
+
+        HierarchyIterator operator++(int)
+        {
+            HierarchyIterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        bool operator==(const HierarchyIterator& other) const { return m_Current == other.m_Current; }
+        bool operator!=(const HierarchyIterator& other) const { return m_Current != other.m_Current; }
+
+    private:
+
+        const RelationshipStorage* m_Storage = nullptr;
+        Scene* m_Scene = nullptr;
+
+        entt::entity m_Current = entt::null;
+        entt::entity m_Root = entt::null;
+
+    };
+
+    inline EntityChildRange Entity::GetChildren() const
+    {
+        const auto& storage = m_Scene->m_Registry.storage<RelationshipComponent>();
+        entt::entity first_child = storage.contains(m_EntityHandle) ? storage.get(m_EntityHandle).FirstChild : entt::null;
+        return { { &storage, m_Scene, first_child }, {} };
+    }
+
+    inline EntityAncestorRange Entity::GetAncestors() const
+    {
+        const auto& storage = m_Scene->m_Registry.storage<RelationshipComponent>();
+        entt::entity parent = storage.contains(m_EntityHandle) ? storage.get(m_EntityHandle).Parent : entt::null;
+        return { { &storage, m_Scene, parent }, {} };
+    }
+
+    inline EntityDescendantRange Entity::GetDescendants() const
+    {
+        const auto& storage = m_Scene->m_Registry.storage<RelationshipComponent>();
+        entt::entity first_child = storage.contains(m_EntityHandle) ? storage.get(m_EntityHandle).FirstChild : entt::null;
+        return { { &storage, m_Scene, first_child, m_EntityHandle }, {} };
+    }
+
+    inline Entity Entity::GetParent() const
+    {
+        const auto* relationship = m_Scene->m_Registry.try_get<RelationshipComponent>(m_EntityHandle);
+        return relationship && relationship->Parent != entt::null ? Entity{ relationship->Parent, m_Scene } : Entity{};
+    }
+
+}
+
 namespace std
 {
 	template<>
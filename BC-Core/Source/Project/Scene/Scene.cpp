@@ -4,6 +4,9 @@
 #include "Scene.h"
 #include "Entity.h"
 
+#include "Asset/AssetManagerAPI.h"
+#include "Asset/Assets/Prefab.h"
+
 #include "Util/Hash.h"
 #include "Util/FileUtil.h"
 
@@ -19,7 +22,8 @@ namespace BC
 
     Scene::Scene() :
         m_SceneID(GUID()),
-        m_Octree(std::make_shared<OctreeBounds<Entity>>())
+        m_SpatialIndex(std::make_shared<OctreeBounds<Entity>>()),
+        m_LightIndex(std::make_shared<OctreeBounds<Entity>>())
     {
     }
 
@@ -27,7 +31,8 @@ namespace BC
         m_SceneID(Util::HashStringInsensitive(Util::NormaliseFilePathToString(scene_file_path))),
         m_SceneName(scene_file_path.stem().string()),
         m_SceneFilePath(scene_file_path),
-        m_Octree(std::make_shared<OctreeBounds<Entity>>())
+        m_SpatialIndex(std::make_shared<OctreeBounds<Entity>>()),
+        m_LightIndex(std::make_shared<OctreeBounds<Entity>>())
     {
     }
 
@@ -74,7 +79,7 @@ namespace BC
     Entity Scene::CreateEntity(GUID entity_guid, const std::string &name, GUID parent_guid)
     {
         // Obtain lock
-		std::unique_lock<std::mutex> scene_octree_lock(m_Octree->GetOctreeMutex());
+		std::unique_lock<std::shared_mutex> scene_index_lock(m_SpatialIndex->GetMutex());
 
 		while (m_EntityMap.find(entity_guid) != m_EntityMap.end()) 
 		{
@@ -86,7 +91,10 @@ namespace BC
         // 1. Transform Component
 		entity.AddComponent<TransformComponent>();
 
-        // 2. Meta Component
+        // 2. Relationship Component
+        m_Registry.emplace<RelationshipComponent>(entity);
+
+        // 3. Meta Component
         auto& meta_component = entity.AddComponent<MetaComponent>();
         meta_component.SetEntityGUID(entity_guid);
 
@@ -95,6 +103,7 @@ namespace BC
         meta_component.SetUniqueName(name);
 
 		m_EntityMap.emplace(entity_guid, entity);
+        m_EntityNameMap.try_emplace(meta_component.GetName(), entity);
 
         MarkHierarchyDirty();
 
@@ -117,6 +126,14 @@ namespace BC
 
     Entity Scene::GetEntity(const std::string &entity_name) const
     {
+        // Fast path, the index may be stale if the entity has since been
+        // renamed so confirm against the MetaComponent before trusting it
+        if (auto it = m_EntityNameMap.find(entity_name); it != m_EntityNameMap.end())
+        {
+            if (m_Registry.valid(it->second) && m_Registry.get<MetaComponent>(it->second).GetName() == entity_name)
+                return Entity { it->second, const_cast<Scene*>(this) };
+        }
+
         auto view = m_Registry.view<MetaComponent>();
         for (auto entity_handle : view) 
         {
@@ -137,7 +154,7 @@ namespace BC
         return m_Registry.valid(static_cast<entt::entity>(entity));
     }
 
-    static void DestroyEntityHelper(const Entity& entity, std::unordered_map<GUID, entt::entity>& entity_map)
+    static void DestroyEntityHelper(const Entity& entity, std::unordered_map<GUID, entt::entity>& entity_map, std::unordered_map<std::string, entt::entity>& entity_name_map)
     {
         Scene* scene = entity.GetScene();
         entt::registry* registry = entity.GetScene()->GetRegistry();
@@ -159,13 +176,17 @@ namespace BC
 
         // Make a copy of the child list so we don't invalidate 
         // the iterator whilst destroying children
-        std::vector<GUID> children = component.GetChildrenGUID();
-        for (const auto& child_guid : children)
-            DestroyEntityHelper(entity.GetScene()->GetEntity(child_guid), entity_map);
+        auto children = entity.GetChildren();
+        std::vector<Entity> child_entities(children.begin(), children.end());
+        for (const auto& child_entity : child_entities)
+            DestroyEntityHelper(child_entity, entity_map, entity_name_map);
 		
         // Destroy this entity
 		entity_map.erase(entity.GetGUID());
 
+        if (auto it = entity_name_map.find(component.GetName()); it != entity_name_map.end() && it->second == static_cast<entt::entity>(entity))
+            entity_name_map.erase(it);
+
 		// 6. Destroy the Entity and Components from the ENTT Registry
 		registry->destroy(entity);
 
@@ -181,9 +202,30 @@ namespace BC
     void Scene::DestroyEntity(const Entity &entity)
     {
         // Obtain lock
-		std::unique_lock<std::mutex> scene_octree_lock(m_Octree->GetOctreeMutex());
+		std::unique_lock<std::shared_mutex> scene_index_lock(m_SpatialIndex->GetMutex());
+
+        // Live instances of pooled prefabs are parked rather than destroyed
+        if (!m_PrefabPools.empty() && entity && m_Registry.valid(static_cast<entt::entity>(entity)))
+        {
+            if (auto pool_it = m_PrefabPools.find(entity.GetComponent<MetaComponent>().GetPrefabHandle()); pool_it != m_PrefabPools.end())
+            {
+                auto& pool = pool_it->second;
+                if (auto live_it = pool.LiveInstances.find(static_cast<entt::entity>(entity)); live_it != pool.LiveInstances.end())
+                {
+                    std::vector<entt::entity> instance_handles = std::move(live_it->second);
+                    pool.LiveInstances.erase(live_it);
+
+                    if (ParkPrefabInstance(*pool.Source, instance_handles))
+                    {
+                        pool.ParkedInstances.push_back(std::move(instance_handles));
+                        MarkHierarchyDirty();
+                        return;
+                    }
+                }
+            }
+        }
 
-        DestroyEntityHelper(entity, m_EntityMap);
+        DestroyEntityHelper(entity, m_EntityMap, m_EntityNameMap);
 
         MarkHierarchyDirty();
     }
@@ -279,20 +321,32 @@ namespace BC
 
         if (out_path.extension() != ".scene")
             out_path.replace_extension(".scene");
-        
+
+        std::vector<entt::entity> entity_handles;
+        {
+            auto view = m_Registry.view<entt::entity>();
+            for (auto it = view.rbegin(); it != view.rend(); ++it)
+                entity_handles.push_back(*it);
+        }
+
+        SerialiseEntities(out_path, m_SceneID, m_SceneName, entity_handles, true);
+    }
+
+    void Scene::SerialiseEntities(const std::filesystem::path& out_path, GUID scene_id, const std::string& scene_name, std::span<const entt::entity> entity_handles, bool write_spatial_layout)
+    {
         YAML::Emitter out;
         out << YAML::BeginMap;
         {
-		    out << YAML::Key << "Scene ID" << YAML::Value << static_cast<uint64_t>(m_SceneID);
-		    out << YAML::Key << "Scene Name" << YAML::Value << m_SceneName;
+		    out << YAML::Key << "Scene ID" << YAML::Value << static_cast<uint64_t>(scene_id);
+		    out << YAML::Key << "Scene Name" << YAML::Value << scene_name;
+		    out << YAML::Key << "Spatial Index" << YAML::Value << Util::SpatialIndexTypeToString(m_SpatialIndexType);
 
 		    out << YAML::Key << "Entities" << YAML::Value;
             out << YAML::BeginSeq;
             {
-                auto view = m_Registry.view<entt::entity>();
-                for (auto it = view.rbegin(); it != view.rend(); ++it)
+                for (entt::entity entity_handle : entity_handles)
                 {
-                    Entity entity = { *it, this };
+                    Entity entity = { entity_handle, this };
                     if (!entity)
                         continue;
 
@@ -301,21 +355,173 @@ namespace BC
             }
             out << YAML::EndSeq;
 
+            if (write_spatial_layout && m_SpatialIndex)
+            {
+                std::vector<uint8_t> spatial_layout;
+                m_SpatialIndex->WriteLayout(spatial_layout, [](const Entity& entity) { return static_cast<uint64_t>(entity.GetGUID()); });
+
+                out << YAML::Key << "Spatial Index Hash" << YAML::Value << Util::HashBytes(spatial_layout.data(), spatial_layout.size());
+                out << YAML::Key << "Spatial Index Layout" << YAML::Value << YAML::Binary(spatial_layout.data(), spatial_layout.size());
+            }
         }
         out << YAML::EndMap;
 
         std::filesystem::create_directories(out_path.parent_path());
 
 		std::ofstream fout(out_path);
-        BC_ASSERT(fout.is_open(), "Scene::Serialise: Could Not Open File.");
+        BC_ASSERT(fout.is_open(), "Scene::SerialiseEntities: Could Not Open File.");
 		fout << out.c_str();
     }
 
+    namespace Util
+    {
+        /// @brief Plain component data decoded from a contiguous range of
+        /// entity nodes. Each decode job owns one chunk exclusively, so no
+        /// synchronisation is required until the chunks are committed.
+        template<typename Group>
+        struct DecodedEntityChunk;
+
+        template<typename... Component>
+        struct DecodedEntityChunk<ComponentGroup<Component...>>
+        {
+            /// @brief Entity GUID and "Entity Name" of each entity in this chunk
+            std::vector<std::pair<GUID, std::string>> Entities;
+
+            /// @brief One array per component type, each element holds the
+            /// chunk local entity index and the decoded component
+            std::tuple<std::vector<std::pair<uint32_t, Component>>...> Components;
+        };
+
+        using SceneEntityChunk = DecodedEntityChunk<AllComponents>;
+
+        /// @brief The minimum amount of entities given to a decode job, below
+        /// this the job overhead outweighs the work
+        constexpr size_t MIN_ENTITIES_PER_DECODE_JOB = 64;
+
+        template<typename... Component>
+        static std::array<std::string, sizeof...(Component)> GetComponentKeys(ComponentGroup<Component...>)
+        {
+            // Entity::GetBlankComponent is not thread safe, so resolve the keys
+            // up front on the calling thread
+            return { Util::ComponentTypeToString(Entity::GetBlankComponent<Component>().GetType())... };
+        }
+
+        template<typename... Component, size_t... Index>
+        static void DecodeComponents(const YAML::Node& data, const std::array<std::string, sizeof...(Component)>& keys, uint32_t local_index, DecodedEntityChunk<ComponentGroup<Component...>>& chunk, std::index_sequence<Index...>)
+        {
+            ([&]()
+                {
+                    auto component_data = data[keys[Index].c_str()];
+                    if (!component_data)
+                        return;
+
+                    auto& [entity_index, component] = std::get<Index>(chunk.Components).emplace_back
+                    (
+                        std::piecewise_construct, 
+                        std::forward_as_tuple(local_index), 
+                        std::forward_as_tuple()
+                    );
+
+                    if (!component.SceneDeserialise(component_data))
+                        BC_CORE_WARN("Util::DecodeComponents: Deserialisation of {} not complete.", keys[Index]);
+                }(), ...);
+        }
+
+        template<typename... Component>
+        static void DecodeEntityRange(const std::vector<YAML::Node>& entity_nodes, size_t begin, size_t end, const std::array<std::string, sizeof...(Component)>& keys, DecodedEntityChunk<ComponentGroup<Component...>>& chunk)
+        {
+            chunk.Entities.reserve(end - begin);
+
+            for (size_t i = begin; i < end; ++i)
+            {
+                const YAML::Node& entity_data = entity_nodes[i];
+
+                uint32_t local_index = static_cast<uint32_t>(chunk.Entities.size());
+                chunk.Entities.emplace_back
+                (
+                    entity_data["Entity ID"].as<uint64_t>(), 
+                    entity_data["Entity Name"] ? entity_data["Entity Name"].as<std::string>() : std::string{}
+                );
+
+                DecodeComponents(entity_data, keys, local_index, chunk, std::index_sequence_for<Component...>{});
+            }
+        }
+
+        template<typename... Component>
+        static void CommitComponents(ComponentGroup<Component...>, entt::registry& registry, Scene* scene, std::vector<SceneEntityChunk>& chunks, const std::vector<size_t>& chunk_offsets, const std::vector<entt::entity>& handles)
+        {
+            // Fill each storage in turn so that every pool is only grown once
+            ([&]()
+                {
+                    size_t component_count = 0;
+                    for (const auto& chunk : chunks)
+                        component_count += std::get<std::vector<std::pair<uint32_t, Component>>>(chunk.Components).size();
+
+                    auto& storage = registry.storage<Component>();
+                    storage.reserve(storage.size() + component_count);
+
+                    for (size_t chunk_index = 0; chunk_index < chunks.size(); ++chunk_index)
+                    {
+                        for (auto& [local_index, decoded_component] : std::get<std::vector<std::pair<uint32_t, Component>>>(chunks[chunk_index].Components))
+                        {
+                            entt::entity entity_handle = handles[chunk_offsets[chunk_index] + local_index];
+
+                            auto& component = registry.emplace<Component>(entity_handle, std::move(decoded_component));
+                            component.SetEntity(Entity{ entity_handle, scene });
+                        }
+                    }
+
+                    // Every entity must carry a Transform and Meta component
+                    // even if the file omitted them
+                    if constexpr (std::is_same_v<Component, TransformComponent> || std::is_same_v<Component, MetaComponent>)
+                    {
+                        for (entt::entity entity_handle : handles)
+                        {
+                            if (registry.all_of<Component>(entity_handle))
+                                continue;
+
+                            auto& component = registry.emplace<Component>(entity_handle);
+                            component.SetEntity(Entity{ entity_handle, scene });
+                        }
+                    }
+                }(), ...);
+        }
+
+        template<typename... Component>
+        static void InitComponents(ComponentGroup<Component...>, entt::registry& registry, std::span<const entt::entity> handles)
+        {
+            // Deferred until every storage is filled, so Init() can safely
+            // query other components and the GUID of its entity
+            ([&]()
+                {
+                    auto& storage = registry.storage<Component>();
+                    for (entt::entity entity_handle : handles)
+                    {
+                        if (storage.contains(entity_handle))
+                            storage.get(entity_handle).Init();
+                    }
+                }(), ...);
+        }
+    }
+
     void Scene::Deserialise(const std::filesystem::path& scene_file_path)
     {
-        if (scene_file_path.extension() != ".scene" || !std::filesystem::exists(scene_file_path))
+        BC_PROFILE_SCOPE("Scene::Deserialise");
+
+        if (!DeserialiseEntities(scene_file_path))
             return;
 
+        IntegrateEntities({});
+        FinaliseLoad();
+    }
+
+    bool Scene::DeserialiseEntities(const std::filesystem::path& scene_file_path, bool parallel_decode)
+    {
+        BC_PROFILE_SCOPE("Scene::DeserialiseEntities");
+
+        if (scene_file_path.extension() != ".scene" || !std::filesystem::exists(scene_file_path))
+            return false;
+
         YAML::Node data = YAML::LoadFile(scene_file_path.string());
 
         if (data["Scene ID"])
@@ -324,244 +530,1239 @@ namespace BC
         if (data["Scene Name"])
             m_SceneName = data["Scene Name"].as<std::string>();
 
-        if (!data["Entities"])
-            return;
+        if (data["Spatial Index"])
+            m_SpatialIndexType = Util::SpatialIndexTypeFromString(data["Spatial Index"].as<std::string>());
 
-        for (const auto& entity_data : data["Entities"])
+        m_PendingSpatialLayout.clear();
+        if (data["Spatial Index Layout"] && data["Spatial Index Hash"])
         {
-            GUID entity_guid = entity_data["Entity ID"].as<uint64_t>();
-            std::string entity_name = entity_data["Entity Name"].as<std::string>();
+            YAML::Binary spatial_layout = data["Spatial Index Layout"].as<YAML::Binary>();
+            if (Util::HashBytes(spatial_layout.data(), spatial_layout.size()) == data["Spatial Index Hash"].as<uint64_t>())
+                m_PendingSpatialLayout.assign(spatial_layout.data(), spatial_layout.data() + spatial_layout.size());
+            else
+                BC_CORE_WARN("Scene::DeserialiseEntities: Spatial Index Layout Does Not Match Its Hash - The Spatial Index Will Be Rebuilt.");
+        }
 
-            Entity entity = CreateEntity(entity_guid, entity_name);
+        if (!data["Entities"])
+            return true;
 
-            Util::DeserialiseEntity(entity_data, entity);
+        // 1. Flatten the entity sequence so decode jobs can random access
+        //    their range without walking the YAML sequence themselves
+        std::vector<YAML::Node> entity_nodes;
+        {
+            const YAML::Node& entities = data["Entities"];
+            entity_nodes.reserve(entities.size());
+            for (const auto& entity_data : entities)
+                entity_nodes.push_back(entity_data);
         }
 
-        auto transform_update = GetAllEntitiesWith<TransformComponent>();
-        for (const auto& entity_handle : transform_update)
+        if (entity_nodes.empty())
+            return true;
+
+        // 2. Parallel decode phase. Each job decodes a contiguous range of
+        //    entity nodes into plain component data that it owns exclusively,
+        //    the registry is not touched until the commit phase below
+        const auto component_keys = Util::GetComponentKeys(Util::AllComponents{});
+
+        // Waiting on nested jobs from a worker would hold that worker, and
+        // several streamed scenes doing so at once could hold every worker
+        JobSystem* job_system = parallel_decode ? Application::GetJobSystem() : nullptr;
+        
+        size_t max_chunks = job_system ? static_cast<size_t>(job_system->GetWorkerCount()) + 1 : 1;
+        size_t chunk_count = std::clamp<size_t>(entity_nodes.size() / Util::MIN_ENTITIES_PER_DECODE_JOB, 1, std::max<size_t>(max_chunks, 1));
+        size_t chunk_size = (entity_nodes.size() + chunk_count - 1) / chunk_count;
+        
+        std::vector<Util::SceneEntityChunk> chunks(chunk_count);
         {
-            transform_update.get<TransformComponent>(entity_handle).SetPosition(transform_update.get<TransformComponent>(entity_handle).GetLocalPosition());
+            BC_PROFILE_SCOPE("Scene::DeserialiseEntities: Decode Entities");
+
+            auto decode_chunk = [&](size_t chunk_index)
+            {
+                size_t begin = chunk_index * chunk_size;
+                size_t end = std::min(begin + chunk_size, entity_nodes.size());
+                if (begin < end)
+                    Util::DecodeEntityRange(entity_nodes, begin, end, component_keys, chunks[chunk_index]);
+            };
+
+            JobCounter decode_counter = {};
+            if (job_system && chunk_count > 1)
+            {
+                std::vector<std::pair<std::string, JobFunction>> decode_jobs;
+                decode_jobs.reserve(chunk_count - 1);
+                for (size_t chunk_index = 1; chunk_index < chunk_count; ++chunk_index)
+                    decode_jobs.emplace_back("Scene Deserialise: Decode Entities", [&decode_chunk, chunk_index]() { decode_chunk(chunk_index); });
+
+                // Persistent as streamed loads decode across frame boundaries
+                job_system->SubmitJobs(decode_jobs, &decode_counter, JobPriority::Medium, true);
+            }
+
+            // The calling thread decodes the first chunk itself
+            decode_chunk(0);
+
+            decode_counter.Wait();
         }
 
-		// Generate Octree for Scene
-		{
-			OctreeBoundsConfig octree_config = {};
+        // 3. Single threaded commit phase. Create every entity in one bulk
+        //    call, fill each storage in turn, then build the indices
+        {
+            BC_PROFILE_SCOPE("Scene::DeserialiseEntities: Commit Entities");
 
-			std::vector<OctreeBounds<Entity>::OctreeData> data_sources;
+            std::unique_lock<std::shared_mutex> scene_index_lock(m_SpatialIndex->GetMutex());
 
-			auto static_mesh_view = GetAllEntitiesWith<MeshRendererComponent>();
-			for (const auto& entity_handle : static_mesh_view) 
+            std::vector<size_t> chunk_offsets(chunk_count, 0);
+            size_t entity_count = 0;
+            for (size_t chunk_index = 0; chunk_index < chunk_count; ++chunk_index)
             {
-				auto& mesh_component = static_mesh_view.get<MeshRendererComponent>(entity_handle);
+                chunk_offsets[chunk_index] = entity_count;
+                entity_count += chunks[chunk_index].Entities.size();
+            }
+
+            std::vector<entt::entity> handles(entity_count);
+            m_Registry.create(handles.begin(), handles.end());
 
-				// Ensure the AABB is up to date
-				mesh_component.UpdateTransformedAABB();
+            Util::CommitComponents(Util::AllComponents{}, m_Registry, this, chunks, chunk_offsets, handles);
 
-				const auto& aabb = mesh_component.GetTransformedAABB();
+            m_EntityMap.reserve(m_EntityMap.size() + entity_count);
+            m_EntityNameMap.reserve(m_EntityNameMap.size() + entity_count);
 
-				if (!mesh_component.GetEntity()) 
+            for (size_t chunk_index = 0; chunk_index < chunk_count; ++chunk_index)
+            {
+                for (size_t local_index = 0; local_index < chunks[chunk_index].Entities.size(); ++local_index)
                 {
-					BC_CORE_ERROR("Scene::Deserialise: Cannot Insert Entity to Octree - Current Entity Is Invalid.");
-					continue;
-				}
+                    auto& [entity_guid, entity_name] = chunks[chunk_index].Entities[local_index];
+                    entt::entity entity_handle = handles[chunk_offsets[chunk_index] + local_index];
+
+                    while (m_EntityMap.find(entity_guid) != m_EntityMap.end()) 
+                    {
+                        BC_CORE_WARN("Scene::DeserialiseEntities: Duplicate Entity GUID {} - Assigning New GUID.", static_cast<uint64_t>(entity_guid));
+                        entity_guid = GUID();
+                    }
+
+                    auto& meta_component = m_Registry.get<MetaComponent>(entity_handle);
+                    meta_component.SetEntityGUID(entity_guid);
+                    
+                    if (meta_component.GetName().empty())
+                        meta_component.SetName(entity_name.empty() ? "Untitled Entity" : entity_name);
+
+                    m_EntityMap.emplace(entity_guid, entity_handle);
+                    m_EntityNameMap.try_emplace(meta_component.GetName(), entity_handle);
+                }
+            }
 
-				data_sources.push_back(std::make_shared<OctreeDataSource<Entity>>(mesh_component.GetEntity(), aabb));
-			}
+            // Link the hierarchy now every GUID can be resolved. Children are
+            // linked in the order they were saved, anything whose parent did
+            // not list it is appended afterwards
+            m_Registry.insert<RelationshipComponent>(handles.begin(), handles.end());
 
-			auto skinned_mesh_view = GetAllEntitiesWith<SkinnedMeshRendererComponent>();
-			for (const auto& entity_handle : skinned_mesh_view) 
+            auto& relationship_storage = m_Registry.storage<RelationshipComponent>();
+            auto try_link = [&](entt::entity child_handle, entt::entity parent_handle)
             {
-				auto& mesh_component = skinned_mesh_view.get<SkinnedMeshRendererComponent>(entity_handle);
+                if (child_handle == parent_handle || relationship_storage.get(child_handle).Parent != entt::null)
+                    return;
 
-				// Ensure the AABB is up to date
-				mesh_component.UpdateTransformedAABB();
+                if (m_Registry.get<MetaComponent>(child_handle).GetParentGUID() != m_Registry.get<MetaComponent>(parent_handle).GetEntityGUID())
+                    return;
 
-				const auto& aabb = mesh_component.GetTransformedAABB();
+                Util::LinkRelationship(m_Registry, child_handle, parent_handle);
+            };
 
-				if (!mesh_component.GetEntity()) 
+            for (entt::entity entity_handle : handles)
+            {
+                auto& meta_component = m_Registry.get<MetaComponent>(entity_handle);
+                for (GUID child_guid : meta_component.m_Children)
                 {
-					BC_CORE_ERROR("Scene::Deserialise: Cannot Insert Entity to Octree - Current Entity Is Invalid.");
-					continue;
-				}
+                    if (auto child_it = m_EntityMap.find(child_guid); child_it != m_EntityMap.end())
+                        try_link(child_it->second, entity_handle);
+                }
 
-				data_sources.push_back(std::make_shared<OctreeDataSource<Entity>>(mesh_component.GetEntity(), aabb));
-			}
+                meta_component.m_Children.clear();
+                meta_component.m_Children.shrink_to_fit();
+            }
 
-			octree_config.Looseness = 1.25f;
-			octree_config.PreferredDataSourceLimit = 8;
+            for (entt::entity entity_handle : handles)
+            {
+                GUID parent_guid = m_Registry.get<MetaComponent>(entity_handle).GetParentGUID();
+                if (parent_guid == NULL_GUID)
+                    continue;
 
-			// Create the octree and insert data sources
-			m_Octree = std::make_shared<OctreeBounds<Entity>>(octree_config, data_sources);
-		}
-        
-        MarkHierarchyDirty();
+                if (auto parent_it = m_EntityMap.find(parent_guid); parent_it != m_EntityMap.end())
+                    try_link(entity_handle, parent_it->second);
+            }
+
+            // A parent outside this scene can not be linked, see
+            // MetaComponent::AttachParent, so such entities load at the root
+            size_t unresolved_parent_count = 0;
+            for (entt::entity entity_handle : handles)
+            {
+                if (relationship_storage.get(entity_handle).Parent != entt::null)
+                    continue;
+
+                auto& meta_component = m_Registry.get<MetaComponent>(entity_handle);
+                if (meta_component.m_Parent != NULL_GUID)
+                {
+                    meta_component.m_Parent = NULL_GUID;
+                    ++unresolved_parent_count;
+                }
+
+                Util::RefreshRelationshipDepth(m_Registry, entity_handle);
+            }
+
+            if (unresolved_parent_count > 0)
+                BC_CORE_WARN("Scene::DeserialiseEntities: {0} Entities Have a Parent Outside This Scene and Were Moved to the Root.", unresolved_parent_count);
+
+            // Component initialisation is left to IntegrateEntities so that
+            // streamed scenes can spread it across frames on the main thread
+            m_PendingIntegration.insert(m_PendingIntegration.end(), handles.begin(), handles.end());
+        }
+
+        return true;
     }
 
-#pragma endregion
+    size_t Scene::IntegrateEntities(const SceneStreamingBudget& budget)
+    {
+        BC_PROFILE_SCOPE("Scene::IntegrateEntities");
 
-#pragma region Static
+        constexpr size_t slice_size = 32;
 
-    std::shared_ptr<Scene> Scene::CreateDefaultScene(const std::filesystem::path &scene_file_path)
+        auto start_time = std::chrono::high_resolution_clock::now();
+        size_t integrated_count = 0;
+
+        while (m_PendingIntegrationIndex < m_PendingIntegration.size())
+        {
+            size_t count = std::min(slice_size, m_PendingIntegration.size() - m_PendingIntegrationIndex);
+            if (budget.MaxEntitiesPerFrame != 0)
+                count = std::min<size_t>(count, budget.MaxEntitiesPerFrame - integrated_count);
+
+            Util::InitComponents(Util::AllComponents{}, m_Registry, std::span<const entt::entity>(m_PendingIntegration.data() + m_PendingIntegrationIndex, count));
+
+            m_PendingIntegrationIndex += count;
+            integrated_count += count;
+
+            if (budget.IsExhausted(integrated_count, start_time))
+                break;
+        }
+
+        size_t remaining = m_PendingIntegration.size() - m_PendingIntegrationIndex;
+        if (remaining == 0)
+        {
+            m_PendingIntegration.clear();
+            m_PendingIntegration.shrink_to_fit();
+            m_PendingIntegrationIndex = 0;
+        }
+
+        return remaining;
+    }
+
+    void Scene::FinaliseLoad()
     {
-        std::shared_ptr<Scene> default_scene = std::make_shared<Scene>(scene_file_path);
+        BC_PROFILE_SCOPE("Scene::FinaliseLoad");
 
-        Entity camera_entity    = default_scene->CreateEntity("Main Camera");
-        Entity light_entity     = default_scene->CreateEntity("Directional Light");
-        Entity cube_entity      = default_scene->CreateEntity("Cube");
+        auto transform_update = GetAllEntitiesWith<TransformComponent>();
+        for (const auto& entity_handle : transform_update)
+        {
+            transform_update.get<TransformComponent>(entity_handle).SetPosition(transform_update.get<TransformComponent>(entity_handle).GetLocalPosition());
+        }
 
-        camera_entity.AddComponent<CameraComponent>();
-        camera_entity.GetTransform().SetPosition({ 0.0f, 5.0f, 10.0f });
-        camera_entity.GetTransform().LookAt({ 0.0f, 0.0f, 0.0f });
+		// Restore the Spatial Index Saved With the Scene, or Generate It
+        if (m_PendingSpatialLayout.empty() || !RestoreSpatialIndex(m_PendingSpatialLayout))
+            BuildSpatialIndex();
+
+        m_PendingSpatialLayout.clear();
+        m_PendingSpatialLayout.shrink_to_fit();
         
-        light_entity.AddComponent<DirectionalLightComponent>();
-        light_entity.GetTransform().SetOrientationEuler({-45.0f, 45.0f, 0.0f});
+        MarkHierarchyDirty();
+    }
 
-        cube_entity.AddComponent<MeshRendererComponent>();
-        // TODO: Add Default MeshHandle for Cube from "Resources/Models/Cube.fbx"
+    void Scene::SetSpatialIndexType(SpatialIndexType index_type)
+    {
+        if (m_SpatialIndexType == index_type)
+            return;
 
-        default_scene->m_SceneName = scene_file_path.stem().string();
-        default_scene->m_SceneFilePath = scene_file_path;
-        
-        return default_scene;
+        // The scene snapshot job may be querying the index being replaced
+        Application::Get()->WaitForSceneSnapshot();
+
+        m_SpatialIndexType = index_type;
+        BuildSpatialIndex();
     }
 
-    std::shared_ptr<Scene> Scene::LoadScene(const std::filesystem::path& scene_file_path, const std::filesystem::path& project_directory)
-    {        
-        auto scene = std::make_shared<Scene>(scene_file_path);
-        scene->Deserialise(project_directory.empty() ? scene_file_path : project_directory / "Scenes" / scene_file_path);
-        return scene;
+    void Scene::Raycast(const Ray& ray, float max_distance, std::vector<SpatialQueryHit<Entity>>& out_hits, bool first_hit_only) const
+    {
+        if (!m_SpatialIndex)
+            return;
+
+        // Scripts and jobs may query while the main thread updates the index
+        std::shared_lock<std::shared_mutex> scene_index_lock(m_SpatialIndex->GetMutex());
+        m_SpatialIndex->QueryRay(ray, max_distance, out_hits, first_hit_only);
     }
 
-    namespace Util
+    void Scene::QuerySegment(const glm::vec3& start, const glm::vec3& end, std::vector<SpatialQueryHit<Entity>>& out_hits, bool first_hit_only) const
     {
-        template<typename... Component>
-        static void CopyComponent(entt::registry& dst, entt::registry& src, const std::unordered_map<GUID, entt::entity>& guid_to_entity_map, Scene* dest_scene)
-        {
-            ([&]()
-                {
-                    auto view = src.view<Component>();
-                    for (auto source_entity_handle : view)
-                    {
-                        auto& source_component = src.get<Component>(source_entity_handle);
+        if (!m_SpatialIndex)
+            return;
 
-                        Entity source_entity = source_component.GetEntity();
-                        if (!source_entity)
-                            continue;
+        std::shared_lock<std::shared_mutex> scene_index_lock(m_SpatialIndex->GetMutex());
+        m_SpatialIndex->QuerySegment(start, end, out_hits, first_hit_only);
+    }
 
-                        entt::entity dest_entity_handle = guid_to_entity_map.at(source_entity.GetGUID());
-                        Entity dest_entity = { dest_entity_handle, dest_scene };
+    void Scene::QueryNearest(const glm::vec3& point, size_t count, float max_distance, std::vector<SpatialQueryHit<Entity>>& out_hits) const
+    {
+        if (!m_SpatialIndex)
+            return;
 
-                        // Temporarily Set Source Entity to Destination Entity for Component Copying
-                        source_component.SetEntity(dest_entity);
+        std::shared_lock<std::shared_mutex> scene_index_lock(m_SpatialIndex->GetMutex());
+        m_SpatialIndex->QueryNearest(point, count, max_distance, out_hits);
+    }
 
-                        // Call Copy Constructor of Component
-                        auto& dest_component = dst.emplace_or_replace<Component>(dest_entity_handle, source_component);
+    void Scene::QueryRadius(const glm::vec3& point, float radius, std::vector<SpatialQueryHit<Entity>>& out_hits) const
+    {
+        if (!m_SpatialIndex)
+            return;
 
-                        // Revert Source Component Entity Reference to Correct Reference
-                        source_component.SetEntity(source_entity);
+        std::shared_lock<std::shared_mutex> scene_index_lock(m_SpatialIndex->GetMutex());
+        m_SpatialIndex->QueryRadius(point, radius, out_hits);
+    }
 
-                        // Ensure Destination Component Has Correct Entity
-                        dest_component.SetEntity(dest_entity);
-                    }
-                }(), ...);
-        }
+    void Scene::QueryFrustum(const Frustum& frustum, std::vector<SpatialDataSource<Entity>>& out_results) const
+    {
+        if (!m_SpatialIndex)
+            return;
 
-        template<typename... Component>
-        static void CopyComponent(ComponentGroup<Component...>, entt::registry& dst, entt::registry& src, const std::unordered_map<GUID, entt::entity>& guid_to_entity_map, Scene* dest_scene)
-        {
-            CopyComponent<Component...>(dst, src, guid_to_entity_map, dest_scene);
-        }
+        std::shared_lock<std::shared_mutex> scene_index_lock(m_SpatialIndex->GetMutex());
+        m_SpatialIndex->Query(frustum, out_results);
+    }
 
-        void CopyRegistry(std::shared_ptr<Scene> source_scene, std::shared_ptr<Scene> dest_scene)
-        {
-            auto source_registry = source_scene->GetRegistry();
-            auto dest_registry = dest_scene->GetRegistry();
+    void Scene::QueryFrustums(std::span<const Frustum> frustums, std::vector<SpatialDataSource<Entity>>& out_results, std::vector<SpatialIndex<Entity>::ViewMask>& out_view_masks) const
+    {
+        if (!m_SpatialIndex)
+            return;
 
-            std::unordered_map<GUID, entt::entity> guid_to_entity_map;
+        std::shared_lock<std::shared_mutex> scene_index_lock(m_SpatialIndex->GetMutex());
+        m_SpatialIndex->QueryFrustums(frustums, out_results, out_view_masks);
+    }
 
-            // Create entities in new scene
-            auto view = source_registry->view<MetaComponent>();
-            for (auto it = view.rbegin(); it != view.rend(); ++it)
-            {
-                auto& source_meta_component = view.get<MetaComponent>(*it);
-                Entity new_entity = dest_scene->CreateEntity(source_meta_component.GetEntityGUID(), source_meta_component.GetName());
+    void Scene::QueryLights(const Frustum& frustum, std::vector<SpatialDataSource<Entity>>& out_results) const
+    {
+        if (!m_LightIndex)
+            return;
 
-                auto& dest_meta_component = new_entity.GetComponent<MetaComponent>();
-                dest_meta_component = source_meta_component;
+        std::shared_lock<std::shared_mutex> light_index_lock(m_LightIndex->GetMutex());
+        m_LightIndex->Query(frustum, out_results);
+    }
 
-                guid_to_entity_map[new_entity.GetGUID()] = (entt::entity)new_entity;
+    void Scene::BuildSpatialIndex()
+    {
+        switch (m_SpatialIndexType)
+        {
+            case SpatialIndexType::BVH:
+            {
+                BuildBVH();
+                break;
+            }
+            default:
+            {
+                OctreeBoundsConfig octree_config = {};
+                octree_config.Looseness = 1.25f;
+                octree_config.PreferredDataSourceLimit = 8;
+                BuildOctree(octree_config);
+                break;
             }
-
-            CopyComponent(AllComponents{}, *dest_registry, *source_registry, guid_to_entity_map, dest_scene.get());
         }
     }
 
-    std::shared_ptr<Scene> Scene::CopyScene(std::shared_ptr<Scene> source_scene)
+    void Scene::BuildOctree(OctreeBoundsConfig octree_config)
     {
-        std::shared_ptr<Scene> dest_scene = std::make_shared<Scene>();
+        BC_PROFILE_SCOPE("Scene::BuildOctree");
 
-        dest_scene->m_EntityMap = source_scene->m_EntityMap;
-        
-        dest_scene->m_SceneID = source_scene->m_SceneID;
-        dest_scene->m_SceneName = source_scene->m_SceneName;
-        dest_scene->m_SceneFilePath = source_scene->m_SceneFilePath;
+        // Create the octree and insert data sources
+        SwapSpatialIndex(std::make_shared<OctreeBounds<Entity>>(octree_config, GatherSpatialDataSources()));
+        m_SpatialIndexType = SpatialIndexType::Octree;
+    }
 
-        Util::CopyRegistry(source_scene, dest_scene);
+    void Scene::BuildBVH(BVHBoundsConfig bvh_config)
+    {
+        BC_PROFILE_SCOPE("Scene::BuildBVH");
 
-		// Generate Octree for New Scene
-		{
-			OctreeBoundsConfig octree_config = source_scene->GetOctree()->GetConfig();
+        // Static meshes are built into their own tree by SAH, the rest are 
+        // inserted into the dynamic tree
+        auto bvh = std::make_shared<BVHBounds<Entity>>(bvh_config);
+        bvh->Build(GatherSpatialDataSources(), [this](const Entity& entity) { return IsSpatiallyStatic(static_cast<entt::entity>(entity)); });
 
-			std::vector<OctreeBounds<Entity>::OctreeData> data_sources;
+        SwapSpatialIndex(bvh);
+        m_SpatialIndexType = SpatialIndexType::BVH;
+    }
 
-			auto static_mesh_view = dest_scene->GetAllEntitiesWith<MeshRendererComponent>();
-			for (const auto& entity_handle : static_mesh_view) 
-            {
-				auto& mesh_component = static_mesh_view.get<MeshRendererComponent>(entity_handle);
+    void Scene::SwapSpatialIndex(std::shared_ptr<SpatialIndex<Entity>> spatial_index)
+    {
+        // The old index is released only once its lock is, as a reader may 
+        // still be waiting on its mutex
+        std::shared_ptr<SpatialIndex<Entity>> old_spatial_index = m_SpatialIndex;
+        if (!old_spatial_index)
+        {
+            m_SpatialIndex = std::move(spatial_index);
+            return;
+        }
 
-				// Ensure the AABB is up to date
-				mesh_component.UpdateTransformedAABB();
+        std::unique_lock<std::shared_mutex> scene_index_lock(old_spatial_index->GetMutex());
+        m_SpatialIndex = std::move(spatial_index);
+    }
 
-				const auto& aabb = mesh_component.GetTransformedAABB();
+    bool Scene::RestoreSpatialIndex(std::span<const uint8_t> spatial_layout)
+    {
+        BC_PROFILE_SCOPE("Scene::RestoreSpatialIndex");
 
-				if (!mesh_component.GetEntity()) 
-                {
-					BC_CORE_ERROR("Scene::CopyScene: Cannot Insert Entity to Octree - Current Entity Is Invalid.");
-					continue;
-				}
+        std::shared_ptr<SpatialIndex<Entity>> spatial_index = nullptr;
+        if (m_SpatialIndexType == SpatialIndexType::BVH)
+            spatial_index = std::make_shared<BVHBounds<Entity>>();
+        else
+            spatial_index = std::make_shared<OctreeBounds<Entity>>();
 
-				data_sources.push_back(std::make_shared<OctreeDataSource<Entity>>(mesh_component.GetEntity(), aabb));
-			}
+        // Entities deleted, or whose mesh was removed, since the save are dropped
+        bool restored = spatial_index->ReadLayout(spatial_layout, [this](uint64_t entity_guid) -> std::optional<Entity>
+        {
+            auto it = m_EntityMap.find(GUID(entity_guid));
+            if (it == m_EntityMap.end() || !m_Registry.any_of<MeshRendererComponent, SkinnedMeshRendererComponent>(it->second))
+                return std::nullopt;
 
-			auto skinned_mesh_view = dest_scene->GetAllEntitiesWith<SkinnedMeshRendererComponent>();
-			for (const auto& entity_handle : skinned_mesh_view) 
-            {
-				auto& mesh_component = skinned_mesh_view.get<SkinnedMeshRendererComponent>(entity_handle);
+            return Entity{ it->second, this };
+        });
 
-				// Ensure the AABB is up to date
-				mesh_component.UpdateTransformedAABB();
+        if (!restored)
+        {
+            BC_CORE_WARN("Scene::RestoreSpatialIndex: Saved Spatial Index Could Not Be Restored - The Spatial Index Will Be Rebuilt.");
+            return false;
+        }
 
-				const auto& aabb = mesh_component.GetTransformedAABB();
+        SwapSpatialIndex(spatial_index);
 
-				if (!mesh_component.GetEntity()) 
-                {
-					BC_CORE_ERROR("Scene::CopyScene: Cannot Insert Entity to Octree - Current Entity Is Invalid.");
-					continue;
-				}
+        // Meshes which kept their saved bounds are left exactly where they were
+        std::vector<SpatialDataSource<Entity>> moved_data_sources;
+        for (const auto& data_source : GatherSpatialDataSources())
+        {
+            Bounds_AABB saved_bounds;
+            if (!m_SpatialIndex->TryGetBounds(data_source.Data, saved_bounds))
+                InsertSpatialData(static_cast<entt::entity>(data_source.Data), data_source.Bounds);
+            else if (!(saved_bounds == data_source.Bounds))
+                moved_data_sources.push_back(data_source);
+        }
 
-				data_sources.push_back(std::make_shared<OctreeDataSource<Entity>>(mesh_component.GetEntity(), aabb));
-			}
+        auto unplaced_data_sources = m_SpatialIndex->UpdateMany(moved_data_sources);
+        if (!unplaced_data_sources.empty())
+            BC_CORE_WARN("Scene::RestoreSpatialIndex: {0} Meshes Could Not Be Placed in the Spatial Index.", unplaced_data_sources.size());
 
-			octree_config.Looseness = 1.25f;
-			octree_config.PreferredDataSourceLimit = 8;
+        return true;
+    }
 
-			// Create the octree and insert data sources
-			dest_scene->m_Octree = std::make_shared<OctreeBounds<Entity>>(octree_config, data_sources);
-		}
+    std::vector<SpatialDataSource<Entity>> Scene::GatherSpatialDataSources()
+    {
+        BC_PROFILE_SCOPE("Scene::GatherSpatialDataSources");
+
+        std::vector<SpatialDataSource<Entity>> data_sources;
+        data_sources.reserve(m_Registry.storage<MeshRendererComponent>().size() + m_Registry.storage<SkinnedMeshRendererComponent>().size());
+
+        auto static_mesh_view = GetAllEntitiesWith<MeshRendererComponent>();
+        for (const auto& entity_handle : static_mesh_view) 
+        {
+            auto& mesh_component = static_mesh_view.get<MeshRendererComponent>(entity_handle);
+
+            // Ensure the AABB is up to date
+            mesh_component.UpdateTransformedAABB();
+
+            const auto& aabb = mesh_component.GetTransformedAABB();
+
+            if (!mesh_component.GetEntity()) 
+            {
+                BC_CORE_ERROR("Scene::GatherSpatialDataSources: Cannot Insert Entity to Spatial Index - Current Entity Is Invalid.");
+                continue;
+            }
+
+            data_sources.emplace_back(mesh_component.GetEntity(), aabb);
+        }
+
+        auto skinned_mesh_view = GetAllEntitiesWith<SkinnedMeshRendererComponent>();
+        for (const auto& entity_handle : skinned_mesh_view) 
+        {
+            auto& mesh_component = skinned_mesh_view.get<SkinnedMeshRendererComponent>(entity_handle);
+
+            // Ensure the AABB is up to date
+            mesh_component.UpdateTransformedAABB();
+
+            const auto& aabb = mesh_component.GetTransformedAABB();
+
+            if (!mesh_component.GetEntity()) 
+            {
+                BC_CORE_ERROR("Scene::GatherSpatialDataSources: Cannot Insert Entity to Spatial Index - Current Entity Is Invalid.");
+                continue;
+            }
+
+            data_sources.emplace_back(mesh_component.GetEntity(), aabb);
+        }
+
+        return data_sources;
+    }
+
+    bool Scene::IsSpatiallyStatic(entt::entity entity_handle) const
+    {
+        return !m_Registry.all_of<RigidbodyComponent>(entity_handle) && !m_Registry.all_of<SkinnedMeshRendererComponent>(entity_handle);
+    }
+
+    void Scene::InsertSpatialData(entt::entity entity_handle, const Bounds_AABB& bounds)
+    {
+        if (IsSpatiallyStatic(entity_handle))
+            m_SpatialIndex->InsertStatic(Entity{ entity_handle, this }, bounds);
+        else
+            m_SpatialIndex->Insert(Entity{ entity_handle, this }, bounds);
+    }
+
+    namespace Util
+    {
+        /// @brief The minimum amount of bounds given to a transform job, below
+        /// this the job overhead outweighs the work
+        constexpr size_t MIN_BOUNDS_PER_TRANSFORM_JOB = 256;
+    }
+
+    void Scene::UpdateLightIndex()
+    {
+        BC_PROFILE_SCOPE("Scene::UpdateLightIndex");
+
+        m_SpatialUpdate.Lights.clear();
+
+        // An entity with both kinds of light is bounded by both, and has both
+        // of its flags cleared the first time it is visited
+        auto gather = [this](entt::entity entity_handle)
+        {
+            const glm::mat4& light_matrix = m_Registry.get<TransformComponent>(entity_handle).GetGlobalMatrix();
+            glm::vec3 light_position = TransformComponent::GetPositionFromMatrix(light_matrix);
+
+            Bounds_AABB bounds = {};
+            if (auto* light_component = m_Registry.try_get<SphereLightComponent>(entity_handle); light_component)
+            {
+                glm::vec3 extent = glm::vec3(light_component->GetRadius());
+                bounds.BoundsMin = glm::min(bounds.BoundsMin, light_position - extent);
+                bounds.BoundsMax = glm::max(bounds.BoundsMax, light_position + extent);
+                light_component->ClearSpatialUpdate();
+            }
+
+            if (auto* light_component = m_Registry.try_get<ConeLightComponent>(entity_handle); light_component)
+            {
+                Bounds_Sphere sphere = Bounds_Sphere::FromCone(light_position, TransformComponent::GetForwardDirectionFromMatrix(light_matrix), light_component->GetRange(), light_component->GetAngle());
+                bounds.BoundsMin = glm::min(bounds.BoundsMin, sphere.BoundsCentre - glm::vec3(sphere.BoundsRadius));
+                bounds.BoundsMax = glm::max(bounds.BoundsMax, sphere.BoundsCentre + glm::vec3(sphere.BoundsRadius));
+                light_component->ClearSpatialUpdate();
+            }
+
+            m_SpatialUpdate.Lights.emplace_back(Entity{ entity_handle, this }, bounds);
+        };
+
+        auto sphere_light_view = m_Registry.view<TransformComponent, SphereLightComponent>(entt::exclude<PrefabPoolParked>);
+        for (const auto& entity_handle : sphere_light_view)
+        {
+            if (sphere_light_view.get<SphereLightComponent>(entity_handle).NeedsSpatialUpdate())
+                gather(entity_handle);
+        }
+
+        auto cone_light_view = m_Registry.view<TransformComponent, ConeLightComponent>(entt::exclude<PrefabPoolParked>);
+        for (const auto& entity_handle : cone_light_view)
+        {
+            if (cone_light_view.get<ConeLightComponent>(entity_handle).NeedsSpatialUpdate())
+                gather(entity_handle);
+        }
+
+        if (m_SpatialUpdate.Lights.empty())
+            return;
+
+        std::unique_lock<std::shared_mutex> light_index_lock(m_LightIndex->GetMutex());
+
+        auto unplaced_data_sources = m_LightIndex->UpdateMany(m_SpatialUpdate.Lights);
+        if (!unplaced_data_sources.empty())
+            BC_CORE_WARN("Scene::UpdateLightIndex: {0} Lights Could Not Be Placed in the Light Index.", unplaced_data_sources.size());
+    }
+
+    void Scene::UpdateSpatialIndex()
+    {
+        BC_PROFILE_SCOPE("Scene::UpdateSpatialIndex");
+
+        UpdateLightIndex();
+
+        // 1. Gather every mesh whose transform changed. Global matrices are
+        //    resolved here on the main thread, as resolving them walks and
+        //    caches up the hierarchy
+        m_SpatialUpdate.Entities.clear();
+        m_SpatialUpdate.Transforms.clear();
+        m_SpatialUpdate.LocalBounds.clear();
+
+        auto gather = [this](auto& view, auto& mesh_component, entt::entity entity_handle, AssetHandle mesh_handle)
+        {
+            if (!mesh_component.NeedsSpatialUpdate() || mesh_handle == NULL_GUID)
+                return;
+
+            auto mesh_asset = AssetManager::GetAsset<StaticMesh>(mesh_handle);
+            if (!mesh_asset)
+                return;
+
+            m_SpatialUpdate.Entities.push_back(entity_handle);
+            m_SpatialUpdate.Transforms.push_back(view.template get<TransformComponent>(entity_handle).GetGlobalMatrix());
+            m_SpatialUpdate.LocalBounds.push_back(mesh_asset->GetMeshBounds());
+        };
+
+        // Parked prefab instances are out of the index until they are reused
+        auto static_mesh_view = m_Registry.view<TransformComponent, MeshRendererComponent>(entt::exclude<PrefabPoolParked>);
+        for (const auto& entity_handle : static_mesh_view)
+        {
+            auto& mesh_component = static_mesh_view.get<MeshRendererComponent>(entity_handle);
+            gather(static_mesh_view, mesh_component, entity_handle, mesh_component.GetMesh());
+        }
+
+        size_t static_mesh_count = m_SpatialUpdate.Entities.size();
+
+        auto skinned_mesh_view = m_Registry.view<TransformComponent, SkinnedMeshRendererComponent>(entt::exclude<PrefabPoolParked>);
+        for (const auto& entity_handle : skinned_mesh_view)
+        {
+            auto& mesh_component = skinned_mesh_view.get<SkinnedMeshRendererComponent>(entity_handle);
+            gather(skinned_mesh_view, mesh_component, entity_handle, mesh_component.GetMesh());
+        }
+
+        size_t update_count = m_SpatialUpdate.Entities.size();
+        if (update_count == 0)
+            return;
+
+        // 2. Transform the bounds in SIMD batches, spread across the workers
+        //    when there are enough of them to be worth it
+        m_SpatialUpdate.WorldBounds.resize(update_count);
+        {
+            BC_PROFILE_SCOPE("Scene::UpdateSpatialIndex: Transform Bounds");
+
+            JobSystem* job_system = Application::GetJobSystem();
+
+            size_t max_chunks = job_system ? static_cast<size_t>(job_system->GetWorkerCount()) + 1 : 1;
+            size_t chunk_count = std::clamp<size_t>(update_count / Util::MIN_BOUNDS_PER_TRANSFORM_JOB, 1, std::max<size_t>(max_chunks, 1));
+            size_t chunk_size = (update_count + chunk_count - 1) / chunk_count;
+
+            auto transform_chunk = [this, chunk_size, update_count](size_t chunk_index)
+            {
+                size_t begin = chunk_index * chunk_size;
+                size_t end = std::min(begin + chunk_size, update_count);
+                if (begin < end)
+                    Util::TransformAABBs(m_SpatialUpdate.Transforms.data() + begin, m_SpatialUpdate.LocalBounds.data() + begin, end - begin, m_SpatialUpdate.WorldBounds.data() + begin);
+            };
+
+            JobCounter transform_counter = {};
+            if (job_system && chunk_count > 1)
+            {
+                std::vector<std::pair<std::string, JobFunction>> transform_jobs;
+                transform_jobs.reserve(chunk_count - 1);
+                for (size_t chunk_index = 1; chunk_index < chunk_count; ++chunk_index)
+                    transform_jobs.emplace_back("Scene Spatial Index: Transform Bounds", [&transform_chunk, chunk_index]() { transform_chunk(chunk_index); });
+
+                job_system->SubmitJobs(transform_jobs, &transform_counter, JobPriority::High);
+            }
+
+            transform_chunk(0);
+
+            transform_counter.Wait();
+        }
+
+        // 3. Hand the bounds back to the components and apply them to the
+        //    index in a single batched update
+        std::vector<SpatialDataSource<Entity>> data_sources;
+        data_sources.reserve(update_count);
+
+        for (size_t i = 0; i < update_count; ++i)
+        {
+            entt::entity entity_handle = m_SpatialUpdate.Entities[i];
+            const Bounds_AABB& world_bounds = m_SpatialUpdate.WorldBounds[i];
+
+            if (i < static_mesh_count)
+                m_Registry.get<MeshRendererComponent>(entity_handle).SetTransformedAABB(world_bounds);
+            else
+                m_Registry.get<SkinnedMeshRendererComponent>(entity_handle).SetTransformedAABB(world_bounds);
+
+            data_sources.emplace_back(Entity{ entity_handle, this }, world_bounds);
+        }
+
+        std::unique_lock<std::shared_mutex> scene_index_lock(m_SpatialIndex->GetMutex());
+
+        auto unplaced_data_sources = m_SpatialIndex->UpdateMany(data_sources);
+        if (!unplaced_data_sources.empty())
+            BC_CORE_WARN("Scene::UpdateSpatialIndex: {0} Meshes Could Not Be Placed in the Spatial Index.", unplaced_data_sources.size());
+    }
+
+    bool Scene::ReleaseEntities(const SceneStreamingBudget& budget)
+    {
+        BC_PROFILE_SCOPE("Scene::ReleaseEntities");
+
+        constexpr size_t slice_size = 64;
+
+        std::unique_lock<std::shared_mutex> scene_index_lock(m_SpatialIndex->GetMutex());
+
+        // The scene is no longer reachable once released, so the lookup
+        // structures are dropped up front rather than per entity
+        if (!m_EntityMap.empty() || !m_SpatialIndex->IsEmpty())
+        {
+            m_EntityMap.clear();
+            m_EntityNameMap.clear();
+            m_PrefabPools.clear();
+            m_PendingIntegration.clear();
+            m_PendingIntegrationIndex = 0;
+            m_SpatialIndex->Clear();
+
+            std::unique_lock<std::shared_mutex> light_index_lock(m_LightIndex->GetMutex());
+            m_LightIndex->Clear();
+        }
+
+        auto start_time = std::chrono::high_resolution_clock::now();
+        size_t released_count = 0;
+
+        std::vector<entt::entity> slice;
+        slice.reserve(slice_size);
+
+        auto view = m_Registry.view<entt::entity>();
+        while (view.begin() != view.end())
+        {
+            size_t count = slice_size;
+            if (budget.MaxEntitiesPerFrame != 0)
+                count = std::min<size_t>(count, budget.MaxEntitiesPerFrame - released_count);
+
+            slice.clear();
+            for (auto it = view.begin(); it != view.end() && slice.size() < count; ++it)
+                slice.push_back(*it);
+
+            m_Registry.destroy(slice.begin(), slice.end());
+            released_count += slice.size();
+
+            if (budget.IsExhausted(released_count, start_time))
+                break;
+        }
+
+        return view.begin() == view.end();
+    }
+
+#pragma endregion
+
+#pragma region Static
+
+    std::shared_ptr<Scene> Scene::CreateDefaultScene(const std::filesystem::path &scene_file_path)
+    {
+        std::shared_ptr<Scene> default_scene = std::make_shared<Scene>(scene_file_path);
+
+        Entity camera_entity    = default_scene->CreateEntity("Main Camera");
+        Entity light_entity     = default_scene->CreateEntity("Directional Light");
+        Entity cube_entity      = default_scene->CreateEntity("Cube");
+
+        camera_entity.AddComponent<CameraComponent>();
+        camera_entity.GetTransform().SetPosition({ 0.0f, 5.0f, 10.0f });
+        camera_entity.GetTransform().LookAt({ 0.0f, 0.0f, 0.0f });
+        
+        light_entity.AddComponent<DirectionalLightComponent>();
+        light_entity.GetTransform().SetOrientationEuler({-45.0f, 45.0f, 0.0f});
+
+        cube_entity.AddComponent<MeshRendererComponent>();
+        // TODO: Add Default MeshHandle for Cube from "Resources/Models/Cube.fbx"
+
+        default_scene->m_SceneName = scene_file_path.stem().string();
+        default_scene->m_SceneFilePath = scene_file_path;
+        
+        return default_scene;
+    }
+
+    std::shared_ptr<Scene> Scene::LoadScene(const std::filesystem::path& scene_file_path, const std::filesystem::path& project_directory)
+    {        
+        auto scene = std::make_shared<Scene>(scene_file_path);
+        scene->Deserialise(project_directory.empty() ? scene_file_path : project_directory / "Scenes" / scene_file_path);
+        return scene;
+    }
+
+    std::shared_ptr<Scene> Scene::LoadSceneDetached(const std::filesystem::path& scene_file_path, const std::filesystem::path& project_directory)
+    {
+        auto scene = std::make_shared<Scene>(scene_file_path);
+        if (!scene->DeserialiseEntities(project_directory.empty() ? scene_file_path : project_directory / "Scenes" / scene_file_path, false))
+            return nullptr;
+        return scene;
+    }
+
+    namespace Util
+    {
+        /// @brief Maps an entity handle of a source registry to its clone,
+        /// indexed by the entity portion of the source handle
+        using EntityHandleRemap = std::vector<entt::entity>;
+
+        static entt::entity RemapEntityHandle(const EntityHandleRemap& remap, entt::entity source_handle)
+        {
+            auto index = static_cast<size_t>(entt::to_entity(source_handle));
+            return index < remap.size() ? remap[index] : entt::entity{ entt::null };
+        }
+
+        template<typename... Component>
+        static void CloneComponents(ComponentGroup<Component...>, entt::registry& dst, entt::registry& src, const EntityHandleRemap& remap, Scene* dest_scene)
+        {
+            // Each storage is copied straight across with the component copy
+            // constructors, no GUID lookups or per entity hierarchy work
+            ([&]()
+                {
+                    auto& source_storage = src.storage<Component>();
+                    auto& dest_storage = dst.storage<Component>();
+                    dest_storage.reserve(source_storage.size());
+
+                    for (auto [source_entity_handle, source_component] : source_storage.each())
+                    {
+                        entt::entity dest_entity_handle = RemapEntityHandle(remap, source_entity_handle);
+                        if (dest_entity_handle == entt::null)
+                            continue;
+
+                        auto& dest_component = dest_storage.emplace(dest_entity_handle, source_component);
+                        dest_component.SetEntity(Entity{ dest_entity_handle, dest_scene });
+                    }
+                }(), ...);
+        }
+    }
+
+    std::unordered_map<GUID, GUID> Scene::ReassignEntityGUIDs(const Scene* reserved_scene)
+    {
+        BC_PROFILE_SCOPE("Scene::ReassignEntityGUIDs");
+
+        auto& meta_storage = m_Registry.storage<MetaComponent>();
+
+        std::unordered_map<GUID, GUID> guid_map;
+        guid_map.reserve(meta_storage.size());
+
+        for (const auto& meta_component : meta_storage)
+        {
+            GUID entity_guid;
+            do
+            {
+                entity_guid = GUID();
+            } while (m_EntityMap.contains(entity_guid) || (reserved_scene && reserved_scene->m_EntityMap.contains(entity_guid)));
+
+            guid_map.emplace(meta_component.m_EntityID, entity_guid);
+        }
+
+        m_EntityMap.clear();
+        m_EntityMap.reserve(meta_storage.size());
+
+        for (auto [entity_handle, meta_component] : meta_storage.each())
+        {
+            meta_component.m_EntityID = guid_map[meta_component.m_EntityID];
+
+            if (auto parent_it = guid_map.find(meta_component.m_Parent); parent_it != guid_map.end())
+                meta_component.m_Parent = parent_it->second;
+
+            m_EntityMap.emplace(meta_component.m_EntityID, entity_handle);
+        }
+
+        return guid_map;
+    }
+
+    std::shared_ptr<Scene> Scene::CopyScene(std::shared_ptr<Scene> source_scene)
+    {
+        BC_PROFILE_SCOPE("Scene::CopyScene");
+
+        std::shared_ptr<Scene> dest_scene = std::make_shared<Scene>();
+        
+        dest_scene->m_SceneID = source_scene->m_SceneID;
+        dest_scene->m_SceneName = source_scene->m_SceneName;
+        dest_scene->m_SceneFilePath = source_scene->m_SceneFilePath;
+
+        std::shared_lock<std::shared_mutex> source_index_lock(source_scene->m_SpatialIndex->GetMutex());
+
+        entt::registry& src = source_scene->m_Registry;
+        entt::registry& dst = dest_scene->m_Registry;
+
+        // 1. Create every entity up front, requesting the source identifier
+        //    so the clone mirrors the source and the remap is the identity
+        Util::EntityHandleRemap remap;
+        {
+            auto view = src.view<MetaComponent>();
+
+            size_t max_index = 0;
+            for (auto entity_handle : view)
+                max_index = std::max(max_index, static_cast<size_t>(entt::to_entity(entity_handle)));
+
+            remap.assign(view.empty() ? 0 : max_index + 1, entt::null);
+
+            for (auto it = view.rbegin(); it != view.rend(); ++it)
+            {
+                // Parked prefab instances belong to the source scene's pools,
+                // which are runtime only and not carried across
+                if (src.all_of<PrefabPoolParked>(*it))
+                    continue;
+
+                remap[static_cast<size_t>(entt::to_entity(*it))] = dst.create(*it);
+            }
+        }
+
+        // 2. Copy every component storage in bulk
+        Util::CloneComponents(Util::AllComponents{}, dst, src, remap, dest_scene.get());
+
+        // Hierarchy links hold entity handles so each one is remapped too
+        {
+            auto& source_storage = src.storage<RelationshipComponent>();
+            auto& dest_storage = dst.storage<RelationshipComponent>();
+            dest_storage.reserve(source_storage.size());
+
+            for (auto [entity_handle, relationship] : source_storage.each())
+            {
+                entt::entity dest_entity_handle = Util::RemapEntityHandle(remap, entity_handle);
+                if (dest_entity_handle == entt::null)
+                    continue;
+
+                RelationshipComponent& dest_relationship = dest_storage.emplace(dest_entity_handle, relationship);
+                dest_relationship.Parent = Util::RemapEntityHandle(remap, relationship.Parent);
+                dest_relationship.FirstChild = Util::RemapEntityHandle(remap, relationship.FirstChild);
+                dest_relationship.LastChild = Util::RemapEntityHandle(remap, relationship.LastChild);
+                dest_relationship.PreviousSibling = Util::RemapEntityHandle(remap, relationship.PreviousSibling);
+                dest_relationship.NextSibling = Util::RemapEntityHandle(remap, relationship.NextSibling);
+            }
+        }
+
+        // 3. Remap the GUID and name keyed indices in a single pass each
+        dest_scene->m_EntityMap.reserve(source_scene->m_EntityMap.size());
+        for (const auto& [entity_guid, entity_handle] : source_scene->m_EntityMap)
+        {
+            if (entt::entity dest_entity_handle = Util::RemapEntityHandle(remap, entity_handle); dest_entity_handle != entt::null)
+                dest_scene->m_EntityMap.emplace(entity_guid, dest_entity_handle);
+        }
+
+        dest_scene->m_EntityNameMap.reserve(source_scene->m_EntityNameMap.size());
+        for (const auto& [entity_name, entity_handle] : source_scene->m_EntityNameMap)
+        {
+            if (entt::entity dest_entity_handle = Util::RemapEntityHandle(remap, entity_handle); dest_entity_handle != entt::null)
+                dest_scene->m_EntityNameMap.emplace(entity_name, dest_entity_handle);
+        }
+
+        // 4. Copy the built spatial index rather than reinserting every mesh
+        Scene* dest_scene_ptr = dest_scene.get();
+        dest_scene->m_SpatialIndexType = source_scene->m_SpatialIndexType;
+        dest_scene->m_SpatialIndex = source_scene->m_SpatialIndex->CloneIndex([&](const Entity& source_entity) 
+        {
+            return Entity{ Util::RemapEntityHandle(remap, static_cast<entt::entity>(source_entity)), dest_scene_ptr };
+        });
 
         return dest_scene;
     }
 
 #pragma endregion
 
+#pragma region Prefabs
+
+    namespace Util
+    {
+        template<typename Component>
+        constexpr bool IsPhysicsComponent = 
+            std::is_same_v<Component, RigidbodyComponent> ||
+            std::is_same_v<Component, BoxColliderComponent> ||
+            std::is_same_v<Component, SphereColliderComponent> ||
+            std::is_same_v<Component, CapsuleColliderComponent> ||
+            std::is_same_v<Component, ConvexMeshColliderComponent> ||
+            std::is_same_v<Component, HeightFieldColliderComponent> ||
+            std::is_same_v<Component, TriangleMeshColliderComponent>;
+
+        template<typename... Component>
+        static void ApplyPrefabComponents(ComponentGroup<Component...>, entt::registry& dst, const entt::registry& src, std::span<const entt::entity> template_handles, std::span<const entt::entity> instance_handles, Scene* scene, bool recycled)
+        {
+            // Copied storage by storage straight from the template. Recycled
+            // instances already own every component of the template, so
+            // their data is reset in place and physics actors are kept
+            ([&]()
+                {
+                    const auto* source_storage = src.storage<Component>();
+                    if (!source_storage || source_storage->empty())
+                        return;
+
+                    auto& dest_storage = dst.storage<Component>();
+                    if (!recycled)
+                        dest_storage.reserve(dest_storage.size() + source_storage->size());
+
+                    for (size_t node_index = 0; node_index < template_handles.size(); ++node_index)
+                    {
+                        if (!source_storage->contains(template_handles[node_index]))
+                            continue;
+
+                        if (recycled)
+                        {
+                            if constexpr (!IsPhysicsComponent<Component>)
+                                dest_storage.get(instance_handles[node_index]) = source_storage->get(template_handles[node_index]);
+                            continue;
+                        }
+
+                        auto& component = dest_storage.emplace(instance_handles[node_index], source_storage->get(template_handles[node_index]));
+                        component.SetEntity(Entity{ instance_handles[node_index], scene });
+                    }
+                }(), ...);
+        }
+
+        template<typename... Component>
+        static bool InstanceMatchesTemplate(ComponentGroup<Component...>, const entt::registry& instance_registry, const entt::registry& template_registry, std::span<const entt::entity> template_handles, std::span<const entt::entity> instance_handles)
+        {
+            return ([&]()
+                {
+                    const auto* template_storage = template_registry.storage<Component>();
+                    if (!template_storage || template_storage->empty())
+                        return true;
+
+                    for (size_t node_index = 0; node_index < template_handles.size(); ++node_index)
+                    {
+                        if (template_storage->contains(template_handles[node_index]) && !instance_registry.all_of<Component>(instance_handles[node_index]))
+                            return false;
+                    }
+                    return true;
+                }() && ...);
+        }
+    }
+
+    Entity Scene::InstantiatePrefab(std::shared_ptr<Prefab> prefab, GUID parent_guid)
+    {
+        return InstantiatePrefabInstance(prefab, nullptr, nullptr, parent_guid);
+    }
+
+    Entity Scene::InstantiatePrefab(std::shared_ptr<Prefab> prefab, const glm::vec3& position, const glm::quat& orientation, GUID parent_guid)
+    {
+        return InstantiatePrefabInstance(prefab, &position, &orientation, parent_guid);
+    }
+
+    Entity Scene::InstantiatePrefabInstance(const std::shared_ptr<Prefab>& prefab, const glm::vec3* position, const glm::quat* orientation, GUID parent_guid)
+    {
+        BC_PROFILE_SCOPE("Scene::InstantiatePrefab");
+
+        if (!prefab || prefab->m_Nodes.empty())
+        {
+            BC_CORE_WARN("Scene::InstantiatePrefab: Cannot Instantiate Invalid Prefab.");
+            return Entity{};
+        }
+
+        // Obtain lock
+		std::unique_lock<std::shared_mutex> scene_index_lock(m_SpatialIndex->GetMutex());
+
+        PrefabPool* pool = nullptr;
+        if (auto pool_it = m_PrefabPools.find(prefab->Handle); pool_it != m_PrefabPools.end())
+            pool = &pool_it->second;
+
+        std::vector<entt::entity> instance_handles;
+        bool recycled = false;
+
+        if (pool && !pool->ParkedInstances.empty())
+        {
+            instance_handles = std::move(pool->ParkedInstances.back());
+            pool->ParkedInstances.pop_back();
+            recycled = true;
+        }
+        else
+        {
+            instance_handles.resize(prefab->m_Nodes.size());
+            m_Registry.create(instance_handles.begin(), instance_handles.end());
+        }
+
+        Entity root_entity = ApplyPrefabInstance(*prefab, instance_handles, recycled, position, orientation, parent_guid);
+
+        if (pool)
+            pool->LiveInstances.emplace(instance_handles.front(), std::move(instance_handles));
+
+        MarkHierarchyDirty();
+
+        return root_entity;
+    }
+
+    Entity Scene::ApplyPrefabInstance(const Prefab& prefab, std::span<const entt::entity> instance_handles, bool recycled, const glm::vec3* position, const glm::quat* orientation, GUID parent_guid)
+    {
+        const auto& nodes = prefab.m_Nodes;
+
+        // 1. Component data
+        Util::ApplyPrefabComponents(Util::AllComponents{}, m_Registry, prefab.m_Registry, prefab.m_TemplateHandles, instance_handles, this, recycled);
+
+        if (recycled)
+            m_Registry.remove<PrefabPoolParked>(instance_handles.begin(), instance_handles.end());
+
+        // 2. Assign new GUIDs and rebuild the hierarchy from the template
+        //    nodes in a single pass, no lookups into other entities.
+        //    Recycled instances keep the links they were parked with
+        std::vector<GUID> instance_guids(nodes.size());
+        for (auto& entity_guid : instance_guids)
+        {
+            do
+            {
+                entity_guid = GUID();
+            } while (m_EntityMap.find(entity_guid) != m_EntityMap.end());
+        }
+
+        if (!recycled)
+        {
+            m_Registry.insert<RelationshipComponent>(instance_handles.begin(), instance_handles.end());
+            for (size_t node_index = 0; node_index < nodes.size(); ++node_index)
+            {
+                for (uint32_t child_index : nodes[node_index].ChildIndices)
+                    Util::LinkRelationship(m_Registry, instance_handles[child_index], instance_handles[node_index]);
+            }
+        }
+
+        m_EntityMap.reserve(m_EntityMap.size() + nodes.size());
+        for (size_t node_index = 0; node_index < nodes.size(); ++node_index)
+        {
+            entt::entity entity_handle = instance_handles[node_index];
+            const auto& node = nodes[node_index];
+
+            auto& meta_component = m_Registry.get<MetaComponent>(entity_handle);
+            meta_component.m_EntityID = instance_guids[node_index];
+            meta_component.m_Parent = node.ParentIndex == Prefab::ROOT_NODE_PARENT ? NULL_GUID : instance_guids[node.ParentIndex];
+            meta_component.m_PrefabSourceHandle = prefab.Handle;
+
+            m_EntityMap.emplace(instance_guids[node_index], entity_handle);
+            m_EntityNameMap.try_emplace(meta_component.GetName(), entity_handle);
+        }
+
+        // 3. Place the root, the change propagates through its descendants
+        Entity root_entity = { instance_handles.front(), this };
+
+        if (parent_guid != NULL_GUID)
+            root_entity.GetComponent<MetaComponent>().AttachParent(parent_guid);
+
+        if (m_Registry.get<RelationshipComponent>(root_entity).Parent == entt::null)
+            Util::RefreshRelationshipDepth(m_Registry, root_entity);
+
+        auto& root_transform = root_entity.GetComponent<TransformComponent>();
+        if (orientation)
+            root_transform.SetOrientation(*orientation, true);
+        root_transform.SetPosition(position ? *position : root_transform.GetLocalPosition(), position != nullptr);
+
+        // 4. Initialise components, recycled instances resume their actors
+        if (!recycled)
+        {
+            Util::InitComponents(Util::AllComponents{}, m_Registry, instance_handles);
+        }
+        else
+        {
+            for (entt::entity entity_handle : instance_handles)
+            {
+                if (auto* rigidbody_component = m_Registry.try_get<RigidbodyComponent>(entity_handle); rigidbody_component)
+                    rigidbody_component->GetRigid()->SetSimulationEnabled(Entity{ entity_handle, this }, true);
+            }
+        }
+
+        // 5. Insert meshes into the spatial index
+        for (entt::entity entity_handle : instance_handles)
+        {
+            if (auto* mesh_component = m_Registry.try_get<MeshRendererComponent>(entity_handle); mesh_component)
+            {
+                mesh_component->UpdateTransformedAABB();
+                InsertSpatialData(entity_handle, mesh_component->GetTransformedAABB());
+            }
+
+            if (auto* mesh_component = m_Registry.try_get<SkinnedMeshRendererComponent>(entity_handle); mesh_component)
+            {
+                mesh_component->UpdateTransformedAABB();
+                InsertSpatialData(entity_handle, mesh_component->GetTransformedAABB());
+            }
+        }
+
+        return root_entity;
+    }
+
+    bool Scene::ParkPrefabInstance(const Prefab& prefab, std::span<const entt::entity> instance_handles)
+    {
+        for (entt::entity entity_handle : instance_handles)
+        {
+            if (!m_Registry.valid(entity_handle))
+                return false;
+        }
+
+        if (!Util::InstanceMatchesTemplate(Util::AllComponents{}, m_Registry, prefab.m_Registry, prefab.m_TemplateHandles, instance_handles))
+            return false;
+
+        Entity root_entity = { instance_handles.front(), this };
+        if (auto& root_meta_component = root_entity.GetComponent<MetaComponent>(); root_meta_component.HasParent())
+            root_meta_component.DetachParent();
+
+        for (entt::entity entity_handle : instance_handles)
+        {
+            Entity entity = { entity_handle, this };
+
+            const auto& meta_component = m_Registry.get<MetaComponent>(entity_handle);
+            m_EntityMap.erase(meta_component.GetEntityGUID());
+
+            if (auto it = m_EntityNameMap.find(meta_component.GetName()); it != m_EntityNameMap.end() && it->second == entity_handle)
+                m_EntityNameMap.erase(it);
+
+            if (auto* mesh_component = m_Registry.try_get<MeshRendererComponent>(entity_handle); mesh_component)
+            {
+                mesh_component->SetActive(false);
+                m_SpatialIndex->Remove(entity);
+            }
+
+            if (auto* mesh_component = m_Registry.try_get<SkinnedMeshRendererComponent>(entity_handle); mesh_component)
+            {
+                mesh_component->SetActive(false);
+                m_SpatialIndex->Remove(entity);
+            }
+
+            if (auto* light_component = m_Registry.try_get<SphereLightComponent>(entity_handle); light_component)
+                light_component->SetActive(false);
+
+            if (auto* light_component = m_Registry.try_get<ConeLightComponent>(entity_handle); light_component)
+                light_component->SetActive(false);
+
+            if (m_LightIndex->Contains(entity))
+            {
+                std::unique_lock<std::shared_mutex> light_index_lock(m_LightIndex->GetMutex());
+                m_LightIndex->Remove(entity);
+            }
+
+            if (auto* light_component = m_Registry.try_get<DirectionalLightComponent>(entity_handle); light_component)
+                light_component->SetActive(false);
+
+            if (auto* rigidbody_component = m_Registry.try_get<RigidbodyComponent>(entity_handle); rigidbody_component)
+                rigidbody_component->GetRigid()->SetSimulationEnabled(entity, false);
+
+            m_Registry.emplace_or_replace<PrefabPoolParked>(entity_handle);
+        }
+
+        return true;
+    }
+
+    void Scene::WarmPrefabPool(std::shared_ptr<Prefab> prefab, size_t instance_count)
+    {
+        BC_PROFILE_SCOPE("Scene::WarmPrefabPool");
+
+        if (!prefab || prefab->m_Nodes.empty())
+        {
+            BC_CORE_WARN("Scene::WarmPrefabPool: Cannot Warm Pool of Invalid Prefab.");
+            return;
+        }
+
+        // Obtain lock
+		std::unique_lock<std::shared_mutex> scene_index_lock(m_SpatialIndex->GetMutex());
+
+        auto& pool = m_PrefabPools[prefab->Handle];
+        pool.Source = prefab;
+        pool.ParkedInstances.reserve(pool.ParkedInstances.size() + instance_count);
+
+        std::vector<entt::entity> instance_handles(prefab->m_Nodes.size() * instance_count);
+        m_Registry.create(instance_handles.begin(), instance_handles.end());
+
+        for (size_t instance_index = 0; instance_index < instance_count; ++instance_index)
+        {
+            std::span<const entt::entity> instance(instance_handles.data() + instance_index * prefab->m_Nodes.size(), prefab->m_Nodes.size());
+
+            ApplyPrefabInstance(*prefab, instance, false, nullptr, nullptr, NULL_GUID);
+            ParkPrefabInstance(*prefab, instance);
+
+            pool.ParkedInstances.emplace_back(instance.begin(), instance.end());
+        }
+    }
+
+    void Scene::ClearPrefabPool(AssetHandle prefab_handle)
+    {
+        // Obtain lock
+		std::unique_lock<std::shared_mutex> scene_index_lock(m_SpatialIndex->GetMutex());
+
+        auto pool_it = m_PrefabPools.find(prefab_handle);
+        if (pool_it == m_PrefabPools.end())
+            return;
+
+        // Parked instances are unlinked from the scene, so there is no
+        // hierarchy or lookup to unwind before destroying them
+        for (const auto& instance_handles : pool_it->second.ParkedInstances)
+            m_Registry.destroy(instance_handles.begin(), instance_handles.end());
+
+        m_PrefabPools.erase(pool_it);
+    }
+
+#pragma endregion
+
 }
\ No newline at end of file
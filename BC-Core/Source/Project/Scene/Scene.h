@@ -3,6 +3,9 @@
 // Core Headers
 #include "Core/GUID.h"
 
+#include "Asset/Asset.h"
+
+#include "Project/Scene/Bounds/BVH.h"
 #include "Project/Scene/Bounds/Octree.h"
 
 // C++ Standard Library Headers
@@ -10,13 +13,37 @@
 #include <memory>
 #include <filesystem>
 #include <unordered_map>
+#include <chrono>
+#include <span>
 
 // External Vendor Library Headers
 #include <entt/entt.hpp>
+#include <glm/gtc/quaternion.hpp>
 
 namespace BC
 {
     class Entity;
+    class Prefab;
+
+    /// @brief Per-frame limits for work that is spread across frames on the
+    /// main thread, e.g., integrating streamed scenes or releasing unloaded
+    /// ones. A value of zero means unlimited.
+    struct SceneStreamingBudget
+    {
+        uint32_t MaxEntitiesPerFrame = 512;
+        uint32_t MaxMicrosecondsPerFrame = 2000;
+
+        bool IsExhausted(size_t processed_entities, std::chrono::high_resolution_clock::time_point start_time) const
+        {
+            if (MaxEntitiesPerFrame != 0 && processed_entities >= MaxEntitiesPerFrame)
+                return true;
+
+            if (MaxMicrosecondsPerFrame != 0 && std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start_time).count() >= MaxMicrosecondsPerFrame)
+                return true;
+
+            return false;
+        }
+    };
 
     class Scene
     {
@@ -36,7 +63,21 @@ namespace BC
 		Entity CreateEntity(const std::string& name = "", GUID parent_guid = NULL_GUID);
 		Entity CreateEntity(GUID entity_guid, const std::string& name = "", GUID parent_guid = NULL_GUID);
 
-		// TODO: Entity InstantiatePrefab(std::shared_ptr<Prefab> prefab, std::optional<TransformComponent> transform = std::nullopt, const GUID& parent_uuid = NULL_GUID);
+        /// @brief Instantiates the prefab into this scene and returns its root
+        /// entity. Every entity of the instance is given a new GUID. If the
+        /// prefab has a warmed pool in this scene, a parked instance is reused.
+		Entity InstantiatePrefab(std::shared_ptr<Prefab> prefab, GUID parent_guid = NULL_GUID);
+		Entity InstantiatePrefab(std::shared_ptr<Prefab> prefab, const glm::vec3& position, const glm::quat& orientation, GUID parent_guid = NULL_GUID);
+
+        /// @brief Pre-creates instances of the prefab and parks them. Whilst a
+        /// pool exists, destroying the root of one of its instances parks the
+        /// instance again instead of tearing down its components and physics
+        /// actors.
+        void WarmPrefabPool(std::shared_ptr<Prefab> prefab, size_t instance_count);
+
+        /// @brief Destroys every parked instance of the prefab and stops
+        /// recycling its live instances
+        void ClearPrefabPool(AssetHandle prefab_handle);
 
         void DuplicateEntity(const Entity& entity);
 
@@ -58,8 +99,51 @@ namespace BC
         void OnUpdate();
         void OnFixedUpdate();
         void OnLateUpdate();
+
+        /// @brief Recomputes the bounds of every mesh whose transform changed
+        /// this frame and applies them to the spatial index in one batch.
+        /// Called on the main thread once transforms are final for the frame.
+        void UpdateSpatialIndex();
         
-        std::shared_ptr<OctreeBounds<Entity>> GetOctree() { return m_Octree; }
+        std::shared_ptr<SpatialIndex<Entity>> GetSpatialIndex() { return m_SpatialIndex; }
+
+        SpatialIndexType GetSpatialIndexType() const { return m_SpatialIndexType; }
+
+        /// @brief Appends the entities whose bounds the ray passes through
+        /// within max_distance, nearest first. With first_hit_only only the nearest
+        /// is kept and the traversal stops early. These queries take a read
+        /// scope on the spatial index, so they are safe to call from jobs as
+        /// long as the index is not being written to.
+        void Raycast(const Ray& ray, float max_distance, std::vector<SpatialQueryHit<Entity>>& out_hits, bool first_hit_only = false) const;
+        void QuerySegment(const glm::vec3& start, const glm::vec3& end, std::vector<SpatialQueryHit<Entity>>& out_hits, bool first_hit_only = false) const;
+
+        /// @brief Appends up to count entities whose bounds are nearest to
+        /// point and within max_distance of it, nearest first.
+        void QueryNearest(const glm::vec3& point, size_t count, float max_distance, std::vector<SpatialQueryHit<Entity>>& out_hits) const;
+        void QueryRadius(const glm::vec3& point, float radius, std::vector<SpatialQueryHit<Entity>>& out_hits) const;
+
+        /// @brief Appends the entities whose bounds are within the frustum.
+        /// Every query holds the spatial index's mutex shared, so any number
+        /// of render jobs may query at once while the main thread's updates
+        /// wait for them.
+        void QueryFrustum(const Frustum& frustum, std::vector<SpatialDataSource<Entity>>& out_results) const;
+
+        /// @brief Queries several frustums, e.g., the faces of a cube shadow
+        /// map, in one walk of the spatial index. Each entity visible to any
+        /// of them is appended once, with the frustums that see it at the
+        /// same index of out_view_masks.
+        void QueryFrustums(std::span<const Frustum> frustums, std::vector<SpatialDataSource<Entity>>& out_results, std::vector<SpatialIndex<Entity>::ViewMask>& out_view_masks) const;
+
+        /// @brief Appends the sphere and cone lights whose bounds are within
+        /// the frustum. Lights are held in an index of their own, separate
+        /// from the renderable bounds, and locked the same as QueryFrustum.
+        void QueryLights(const Frustum& frustum, std::vector<SpatialDataSource<Entity>>& out_results) const;
+
+        /// @brief Selects the spatial index the scene's renderable bounds are
+        /// held in, rebuilding it if the type changes. The octree suits scenes
+        /// that are mostly dynamic, the BVH suits mostly static scenes and
+        /// ray queries. Must be called on the main thread.
+        void SetSpatialIndexType(SpatialIndexType index_type);
 
         GUID GetSceneID() const { return m_SceneID; }
         const std::string& GetName() const { return m_SceneName; }
@@ -74,6 +158,91 @@ namespace BC
         void Serialise();
         void Deserialise(const std::filesystem::path& scene_file_path);
 
+        /// @brief Writes the given entities to a scene file under the given
+        /// scene ID and name. Parents must be written alongside their
+        /// children for the hierarchy to be linked on load. The built spatial
+        /// index is only written when every entity of the scene is, as it
+        /// would otherwise refer to entities missing from the file.
+        void SerialiseEntities(const std::filesystem::path& out_path, GUID scene_id, const std::string& scene_name, std::span<const entt::entity> entity_handles, bool write_spatial_layout = false);
+
+        /// @brief Decodes the scene file and commits every entity into this
+        /// scene's registry without initialising any components. Touches no
+        /// state outside of this scene, so it is safe to call on a detached
+        /// scene from a worker thread.
+        ///
+        /// With parallel_decode the entities are decoded by jobs the calling
+        /// thread waits on, so it must be false when called from a job.
+        bool DeserialiseEntities(const std::filesystem::path& scene_file_path, bool parallel_decode = true);
+
+        /// @brief Gives every entity a new GUID, held by neither this scene
+        /// nor reserved_scene, and relinks parents by the new GUIDs. Returns
+        /// each old GUID mapped to its new GUID.
+        std::unordered_map<GUID, GUID> ReassignEntityGUIDs(const Scene* reserved_scene = nullptr);
+
+        /// @brief Initialises the components of entities committed by
+        /// DeserialiseEntities, stopping once the budget is exhausted. Must
+        /// be called on the main thread. Returns the amount of entities still
+        /// awaiting integration.
+        size_t IntegrateEntities(const SceneStreamingBudget& budget);
+
+        /// @brief Refreshes transforms and builds the spatial index once every entity
+        /// has been integrated. Requires the scene to be visible to the
+        /// SceneManager as components resolve their hierarchy by GUID.
+        void FinaliseLoad();
+
+        /// @brief Destroys entities of an unloaded scene, stopping once the
+        /// budget is exhausted. Returns true once every entity is released.
+        bool ReleaseEntities(const SceneStreamingBudget& budget);
+
+        float GetIntegrationProgress() const 
+        { 
+            return m_PendingIntegration.empty() ? 1.0f : static_cast<float>(m_PendingIntegrationIndex) / static_cast<float>(m_PendingIntegration.size()); 
+        }
+
+        /// @brief Takes a parked instance from the prefab's pool if one is
+        /// available, otherwise creates the entities, then applies the template
+        Entity InstantiatePrefabInstance(const std::shared_ptr<Prefab>& prefab, const glm::vec3* position, const glm::quat* orientation, GUID parent_guid);
+
+        /// @brief Writes the prefab template onto the instance entities, then
+        /// assigns GUIDs, rebuilds the hierarchy and initialises components.
+        /// Recycled instances keep their physics components and actors.
+        Entity ApplyPrefabInstance(const Prefab& prefab, std::span<const entt::entity> instance_handles, bool recycled, const glm::vec3* position, const glm::quat* orientation, GUID parent_guid);
+
+        /// @brief Unlinks the instance from the scene and parks it. Returns
+        /// false if the instance no longer matches the template, in which
+        /// case it is left untouched and must be destroyed instead.
+        bool ParkPrefabInstance(const Prefab& prefab, std::span<const entt::entity> instance_handles);
+
+        /// @brief Rebuilds the scene's spatial index, of the selected type, in
+        /// a single pass from every mesh renderer currently in the registry
+        void BuildSpatialIndex();
+        void BuildOctree(OctreeBoundsConfig octree_config = {});
+        void BuildBVH(BVHBoundsConfig bvh_config = {});
+
+        /// @brief Restores the spatial index saved with the scene rather than
+        /// building it, then places again only the meshes added or moved since
+        /// the save. Returns false if the layout could not be restored.
+        bool RestoreSpatialIndex(std::span<const uint8_t> spatial_layout);
+
+        /// @brief Replaces m_SpatialIndex with an index built beforehand, 
+        /// holding the old index's lock so no query is within it as it goes
+        void SwapSpatialIndex(std::shared_ptr<SpatialIndex<Entity>> spatial_index);
+
+        /// @brief Bounds of every mesh renderer currently in the registry
+        std::vector<SpatialDataSource<Entity>> GatherSpatialDataSources();
+
+        /// @brief Places every sphere and cone light flagged since the last
+        /// update in the light index, bounded by the union of its lights
+        void UpdateLightIndex();
+
+        /// @brief Entities without a rigidbody or skinned mesh are not expected
+        /// to move, so they are placed in the static tree of a BVH
+        bool IsSpatiallyStatic(entt::entity entity_handle) const;
+
+        /// @brief Inserts the entity's mesh bounds, as static data if the
+        /// entity is spatially static
+        void InsertSpatialData(entt::entity entity_handle, const Bounds_AABB& bounds);
+
         /// @brief This creates a generic default scene
         static std::shared_ptr<Scene> CreateDefaultScene(const std::filesystem::path& scene_file_path);
 
@@ -82,6 +251,13 @@ namespace BC
         /// to provide manual project directory.
         static std::shared_ptr<Scene> LoadScene(const std::filesystem::path& scene_file_path, const std::filesystem::path& project_directory = "");
 
+        /// @brief Same as LoadScene, however the returned scene has only been
+        /// decoded and committed. IntegrateEntities and FinaliseLoad must be
+        /// called on the main thread before it is used. Returns nullptr if
+        /// the file could not be read. Decodes on the calling thread alone,
+        /// as it is meant to be called from a job.
+        static std::shared_ptr<Scene> LoadSceneDetached(const std::filesystem::path& scene_file_path, const std::filesystem::path& project_directory = "");
+
         /// @brief This will copy the source scene and return a dest scene.
         ///
         /// For Physics Components, it will not make copies of the instances,
@@ -104,7 +280,54 @@ namespace BC
         entt::registry m_Registry;
         std::unordered_map<GUID, entt::entity> m_EntityMap = {};
 
-		std::shared_ptr<OctreeBounds<Entity>> m_Octree = nullptr;
+        /// @brief Name lookup accelerator for GetEntity(name). Entries are
+        /// validated against the MetaComponent on lookup as entities can be
+        /// renamed without the scene being notified
+        std::unordered_map<std::string, entt::entity> m_EntityNameMap = {};
+
+        /// @brief Entities committed by DeserialiseEntities whose components
+        /// have not yet been initialised
+        std::vector<entt::entity> m_PendingIntegration = {};
+        size_t m_PendingIntegrationIndex = 0;
+
+        /// @brief Serialised with the scene, selects the type of m_SpatialIndex
+        SpatialIndexType m_SpatialIndexType = SpatialIndexType::Octree;
+
+		std::shared_ptr<SpatialIndex<Entity>> m_SpatialIndex = nullptr;
+
+        /// @brief Bounds of the scene's sphere and cone lights. Always an
+        /// octree, as lights are few and mostly move with their parents
+        std::shared_ptr<SpatialIndex<Entity>> m_LightIndex = nullptr;
+
+        /// @brief Spatial index layout read by DeserialiseEntities, whose hash
+        /// matched, held until FinaliseLoad restores it
+        std::vector<uint8_t> m_PendingSpatialLayout = {};
+
+        /// @brief Scratch buffers of UpdateSpatialIndex, kept between frames
+        /// to avoid reallocating them every frame
+        struct SpatialUpdateBuffers
+        {
+            std::vector<entt::entity> Entities = {};
+            std::vector<glm::mat4> Transforms = {};
+            std::vector<Bounds_AABB> LocalBounds = {};
+            std::vector<Bounds_AABB> WorldBounds = {};
+            std::vector<SpatialDataSource<Entity>> Lights = {};
+        };
+
+        SpatialUpdateBuffers m_SpatialUpdate = {};
+
+        struct PrefabPool
+        {
+            std::shared_ptr<Prefab> Source = nullptr;
+
+            /// @brief Entities of each parked instance, in template node order
+            std::vector<std::vector<entt::entity>> ParkedInstances = {};
+
+            /// @brief Entities of each live instance keyed by its root entity
+            std::unordered_map<entt::entity, std::vector<entt::entity>> LiveInstances = {};
+        };
+
+        std::unordered_map<AssetHandle, PrefabPool> m_PrefabPools = {};
 
         /// @brief Used as a dirty flag to indicate to Editor's Hierarchy Panel if the state of the hierarchy has changed and its references will need to change
         std::atomic<bool> m_HierarchyChangedThisFrame = false;
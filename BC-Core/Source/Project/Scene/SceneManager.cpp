@@ -3,6 +3,7 @@
 
 // Core Headers
 #include "Asset/AssetManagerAPI.h"
+#include "Asset/Assets/Prefab.h"
 #include "Graphics/Renderer/SceneRenderer.h"
 
 #include "Util/Hash.h"
@@ -101,6 +102,76 @@ namespace BC
         entity.Destroy();
     }
 
+    namespace
+    {
+        /// @brief Sorts hits merged from several scenes nearest first and
+        /// keeps the nearest count of them.
+        void SortAndTrimHits(std::vector<SpatialQueryHit<Entity>>& hits, size_t count)
+        {
+            std::sort(hits.begin(), hits.end(), [](const SpatialQueryHit<Entity>& a, const SpatialQueryHit<Entity>& b) { return a.Distance < b.Distance; });
+            if (hits.size() > count)
+                hits.resize(count);
+        }
+    }
+
+    void SceneManager::Raycast(const Ray& ray, float max_distance, std::vector<SpatialQueryHit<Entity>>& out_hits, bool first_hit_only) const
+    {
+        out_hits.clear();
+        for(auto [scene_id, scene] : m_SceneInstances)
+            scene->Raycast(ray, max_distance, out_hits, first_hit_only);
+
+        SortAndTrimHits(out_hits, first_hit_only ? 1 : out_hits.size());
+    }
+
+    void SceneManager::QuerySegment(const glm::vec3& start, const glm::vec3& end, std::vector<SpatialQueryHit<Entity>>& out_hits, bool first_hit_only) const
+    {
+        out_hits.clear();
+        for(auto [scene_id, scene] : m_SceneInstances)
+            scene->QuerySegment(start, end, out_hits, first_hit_only);
+
+        SortAndTrimHits(out_hits, first_hit_only ? 1 : out_hits.size());
+    }
+
+    void SceneManager::QueryNearest(const glm::vec3& point, size_t count, float max_distance, std::vector<SpatialQueryHit<Entity>>& out_hits) const
+    {
+        out_hits.clear();
+        for(auto [scene_id, scene] : m_SceneInstances)
+            scene->QueryNearest(point, count, max_distance, out_hits);
+
+        SortAndTrimHits(out_hits, count);
+    }
+
+    void SceneManager::QueryRadius(const glm::vec3& point, float radius, std::vector<SpatialQueryHit<Entity>>& out_hits) const
+    {
+        out_hits.clear();
+        for(auto [scene_id, scene] : m_SceneInstances)
+            scene->QueryRadius(point, radius, out_hits);
+
+        SortAndTrimHits(out_hits, out_hits.size());
+    }
+
+    void SceneManager::QueryFrustum(const Frustum& frustum, std::vector<SpatialDataSource<Entity>>& out_results) const
+    {
+        out_results.clear();
+        for(auto [scene_id, scene] : m_SceneInstances)
+            scene->QueryFrustum(frustum, out_results);
+    }
+
+    void SceneManager::QueryFrustums(std::span<const Frustum> frustums, std::vector<SpatialDataSource<Entity>>& out_results, std::vector<SpatialIndex<Entity>::ViewMask>& out_view_masks) const
+    {
+        out_results.clear();
+        out_view_masks.clear();
+        for(auto [scene_id, scene] : m_SceneInstances)
+            scene->QueryFrustums(frustums, out_results, out_view_masks);
+    }
+
+    void SceneManager::QueryLights(const Frustum& frustum, std::vector<SpatialDataSource<Entity>>& out_results) const
+    {
+        out_results.clear();
+        for(auto [scene_id, scene] : m_SceneInstances)
+            scene->QueryLights(frustum, out_results);
+    }
+
     void SceneManager::OnStart()
     {
     }
@@ -190,82 +261,78 @@ namespace BC
         }
     }
 
-    void SceneManager::OnStartPhysics()
+    namespace Util
     {
-        m_PhysicsSystem = std::make_unique<PhysicsSystem>();
-        m_PhysicsSystem->Init();
-
-        std::unordered_set<Entity> physics_entities = {};
-
-        for (auto&& e : GetAllEntitiesWithComponent<RigidbodyComponent>())                  physics_entities.insert(e);
-        for (auto&& e : GetAllEntitiesWithComponent<BoxColliderComponent>())                physics_entities.insert(e);
-        for (auto&& e : GetAllEntitiesWithComponent<SphereColliderComponent>())             physics_entities.insert(e);
-        for (auto&& e : GetAllEntitiesWithComponent<CapsuleColliderComponent>())            physics_entities.insert(e);
-        for (auto&& e : GetAllEntitiesWithComponent<ConvexMeshColliderComponent>())         physics_entities.insert(e);
-        for (auto&& e : GetAllEntitiesWithComponent<HeightFieldColliderComponent>())        physics_entities.insert(e);
-        for (auto&& e : GetAllEntitiesWithComponent<TriangleMeshColliderComponent>())       physics_entities.insert(e);
-
-		for (const auto& entity : physics_entities)
+        /// @brief Physics components in initialisation order, rigidbodies come
+        /// first so colliders can attach to their actor
+        using PhysicsInitOrder = ComponentGroup<
+            RigidbodyComponent, 
+            BoxColliderComponent, 
+            SphereColliderComponent, 
+            CapsuleColliderComponent, 
+            ConvexMeshColliderComponent, 
+            HeightFieldColliderComponent, 
+            TriangleMeshColliderComponent
+        >;
+
+        /// @brief Physics components in shutdown order, colliders are detached
+        /// before their actor is released
+        using PhysicsShutdownOrder = ComponentGroup<
+            TriangleMeshColliderComponent, 
+            HeightFieldColliderComponent, 
+            ConvexMeshColliderComponent, 
+            CapsuleColliderComponent, 
+            SphereColliderComponent, 
+            BoxColliderComponent, 
+            RigidbodyComponent
+        >;
+
+        template<typename... Component>
+        static void InitComponentStorages(ComponentGroup<Component...>, entt::registry& registry)
         {
-			if (auto component = entity.TryGetComponent<RigidbodyComponent>(); component)
-				component->Init();
-
-			if (auto component = entity.TryGetComponent<BoxColliderComponent>(); component)
-				component->Init();
+            ([&]()
+                {
+                    for (auto [entity_handle, component] : registry.storage<Component>().each())
+                        component.Init();
+                }(), ...);
+        }
 
-			if (auto component = entity.TryGetComponent<SphereColliderComponent>(); component)
-				component->Init();
+        template<typename... Component>
+        static void ShutdownComponentStorages(ComponentGroup<Component...>, entt::registry& registry)
+        {
+            ([&]()
+                {
+                    for (auto [entity_handle, component] : registry.storage<Component>().each())
+                        component.Shutdown();
+                }(), ...);
+        }
+    }
 
-			if (auto component = entity.TryGetComponent<CapsuleColliderComponent>(); component)
-				component->Init();
+    void SceneManager::OnStartPhysics()
+    {
+        BC_PROFILE_SCOPE("SceneManager::OnStartPhysics");
 
-			if (auto component = entity.TryGetComponent<ConvexMeshColliderComponent>(); component)
-				component->Init();
+        m_PhysicsSystem = std::make_unique<PhysicsSystem>();
+        m_PhysicsSystem->Init();
 
-			if (auto component = entity.TryGetComponent<HeightFieldColliderComponent>(); component)
-				component->Init();
+        // Actors are created in one batch per component storage rather than
+        // gathering and hashing every physics entity first
+        for (auto& [scene_id, scene] : m_SceneInstances)
+        {
+            if (scene)
+                Util::InitComponentStorages(Util::PhysicsInitOrder{}, scene->m_Registry);
+        }
 
-			if (auto component = entity.TryGetComponent<TriangleMeshColliderComponent>(); component)
-				component->Init();
-		}
         m_PhysicsSystem->OnUpdate();
     }
 
     void SceneManager::OnStopPhysics()
     {
-        std::unordered_set<Entity> physics_entities = {};
-
-        for (auto&& e : GetAllEntitiesWithComponent<RigidbodyComponent>())              physics_entities.insert(e);
-        for (auto&& e : GetAllEntitiesWithComponent<BoxColliderComponent>())            physics_entities.insert(e);
-        for (auto&& e : GetAllEntitiesWithComponent<SphereColliderComponent>())         physics_entities.insert(e);
-        for (auto&& e : GetAllEntitiesWithComponent<CapsuleColliderComponent>())        physics_entities.insert(e);
-        for (auto&& e : GetAllEntitiesWithComponent<ConvexMeshColliderComponent>())     physics_entities.insert(e);
-        for (auto&& e : GetAllEntitiesWithComponent<HeightFieldColliderComponent>())    physics_entities.insert(e);
-        for (auto&& e : GetAllEntitiesWithComponent<TriangleMeshColliderComponent>())   physics_entities.insert(e);
-
-		for (const auto& entity : physics_entities) 
+        for (auto& [scene_id, scene] : m_SceneInstances)
         {
-			if (entity.HasComponent<RigidbodyComponent>())
-				entity.GetComponent<RigidbodyComponent>().Shutdown();
-
-			if (entity.HasComponent<BoxColliderComponent>())
-				entity.GetComponent<BoxColliderComponent>().Shutdown();
-
-			if (entity.HasComponent<SphereColliderComponent>())
-				entity.GetComponent<SphereColliderComponent>().Shutdown();
-
-			if (entity.HasComponent<CapsuleColliderComponent>())
-				entity.GetComponent<CapsuleColliderComponent>().Shutdown();
-
-			if (entity.HasComponent<ConvexMeshColliderComponent>())
-				entity.GetComponent<ConvexMeshColliderComponent>().Shutdown();
-
-			if (entity.HasComponent<HeightFieldColliderComponent>())
-				entity.GetComponent<HeightFieldColliderComponent>().Shutdown();
-
-			if (entity.HasComponent<TriangleMeshColliderComponent>())
-				entity.GetComponent<TriangleMeshColliderComponent>().Shutdown(); 
-		}
+            if (scene)
+                Util::ShutdownComponentStorages(Util::PhysicsShutdownOrder{}, scene->m_Registry);
+        }
 
         if (m_PhysicsSystem)
         {
@@ -279,6 +346,10 @@ namespace BC
     {
         BC_PROFILE_SCOPE("SceneManager::OnUpdate: On Update Loop");
 
+        // Streaming continues in edit mode and whilst paused
+        OnUpdateWorldPartition();
+        OnUpdateStreaming();
+
         if (m_IsPaused)
             return;
 
@@ -318,16 +389,21 @@ namespace BC
     {
         BC_PROFILE_SCOPE("SceneManager::OnLateUpdate: On Late Update Loop");
 
-        if (m_IsPaused)
-            return;
-
-        if (!m_IsRunning && !m_IsSimulating)
-            return;
+        if (!m_IsPaused && (m_IsRunning || m_IsSimulating))
+        {
+            for(auto [scene_id, scene] : m_SceneInstances)
+            {
+                if (!scene) continue;
+                scene->OnLateUpdate();
+            }
+        }
 
+        // Transforms are final for the frame. Runs in edit mode and whilst
+        // paused too, as the editor moves entities outside of play
         for(auto [scene_id, scene] : m_SceneInstances)
         {
             if (!scene) continue;
-            scene->OnLateUpdate();
+            scene->UpdateSpatialIndex();
         }
     }
 
@@ -344,17 +420,17 @@ namespace BC
         BC_CORE_WARN("SceneManager::LoadScene: Could Not Find Scene Name: '{}'", scene_name);
     }
 
-    void SceneManager::LoadSceneAsync(const std::string &scene_name, bool additive)
+    std::shared_ptr<SceneStreamOperation> SceneManager::LoadSceneAsync(const std::string &scene_name, bool additive)
     {
         for (const auto& [scene_id, scene_path] : m_SceneFilePaths)
         {
             if (scene_name == scene_path.stem().string())
             {
-                LoadSceneAsync(scene_id, additive);
-                return;
+                return LoadSceneAsync(scene_id, additive);
             }
         }
         BC_CORE_WARN("SceneManager::LoadSceneAsync: Could Not Find Scene Name: '{}'", scene_name);
+        return nullptr;
     }
 
     void SceneManager::LoadScene(GUID scene_guid, bool additive, const std::filesystem::path &project_directory)
@@ -372,18 +448,19 @@ namespace BC
         Application::Get()->SubmitToMainThread([&, additive, scene_guid, project_directory]()
         {
             if (!additive)
-                m_SceneInstances.clear();
+                ReleaseAllScenes();
 
+            Application::Get()->WaitForSceneSnapshot();
             m_SceneInstances[scene_guid] = Scene::LoadScene(m_SceneFilePaths[scene_guid], project_directory);
             m_SceneInstances[scene_guid]->m_SceneID = scene_guid;
         });
     }
     
-    void SceneManager::LoadSceneAsync(GUID scene_guid, bool additive, const std::filesystem::path& project_directory)
+    std::shared_ptr<SceneStreamOperation> SceneManager::LoadSceneAsync(GUID scene_guid, bool additive, const std::filesystem::path& project_directory)
     {
         // Don't load if doesn't exist in templates OR if already loaded
         if (!m_SceneFilePaths.contains(scene_guid) || m_SceneInstances.contains(scene_guid))
-            return;
+            return nullptr;
         
         BC_ASSERT
         (
@@ -391,24 +468,7 @@ namespace BC
             "SceneManager::LoadSceneAsync: SceneManager Cached ID Mismatch With Runtime Hash of Scene File Path."
         );
         
-        Application::Get()->SubmitToMainThread([&, additive, scene_guid, project_directory]()
-        {
-            if (!additive)
-                m_SceneInstances.clear();
-            
-            Application::GetJobSystem()->SubmitJob
-            (
-                "SceneManager::LoadSceneAsync",
-                [&, scene_guid, project_directory]()
-                {
-                    m_SceneInstances[scene_guid] = Scene::LoadScene(m_SceneFilePaths[scene_guid], project_directory);
-                    m_SceneInstances[scene_guid]->m_SceneID = scene_guid;
-                },
-                nullptr,
-                JobPriority::Medium,
-                false
-            );
-        });
+        return StreamScene(scene_guid, m_SceneFilePaths[scene_guid], additive, project_directory);
     }
 
     void SceneManager::LoadSceneNoAdd(const std::filesystem::path &scene_file_path, bool additive)
@@ -420,37 +480,21 @@ namespace BC
         Application::Get()->SubmitToMainThread([&, additive, scene_guid, scene_file_path]()
         {
             if (!additive)
-                m_SceneInstances.clear();
+                ReleaseAllScenes();
 
+            Application::Get()->WaitForSceneSnapshot();
             m_SceneInstances[scene_guid] = Scene::LoadScene(scene_file_path, Application::GetProject()->GetDirectory());
             m_SceneInstances[scene_guid]->m_SceneID = scene_guid;
         });
     }
 
-    void SceneManager::LoadSceneAsyncNoAdd(const std::filesystem::path &scene_file_path, bool additive)
+    std::shared_ptr<SceneStreamOperation> SceneManager::LoadSceneAsyncNoAdd(const std::filesystem::path &scene_file_path, bool additive)
     {
         GUID scene_guid = Util::HashStringInsensitive(Util::NormaliseFilePathToString(scene_file_path));
         if (m_SceneInstances.contains(scene_guid)) // Do Not Reload
-            return;
-
-        Application::Get()->SubmitToMainThread([&, additive, scene_guid, scene_file_path]()
-        {
-            if (!additive)
-                m_SceneInstances.clear();
+            return nullptr;
 
-            Application::GetJobSystem()->SubmitJob
-            (
-                "SceneManager::LoadSceneAsync",
-                [&, scene_guid, scene_file_path]()
-                {
-                    m_SceneInstances[scene_guid] = Scene::LoadScene(scene_file_path, Application::GetProject()->GetDirectory());
-                    m_SceneInstances[scene_guid]->m_SceneID = scene_guid;
-                },
-                nullptr,
-                JobPriority::Medium,
-                false
-            );
-        });
+        return StreamScene(scene_guid, scene_file_path, additive, Application::GetProject()->GetDirectory());
     }
 
     void SceneManager::AddSceneTemplate(std::shared_ptr<Scene> scene)
@@ -461,6 +505,7 @@ namespace BC
         if (scene->m_SceneFilePath.extension() != ".scene")
             scene->m_SceneFilePath.replace_extension(".scene");
 
+        Application::Get()->WaitForSceneSnapshot();
         m_SceneInstances[scene->m_SceneID] = scene;
         m_SceneFilePaths[scene->m_SceneID] = scene->m_SceneFilePath;
     }
@@ -520,7 +565,7 @@ namespace BC
 
         Application::Get()->SubmitToMainThread([&, scene_guid]()
         {
-            m_SceneInstances.erase(scene_guid);
+            ReleaseScene(scene_guid);
         });
     }
 
@@ -532,13 +577,459 @@ namespace BC
             {
                 Application::Get()->SubmitToMainThread([&, scene_id]()
                 {
-                    m_SceneInstances.erase(scene_id);
+                    ReleaseScene(scene_id);
                 });
                 return;
             }
         }
     }
 
+#pragma region Scene Streaming
+
+    void SceneStreamOperation::OnComplete(const std::function<void(std::shared_ptr<Scene>)>& callback)
+    {
+        {
+            std::scoped_lock<std::mutex> lock(m_CallbackMutex);
+            if (!IsDone())
+            {
+                m_CompletionCallbacks.push_back(callback);
+                return;
+            }
+        }
+
+        callback(m_PublishedScene.lock());
+    }
+
+    void SceneStreamOperation::Finish(SceneStreamState state, std::shared_ptr<Scene> scene)
+    {
+        std::vector<std::function<void(std::shared_ptr<Scene>)>> callbacks;
+        {
+            std::scoped_lock<std::mutex> lock(m_CallbackMutex);
+
+            // The handle must not keep an unloaded scene alive, so only a weak
+            // reference to the published scene is retained
+            m_Scene.reset();
+            if (state == SceneStreamState::Complete)
+            {
+                m_PublishedScene = scene;
+                m_Progress.store(1.0f);
+            }
+            m_State.store(state);
+
+            callbacks.swap(m_CompletionCallbacks);
+        }
+
+        for (const auto& callback : callbacks)
+            callback(state == SceneStreamState::Complete ? scene : nullptr);
+    }
+
+    std::shared_ptr<SceneStreamOperation> SceneManager::StreamScene(GUID scene_guid, const std::filesystem::path& scene_file_path, bool additive, const std::filesystem::path& project_directory)
+    {
+        auto operation = std::make_shared<SceneStreamOperation>(scene_guid, additive);
+
+        Application::Get()->SubmitToMainThread([&, operation, scene_file_path, project_directory]()
+        {
+            bool already_streaming = std::any_of(m_StreamOperations.begin(), m_StreamOperations.end(), [&](const auto& other) { return other->GetSceneID() == operation->GetSceneID(); });
+            if (already_streaming || m_SceneInstances.contains(operation->GetSceneID()))
+            {
+                BC_CORE_WARN("SceneManager::StreamScene: Scene '{}' Is Already Loaded or Streaming.", scene_file_path.stem().string());
+                operation->Finish(SceneStreamState::Failed, nullptr);
+                return;
+            }
+
+            m_StreamOperations.push_back(operation);
+
+            // The job only ever touches the detached scene and the operation,
+            // the SceneManager containers are left to the main thread. It is
+            // persistent as a large scene may take several frames to decode.
+            Application::GetJobSystem()->SubmitJob
+            (
+                "SceneManager::StreamScene: Decode Scene",
+                [operation, scene_file_path, project_directory]()
+                {
+                    if (operation->IsCancelRequested())
+                        return;
+
+                    std::shared_ptr<Scene> scene = Scene::LoadSceneDetached(scene_file_path, project_directory);
+                    if (scene)
+                        scene->m_SceneID = operation->GetSceneID();
+
+                    // Published under the callback mutex, which Finish holds
+                    // while it drops m_Scene. The scene is written before the
+                    // state so the main thread never sees Integrating without
+                    // it. If cancelled whilst decoding, the scene has never
+                    // been integrated so it is safe to let it destruct here.
+                    {
+                        std::scoped_lock<std::mutex> lock(operation->m_CallbackMutex);
+
+                        operation->m_Scene = scene;
+                        operation->m_Progress.store(0.5f);
+
+                        SceneStreamState expected = SceneStreamState::Loading;
+                        if (!operation->m_State.compare_exchange_strong(expected, SceneStreamState::Integrating))
+                            operation->m_Scene.reset();
+                    }
+                },
+                nullptr,
+                JobPriority::Low,
+                true
+            );
+        });
+
+        return operation;
+    }
+
+    void SceneManager::OnUpdateStreaming()
+    {
+        if (m_StreamOperations.empty() && m_ScenesPendingRelease.empty())
+            return;
+
+        BC_PROFILE_SCOPE("SceneManager::OnUpdateStreaming");
+
+        // 1. Advance in-flight loads. Only one scene is integrated per frame
+        //    so the frame budget holds regardless of how many are in flight
+        bool integrated_this_frame = false;
+
+        for (auto it = m_StreamOperations.begin(); it != m_StreamOperations.end();)
+        {
+            std::shared_ptr<SceneStreamOperation> operation = *it;
+
+            if (operation->IsCancelRequested())
+            {
+                SceneStreamState expected = SceneStreamState::Loading;
+                if (operation->m_State.compare_exchange_strong(expected, SceneStreamState::Cancelled))
+                {
+                    // Decode job still running, it will drop the scene itself
+                    operation->Finish(SceneStreamState::Cancelled, nullptr);
+                }
+                else
+                {
+                    // Partially integrated components must be shut down on
+                    // the main thread so hand the scene to the release queue
+                    if (operation->m_Scene)
+                        m_ScenesPendingRelease.push_back(std::move(operation->m_Scene));
+                    operation->Finish(SceneStreamState::Cancelled, nullptr);
+                }
+
+                it = m_StreamOperations.erase(it);
+                continue;
+            }
+
+            if (operation->GetState() != SceneStreamState::Integrating || integrated_this_frame)
+            {
+                ++it;
+                continue;
+            }
+
+            std::shared_ptr<Scene> scene = operation->m_Scene;
+            if (!scene)
+            {
+                BC_CORE_ERROR("SceneManager::OnUpdateStreaming: Failed to Load Scene {}.", static_cast<uint64_t>(operation->GetSceneID()));
+                operation->Finish(SceneStreamState::Failed, nullptr);
+                it = m_StreamOperations.erase(it);
+                continue;
+            }
+
+            integrated_this_frame = true;
+
+            size_t remaining = scene->IntegrateEntities(m_StreamingBudget);
+            operation->m_Progress.store(0.5f + 0.49f * scene->GetIntegrationProgress());
+
+            if (remaining != 0)
+            {
+                ++it;
+                continue;
+            }
+
+            // 2. Publish. The scene becomes visible and, for non-additive
+            //    loads, the previous scenes disappear within the same frame.
+            //    Not before this frame's snapshot has stopped reading them.
+            Application::Get()->WaitForSceneSnapshot();
+
+            if (m_SceneInstances.contains(operation->GetSceneID()))
+            {
+                BC_CORE_WARN("SceneManager::OnUpdateStreaming: Scene {} Was Loaded Whilst Streaming - Discarding Streamed Copy.", static_cast<uint64_t>(operation->GetSceneID()));
+                m_ScenesPendingRelease.push_back(std::move(operation->m_Scene));
+                operation->Finish(SceneStreamState::Failed, nullptr);
+                it = m_StreamOperations.erase(it);
+                continue;
+            }
+
+            if (!operation->IsAdditive())
+            {
+                ReleaseAllScenes();
+                m_ActiveScene = operation->GetSceneID();
+            }
+
+            m_SceneInstances[operation->GetSceneID()] = scene;
+            scene->FinaliseLoad();
+
+            it = m_StreamOperations.erase(it);
+            operation->Finish(SceneStreamState::Complete, scene);
+        }
+
+        // 3. Release unloaded scenes, oldest first, under the same budget
+        if (!m_ScenesPendingRelease.empty() && m_ScenesPendingRelease.front()->ReleaseEntities(m_StreamingBudget))
+            m_ScenesPendingRelease.erase(m_ScenesPendingRelease.begin());
+    }
+
+    void SceneManager::ReleaseScene(GUID scene_guid)
+    {
+        auto it = m_SceneInstances.find(scene_guid);
+        if (it == m_SceneInstances.end())
+            return;
+
+        Application::Get()->WaitForSceneSnapshot();
+
+        if (it->second)
+            m_ScenesPendingRelease.push_back(std::move(it->second));
+        
+        m_SceneInstances.erase(it);
+    }
+
+    void SceneManager::ReleaseAllScenes()
+    {
+        Application::Get()->WaitForSceneSnapshot();
+
+        for (auto& [scene_id, scene] : m_SceneInstances)
+        {
+            if (scene)
+                m_ScenesPendingRelease.push_back(std::move(scene));
+        }
+
+        m_SceneInstances.clear();
+    }
+
+#pragma endregion
+
+#pragma region World Partition
+
+    bool SceneManager::PartitionScene(GUID scene_guid, const WorldPartitionConfig& config)
+    {
+        BC_PROFILE_SCOPE("SceneManager::PartitionScene");
+
+        auto scene_it = m_SceneInstances.find(scene_guid);
+        if (scene_it == m_SceneInstances.end() || !scene_it->second)
+        {
+            BC_CORE_WARN("SceneManager::PartitionScene: Cannot Partition Scene {} - Scene Is Not Loaded.", static_cast<uint64_t>(scene_guid));
+            return false;
+        }
+
+        Scene* scene = scene_it->second.get();
+        auto partition = std::make_unique<WorldPartition>(config);
+        partition->SetSourceSceneID(scene_guid);
+
+        // 1. Assign each root to the cell containing it, its descendants
+        //    follow so a hierarchy is never split across cells
+        std::unordered_map<WorldCellCoord, std::vector<entt::entity>> cell_entities;
+        for (auto [entity_handle, relationship] : scene->m_Registry.storage<RelationshipComponent>().each())
+        {
+            if (relationship.Parent != entt::null || scene->m_Registry.all_of<PrefabPoolParked>(entity_handle))
+                continue;
+
+            Entity root_entity = { entity_handle, scene };
+
+            auto& handles = cell_entities[partition->GetCellCoord(root_entity.GetTransform().GetGlobalPosition())];
+            handles.push_back(entity_handle);
+
+            auto descendants = root_entity.GetDescendants();
+            for (auto it = descendants.begin(); it != descendants.end(); ++it)
+                handles.push_back(it.GetEntityHandle());
+        }
+
+        // 2. Cells are written from a copy of the scene whose entities are
+        //    given new GUIDs, so a streamed cell never holds a GUID the loaded
+        //    source scene still does and the source scene is left untouched
+        std::shared_ptr<Scene> cell_source_scene = Scene::CopyScene(scene_it->second);
+        std::unordered_map<GUID, GUID> cell_entity_guids = cell_source_scene->ReassignEntityGUIDs(scene);
+
+        // 3. Write every cell to its own scene file
+        const std::filesystem::path& project_directory = Application::GetProject()->GetDirectory();
+        std::filesystem::path cell_directory = scene->m_SceneFilePath.parent_path() / (scene->m_SceneFilePath.stem().string() + " Cells");
+
+        std::vector<entt::entity> cell_handles;
+        for (const auto& [coord, handles] : cell_entities)
+        {
+            std::filesystem::path cell_path = cell_directory / ("Cell_" + std::to_string(coord.X) + "_" + std::to_string(coord.Y) + "_" + std::to_string(coord.Z) + ".scene");
+            std::filesystem::path out_path = project_directory / "Scenes" / cell_path;
+
+            cell_handles.clear();
+            for (entt::entity entity_handle : handles)
+            {
+                auto guid_it = cell_entity_guids.find(scene->m_Registry.get<MetaComponent>(entity_handle).GetEntityGUID());
+                if (guid_it == cell_entity_guids.end())
+                    continue;
+
+                if (auto entity_it = cell_source_scene->m_EntityMap.find(guid_it->second); entity_it != cell_source_scene->m_EntityMap.end())
+                    cell_handles.push_back(entity_it->second);
+            }
+
+            GUID cell_scene_id = Util::HashStringInsensitive(Util::NormaliseFilePathToString(cell_path));
+            cell_source_scene->SerialiseEntities(out_path, cell_scene_id, cell_path.stem().string(), cell_handles);
+
+            std::error_code error_code;
+            uintmax_t file_size = std::filesystem::file_size(out_path, error_code);
+            partition->AddCell(coord, cell_path, error_code ? 0 : static_cast<uint64_t>(file_size));
+        }
+
+        partition->SetCellEntityGUIDs(std::move(cell_entity_guids));
+
+        ClearWorldPartition();
+        m_WorldPartition = std::move(partition);
+
+        return true;
+    }
+
+    void SceneManager::ClearWorldPartition()
+    {
+        if (!m_WorldPartition)
+            return;
+
+        for (auto& [coord, cell] : m_WorldPartition->m_Cells)
+        {
+            if (cell.Operation)
+                cell.Operation->Cancel();
+
+            if (cell.State == WorldCellState::Loaded)
+                ReleaseScene(cell.SceneID);
+        }
+
+        m_WorldPartition.reset();
+    }
+
+    void SceneManager::OnUpdateWorldPartition()
+    {
+        if (!m_WorldPartition || !m_WorldPartition->IsStreamingEnabled())
+            return;
+
+        BC_PROFILE_SCOPE("SceneManager::OnUpdateWorldPartition");
+
+        WorldPartition& partition = *m_WorldPartition;
+        const WorldPartitionConfig& config = partition.GetConfig();
+
+        // 1. Pick up finished loads and cells loaded or unloaded by other
+        //    means, e.g., a non-additive scene load
+        for (auto& [coord, cell] : partition.m_Cells)
+        {
+            if (cell.State == WorldCellState::Loading && cell.Operation && cell.Operation->IsDone())
+            {
+                bool published = cell.Operation->GetState() == SceneStreamState::Complete && m_SceneInstances.contains(cell.SceneID);
+                cell.State = published ? WorldCellState::Loaded : WorldCellState::Unloaded;
+                cell.Operation = nullptr;
+            }
+            else if (cell.State != WorldCellState::Loading)
+            {
+                cell.State = m_SceneInstances.contains(cell.SceneID) ? WorldCellState::Loaded : WorldCellState::Unloaded;
+            }
+        }
+
+        // 2. Gather streaming sources. Without any, the loaded set is kept
+        //    as is rather than unloading the whole world
+        std::vector<glm::vec3> source_positions = std::move(partition.m_TransientSources);
+        partition.m_TransientSources.clear();
+
+        for (GUID source_guid : partition.m_SourceEntities)
+        {
+            if (Entity source_entity = GetEntity(source_guid); source_entity)
+                source_positions.push_back(source_entity.GetTransform().GetGlobalPosition());
+        }
+
+        if (config.StreamFromCameras)
+        {
+            for (const auto& camera_entity : GetAllEntitiesWithComponent<CameraComponent>())
+                source_positions.push_back(camera_entity.GetTransform().GetGlobalPosition());
+        }
+
+        if (source_positions.empty())
+            return;
+
+        // 3. Unload cells beyond the unload radius and collect the rest
+        struct CellDistance
+        {
+            WorldCell* Cell = nullptr;
+            float Distance = 0.0f;
+        };
+
+        std::vector<CellDistance> load_candidates;
+        std::vector<CellDistance> resident_cells;
+
+        uint64_t resident_file_bytes = 0;
+        uint32_t loads_in_flight = 0;
+
+        for (auto& [coord, cell] : partition.m_Cells)
+        {
+            float distance = std::numeric_limits<float>::max();
+            for (const auto& position : source_positions)
+                distance = std::min(distance, partition.GetDistanceToCell(position, coord));
+
+            if (cell.State == WorldCellState::Unloaded)
+            {
+                if (distance <= config.LoadRadius)
+                    load_candidates.push_back({ &cell, distance });
+                continue;
+            }
+
+            if (distance > config.UnloadRadius)
+            {
+                if (cell.State == WorldCellState::Loading)
+                    cell.Operation->Cancel();
+                else
+                    ReleaseScene(cell.SceneID);
+
+                cell.State = WorldCellState::Unloaded;
+                cell.Operation = nullptr;
+                continue;
+            }
+
+            resident_file_bytes += cell.FileBytes;
+
+            if (cell.State == WorldCellState::Loading)
+                loads_in_flight++;
+            else
+                resident_cells.push_back({ &cell, distance });
+        }
+
+        if (load_candidates.empty())
+            return;
+
+        // 4. Request the nearest cells first. Over the cell file budget, loaded
+        //    cells further away than the candidate are evicted to make room
+        std::sort(load_candidates.begin(), load_candidates.end(), [](const CellDistance& a, const CellDistance& b) { return a.Distance < b.Distance; });
+        std::sort(resident_cells.begin(), resident_cells.end(), [](const CellDistance& a, const CellDistance& b) { return a.Distance > b.Distance; });
+
+        size_t next_eviction = 0;
+
+        for (const auto& candidate : load_candidates)
+        {
+            if (config.MaxConcurrentLoads != 0 && loads_in_flight >= config.MaxConcurrentLoads)
+                break;
+
+            WorldCell& cell = *candidate.Cell;
+
+            if (config.CellFileBudgetBytes != 0)
+            {
+                while (resident_file_bytes + cell.FileBytes > config.CellFileBudgetBytes && next_eviction < resident_cells.size() && resident_cells[next_eviction].Distance > candidate.Distance)
+                {
+                    WorldCell& evicted_cell = *resident_cells[next_eviction++].Cell;
+                    ReleaseScene(evicted_cell.SceneID);
+                    evicted_cell.State = WorldCellState::Unloaded;
+                    resident_file_bytes -= evicted_cell.FileBytes;
+                }
+
+                if (resident_file_bytes + cell.FileBytes > config.CellFileBudgetBytes)
+                    break;
+            }
+
+            cell.Operation = StreamScene(cell.SceneID, cell.FilePath, true, Application::GetProject()->GetDirectory());
+            cell.State = WorldCellState::Loading;
+
+            resident_file_bytes += cell.FileBytes;
+            loads_in_flight++;
+        }
+    }
+
+#pragma endregion
+
     std::shared_ptr<Scene> SceneManager::GetActiveScene()
     {
         // Populate scene file paths from loaded instances if needed
@@ -613,6 +1104,9 @@ namespace BC
                 out << YAML::EndMap;
             }
             out << YAML::EndSeq;
+
+            if (m_WorldPartition)
+                m_WorldPartition->Serialise(out);
         }
         out << YAML::EndMap;
     }
@@ -623,6 +1117,12 @@ namespace BC
             m_EntryScene = data["Entry Scene"].as<uint64_t>();
 
         m_ActiveScene = m_EntryScene;
+
+        if (data["World Partition"])
+        {
+            m_WorldPartition = std::make_unique<WorldPartition>();
+            m_WorldPartition->Deserialise(data["World Partition"]);
+        }
         
         if (!data["Scenes"])
             return;
@@ -5,6 +5,7 @@
 
 #include "Scene.h"
 #include "Entity.h"
+#include "WorldPartition.h"
 
 #include "Physics/PhysicsSystem.h"
 
@@ -12,6 +13,9 @@
 #include <memory>
 #include <filesystem>
 #include <unordered_map>
+#include <functional>
+#include <atomic>
+#include <mutex>
 
 // External Vendor Library Headers
 
@@ -33,6 +37,79 @@ namespace BC
 
     class CollisionCallback;
 
+    enum class SceneStreamState : uint8_t
+    {
+        /// @brief Scene file is being decoded on a worker thread
+        Loading,
+
+        /// @brief Components are being initialised on the main thread under
+        /// the SceneManager streaming budget
+        Integrating,
+
+        /// @brief Scene has been published into the SceneManager
+        Complete,
+
+        Cancelled,
+        Failed
+    };
+
+    /// @brief Handle to an asynchronous scene load. Returned by
+    /// SceneManager::LoadSceneAsync and safe to query from any thread.
+    class SceneStreamOperation
+    {
+
+    public:
+
+        SceneStreamOperation(GUID scene_guid, bool additive) : m_SceneID(scene_guid), m_Additive(additive) { }
+
+        GUID GetSceneID() const { return m_SceneID; }
+        bool IsAdditive() const { return m_Additive; }
+
+        SceneStreamState GetState() const { return m_State.load(); }
+
+        /// @brief Progress of the load in the range [0, 1]
+        float GetProgress() const { return m_Progress.load(); }
+
+        bool IsDone() const 
+        { 
+            SceneStreamState state = m_State.load();
+            return state == SceneStreamState::Complete || state == SceneStreamState::Cancelled || state == SceneStreamState::Failed; 
+        }
+
+        /// @brief Requests the load be abandoned. Has no effect once the scene
+        /// has been published.
+        void Cancel() { m_CancelRequested.store(true); }
+        bool IsCancelRequested() const { return m_CancelRequested.load(); }
+
+        /// @brief Registers a callback invoked on the main thread when the
+        /// operation finishes. The scene is nullptr if the load was cancelled
+        /// or failed. Invoked immediately if the operation is already done.
+        void OnComplete(const std::function<void(std::shared_ptr<Scene>)>& callback);
+
+    private:
+
+        void Finish(SceneStreamState state, std::shared_ptr<Scene> scene);
+
+        GUID m_SceneID = NULL_GUID;
+        bool m_Additive = false;
+
+        std::atomic<SceneStreamState> m_State = SceneStreamState::Loading;
+        std::atomic<float> m_Progress = 0.0f;
+        std::atomic<bool> m_CancelRequested = false;
+
+        /// @brief The detached scene, written by the loading job before the
+        /// state is moved to Integrating
+        std::shared_ptr<Scene> m_Scene = nullptr;
+
+        std::weak_ptr<Scene> m_PublishedScene;
+
+        std::mutex m_CallbackMutex;
+        std::vector<std::function<void(std::shared_ptr<Scene>)>> m_CompletionCallbacks;
+
+        friend class SceneManager;
+
+    };
+
     class SceneManager
     {
     
@@ -59,8 +136,11 @@ namespace BC
             m_ActiveScene = other.m_ActiveScene;
             m_EntryScene = other.m_EntryScene;
 
-            if (m_PersistentScene)
+            if (other.m_PersistentScene)
                 m_PersistentScene = Scene::CopyScene(other.m_PersistentScene);
+
+            if (other.m_WorldPartition)
+                m_WorldPartition = std::make_unique<WorldPartition>(*other.m_WorldPartition);
         }
 
         SceneManager(SceneManager&& other) = default;
@@ -86,9 +166,12 @@ namespace BC
             m_ActiveScene = other.m_ActiveScene;
             m_EntryScene = other.m_EntryScene;
 
-            if (m_PersistentScene)
+            if (other.m_PersistentScene)
                 m_PersistentScene = Scene::CopyScene(other.m_PersistentScene);
 
+            if (other.m_WorldPartition)
+                m_WorldPartition = std::make_unique<WorldPartition>(*other.m_WorldPartition);
+
             return *this;
         }
 
@@ -113,6 +196,30 @@ namespace BC
         
         #pragma endregion
 
+        // ----------------------------
+        //       Spatial Queries
+        // ----------------------------
+
+        #pragma region Spatial Queries
+
+        /// @brief Same as the Scene queries, merged across every loaded scene
+        /// and ordered nearest first. out_hits is cleared first.
+        void Raycast(const Ray& ray, float max_distance, std::vector<SpatialQueryHit<Entity>>& out_hits, bool first_hit_only = false) const;
+        void QuerySegment(const glm::vec3& start, const glm::vec3& end, std::vector<SpatialQueryHit<Entity>>& out_hits, bool first_hit_only = false) const;
+        void QueryNearest(const glm::vec3& point, size_t count, float max_distance, std::vector<SpatialQueryHit<Entity>>& out_hits) const;
+        void QueryRadius(const glm::vec3& point, float radius, std::vector<SpatialQueryHit<Entity>>& out_hits) const;
+
+        /// @brief Entities, or lights, within the frustum across every loaded
+        /// scene, in no particular order. out_results is cleared first.
+        void QueryFrustum(const Frustum& frustum, std::vector<SpatialDataSource<Entity>>& out_results) const;
+        void QueryLights(const Frustum& frustum, std::vector<SpatialDataSource<Entity>>& out_results) const;
+
+        /// @brief Scene::QueryFrustums across every loaded scene. out_results
+        /// and out_view_masks are cleared first.
+        void QueryFrustums(std::span<const Frustum> frustums, std::vector<SpatialDataSource<Entity>>& out_results, std::vector<SpatialIndex<Entity>::ViewMask>& out_view_masks) const;
+
+        #pragma endregion
+
         // ----------------------------
         //     Scene Functionality
         // ----------------------------
@@ -174,10 +281,19 @@ namespace BC
         #pragma region Scene Manager
 
         void LoadScene(const std::string& scene_name, bool additive = false);
-        void LoadSceneAsync(const std::string& scene_name, bool additive = false);
+        std::shared_ptr<SceneStreamOperation> LoadSceneAsync(const std::string& scene_name, bool additive = false);
         
         void LoadScene(GUID scene_guid, bool additive = false, const std::filesystem::path& project_directory = "");
-        void LoadSceneAsync(GUID scene_guid, bool additive = false, const std::filesystem::path& project_directory = "");
+
+        /// @brief Streams a scene in without stalling the main thread.
+        ///
+        /// The scene file is decoded into a detached scene on a worker thread,
+        /// its components are then initialised on the main thread under the
+        /// streaming budget, and the scene is published in a single step once
+        /// complete. Non-additive loads unload the current scenes at the
+        /// moment of publishing rather than when the load is requested.
+        /// Returns nullptr if the scene is unknown or already loaded.
+        std::shared_ptr<SceneStreamOperation> LoadSceneAsync(GUID scene_guid, bool additive = false, const std::filesystem::path& project_directory = "");
 
         /// @brief This will load a scene into the SceneManager which is not included in m_SceneFilepaths
         ///
@@ -191,7 +307,7 @@ namespace BC
         /// For example, for the editor, you may load scenes for editing, but
         /// not add them to the m_SceneFilePaths (e.g., what is included in
         /// final build)
-        void LoadSceneAsyncNoAdd(const std::filesystem::path& scene_file_path, bool additive = false);
+        std::shared_ptr<SceneStreamOperation> LoadSceneAsyncNoAdd(const std::filesystem::path& scene_file_path, bool additive = false);
 
         void AddSceneTemplate(std::shared_ptr<Scene> scene);
         void AddSceneTemplate(GUID scene_id, const std::filesystem::path& scene_file_path);
@@ -203,9 +319,17 @@ namespace BC
         void SetEntryScene(const std::string& scene_name);
         GUID GetEntryScene() const { return m_EntryScene; }
 
+        /// @brief Removes the scene from the SceneManager immediately, its
+        /// entities are then released across frames under the streaming budget
         void UnloadScene(GUID scene_guid);
         void UnloadScene(const std::string& scene_name);
 
+        void SetStreamingBudget(const SceneStreamingBudget& budget) { m_StreamingBudget = budget; }
+        const SceneStreamingBudget& GetStreamingBudget() const { return m_StreamingBudget; }
+
+        /// @brief True whilst any scene is loading, integrating or releasing
+        bool IsStreaming() const { return !m_StreamOperations.empty() || !m_ScenesPendingRelease.empty(); }
+
         std::shared_ptr<Scene> GetActiveScene();
 
         void Serialise(YAML::Emitter& out);
@@ -215,8 +339,48 @@ namespace BC
 
         #pragma endregion
 
+        // ----------------------------
+        //       World Partition
+        // ----------------------------
+
+        #pragma region World Partition
+
+        /// @brief Splits a loaded scene into world partition cells. Each root
+        /// entity is assigned, along with its descendants, to the cell that
+        /// contains it and every cell is written to its own scene file beside
+        /// the source scene. The source scene file is left untouched and the
+        /// new partition replaces any existing one. Entities are given new
+        /// GUIDs in the cells, see WorldPartition::GetCellEntityGUID, so cells
+        /// stream alongside the loaded source scene. Returns false if the
+        /// scene is not loaded.
+        bool PartitionScene(GUID scene_guid, const WorldPartitionConfig& config = {});
+
+        /// @brief Unloads every streamed cell and removes the partition
+        void ClearWorldPartition();
+
+        WorldPartition* GetWorldPartition() const { return m_WorldPartition.get(); }
+
+        #pragma endregion
+
     private:
 
+        /// @brief Advances in-flight scene loads and releases of unloaded
+        /// scenes. Called on the main thread every frame.
+        void OnUpdateStreaming();
+
+        /// @brief Requests cells near the streaming sources and unloads those
+        /// that have fallen out of range or over the memory budget. Called on
+        /// the main thread every frame before OnUpdateStreaming.
+        void OnUpdateWorldPartition();
+
+        std::shared_ptr<SceneStreamOperation> StreamScene(GUID scene_guid, const std::filesystem::path& scene_file_path, bool additive, const std::filesystem::path& project_directory);
+
+        /// @brief Moves the scene out of m_SceneInstances and queues it to be
+        /// released across frames. Main thread only, waits for this frame's
+        /// scene snapshot first as it iterates m_SceneInstances.
+        void ReleaseScene(GUID scene_guid);
+        void ReleaseAllScenes();
+
         bool m_IsRunning = false;
         bool m_IsSimulating = false;
         bool m_IsPaused = false;
@@ -225,7 +389,9 @@ namespace BC
         // will deserialise from file, Unloaded scenes will just be relative
         // file paths to scene file in project/scenes
 
-        /// @brief This holds instances of scenes that are currently simulating/running
+        /// @brief This holds instances of scenes that are currently simulating/running.
+        /// Read by the render thread's scene snapshot, so only changed on the
+        /// main thread after Application::WaitForSceneSnapshot.
         std::unordered_map<GUID, std::shared_ptr<Scene>> m_SceneInstances = {};
 
         /// @brief This holds relative paths to all scenes in Project/Scenes folder
@@ -243,6 +409,23 @@ namespace BC
         /// @brief To be initialised when SceneManager simulation/runtime starts
         std::unique_ptr<PhysicsSystem> m_PhysicsSystem = nullptr;
 
+        // ----------------------------------
+        // 			Scene Streaming
+        // ----------------------------------
+
+        SceneStreamingBudget m_StreamingBudget = {};
+
+        /// @brief In-flight asynchronous loads. Main thread only.
+        std::vector<std::shared_ptr<SceneStreamOperation>> m_StreamOperations = {};
+
+        /// @brief Unloaded scenes whose entities are still being released.
+        /// Main thread only.
+        std::vector<std::shared_ptr<Scene>> m_ScenesPendingRelease = {};
+
+        /// @brief Present once a scene has been partitioned or a partition
+        /// has been read from the project file
+        std::unique_ptr<WorldPartition> m_WorldPartition = nullptr;
+
         friend class Scene;
         friend class Project;
 
@@ -0,0 +1,209 @@
+#include "BC_PCH.h"
+#include "WorldPartition.h"
+
+// Core Headers
+#include "Util/Hash.h"
+#include "Util/FileUtil.h"
+
+// C++ Standard Library Headers
+
+// External Vendor Library Headers
+#include <yaml-cpp/yaml.h>
+
+namespace BC
+{
+
+    WorldPartition::WorldPartition(const WorldPartitionConfig& config)
+    {
+        SetConfig(config);
+    }
+
+    WorldPartition::WorldPartition(const WorldPartition& other)
+    {
+        *this = other;
+    }
+
+    WorldPartition& WorldPartition::operator=(const WorldPartition& other)
+    {
+        if (this == &other)
+            return *this;
+
+        m_Config = other.m_Config;
+        m_StreamingEnabled = other.m_StreamingEnabled;
+        m_SourceSceneID = other.m_SourceSceneID;
+        m_CellEntityGUIDs = other.m_CellEntityGUIDs;
+        m_SourceEntities = other.m_SourceEntities;
+        m_TransientSources.clear();
+
+        m_Cells = other.m_Cells;
+        for (auto& [coord, cell] : m_Cells)
+        {
+            if (cell.State == WorldCellState::Loading)
+                cell.State = WorldCellState::Unloaded;
+            cell.Operation = nullptr;
+        }
+
+        return *this;
+    }
+
+    void WorldPartition::SetConfig(const WorldPartitionConfig& config)
+    {
+        m_Config = config;
+        m_Config.CellSize = std::max(m_Config.CellSize, 1.0f);
+        m_Config.LoadRadius = std::max(m_Config.LoadRadius, 0.0f);
+        m_Config.UnloadRadius = std::max(m_Config.UnloadRadius, m_Config.LoadRadius);
+    }
+
+    WorldCellCoord WorldPartition::GetCellCoord(const glm::vec3& position) const
+    {
+        glm::vec3 cell = glm::floor(position / m_Config.CellSize);
+        return { static_cast<int32_t>(cell.x), static_cast<int32_t>(cell.y), static_cast<int32_t>(cell.z) };
+    }
+
+    Bounds_AABB WorldPartition::GetCellBounds(const WorldCellCoord& coord) const
+    {
+        glm::vec3 min = glm::vec3(coord.X, coord.Y, coord.Z) * m_Config.CellSize;
+        return { min, min + glm::vec3(m_Config.CellSize) };
+    }
+
+    float WorldPartition::GetDistanceToCell(const glm::vec3& position, const WorldCellCoord& coord) const
+    {
+        Bounds_AABB bounds = GetCellBounds(coord);
+        return glm::distance(position, glm::clamp(position, bounds.BoundsMin, bounds.BoundsMax));
+    }
+
+    GUID WorldPartition::GetCellEntityGUID(GUID source_entity_guid) const
+    {
+        auto it = m_CellEntityGUIDs.find(source_entity_guid);
+        return it != m_CellEntityGUIDs.end() ? it->second : NULL_GUID;
+    }
+
+    void WorldPartition::AddCell(const WorldCellCoord& coord, const std::filesystem::path& file_path, uint64_t file_bytes)
+    {
+        WorldCell& cell = m_Cells[coord];
+        cell.Coord = coord;
+        cell.FilePath = file_path;
+        cell.SceneID = Util::HashStringInsensitive(Util::NormaliseFilePathToString(file_path));
+        cell.FileBytes = file_bytes;
+    }
+
+    uint64_t WorldPartition::GetResidentFileBytes() const
+    {
+        uint64_t resident_file_bytes = 0;
+        for (const auto& [coord, cell] : m_Cells)
+        {
+            if (cell.State != WorldCellState::Unloaded)
+                resident_file_bytes += cell.FileBytes;
+        }
+        return resident_file_bytes;
+    }
+
+    void WorldPartition::Serialise(YAML::Emitter& out) const
+    {
+        out << YAML::Key << "World Partition";
+        out << YAML::BeginMap;
+        {
+            out << YAML::Key << "Cell Size" << YAML::Value << m_Config.CellSize;
+            out << YAML::Key << "Load Radius" << YAML::Value << m_Config.LoadRadius;
+            out << YAML::Key << "Unload Radius" << YAML::Value << m_Config.UnloadRadius;
+            out << YAML::Key << "Cell File Budget Bytes" << YAML::Value << m_Config.CellFileBudgetBytes;
+            out << YAML::Key << "Max Concurrent Loads" << YAML::Value << m_Config.MaxConcurrentLoads;
+            out << YAML::Key << "Stream From Cameras" << YAML::Value << m_Config.StreamFromCameras;
+            out << YAML::Key << "Streaming Enabled" << YAML::Value << m_StreamingEnabled;
+            out << YAML::Key << "Source Scene ID" << YAML::Value << static_cast<uint64_t>(m_SourceSceneID);
+
+            out << YAML::Key << "Streaming Sources" << YAML::Value << YAML::Flow << YAML::BeginSeq;
+            for (GUID source_guid : m_SourceEntities)
+                out << static_cast<uint64_t>(source_guid);
+            out << YAML::EndSeq;
+
+            out << YAML::Key << "Cell Entity GUIDs";
+            out << YAML::BeginSeq;
+            for (const auto& [source_guid, cell_guid] : m_CellEntityGUIDs)
+                out << YAML::Flow << YAML::BeginSeq << static_cast<uint64_t>(source_guid) << static_cast<uint64_t>(cell_guid) << YAML::EndSeq;
+            out << YAML::EndSeq;
+
+            out << YAML::Key << "Cells";
+            out << YAML::BeginSeq;
+            for (const auto& [coord, cell] : m_Cells)
+            {
+                out << YAML::BeginMap;
+                {
+                    out << YAML::Key << "Coord" << YAML::Value << YAML::Flow
+                        << YAML::BeginSeq
+                        << coord.X
+                        << coord.Y
+                        << coord.Z
+                        << YAML::EndSeq;
+                    out << YAML::Key << "Relative Path" << YAML::Value << cell.FilePath.string();
+                    out << YAML::Key << "File Bytes" << YAML::Value << cell.FileBytes;
+                }
+                out << YAML::EndMap;
+            }
+            out << YAML::EndSeq;
+        }
+        out << YAML::EndMap;
+    }
+
+    void WorldPartition::Deserialise(const YAML::Node& data)
+    {
+        WorldPartitionConfig config = {};
+        if (data["Cell Size"])              config.CellSize = data["Cell Size"].as<float>();
+        if (data["Load Radius"])            config.LoadRadius = data["Load Radius"].as<float>();
+        if (data["Unload Radius"])          config.UnloadRadius = data["Unload Radius"].as<float>();
+        if (data["Cell File Budget Bytes"]) config.CellFileBudgetBytes = data["Cell File Budget Bytes"].as<uint64_t>();
+        else if (data["Memory Budget Bytes"]) config.CellFileBudgetBytes = data["Memory Budget Bytes"].as<uint64_t>();
+        if (data["Max Concurrent Loads"])   config.MaxConcurrentLoads = data["Max Concurrent Loads"].as<uint32_t>();
+        if (data["Stream From Cameras"])    config.StreamFromCameras = data["Stream From Cameras"].as<bool>();
+        SetConfig(config);
+
+        if (data["Streaming Enabled"])
+            m_StreamingEnabled = data["Streaming Enabled"].as<bool>();
+
+        m_SourceSceneID = data["Source Scene ID"] ? GUID(data["Source Scene ID"].as<uint64_t>()) : NULL_GUID;
+
+        m_SourceEntities.clear();
+        if (data["Streaming Sources"])
+        {
+            for (const auto& source_data : data["Streaming Sources"])
+                m_SourceEntities.insert(source_data.as<uint64_t>());
+        }
+
+        m_CellEntityGUIDs.clear();
+        if (data["Cell Entity GUIDs"])
+        {
+            for (const auto& guid_data : data["Cell Entity GUIDs"])
+            {
+                if (guid_data.size() == 2)
+                    m_CellEntityGUIDs.emplace(guid_data[0].as<uint64_t>(), guid_data[1].as<uint64_t>());
+            }
+        }
+
+        m_Cells.clear();
+        if (!data["Cells"])
+            return;
+
+        for (const auto& cell_data : data["Cells"])
+        {
+            if (!cell_data["Coord"] || !cell_data["Relative Path"] || cell_data["Coord"].size() != 3)
+                continue;
+
+            WorldCellCoord coord =
+            {
+                cell_data["Coord"][0].as<int32_t>(),
+                cell_data["Coord"][1].as<int32_t>(),
+                cell_data["Coord"][2].as<int32_t>()
+            };
+
+            // Partitions saved before the rename hold the same file size under "Estimated Bytes"
+            uint64_t file_bytes = 0;
+            if (cell_data["File Bytes"])
+                file_bytes = cell_data["File Bytes"].as<uint64_t>();
+            else if (cell_data["Estimated Bytes"])
+                file_bytes = cell_data["Estimated Bytes"].as<uint64_t>();
+
+            AddCell(coord, cell_data["Relative Path"].as<std::string>(), file_bytes);
+        }
+    }
+
+}
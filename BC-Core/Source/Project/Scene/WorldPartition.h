@@ -0,0 +1,199 @@
+#pragma once
+
+// Core Headers
+#include "Core/GUID.h"
+
+#include "Project/Scene/Bounds/Bounds.h"
+
+// C++ Standard Library Headers
+#include <memory>
+#include <filesystem>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// External Vendor Library Headers
+#include <glm/glm.hpp>
+
+namespace YAML
+{
+    class Emitter;
+    class Node;
+}
+
+namespace BC
+{
+
+    class SceneStreamOperation;
+
+    struct WorldCellCoord
+    {
+        int32_t X = 0;
+        int32_t Y = 0;
+        int32_t Z = 0;
+
+        bool operator==(const WorldCellCoord& other) const { return X == other.X && Y == other.Y && Z == other.Z; }
+        bool operator!=(const WorldCellCoord& other) const { return !(*this == other); }
+    };
+
+}
+
+namespace std
+{
+    template<>
+    struct hash<BC::WorldCellCoord>
+    {
+        std::size_t operator()(const BC::WorldCellCoord& coord) const noexcept
+        {
+            std::size_t seed = std::hash<int32_t>{}(coord.X);
+            seed ^= std::hash<int32_t>{}(coord.Y) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            seed ^= std::hash<int32_t>{}(coord.Z) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            return seed;
+        }
+    };
+}
+
+namespace BC
+{
+
+    struct WorldPartitionConfig
+    {
+        /// @brief Edge length of each cubic cell in world units
+        float CellSize = 128.0f;
+
+        /// @brief Cells within this distance of any streaming source are loaded
+        float LoadRadius = 256.0f;
+
+        /// @brief Loaded cells are only unloaded once every streaming source is
+        /// further than this. Kept above LoadRadius so sources moving along a
+        /// cell boundary do not load and unload the same cell every frame.
+        float UnloadRadius = 320.0f;
+
+        /// @brief Upper limit of the combined scene file size of loaded and
+        /// loading cells, a proxy for their memory which is not measured. The
+        /// furthest cells are evicted to make room for nearer ones. Zero means
+        /// unlimited.
+        uint64_t CellFileBudgetBytes = 0;
+
+        /// @brief Maximum amount of cells loading at once. Zero means
+        /// unlimited.
+        uint32_t MaxConcurrentLoads = 2;
+
+        /// @brief Every camera entity in a loaded scene acts as a source
+        bool StreamFromCameras = true;
+    };
+
+    enum class WorldCellState : uint8_t
+    {
+        Unloaded,
+        Loading,
+        Loaded
+    };
+
+    /// @brief A spatial cell of a partitioned world. Each cell is stored as
+    /// its own scene file and is loaded as an additive scene, so it owns its
+    /// octree and registers its physics actors as its components initialise.
+    struct WorldCell
+    {
+        WorldCellCoord Coord = {};
+
+        /// @brief Relative to the Project/Scenes folder
+        std::filesystem::path FilePath = "";
+
+        /// @brief Derived from FilePath, the same as any scene loaded by path
+        GUID SceneID = NULL_GUID;
+
+        /// @brief Size of the cell's scene file when partitioned
+        uint64_t FileBytes = 0;
+
+        WorldCellState State = WorldCellState::Unloaded;
+        std::shared_ptr<SceneStreamOperation> Operation = nullptr;
+    };
+
+    /// @brief Splits a large scene into cells which are streamed in and out
+    /// by distance from one or more streaming sources. Owned and driven by the
+    /// SceneManager on the main thread.
+    class WorldPartition
+    {
+
+    public:
+
+        WorldPartition(const WorldPartitionConfig& config = {});
+        ~WorldPartition() = default;
+
+        /// @brief In-flight loads belong to the SceneManager that requested
+        /// them, so the copy only keeps cells which are already loaded
+        WorldPartition(const WorldPartition& other);
+        WorldPartition& operator=(const WorldPartition& other);
+
+        WorldPartition(WorldPartition&& other) = default;
+        WorldPartition& operator=(WorldPartition&& other) = default;
+
+        const WorldPartitionConfig& GetConfig() const { return m_Config; }
+        void SetConfig(const WorldPartitionConfig& config);
+
+        bool IsStreamingEnabled() const { return m_StreamingEnabled; }
+        void SetStreamingEnabled(bool enabled) { m_StreamingEnabled = enabled; }
+
+        /// @brief The scene the cells were partitioned from
+        GUID GetSourceSceneID() const { return m_SourceSceneID; }
+        void SetSourceSceneID(GUID scene_id) { m_SourceSceneID = scene_id; }
+
+        /// @brief Cell entities are given new GUIDs, so cells can be streamed
+        /// while the source scene is loaded. Returns the GUID the source
+        /// entity was given in its cell, NULL_GUID if it was not partitioned.
+        GUID GetCellEntityGUID(GUID source_entity_guid) const;
+        void SetCellEntityGUIDs(std::unordered_map<GUID, GUID> cell_entity_guids) { m_CellEntityGUIDs = std::move(cell_entity_guids); }
+
+        // ----------------------------
+        //         Cells
+        // ----------------------------
+
+        WorldCellCoord GetCellCoord(const glm::vec3& position) const;
+        Bounds_AABB GetCellBounds(const WorldCellCoord& coord) const;
+
+        /// @brief Distance from the position to the nearest point of the cell,
+        /// zero if the position lies within it
+        float GetDistanceToCell(const glm::vec3& position, const WorldCellCoord& coord) const;
+
+        void AddCell(const WorldCellCoord& coord, const std::filesystem::path& file_path, uint64_t file_bytes);
+        void ClearCells() { m_Cells.clear(); }
+
+        const std::unordered_map<WorldCellCoord, WorldCell>& GetCells() const { return m_Cells; }
+
+        /// @brief Combined file size of every cell that is loaded or loading
+        uint64_t GetResidentFileBytes() const;
+
+        // ----------------------------
+        //      Streaming Sources
+        // ----------------------------
+
+        void AddStreamingSource(GUID entity_guid) { m_SourceEntities.insert(entity_guid); }
+        void RemoveStreamingSource(GUID entity_guid) { m_SourceEntities.erase(entity_guid); }
+        const std::unordered_set<GUID>& GetStreamingSources() const { return m_SourceEntities; }
+
+        /// @brief Adds a position that is only used for the next streaming
+        /// update, e.g., the editor camera which is not an entity
+        void SubmitStreamingPosition(const glm::vec3& position) { m_TransientSources.push_back(position); }
+
+        void Serialise(YAML::Emitter& out) const;
+        void Deserialise(const YAML::Node& data);
+
+    private:
+
+        WorldPartitionConfig m_Config = {};
+        bool m_StreamingEnabled = true;
+
+        GUID m_SourceSceneID = NULL_GUID;
+        std::unordered_map<GUID, GUID> m_CellEntityGUIDs = {};
+
+        std::unordered_map<WorldCellCoord, WorldCell> m_Cells = {};
+
+        std::unordered_set<GUID> m_SourceEntities = {};
+        std::vector<glm::vec3> m_TransientSources = {};
+
+        friend class SceneManager;
+
+    };
+
+}
@@ -78,6 +78,15 @@ namespace BC
         register_function("Entity_GetComponentsInHierarchyCopy", reinterpret_cast<void*>(&Entity_GetComponentsInHierarchyCopy));
     #pragma endregion
 
+    #pragma region Spatial Queries
+        register_function("Spatial_Raycast", reinterpret_cast<void*>(&Spatial_Raycast));
+        register_function("Spatial_RaycastAllCount", reinterpret_cast<void*>(&Spatial_RaycastAllCount));
+        register_function("Spatial_SegmentCount", reinterpret_cast<void*>(&Spatial_SegmentCount));
+        register_function("Spatial_NearestCount", reinterpret_cast<void*>(&Spatial_NearestCount));
+        register_function("Spatial_RadiusCount", reinterpret_cast<void*>(&Spatial_RadiusCount));
+        register_function("Spatial_GetHitsCopy", reinterpret_cast<void*>(&Spatial_GetHitsCopy));
+    #pragma endregion
+
     #pragma region TransformComponent
         register_function("TransformComponent_GetTransform", reinterpret_cast<void*>(&TransformComponent_GetTransform));
         register_function("TransformComponent_SetTransform", reinterpret_cast<void*>(&TransformComponent_SetTransform));
@@ -409,6 +418,90 @@ namespace BC
 
 #pragma endregion
 
+#pragma region Spatial Queries
+
+    bool ScriptRegister::Spatial_Raycast(const glm::vec3* origin, const glm::vec3* direction, float max_distance, _SpatialHit* out_hit)
+    {
+        if (!origin || !direction || !out_hit || glm::length(*direction) <= 0.0f)
+            return false;
+
+        std::vector<SpatialQueryHit<Entity>> hits;
+        Application::GetProject()->GetSceneManager()->Raycast(Ray{ *origin, glm::normalize(*direction) }, max_distance, hits, true);
+
+        if (hits.empty())
+            return false;
+
+        *out_hit = { hits[0].Data.GetGUID(), hits[0].Distance };
+        return true;
+    }
+
+    uint64_t ScriptRegister::Spatial_RaycastAllCount(const glm::vec3* origin, const glm::vec3* direction, float max_distance, size_t* count)
+    {
+        std::vector<SpatialQueryHit<Entity>> hits;
+        if (origin && direction && glm::length(*direction) > 0.0f)
+            Application::GetProject()->GetSceneManager()->Raycast(Ray{ *origin, glm::normalize(*direction) }, max_distance, hits);
+
+        return CacheSpatialHits(hits, count);
+    }
+
+    uint64_t ScriptRegister::Spatial_SegmentCount(const glm::vec3* start, const glm::vec3* end, bool first_hit_only, size_t* count)
+    {
+        std::vector<SpatialQueryHit<Entity>> hits;
+        if (start && end)
+            Application::GetProject()->GetSceneManager()->QuerySegment(*start, *end, hits, first_hit_only);
+
+        return CacheSpatialHits(hits, count);
+    }
+
+    uint64_t ScriptRegister::Spatial_NearestCount(const glm::vec3* point, size_t max_count, float max_distance, size_t* count)
+    {
+        std::vector<SpatialQueryHit<Entity>> hits;
+        if (point)
+            Application::GetProject()->GetSceneManager()->QueryNearest(*point, max_count, max_distance, hits);
+
+        return CacheSpatialHits(hits, count);
+    }
+
+    uint64_t ScriptRegister::Spatial_RadiusCount(const glm::vec3* point, float radius, size_t* count)
+    {
+        std::vector<SpatialQueryHit<Entity>> hits;
+        if (point)
+            Application::GetProject()->GetSceneManager()->QueryRadius(*point, radius, hits);
+
+        return CacheSpatialHits(hits, count);
+    }
+
+    void ScriptRegister::Spatial_GetHitsCopy(_SpatialHit* hit_array, size_t count, uint64_t cached_key)
+    {
+        auto it = s_CachedSpatialHits.find(cached_key);
+        if (it == s_CachedSpatialHits.end())
+            return;
+
+        if (hit_array)
+            std::copy_n(it->second.begin(), std::min(count, it->second.size()), hit_array);
+
+        s_CachedSpatialHits.erase(it);
+    }
+
+    uint64_t ScriptRegister::CacheSpatialHits(const std::vector<SpatialQueryHit<Entity>>& hits, size_t* count)
+    {
+        if (count)
+            *count = hits.size();
+
+        if (hits.empty())
+            return -1;
+
+        uint64_t cached_key = s_NextSpatialHitsKey++;
+        auto& cached_hits = s_CachedSpatialHits[cached_key];
+        cached_hits.reserve(hits.size());
+        for (const auto& hit : hits)
+            cached_hits.push_back({ hit.Data.GetGUID(), hit.Distance });
+
+        return cached_key;
+    }
+
+#pragma endregion
+
 #pragma region TransformComponent
 
     ScriptRegister::_Transform ScriptRegister::TransformComponent_GetTransform(GUID entity_guid, bool global)
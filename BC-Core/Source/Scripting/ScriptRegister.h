@@ -103,6 +103,33 @@ namespace BC
 
 #pragma endregion
 
+#pragma region Spatial Queries
+
+        struct _SpatialHit
+        {
+            GUID entity;
+            float distance;
+        };
+
+        static bool Spatial_Raycast(const glm::vec3* origin, const glm::vec3* direction, float max_distance, _SpatialHit* out_hit);
+
+        // Same as the hierarchy queries, the hits are cached against the returned 
+        // key until the APP copies them into an array it allocated for count.
+
+        static inline std::unordered_map<uint64_t, std::vector<_SpatialHit>> s_CachedSpatialHits;
+        static inline uint64_t s_NextSpatialHitsKey = 0;
+
+        static uint64_t Spatial_RaycastAllCount(const glm::vec3* origin, const glm::vec3* direction, float max_distance, size_t* count);
+        static uint64_t Spatial_SegmentCount(const glm::vec3* start, const glm::vec3* end, bool first_hit_only, size_t* count);
+        static uint64_t Spatial_NearestCount(const glm::vec3* point, size_t max_count, float max_distance, size_t* count);
+        static uint64_t Spatial_RadiusCount(const glm::vec3* point, float radius, size_t* count);
+
+        static void Spatial_GetHitsCopy(_SpatialHit* hit_array, size_t count, uint64_t cached_key);
+
+        static uint64_t CacheSpatialHits(const std::vector<SpatialQueryHit<Entity>>& hits, size_t* count);
+
+#pragma endregion
+
 #pragma region TransformComponent
 
         static _Transform TransformComponent_GetTransform(GUID entity_guid, bool global);
@@ -0,0 +1,105 @@
+#include "BC_PCH.h"
+#include "RadixSort.h"
+
+namespace BC::Util
+{
+
+    // Below this many entries a pass is counted and scattered on one thread
+    static constexpr size_t MIN_ENTRIES_PER_SORT_CHUNK = 16384;
+
+    void RadixSort(std::pmr::vector<RadixSortEntry>& entries, std::pmr::vector<RadixSortEntry>& scratch)
+    {
+        BC_PROFILE_SCOPE("Util::RadixSort");
+
+        const size_t entry_count = entries.size();
+        if (entry_count < 2)
+            return;
+
+        scratch.resize(entry_count);
+
+        JobSystem* job_system = Application::GetJobSystem();
+
+        size_t chunk_count = 1;
+        if (job_system)
+            chunk_count = std::clamp<size_t>(entry_count / MIN_ENTRIES_PER_SORT_CHUNK, 1, static_cast<size_t>(job_system->GetWorkerCount()) + 1);
+
+        const size_t chunk_size = (entry_count + chunk_count - 1) / chunk_count;
+
+        auto run_chunks = [&](const std::function<void(size_t, size_t, size_t)>& chunk_function)
+        {
+            auto run_chunk = [&](size_t chunk_index)
+            {
+                size_t begin = std::min(chunk_index * chunk_size, entry_count);
+                chunk_function(chunk_index, begin, std::min(begin + chunk_size, entry_count));
+            };
+
+            if (chunk_count == 1)
+            {
+                run_chunk(0);
+                return;
+            }
+
+            std::vector<std::pair<std::string, JobFunction>> chunk_jobs;
+            chunk_jobs.reserve(chunk_count - 1);
+            for (size_t chunk_index = 1; chunk_index < chunk_count; ++chunk_index)
+                chunk_jobs.emplace_back("Radix Sort Chunk", [&run_chunk, chunk_index]() { run_chunk(chunk_index); });
+
+            JobCounter chunk_counter = {};
+            job_system->SubmitJobs(chunk_jobs, &chunk_counter, JobPriority::High);
+
+            run_chunk(0);
+
+            chunk_counter.Wait();
+        };
+
+        // Per chunk bucket counts, turned into each chunk's write offsets
+        std::vector<std::array<size_t, 256>> chunk_buckets(chunk_count);
+
+        RadixSortEntry* source = entries.data();
+        RadixSortEntry* target = scratch.data();
+
+        for (uint32_t shift = 0; shift < 64; shift += 8)
+        {
+            run_chunks([&](size_t chunk_index, size_t begin, size_t end)
+            {
+                auto& buckets = chunk_buckets[chunk_index];
+                buckets.fill(0);
+
+                for (size_t i = begin; i < end; ++i)
+                    buckets[(source[i].key >> shift) & 0xFF]++;
+            });
+
+            // Chunks write each bucket in chunk order, which keeps the sort stable
+            size_t offset = 0;
+            bool single_bucket = false;
+            for (size_t bucket = 0; bucket < 256 && !single_bucket; ++bucket)
+            {
+                size_t bucket_start = offset;
+                for (auto& buckets : chunk_buckets)
+                {
+                    size_t bucket_count = buckets[bucket];
+                    buckets[bucket] = offset;
+                    offset += bucket_count;
+                }
+
+                single_bucket = offset - bucket_start == entry_count;
+            }
+
+            if (single_bucket)
+                continue;
+
+            run_chunks([&](size_t chunk_index, size_t begin, size_t end)
+            {
+                auto& offsets = chunk_buckets[chunk_index];
+                for (size_t i = begin; i < end; ++i)
+                    target[offsets[(source[i].key >> shift) & 0xFF]++] = source[i];
+            });
+
+            std::swap(source, target);
+        }
+
+        if (source != entries.data())
+            entries.swap(scratch);
+    }
+
+}
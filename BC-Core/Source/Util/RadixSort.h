@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace BC::Util
+{
+
+    struct RadixSortEntry
+    {
+        uint64_t key;
+        uint32_t index;
+    };
+
+    // Stable LSD radix sort of entries by key, one byte per pass. Passes in
+    // which every key shares the same byte are skipped. Large inputs are split
+    // across the job system, each chunk counting and scattering its own range.
+    // scratch is resized to match and may be reused between calls, it must
+    // share the memory resource of entries as the two are swapped.
+    void RadixSort(std::pmr::vector<RadixSortEntry>& entries, std::pmr::vector<RadixSortEntry>& scratch);
+
+}
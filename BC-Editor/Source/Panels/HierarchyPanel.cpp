@@ -3,6 +3,8 @@
 
 #include "BC-Editor.h"
 
+#include "Asset/Assets/Prefab.h"
+
 namespace BC
 {
     void HierarchyPanel::OnRenderGUI()
@@ -279,20 +281,7 @@ namespace BC
                             dropped_entity.GetComponent<MetaComponent>().AttachParent(parent_entity.GetGUID());
 
                             // Reorder the dropped entity to appear just before the current one in the parent's child list
-                            auto& children = parent_entity.GetComponent<MetaComponent>().m_Children;
-                            GUID dropped_guid = dropped_entity.GetGUID();
-                            GUID current_guid = current_entity.GetGUID();
-
-                            // Remove if already present to avoid duplication
-                            auto dropped_it = std::find(children.begin(), children.end(), dropped_guid);
-                            BC_ASSERT(dropped_it != children.end(), "HierarchyPanel::DrawEntityRecursive: We Attached To Parent, But Dropped GUID Not Found In Parent->Children Vector.");
-
-                            if (dropped_it != children.end())
-                                children.erase(dropped_it);
-
-                            // Insert before the current entity
-                            auto insert_pos = std::find(children.begin(), children.end(), current_guid);
-                            children.insert(insert_pos, dropped_guid);
+                            dropped_entity.GetComponent<MetaComponent>().MoveBeforeSibling(current_entity.GetGUID());
                         });
                     }
                     m_DraggingSourceMin = {};
@@ -581,15 +570,8 @@ namespace BC
             return;
         }
         
-        for (const auto& child_guid : current_entity.GetComponent<MetaComponent>().GetChildrenGUID())
+        for (Entity child_entity : current_entity.GetChildren())
         {
-            if (!all_entities.contains(child_guid))
-                continue;
-            
-            const Entity& child_entity = all_entities.at(child_guid);
-            if (!child_entity)
-                continue;
-            
             DrawEntityRecursive(scene, child_entity, all_entities);
         }
 
@@ -681,6 +663,9 @@ namespace BC
 
             for (const auto& entity_handle : all_entities_view)
             {
+                if (scene->GetRegistry()->all_of<PrefabPoolParked>(entity_handle))
+                    continue;
+
                 auto& meta_component = all_entities_view.get<MetaComponent>(entity_handle);
 
                 all_entities[scene->GetSceneID()][meta_component.GetEntityGUID()] = Entity(entity_handle, scene.get());
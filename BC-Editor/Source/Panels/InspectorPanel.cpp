@@ -251,7 +251,187 @@ namespace BC
 
     static void DrawLODMeshComponent(LODMeshComponent& component)
     {
+        ImGui::PushStyleColor(ImGuiCol_TableBorderLight, ImVec4(0.409f, 0.409f, 0.409f, 1.000f));
+        if (ImGui::BeginTable("##LODMeshComponentTable", 2, ImGuiTableFlags_BordersInnerV))
+        {
+            ImGui::PopStyleColor();
+            
+            ImGui::TableSetupColumn("##DataName", ImGuiTableColumnFlags_WidthFixed, 100.0f);
+            
+            ImGui::TableSetupColumn("##DataValue", ImGuiTableColumnFlags_WidthStretch);
+
+            // LOD Bias
+            {
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+
+                ImGui::TextWrapped("LOD Bias");
+
+                if (ImGui::IsItemHovered(ImGuiHoveredFlags_DelayNormal | ImGuiHoveredFlags_NoSharedDelay))
+                    ImGui::SetTooltip("Scales the Screen Coverage. Above 1 Keeps Finer Levels for Longer.");
+
+                ImGui::TableSetColumnIndex(1);
+
+                auto lod_bias = component.GetLODBias();
+                if (ImGui::DragFloat("##LODMeshBias", &lod_bias, 0.01f, 0.01f, FLT_MAX, "%.2f"))
+                {
+                    component.SetLODBias(lod_bias);
+                }
+            }
+
+            // Cross Fade
+            {
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+
+                ImGui::TextWrapped("Cross Fade");
+
+                if (ImGui::IsItemHovered(ImGuiHoveredFlags_DelayNormal | ImGuiHoveredFlags_NoSharedDelay))
+                    ImGui::SetTooltip("Dither Between Levels Near Each Threshold Rather Than Popping.");
+
+                ImGui::TableSetColumnIndex(1);
+
+                auto cross_fade = component.GetCrossFade();
+                if (ImGui::Checkbox("##LODMeshCrossFade", &cross_fade))
+                {
+                    component.SetCrossFade(cross_fade);
+                }
+
+                if (cross_fade)
+                {
+                    ImGui::SameLine();
+
+                    auto cross_fade_width = component.GetCrossFadeWidth();
+                    if (ImGui::DragFloat("##LODMeshCrossFadeWidth", &cross_fade_width, 0.01f, 0.0f, 1.0f, "%.2f"))
+                    {
+                        component.SetCrossFadeWidth(cross_fade_width);
+                    }
+                }
+            }
+
+            // Shadow LOD
+            {
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+
+                ImGui::TextWrapped("Shadow LOD");
+
+                if (ImGui::IsItemHovered(ImGuiHoveredFlags_DelayNormal | ImGuiHoveredFlags_NoSharedDelay))
+                    ImGui::SetTooltip("The Level Drawn Into Shadow Maps, Regardless of Distance.");
+
+                ImGui::TableSetColumnIndex(1);
+
+                uint32_t shadow_lod = component.GetShadowLOD();
+                uint32_t max_shadow_lod = LODMeshComponent::MAX_LOD_COUNT - 1;
+                if (ImGui::DragScalar("##LODMeshShadowLOD", ImGuiDataType_U32, &shadow_lod, 0.1f, nullptr, &max_shadow_lod))
+                {
+                    component.SetShadowLOD(std::min(shadow_lod, max_shadow_lod));
+                }
+            }
+
+            // Levels
+            std::vector<Util::LODLevel> lods = component.GetLODs();
+            bool lods_changed = false;
+            int remove_index = -1;
+
+            for (size_t i = 0; i < lods.size(); ++i)
+            {
+                ImGui::PushID(static_cast<int>(i));
+
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+
+                ImGui::Text("LOD %zu", i);
+
+                if (ImGui::IsItemHovered(ImGuiHoveredFlags_DelayNormal | ImGuiHoveredFlags_NoSharedDelay))
+                    ImGui::SetTooltip("Drawn While the Mesh Covers at Least This Fraction of the Screen's Height. No Mesh Draws the Mesh Renderer's.");
+
+                ImGui::TableSetColumnIndex(1);
+
+                if (ImGui::DragFloat("##LODMeshCoverage", &lods[i].screen_coverage, 0.001f, 0.0f, FLT_MAX, "%.3f"))
+                    lods_changed = true;
+
+                std::string label = "None (Mesh Asset)";
+                if (AssetManager::IsAssetHandleValid(lods[i].mesh_handle))
+                {
+                    auto meta_data = AssetManager::GetMetaData(lods[i].mesh_handle);
+                    label = meta_data.name + " (Mesh Asset)";
+                }
+
+                char label_buf[256] = {};
+                strncpy(label_buf, label.c_str(), sizeof(label_buf) - 1);
+
+                ImGui::InputText("##LODMeshMeshAsset", label_buf, sizeof(label_buf), ImGuiInputTextFlags_ReadOnly);
+
+                if (ImGui::BeginDragDropTarget())
+                {
+                    AssetHandle handle = NULL_GUID;
+                    if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("CONTENT_ITEM_FILE"))
+                    {
+                        std::filesystem::path dropped_path = std::string(static_cast<const char*>(payload->Data), payload->DataSize);
+
+                        if (std::filesystem::exists(dropped_path))
+                        {
+                            auto meta_data = AssetManager::GetMetaData(dropped_path);
+                            handle = meta_data.handle;
+                        }
+                    }
+
+                    if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("ASSET_HANDLE"))
+                    {
+                        handle = *static_cast<const AssetHandle*>(payload->Data);
+                    }
+
+                    if (handle != NULL_GUID && AssetManager::IsAssetHandleValid(handle))
+                    {
+                        if (AssetManager::GetMetaData(handle).type == AssetType::Mesh)
+                        {
+                            lods[i].mesh_handle = handle;
+                            lods_changed = true;
+                        }
+                        else
+                        {
+                            BC_APP_TRACE("InspectorPanel::DrawLODMeshComponent: Dropped Invalid Asset onto Mesh Handle.");
+                        }
+                    }
 
+                    ImGui::EndDragDropTarget();
+                }
+
+                ImGui::SameLine();
+                if (ImGui::Button("Remove"))
+                    remove_index = static_cast<int>(i);
+
+                ImGui::PopID();
+            }
+
+            // Add Level
+            {
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(1);
+
+                ImGui::BeginDisabled(lods.size() >= LODMeshComponent::MAX_LOD_COUNT);
+                if (ImGui::Button("Add LOD##LODMeshAddLOD"))
+                {
+                    // Each new level takes over at half the previous coverage
+                    Util::LODLevel& lod = lods.emplace_back();
+                    lod.screen_coverage = lods.size() > 1 ? lods[lods.size() - 2].screen_coverage * 0.5f : 0.5f;
+                    lods_changed = true;
+                }
+                ImGui::EndDisabled();
+            }
+
+            if (remove_index >= 0)
+            {
+                lods.erase(lods.begin() + remove_index);
+                lods_changed = true;
+            }
+
+            if (lods_changed)
+                component.SetLODs(std::move(lods));
+
+            ImGui::EndTable();
+        }
     }
 
     static void DrawMeshRendererComponent(MeshRendererComponent& component)
@@ -303,6 +483,25 @@ namespace BC
                 }
             }
 
+            // Occluder
+            {
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+
+                ImGui::TextWrapped("Occluder");
+
+                if (ImGui::IsItemHovered(ImGuiHoveredFlags_DelayNormal | ImGuiHoveredFlags_NoSharedDelay))
+                    ImGui::SetTooltip("Is Mesh to Hide Meshes Behind It? Its Bounds Are Used, so Only Use on Solid Box Like Meshes.");
+
+                ImGui::TableSetColumnIndex(1);
+
+                auto occluder = component.GetOccluder();
+                if (ImGui::Checkbox("##MeshRendererOccluder", &occluder))
+                {
+                    component.SetOccluder(occluder);
+                }
+            }
+
             // Debug AABB
             {
                 ImGui::TableNextRow();
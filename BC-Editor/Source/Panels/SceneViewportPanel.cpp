@@ -34,6 +34,7 @@ namespace BC
             if (ImGui::Begin(Util::PanelTypeToString(GetType()), &m_Active))
             {
                 ImVec2 panel_size = ImGui::GetContentRegionAvail();
+                ImVec2 panel_origin = ImGui::GetCursorScreenPos();
                 
                 if (panel_size.x != m_ViewportSize.x || panel_size.y != m_ViewportSize.y)
                 {
@@ -48,9 +49,53 @@ namespace BC
                 //     ImVec2{0, 1}, 
                 //     ImVec2{1, 0}
                 // );
+
+                if (m_EditorLayer->GetSceneState() != SceneState_Play && ImGui::IsWindowHovered() && ImGui::IsMouseClicked(ImGuiMouseButton_Left))
+                {
+                    ImVec2 mouse_position = ImGui::GetMousePos();
+                    PickEntity({ mouse_position.x - panel_origin.x, mouse_position.y - panel_origin.y });
+                }
             }
             ImGui::End();
         }
     }
 
+    void SceneViewportPanel::PickEntity(const glm::vec2& viewport_position)
+    {
+        if (viewport_position.x < 0.0f || viewport_position.y < 0.0f || viewport_position.x > m_ViewportSize.x || viewport_position.y > m_ViewportSize.y)
+            return;
+
+        auto project = Application::GetProject();
+        if (!project || !project->GetSceneManager())
+            return;
+
+        auto editor_camera = m_EditorLayer->GetEditorCamera();
+
+        // Unproject the near and far plane points under the cursor
+        glm::vec2 ndc = 
+        {
+            (viewport_position.x / m_ViewportSize.x) * 2.0f - 1.0f,
+            1.0f - (viewport_position.y / m_ViewportSize.y) * 2.0f
+        };
+
+        glm::mat4 inverse_view_proj = glm::inverse(editor_camera->GetProjMatrix() * editor_camera->GetViewMatrix());
+        glm::vec4 near_point = inverse_view_proj * glm::vec4(ndc, -1.0f, 1.0f);
+        glm::vec4 far_point = inverse_view_proj * glm::vec4(ndc, 1.0f, 1.0f);
+        near_point /= near_point.w;
+        far_point /= far_point.w;
+
+        project->GetSceneManager()->QuerySegment(glm::vec3(near_point), glm::vec3(far_point), m_PickHits, true);
+
+        auto hierarchy_selection = m_EditorLayer->GetPanel<HierarchyPanel>()->GetSelectionContext();
+        if (m_PickHits.empty())
+        {
+            hierarchy_selection->Clear();
+            return;
+        }
+
+        Entity picked_entity = m_PickHits[0].Data;
+        hierarchy_selection->SetSelection(picked_entity);
+        m_EditorLayer->GetPanel<InspectorPanel>()->SetContextEntity(picked_entity);
+    }
+
 }
\ No newline at end of file
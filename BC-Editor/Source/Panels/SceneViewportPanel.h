@@ -22,6 +22,13 @@ namespace BC
 
     private:
 
+        /// @brief Selects the nearest entity under a point of the viewport, 
+        /// given in pixels from its top left corner
+        void PickEntity(const glm::vec2& viewport_position);
+
+        /// @brief Reused between picks to avoid allocating per click
+        std::vector<SpatialQueryHit<Entity>> m_PickHits;
+
         bool m_PanelFocused = false;
         bool m_ViewportResized = false;
         
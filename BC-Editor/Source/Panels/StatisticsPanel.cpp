@@ -0,0 +1,130 @@
+#include "BC_PCH.h"
+#include "StatisticsPanel.h"
+
+#include "BC-Editor.h"
+
+namespace BC
+{
+
+    void StatisticsPanel::OnRenderGUI()
+    {
+        if (m_Active)
+        {
+            if (ImGui::Begin(Util::PanelTypeToString(GetType()), &m_Active))
+            {
+                DrawDrawCalls();
+                DrawLevelsOfDetail();
+                DrawGPUScene();
+                DrawShadows();
+                DrawOcclusionCulling();
+            }
+            ImGui::End();
+        }
+    }
+
+    void StatisticsPanel::DrawDrawCalls()
+    {
+        if (!ImGui::CollapsingHeader("Draw Calls", ImGuiTreeNodeFlags_DefaultOpen))
+            return;
+
+        DrawCallStats stats = SceneRenderer::GetDrawCallStats();
+        ImGui::Text("Draws: %u", stats.draw_item_count);
+        ImGui::Text("Instanced Draws: %u", stats.instanced_draw_count);
+    }
+
+    void StatisticsPanel::DrawLevelsOfDetail()
+    {
+        if (!ImGui::CollapsingHeader("Levels of Detail", ImGuiTreeNodeFlags_DefaultOpen))
+            return;
+
+        LODStats stats = SceneRenderer::GetLODStats();
+        for (size_t i = 0; i < stats.draw_count.size(); ++i)
+        {
+            if (stats.draw_count[i] == 0)
+                continue;
+
+            ImGui::Text("LOD %zu: %u Draws, %u Triangles", i, stats.draw_count[i], stats.triangle_count[i]);
+        }
+        ImGui::Text("Cross Fading: %u", stats.cross_fade_count);
+        ImGui::Text("Culled: %u", stats.culled_count);
+    }
+
+    void StatisticsPanel::DrawGPUScene()
+    {
+        if (!ImGui::CollapsingHeader("GPU Scene", ImGuiTreeNodeFlags_DefaultOpen))
+            return;
+
+        GPUSceneStats stats = SceneRenderer::GetGPUSceneStats();
+        ImGui::Text("Uploaded: %.2f KB", static_cast<float>(stats.uploaded_bytes) / 1024.0f);
+        ImGui::Text("Objects: %u / %u", stats.uploaded_object_count, stats.object_count);
+        ImGui::Text("Lights: %u / %u", stats.uploaded_light_count, stats.light_count);
+        ImGui::Text("Materials: %u / %u", stats.uploaded_material_count, stats.material_count);
+    }
+
+    void StatisticsPanel::DrawShadows()
+    {
+        if (!ImGui::CollapsingHeader("Shadows", ImGuiTreeNodeFlags_DefaultOpen))
+            return;
+
+        ShadowStats stats = SceneRenderer::GetShadowStats();
+        ImGui::Text("Views: %u", stats.view_count);
+        ImGui::Text("Rendered: %u (%u Cached)", stats.rendered_view_count, stats.view_count - stats.rendered_view_count);
+        ImGui::Text("Caster Draws: %u", stats.caster_draw_count);
+    }
+
+    void StatisticsPanel::DrawOcclusionCulling()
+    {
+        if (!ImGui::CollapsingHeader("Occlusion Culling", ImGuiTreeNodeFlags_DefaultOpen))
+            return;
+
+        bool occlusion_culling = SceneRenderer::IsOcclusionCullingEnabled();
+        if (ImGui::Checkbox("Enabled##OcclusionCulling", &occlusion_culling))
+            SceneRenderer::SetOcclusionCullingEnabled(occlusion_culling);
+
+        OcclusionCullingStats stats = SceneRenderer::GetOcclusionStats();
+        ImGui::Text("Occluders: %u (%u Faces)", stats.occluder_count, stats.rasterised_face_count);
+        ImGui::Text("Tested: %u", stats.tested_count);
+        ImGui::Text("Culled: %u (%.1f%%)", stats.culled_count, stats.tested_count ? 100.0f * stats.culled_count / stats.tested_count : 0.0f);
+
+        if (ImGui::Checkbox("Show Depth Buffer##OcclusionCulling", &m_ShowOcclusionBuffer))
+            SceneRenderer::SetOcclusionDebugView(m_ShowOcclusionBuffer);
+
+        glm::uvec2 image_size = {};
+        if (!m_ShowOcclusionBuffer || !SceneRenderer::GetOcclusionDebugImage(m_OcclusionImage, image_size))
+            return;
+
+        // The buffer is small, so it is drawn as blocks of pixels rather than
+        // uploaded as a texture every frame
+        constexpr uint32_t BLOCK_SIZE = 4;
+
+        float available_width = ImGui::GetContentRegionAvail().x;
+        float scale = available_width / static_cast<float>(image_size.x);
+        ImVec2 image_min = ImGui::GetCursorScreenPos();
+        ImVec2 image_max = { image_min.x + available_width, image_min.y + image_size.y * scale };
+
+        ImDrawList* draw_list = ImGui::GetWindowDrawList();
+        draw_list->AddRectFilled(image_min, image_max, IM_COL32(0, 0, 0, 255));
+
+        for (uint32_t y = 0; y < image_size.y; y += BLOCK_SIZE)
+        {
+            for (uint32_t x = 0; x < image_size.x; x += BLOCK_SIZE)
+            {
+                // Nearest occluder within the block
+                uint8_t block_value = 0;
+                for (uint32_t block_y = y; block_y < std::min(y + BLOCK_SIZE, image_size.y); ++block_y)
+                    for (uint32_t block_x = x; block_x < std::min(x + BLOCK_SIZE, image_size.x); ++block_x)
+                        block_value = std::max(block_value, m_OcclusionImage[block_y * image_size.x + block_x]);
+
+                if (block_value == 0)
+                    continue;
+
+                ImVec2 block_min = { image_min.x + x * scale, image_min.y + y * scale };
+                ImVec2 block_max = { image_min.x + std::min(x + BLOCK_SIZE, image_size.x) * scale, image_min.y + std::min(y + BLOCK_SIZE, image_size.y) * scale };
+                draw_list->AddRectFilled(block_min, block_max, IM_COL32(block_value, block_value, block_value, 255));
+            }
+        }
+
+        ImGui::Dummy({ available_width, image_max.y - image_min.y });
+    }
+
+}
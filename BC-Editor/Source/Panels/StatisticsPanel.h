@@ -16,22 +16,23 @@ namespace BC
         PanelType GetType() const override { return PanelType_Statistics; }
 
         void OnUpdate() override {}
-        void OnRenderGUI() override
-        {
-            if (m_Active)
-            {
-                if (ImGui::Begin(Util::PanelTypeToString(GetType()), &m_Active))
-                {
-
-                }
-                ImGui::End();
-            }
-        }
+        void OnRenderGUI() override;
 
     private:
 
+        void DrawDrawCalls();
+        void DrawLevelsOfDetail();
+        void DrawGPUScene();
+        void DrawShadows();
+        void DrawOcclusionCulling();
+
+        bool m_ShowOcclusionBuffer = false;
+
+        // Kept between frames to avoid reallocating the copied debug image
+        std::vector<uint8_t> m_OcclusionImage = {};
+
         friend class EditorLayer;
 
     };
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,284 @@
+#include "BC_PCH.h"
+#include "Test.h"
+
+// Core Headers
+#include "Project/Scene/Bounds/FrustumCulling.h"
+
+// C++ Standard Library Headers
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// External Vendor Library Headers
+#include <glm/glm.hpp>
+
+namespace BC
+{
+
+	static constexpr std::array<CullingInstructionSet, 3> INSTRUCTION_SETS =
+	{
+		CullingInstructionSet::Scalar,
+		CullingInstructionSet::SSE4,
+		CullingInstructionSet::AVX2
+	};
+
+	// Every tail length of the 4 and 8 wide SIMD paths, and a long batch
+	static constexpr std::array<size_t, 16> BATCH_COUNTS = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 15, 16, 17, 1003 };
+
+	static constexpr size_t GUARD_COUNT = 8;
+	static constexpr FrustumContainResult GUARD_RESULT = static_cast<FrustumContainResult>(0x7F);
+
+	static constexpr float BOX_HALF_EXTENT = 10.0f;
+
+	static const char* InstructionSetToString(CullingInstructionSet instruction_set)
+	{
+		switch (instruction_set)
+		{
+			case CullingInstructionSet::AVX2:	return "AVX2";
+			case CullingInstructionSet::SSE4:	return "SSE4";
+			default:							return "Scalar";
+		}
+	}
+
+	/// <summary>
+	/// A frustum of six axis aligned planes around the origin. Every plane
+	/// distance is exact for bounds on the integer grid, so they can sit
+	/// exactly on a plane. zero_sign flips the sign of the zero components.
+	/// </summary>
+	static Frustum MakeBoxFrustum(float zero_sign)
+	{
+		float zero = std::copysign(0.0f, zero_sign);
+
+		Frustum frustum;
+		frustum.planes[0] = { glm::vec3( 1.0f, zero, zero), BOX_HALF_EXTENT };
+		frustum.planes[1] = { glm::vec3(-1.0f, zero, zero), BOX_HALF_EXTENT };
+		frustum.planes[2] = { glm::vec3(zero,  1.0f, zero), BOX_HALF_EXTENT };
+		frustum.planes[3] = { glm::vec3(zero, -1.0f, zero), BOX_HALF_EXTENT };
+		frustum.planes[4] = { glm::vec3(zero, zero,  1.0f), BOX_HALF_EXTENT };
+		frustum.planes[5] = { glm::vec3(zero, zero, -1.0f), BOX_HALF_EXTENT };
+		return frustum;
+	}
+
+	static Frustum MakeRandomFrustum(std::mt19937& rng)
+	{
+		std::uniform_real_distribution<float> component(-1.0f, 1.0f);
+		std::uniform_real_distribution<float> distance(2.0f, 5.0f);
+
+		Frustum frustum;
+		for (auto& plane : frustum.planes)
+		{
+			plane.normal = glm::vec3(component(rng), component(rng), component(rng));
+			plane.distance = distance(rng);
+			plane.normalize();
+		}
+		return frustum;
+	}
+
+	/// <summary>
+	/// Bounds on the integer grid around the box frustum, so many of their
+	/// faces, edges and corners lie exactly on its planes. Some are points.
+	/// </summary>
+	static Bounds_AABB MakeGridAABB(std::mt19937& rng)
+	{
+		std::uniform_int_distribution<int> coordinate(-12, 12);
+		std::uniform_int_distribution<int> extent(0, 3);
+
+		glm::vec3 min(static_cast<float>(coordinate(rng)), static_cast<float>(coordinate(rng)), static_cast<float>(coordinate(rng)));
+		glm::vec3 size(static_cast<float>(extent(rng)), static_cast<float>(extent(rng)), static_cast<float>(extent(rng)));
+		return Bounds_AABB(min, min + size);
+	}
+
+	static Bounds_Sphere MakeGridSphere(std::mt19937& rng)
+	{
+		std::uniform_int_distribution<int> coordinate(-12, 12);
+		std::uniform_int_distribution<int> radius(0, 3);
+
+		glm::vec3 centre(static_cast<float>(coordinate(rng)), static_cast<float>(coordinate(rng)), static_cast<float>(coordinate(rng)));
+		return Bounds_Sphere(centre, static_cast<float>(radius(rng)));
+	}
+
+	static Bounds_AABB MakeRandomAABB(std::mt19937& rng)
+	{
+		std::uniform_real_distribution<float> coordinate(-8.0f, 8.0f);
+		std::uniform_real_distribution<float> extent(0.0f, 2.0f);
+
+		glm::vec3 centre(coordinate(rng), coordinate(rng), coordinate(rng));
+		glm::vec3 half_size(extent(rng), extent(rng), extent(rng));
+		return Bounds_AABB(centre - half_size, centre + half_size);
+	}
+
+	static Bounds_Sphere MakeRandomSphere(std::mt19937& rng)
+	{
+		std::uniform_real_distribution<float> coordinate(-8.0f, 8.0f);
+		std::uniform_real_distribution<float> radius(0.0f, 2.0f);
+
+		return Bounds_Sphere(glm::vec3(coordinate(rng), coordinate(rng), coordinate(rng)), radius(rng));
+	}
+
+	/// <summary>
+	/// Culls every batch count of the bounds with each instruction set, from an
+	/// aligned and an unaligned start, checking each result against
+	/// Frustum::Contains and that nothing past the batch is written.
+	/// </summary>
+	template<typename BoundsType, typename CullFunction>
+	static void CheckKernels(const char* label, const Frustum& frustum, const std::vector<BoundsType>& bounds, CullFunction&& cull)
+	{
+		FrustumPlanesSoA planes(frustum);
+
+		for (size_t count : BATCH_COUNTS)
+		{
+			for (size_t offset = 0; offset < 2; ++offset)
+			{
+				if (offset + count > bounds.size())
+					continue;
+
+				const BoundsType* batch = bounds.data() + offset;
+
+				for (CullingInstructionSet instruction_set : INSTRUCTION_SETS)
+				{
+					std::vector<FrustumContainResult> results(count + GUARD_COUNT, GUARD_RESULT);
+					cull(instruction_set, planes, batch, count, results.data());
+
+					size_t mismatch_count = 0;
+					for (size_t i = 0; i < count; ++i)
+					{
+						if (results[i] != frustum.Contains(batch[i]))
+							++mismatch_count;
+					}
+
+					size_t overwritten_count = 0;
+					for (size_t i = count; i < results.size(); ++i)
+					{
+						if (results[i] != GUARD_RESULT)
+							++overwritten_count;
+					}
+
+					BC_TEST_CHECK(mismatch_count == 0, "%s - %s - %zu of %zu Results Differ From Frustum::Contains (Offset %zu).",
+						label, InstructionSetToString(instruction_set), mismatch_count, count, offset);
+					BC_TEST_CHECK(overwritten_count == 0, "%s - %s - %zu Results Written Past a Batch of %zu (Offset %zu).",
+						label, InstructionSetToString(instruction_set), overwritten_count, count, offset);
+				}
+			}
+		}
+	}
+
+	static void CheckAABBKernels(const char* label, const Frustum& frustum, const std::vector<Bounds_AABB>& bounds)
+	{
+		CheckKernels(label, frustum, bounds, [](CullingInstructionSet instruction_set, const FrustumPlanesSoA& planes, const Bounds_AABB* batch, size_t count, FrustumContainResult* out_results)
+		{
+			Util::CullAABBs(instruction_set, planes, batch, count, out_results);
+		});
+	}
+
+	static void CheckSphereKernels(const char* label, const Frustum& frustum, const std::vector<Bounds_Sphere>& bounds)
+	{
+		CheckKernels(label, frustum, bounds, [](CullingInstructionSet instruction_set, const FrustumPlanesSoA& planes, const Bounds_Sphere* batch, size_t count, FrustumContainResult* out_results)
+		{
+			Util::CullSpheres(instruction_set, planes, batch, count, out_results);
+		});
+	}
+
+	static void TestExactlyOnPlane()
+	{
+		// Points, faces and spheres touching the box from either side
+		std::vector<Bounds_AABB> aabbs;
+		std::vector<Bounds_Sphere> spheres;
+
+		for (float x : { -12.0f, -10.0f, 0.0f, 10.0f, 12.0f })
+		{
+			glm::vec3 point(x, 10.0f, -10.0f);
+			aabbs.emplace_back(point, point);
+			aabbs.emplace_back(point, point + glm::vec3(2.0f));
+			aabbs.emplace_back(point - glm::vec3(2.0f), point);
+
+			spheres.emplace_back(point, 0.0f);
+			spheres.emplace_back(point, 2.0f);
+			spheres.emplace_back(glm::vec3(x, 12.0f, 0.0f), 2.0f);
+		}
+
+		for (float zero_sign : { 1.0f, -1.0f })
+		{
+			Frustum frustum = MakeBoxFrustum(zero_sign);
+			CheckAABBKernels(zero_sign > 0.0f ? "Box AABBs" : "Box AABBs (Negative Zeros)", frustum, aabbs);
+			CheckSphereKernels(zero_sign > 0.0f ? "Box Spheres" : "Box Spheres (Negative Zeros)", frustum, spheres);
+		}
+	}
+
+	static void TestGridBounds()
+	{
+		std::mt19937 rng(35);
+
+		std::vector<Bounds_AABB> aabbs(BATCH_COUNTS.back() + 1);
+		std::vector<Bounds_Sphere> spheres(BATCH_COUNTS.back() + 1);
+
+		for (auto& aabb : aabbs)
+			aabb = MakeGridAABB(rng);
+		for (auto& sphere : spheres)
+			sphere = MakeGridSphere(rng);
+
+		for (float zero_sign : { 1.0f, -1.0f })
+		{
+			Frustum frustum = MakeBoxFrustum(zero_sign);
+			CheckAABBKernels("Grid AABBs", frustum, aabbs);
+			CheckSphereKernels("Grid Spheres", frustum, spheres);
+		}
+	}
+
+	static void TestRandomBounds()
+	{
+		std::mt19937 rng(3535);
+
+		std::vector<Bounds_AABB> aabbs(BATCH_COUNTS.back() + 1);
+		std::vector<Bounds_Sphere> spheres(BATCH_COUNTS.back() + 1);
+
+		for (int frustum_index = 0; frustum_index < 32; ++frustum_index)
+		{
+			Frustum frustum = MakeRandomFrustum(rng);
+
+			for (auto& aabb : aabbs)
+				aabb = MakeRandomAABB(rng);
+			for (auto& sphere : spheres)
+				sphere = MakeRandomSphere(rng);
+
+			CheckAABBKernels("Random AABBs", frustum, aabbs);
+			CheckSphereKernels("Random Spheres", frustum, spheres);
+		}
+	}
+
+	static void TestDefaultInstructionSet()
+	{
+		std::mt19937 rng(353535);
+
+		Frustum frustum = MakeRandomFrustum(rng);
+		FrustumPlanesSoA planes(frustum);
+
+		std::vector<Bounds_AABB> aabbs(BATCH_COUNTS.back());
+		for (auto& aabb : aabbs)
+			aabb = MakeRandomAABB(rng);
+
+		std::vector<FrustumContainResult> expected(aabbs.size());
+		std::vector<FrustumContainResult> results(aabbs.size());
+
+		Util::CullAABBs(CullingInstructionSet::Scalar, planes, aabbs.data(), aabbs.size(), expected.data());
+		Util::CullAABBs(planes, aabbs.data(), aabbs.size(), results.data());
+
+		BC_TEST_CHECK(results == expected, "The Detected Instruction Set (%s) Differs From the Scalar Path.",
+			InstructionSetToString(Util::GetCullingInstructionSet()));
+	}
+
+}
+
+int main()
+{
+	BC::LoggingSystem::Init();
+
+	std::printf("Culling Instruction Set: %s\n", BC::InstructionSetToString(BC::Util::GetCullingInstructionSet()));
+
+	BC::Test::Run("FrustumCulling.ExactlyOnPlane", BC::TestExactlyOnPlane);
+	BC::Test::Run("FrustumCulling.GridBounds", BC::TestGridBounds);
+	BC::Test::Run("FrustumCulling.RandomBounds", BC::TestRandomBounds);
+	BC::Test::Run("FrustumCulling.DefaultInstructionSet", BC::TestDefaultInstructionSet);
+
+	return BC::Test::Finish();
+}
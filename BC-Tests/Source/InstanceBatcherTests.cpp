@@ -0,0 +1,253 @@
+#include "BC_PCH.h"
+#include "Test.h"
+
+// Core Headers
+#include "Graphics/Renderer/InstanceBatcher.h"
+
+// C++ Standard Library Headers
+#include <array>
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+
+// External Vendor Library Headers
+
+namespace BC
+{
+
+	static constexpr AssetHandle MESH_A = 1001;
+	static constexpr AssetHandle MESH_B = 1002;
+	static constexpr AssetHandle MATERIAL_A = 2001;
+	static constexpr AssetHandle MATERIAL_B = 2002;
+
+	/// <summary>
+	/// Adds a draw the way GeometryEnvironment::AddStaticMesh does. Each draw
+	/// is given a unique object index, so instances can be traced back to it.
+	/// </summary>
+	static void AddDraw(GeometryEnvironment& geometry, Util::DrawPass pass, AssetHandle mesh, AssetHandle material, uint32_t sub_mesh_index, float normalised_depth,
+		uint32_t object_index, Util::GeometryType geom_type = Util::GeometryType_Static)
+	{
+		Util::DrawItem& item = geometry.DrawItems.emplace_back();
+		item.sort_key = Util::MakeDrawSortKey(pass, geom_type, material, mesh, normalised_depth);
+		item.static_mesh_asset_handle = mesh;
+		item.material_handle = material;
+		item.sub_mesh_index = sub_mesh_index;
+		item.geom_type = geom_type;
+		item.object_index = object_index;
+		item.material_index = object_index + 500;
+		item.lod_fade = 1.0f / static_cast<float>(object_index + 1);
+	}
+
+	/// <summary>
+	/// Checks the batches built from geometry, starting at first_batch, cover
+	/// each of its draws exactly once with an instance matching the draw.
+	/// </summary>
+	static void CheckBatchesCoverDraws(const GeometryEnvironment& geometry, const std::pmr::vector<Util::InstanceBatch>& batches, size_t first_batch,
+		const std::pmr::vector<Util::InstanceData>& instance_buffer)
+	{
+		std::unordered_map<uint32_t, const Util::DrawItem*> draws;
+		for (const Util::DrawItem& item : geometry.DrawItems)
+			draws[item.object_index] = &item;
+
+		std::unordered_map<uint32_t, size_t> instance_counts;
+
+		for (size_t batch_index = first_batch; batch_index < batches.size(); ++batch_index)
+		{
+			const Util::InstanceBatch& batch = batches[batch_index];
+
+			BC_TEST_CHECK(batch.instance_count > 0, "Batch %zu Has No Instances.", batch_index);
+			BC_TEST_CHECK(batch.first_instance + batch.instance_count <= instance_buffer.size(), "Batch %zu Reaches Past the Instance Buffer.", batch_index);
+
+			if (batch.first_instance + batch.instance_count > instance_buffer.size())
+				continue;
+
+			for (uint32_t i = 0; i < batch.instance_count; ++i)
+			{
+				const Util::InstanceData& instance = instance_buffer[batch.first_instance + i];
+
+				auto it = draws.find(instance.object_index);
+				BC_TEST_CHECK(it != draws.end(), "Batch %zu Holds an Instance of an Unknown Object %u.", batch_index, instance.object_index);
+				if (it == draws.end())
+					continue;
+
+				const Util::DrawItem& item = *it->second;
+				++instance_counts[item.object_index];
+
+				BC_TEST_CHECK(item.static_mesh_asset_handle == batch.static_mesh_asset_handle && item.material_handle == batch.material_handle &&
+					item.sub_mesh_index == batch.sub_mesh_index && item.geom_type == batch.geom_type,
+					"Object %u Was Batched With a Different Mesh, Sub Mesh or Material.", item.object_index);
+				BC_TEST_CHECK(instance.material_index == item.material_index && instance.lod_fade == item.lod_fade,
+					"Object %u's Instance Does Not Match Its Draw.", item.object_index);
+			}
+		}
+
+		for (const auto& [object_index, item] : draws)
+		{
+			BC_TEST_CHECK(instance_counts[object_index] == 1, "Object %u Has %zu Instances Rather Than 1.", object_index, instance_counts[object_index]);
+		}
+	}
+
+	static void TestMergesIdenticalDraws()
+	{
+		GeometryEnvironment geometry;
+
+		// Interleaved by depth with another mesh, so they are not neighbours once sorted
+		AddDraw(geometry, Util::DrawPass_Opaque, MESH_A, MATERIAL_A, 0, 0.4f, 0);
+		AddDraw(geometry, Util::DrawPass_Opaque, MESH_B, MATERIAL_B, 0, 0.3f, 1);
+		AddDraw(geometry, Util::DrawPass_Opaque, MESH_A, MATERIAL_A, 0, 0.1f, 2);
+		AddDraw(geometry, Util::DrawPass_Opaque, MESH_B, MATERIAL_B, 0, 0.5f, 3);
+		AddDraw(geometry, Util::DrawPass_Opaque, MESH_A, MATERIAL_A, 0, 0.2f, 4);
+		AddDraw(geometry, Util::DrawPass_Mixed, MESH_A, MATERIAL_A, 0, 0.6f, 5);
+		AddDraw(geometry, Util::DrawPass_Mixed, MESH_A, MATERIAL_A, 0, 0.7f, 6);
+		geometry.Sort();
+
+		std::pmr::vector<Util::InstanceBatch> batches;
+		std::pmr::vector<Util::InstanceData> instance_buffer;
+		size_t batch_count = Util::BuildInstanceBatches(geometry, batches, instance_buffer);
+
+		BC_TEST_CHECK(batch_count == 3, "Expected 3 Batches, Built %zu.", batch_count);
+		BC_TEST_CHECK(instance_buffer.size() == geometry.DrawItems.size(), "Expected %zu Instances, Wrote %zu.", geometry.DrawItems.size(), instance_buffer.size());
+		CheckBatchesCoverDraws(geometry, batches, 0, instance_buffer);
+
+		for (const Util::InstanceBatch& batch : batches)
+		{
+			if (batch.static_mesh_asset_handle == MESH_A && batch.pass == Util::DrawPass_Opaque)
+			{
+				// Front to back within the batch
+				BC_TEST_CHECK(batch.instance_count == 3, "Mesh A Should Merge Into 1 Opaque Batch of 3, Has %u.", batch.instance_count);
+				if (batch.instance_count == 3)
+				{
+					BC_TEST_CHECK(instance_buffer[batch.first_instance + 0].object_index == 2 &&
+						instance_buffer[batch.first_instance + 1].object_index == 4 &&
+						instance_buffer[batch.first_instance + 2].object_index == 0,
+						"Merged Instances Are Not Front to Back.");
+				}
+			}
+			else if (batch.static_mesh_asset_handle == MESH_A)
+			{
+				BC_TEST_CHECK(batch.pass == Util::DrawPass_Mixed && batch.instance_count == 2, "Mixed Draws of Mesh A Should Merge Into 1 Batch of 2, Has %u.", batch.instance_count);
+			}
+			else
+			{
+				BC_TEST_CHECK(batch.instance_count == 2, "Mesh B Should Merge Into 1 Batch of 2, Has %u.", batch.instance_count);
+			}
+		}
+	}
+
+	static void TestSplitsOnMaterialOrMeshChange()
+	{
+		GeometryEnvironment geometry;
+
+		AddDraw(geometry, Util::DrawPass_Opaque, MESH_A, MATERIAL_A, 0, 0.1f, 0);
+		AddDraw(geometry, Util::DrawPass_Opaque, MESH_A, MATERIAL_A, 0, 0.2f, 1);
+		AddDraw(geometry, Util::DrawPass_Opaque, MESH_A, MATERIAL_B, 0, 0.3f, 2);	// Material change
+		AddDraw(geometry, Util::DrawPass_Opaque, MESH_B, MATERIAL_A, 0, 0.4f, 3);	// Mesh change
+		AddDraw(geometry, Util::DrawPass_Opaque, MESH_A, MATERIAL_A, 1, 0.5f, 4);	// Sub mesh change
+		AddDraw(geometry, Util::DrawPass_Opaque, MESH_A, MATERIAL_A, 0, 0.6f, 5, Util::GeometryType_Skinned);
+		AddDraw(geometry, Util::DrawPass_Opaque, MESH_A, MATERIAL_A, 0, 0.7f, 6, Util::GeometryType_Skinned);
+		geometry.Sort();
+
+		std::pmr::vector<Util::InstanceBatch> batches;
+		std::pmr::vector<Util::InstanceData> instance_buffer;
+		size_t batch_count = Util::BuildInstanceBatches(geometry, batches, instance_buffer);
+
+		// Objects 0 and 1 share a batch, every other draw gets its own
+		BC_TEST_CHECK(batch_count == 6, "Expected 6 Batches, Built %zu.", batch_count);
+		CheckBatchesCoverDraws(geometry, batches, 0, instance_buffer);
+
+		for (const Util::InstanceBatch& batch : batches)
+		{
+			if (batch.geom_type == Util::GeometryType_Skinned)
+				BC_TEST_CHECK(batch.instance_count == 1, "Skinned Draws Must Not Merge, Batch Has %u.", batch.instance_count);
+		}
+	}
+
+	static void TestTransparentDrawsKeepTheirOrder()
+	{
+		GeometryEnvironment geometry;
+
+		// Back to front: A A B A, only the first two are neighbours
+		AddDraw(geometry, Util::DrawPass_Transparent, MESH_A, MATERIAL_A, 0, 0.9f, 0);
+		AddDraw(geometry, Util::DrawPass_Transparent, MESH_A, MATERIAL_A, 0, 0.8f, 1);
+		AddDraw(geometry, Util::DrawPass_Transparent, MESH_B, MATERIAL_A, 0, 0.7f, 2);
+		AddDraw(geometry, Util::DrawPass_Transparent, MESH_A, MATERIAL_A, 0, 0.6f, 3);
+		AddDraw(geometry, Util::DrawPass_Transparent, MESH_A, MATERIAL_B, 0, 0.5f, 4);
+		geometry.Sort();
+
+		std::pmr::vector<Util::InstanceBatch> batches;
+		std::pmr::vector<Util::InstanceData> instance_buffer;
+		size_t batch_count = Util::BuildInstanceBatches(geometry, batches, instance_buffer);
+
+		BC_TEST_CHECK(batch_count == 4, "Expected 4 Batches, Built %zu.", batch_count);
+		CheckBatchesCoverDraws(geometry, batches, 0, instance_buffer);
+
+		// The instance buffer stays back to front across batches
+		static constexpr std::array<uint32_t, 5> EXPECTED_ORDER = { 0, 1, 2, 3, 4 };
+		for (size_t i = 0; i < EXPECTED_ORDER.size() && i < instance_buffer.size(); ++i)
+		{
+			BC_TEST_CHECK(instance_buffer[i].object_index == EXPECTED_ORDER[i], "Instance %zu Is Object %u, Expected %u.", i, instance_buffer[i].object_index, EXPECTED_ORDER[i]);
+		}
+	}
+
+	static void TestInstanceOffsetsAcrossCameras()
+	{
+		// Each camera appends to the same batch list and instance buffer, as
+		// SceneRenderer does for every camera of a snapshot
+		std::array<GeometryEnvironment, 3> cameras;
+
+		uint32_t object_index = 0;
+		for (size_t camera_index = 0; camera_index < cameras.size(); ++camera_index)
+		{
+			GeometryEnvironment& geometry = cameras[camera_index];
+
+			for (size_t i = 0; i < 4 + camera_index * 3; ++i)
+			{
+				float depth = static_cast<float>(i + 1) / 32.0f;
+				AddDraw(geometry, Util::DrawPass_Opaque, i % 2 ? MESH_A : MESH_B, MATERIAL_A, 0, depth, object_index++);
+				AddDraw(geometry, Util::DrawPass_Transparent, MESH_A, i % 3 ? MATERIAL_A : MATERIAL_B, 0, depth, object_index++);
+			}
+			geometry.Sort();
+		}
+
+		std::pmr::vector<Util::InstanceBatch> batches;
+		std::pmr::vector<Util::InstanceData> instance_buffer;
+
+		for (const GeometryEnvironment& geometry : cameras)
+		{
+			size_t first_batch = batches.size();
+			size_t first_instance = instance_buffer.size();
+
+			size_t batch_count = Util::BuildInstanceBatches(geometry, batches, instance_buffer);
+
+			BC_TEST_CHECK(batch_count == batches.size() - first_batch, "Returned %zu Batches, Appended %zu.", batch_count, batches.size() - first_batch);
+			BC_TEST_CHECK(instance_buffer.size() - first_instance == geometry.DrawItems.size(), "Appended %zu Instances for %zu Draws.",
+				instance_buffer.size() - first_instance, geometry.DrawItems.size());
+
+			// The camera's batches tile its range of the instance buffer in order
+			size_t expected_first_instance = first_instance;
+			for (size_t batch_index = first_batch; batch_index < batches.size(); ++batch_index)
+			{
+				BC_TEST_CHECK(batches[batch_index].first_instance == expected_first_instance, "Batch %zu Starts at Instance %u, Expected %zu.",
+					batch_index, batches[batch_index].first_instance, expected_first_instance);
+				expected_first_instance = batches[batch_index].first_instance + batches[batch_index].instance_count;
+			}
+			BC_TEST_CHECK(expected_first_instance == instance_buffer.size(), "The Camera's Batches End at Instance %zu, the Buffer at %zu.",
+				expected_first_instance, instance_buffer.size());
+
+			CheckBatchesCoverDraws(geometry, batches, first_batch, instance_buffer);
+		}
+	}
+
+}
+
+int main()
+{
+	BC::LoggingSystem::Init();
+
+	BC::Test::Run("InstanceBatcher.MergesIdenticalDraws", BC::TestMergesIdenticalDraws);
+	BC::Test::Run("InstanceBatcher.SplitsOnMaterialOrMeshChange", BC::TestSplitsOnMaterialOrMeshChange);
+	BC::Test::Run("InstanceBatcher.TransparentDrawsKeepTheirOrder", BC::TestTransparentDrawsKeepTheirOrder);
+	BC::Test::Run("InstanceBatcher.InstanceOffsetsAcrossCameras", BC::TestInstanceOffsetsAcrossCameras);
+
+	return BC::Test::Finish();
+}
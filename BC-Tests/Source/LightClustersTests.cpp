@@ -0,0 +1,374 @@
+#include "BC_PCH.h"
+#include "Test.h"
+
+// Core Headers
+#include "Graphics/Renderer/CameraContext.h"
+#include "Graphics/Renderer/LightClusters.h"
+
+// C++ Standard Library Headers
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// External Vendor Library Headers
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace BC
+{
+
+	/// <summary>
+	/// Sphere, cone and directional lights scattered around the camera, some
+	/// behind it or past its far clip.
+	/// </summary>
+	static LightEnvironment MakeLights(std::mt19937& rng, size_t light_count)
+	{
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		std::uniform_real_distribution<float> radius(0.25f, 12.0f);
+		std::uniform_real_distribution<float> angle(10.0f, 170.0f);
+
+		LightEnvironment light_environment;
+		for (size_t i = 0; i < light_count; ++i)
+		{
+			glm::vec4 position(unit(rng) * 80.0f, unit(rng) * 40.0f, unit(rng) * 150.0f, 1.0f);
+
+			Util::LightData light = {};
+			switch (i % 5)
+			{
+				case 4:
+				{
+					light.directional.light_type = Util::LightType_Directional;
+					light.directional.direction = glm::vec4(glm::normalize(glm::vec3(unit(rng), -1.0f, unit(rng))), 0.0f);
+					break;
+				}
+				case 3:
+				case 2:
+				{
+					light.cone.light_type = Util::LightType_Cone;
+					light.cone.position = position;
+					light.cone.direction = glm::vec4(glm::normalize(glm::vec3(unit(rng), unit(rng), unit(rng))), 0.0f);
+					light.cone.range = radius(rng);
+					light.cone.angle = angle(rng);
+					break;
+				}
+				default:
+				{
+					light.sphere.light_type = Util::LightType_Sphere;
+					light.sphere.position = position;
+					light.sphere.radius = radius(rng);
+					break;
+				}
+			}
+
+			light_environment.lights.push_back(light);
+		}
+
+		return light_environment;
+	}
+
+	static CameraContext MakePerspectiveCamera(const glm::vec3& position, const glm::vec3& target)
+	{
+		CameraContext context;
+		context.near_clip = 0.1f;
+		context.far_clip = 250.0f;
+		context.view_matrix = glm::lookAt(position, target, glm::vec3(0.0f, 1.0f, 0.0f));
+		context.projection_matrix = glm::perspective(glm::radians(context.fov), context.aspect_ratio, context.near_clip, context.far_clip);
+		return context;
+	}
+
+	static CameraContext MakeOrthographicCamera(const glm::vec3& position, const glm::vec3& target)
+	{
+		CameraContext context;
+		context.is_orthographic = true;
+		context.near_clip = 0.5f;
+		context.far_clip = 200.0f;
+		context.orthographic_size = 60.0f;
+		context.view_matrix = glm::lookAt(position, target, glm::vec3(0.0f, 1.0f, 0.0f));
+
+		float half_width = context.orthographic_size * context.aspect_ratio * 0.5f;
+		float half_height = context.orthographic_size * 0.5f;
+		context.projection_matrix = glm::ortho(-half_width, half_width, -half_height, half_height, context.near_clip, context.far_clip);
+		return context;
+	}
+
+	/// <summary>
+	/// The view space point at an NDC position and view depth, solved from the
+	/// projection's scale and offset rather than by unprojecting.
+	/// </summary>
+	static glm::vec3 ViewPointAtDepth(const CameraContext& context, float ndc_x, float ndc_y, float depth)
+	{
+		const glm::mat4& projection = context.projection_matrix;
+
+		if (context.is_orthographic)
+			return glm::vec3((ndc_x - projection[3][0]) / projection[0][0], (ndc_y - projection[3][1]) / projection[1][1], -depth);
+
+		return glm::vec3(ndc_x * depth / projection[0][0], ndc_y * depth / projection[1][1], -depth);
+	}
+
+	static void GetSliceDepths(const CameraContext& context, uint32_t slice, float& out_near, float& out_far)
+	{
+		float depth_ratio = context.far_clip / context.near_clip;
+		out_near = context.near_clip * std::pow(depth_ratio, static_cast<float>(slice) / LightClusterGrid::SLICE_COUNT);
+		out_far = context.near_clip * std::pow(depth_ratio, static_cast<float>(slice + 1) / LightClusterGrid::SLICE_COUNT);
+	}
+
+	/// <summary>
+	/// View space bounds of a cluster, from the slice depths and tile corners
+	/// documented by LightClusterGrid.
+	/// </summary>
+	static Bounds_AABB MakeClusterBounds(const CameraContext& context, uint32_t x, uint32_t y, uint32_t slice)
+	{
+		float slice_near, slice_far;
+		GetSliceDepths(context, slice, slice_near, slice_far);
+
+		Bounds_AABB bounds = {};
+		for (uint32_t corner = 0; corner < 8; ++corner)
+		{
+			float ndc_x = -1.0f + 2.0f * static_cast<float>(x + (corner & 1)) / LightClusterGrid::TILE_COUNT_X;
+			float ndc_y = -1.0f + 2.0f * static_cast<float>(y + ((corner >> 1) & 1)) / LightClusterGrid::TILE_COUNT_Y;
+
+			glm::vec3 point = ViewPointAtDepth(context, ndc_x, ndc_y, (corner & 4) ? slice_far : slice_near);
+			bounds.BoundsMin = glm::min(bounds.BoundsMin, point);
+			bounds.BoundsMax = glm::max(bounds.BoundsMax, point);
+		}
+		return bounds;
+	}
+
+	/// <summary>
+	/// Whether the sphere certainly reaches into the cluster itself, rather
+	/// than only its AABB: its centre is inside the cluster, or a point
+	/// sampled through the cluster is inside the sphere by more than tolerance.
+	/// </summary>
+	static bool TouchesClusterVolume(const CameraContext& context, uint32_t x, uint32_t y, uint32_t slice, const Bounds_Sphere& sphere, float tolerance)
+	{
+		constexpr uint32_t SAMPLE_COUNT = 5;
+
+		float slice_near, slice_far;
+		GetSliceDepths(context, slice, slice_near, slice_far);
+
+		float tile_min_x = -1.0f + 2.0f * static_cast<float>(x) / LightClusterGrid::TILE_COUNT_X;
+		float tile_min_y = -1.0f + 2.0f * static_cast<float>(y) / LightClusterGrid::TILE_COUNT_Y;
+		float tile_size_x = 2.0f / LightClusterGrid::TILE_COUNT_X;
+		float tile_size_y = 2.0f / LightClusterGrid::TILE_COUNT_Y;
+
+		glm::vec4 clip = context.projection_matrix * glm::vec4(sphere.BoundsCentre, 1.0f);
+		float depth = -sphere.BoundsCentre.z;
+		if (clip.w > 0.0f && depth >= slice_near && depth <= slice_far)
+		{
+			float ndc_x = clip.x / clip.w;
+			float ndc_y = clip.y / clip.w;
+			if (ndc_x >= tile_min_x && ndc_x <= tile_min_x + tile_size_x && ndc_y >= tile_min_y && ndc_y <= tile_min_y + tile_size_y)
+				return true;
+		}
+
+		float inner_radius = sphere.BoundsRadius - tolerance;
+		if (inner_radius <= 0.0f)
+			return false;
+
+		for (uint32_t k = 0; k < SAMPLE_COUNT; ++k)
+		{
+			float sample_depth = slice_near * std::pow(slice_far / slice_near, static_cast<float>(k) / (SAMPLE_COUNT - 1));
+
+			for (uint32_t j = 0; j < SAMPLE_COUNT; ++j)
+			{
+				for (uint32_t i = 0; i < SAMPLE_COUNT; ++i)
+				{
+					float ndc_x = tile_min_x + tile_size_x * static_cast<float>(i) / (SAMPLE_COUNT - 1);
+					float ndc_y = tile_min_y + tile_size_y * static_cast<float>(j) / (SAMPLE_COUNT - 1);
+
+					if (glm::length(ViewPointAtDepth(context, ndc_x, ndc_y, sample_depth) - sphere.BoundsCentre) < inner_radius)
+						return true;
+				}
+			}
+		}
+
+		return false;
+	}
+
+	static bool TryGetViewBounds(const CameraContext& context, const Util::LightData& light, Bounds_Sphere& out_bounds)
+	{
+		Bounds_Sphere world_bounds;
+		switch (light.sphere.light_type)
+		{
+			case Util::LightType_Sphere:	world_bounds = Bounds_Sphere(glm::vec3(light.sphere.position), light.sphere.radius); break;
+			case Util::LightType_Cone:		world_bounds = Bounds_Sphere::FromCone(glm::vec3(light.cone.position), glm::vec3(light.cone.direction), light.cone.range, light.cone.angle); break;
+			default:						return false;
+		}
+
+		out_bounds = Bounds_Sphere(glm::vec3(context.view_matrix * glm::vec4(world_bounds.BoundsCentre, 1.0f)), world_bounds.BoundsRadius);
+		return true;
+	}
+
+	static void BuildGrid(LightClusterGrid& grid, const CameraContext& context, const LightEnvironment& light_environment)
+	{
+		grid.Begin(context, light_environment);
+		for (uint32_t slice = 0; slice < LightClusterGrid::SLICE_COUNT; ++slice)
+			grid.AssignSlice(slice);
+		grid.Finalise();
+	}
+
+	/// <summary>
+	/// Checks every cluster of the grid against a brute force test of every
+	/// light. A binned light must touch the cluster's AABB, and a light that
+	/// reaches into the cluster itself must be binned. Between the two the
+	/// grid may go either way, its tile and slice ranges drop lights which
+	/// only touch the corners of an AABB that stick out of the cluster.
+	/// Tolerances cover the grid finding the same bounds a different way.
+	/// </summary>
+	static void CheckGridAgainstBruteForce(const char* label, const CameraContext& context, const LightEnvironment& light_environment)
+	{
+		LightClusterGrid grid;
+		BuildGrid(grid, context, light_environment);
+
+		BC_TEST_CHECK(grid.clusters.size() == LightClusterGrid::CLUSTER_COUNT, "%s - Grid Has %zu Clusters.", label, grid.clusters.size());
+		if (grid.clusters.size() != LightClusterGrid::CLUSTER_COUNT)
+			return;
+
+		std::vector<Bounds_Sphere> view_bounds(light_environment.lights.size());
+		std::vector<bool> binnable(light_environment.lights.size());
+		for (size_t i = 0; i < light_environment.lights.size(); ++i)
+			binnable[i] = TryGetViewBounds(context, light_environment.lights[i], view_bounds[i]);
+
+		size_t missing_count = 0;
+		size_t extra_count = 0;
+		size_t binned_count = 0;
+		uint32_t expected_offset = 0;
+
+		for (uint32_t slice = 0; slice < LightClusterGrid::SLICE_COUNT; ++slice)
+		{
+			for (uint32_t y = 0; y < LightClusterGrid::TILE_COUNT_Y; ++y)
+			{
+				for (uint32_t x = 0; x < LightClusterGrid::TILE_COUNT_X; ++x)
+				{
+					uint32_t cluster_index = x + y * LightClusterGrid::TILE_COUNT_X + slice * LightClusterGrid::CLUSTERS_PER_SLICE;
+					const Util::LightCluster& cluster = grid.clusters[cluster_index];
+
+					// Clusters are packed in order, with their lights in light order
+					BC_TEST_CHECK(cluster.offset == expected_offset, "%s - Cluster %u Starts at %u, Expected %u.", label, cluster_index, cluster.offset, expected_offset);
+					BC_TEST_CHECK(cluster.offset + cluster.count <= grid.light_indices.size(), "%s - Cluster %u Reaches Past the Light Indices.", label, cluster_index);
+					if (cluster.offset + cluster.count > grid.light_indices.size())
+						return;
+
+					expected_offset = cluster.offset + cluster.count;
+
+					const uint32_t* cluster_lights = grid.light_indices.data() + cluster.offset;
+					BC_TEST_CHECK(std::is_sorted(cluster_lights, cluster_lights + cluster.count) &&
+						std::adjacent_find(cluster_lights, cluster_lights + cluster.count) == cluster_lights + cluster.count,
+						"%s - Cluster %u's Lights Are Out of Order or Repeated.", label, cluster_index);
+
+					Bounds_AABB bounds = MakeClusterBounds(context, x, y, slice);
+
+					for (uint32_t light_index = 0; light_index < light_environment.lights.size(); ++light_index)
+					{
+						bool binned = std::binary_search(cluster_lights, cluster_lights + cluster.count, light_index);
+
+						if (!binnable[light_index])
+						{
+							BC_TEST_CHECK(!binned, "%s - Directional Light %u Was Binned Into Cluster %u.", label, light_index, cluster_index);
+							continue;
+						}
+
+						const Bounds_Sphere& sphere = view_bounds[light_index];
+						float distance = glm::length(glm::clamp(sphere.BoundsCentre, bounds.BoundsMin, bounds.BoundsMax) - sphere.BoundsCentre);
+						float tolerance = 1e-3f * std::max(1.0f, sphere.BoundsRadius + glm::length(sphere.BoundsCentre));
+
+						if (binned)
+						{
+							++binned_count;
+							if (distance > sphere.BoundsRadius + tolerance)
+								++extra_count;
+						}
+						else if (distance <= sphere.BoundsRadius && TouchesClusterVolume(context, x, y, slice, sphere, tolerance))
+						{
+							++missing_count;
+						}
+					}
+				}
+			}
+		}
+
+		BC_TEST_CHECK(expected_offset == grid.light_indices.size(), "%s - Clusters Cover %u of %zu Light Indices.", label, expected_offset, grid.light_indices.size());
+		BC_TEST_CHECK(missing_count == 0, "%s - %zu Lights Reaching Into a Cluster Were Not Binned Into It.", label, missing_count);
+		BC_TEST_CHECK(extra_count == 0, "%s - %zu of %zu Binned Lights Do Not Touch Their Cluster's AABB.", label, extra_count, binned_count);
+		BC_TEST_CHECK(binned_count > 0, "%s - No Light Was Binned, the Scene Tests Nothing.", label);
+	}
+
+	static void TestPerspectiveMatchesBruteForce()
+	{
+		std::mt19937 rng(45);
+		LightEnvironment light_environment = MakeLights(rng, 300);
+
+		CheckGridAgainstBruteForce("Perspective", MakePerspectiveCamera(glm::vec3(0.0f, 0.0f, 60.0f), glm::vec3(0.0f)), light_environment);
+		CheckGridAgainstBruteForce("Perspective (Rotated)", MakePerspectiveCamera(glm::vec3(30.0f, 20.0f, -20.0f), glm::vec3(-10.0f, 0.0f, 40.0f)), light_environment);
+	}
+
+	static void TestOrthographicMatchesBruteForce()
+	{
+		std::mt19937 rng(4545);
+		LightEnvironment light_environment = MakeLights(rng, 300);
+
+		CheckGridAgainstBruteForce("Orthographic", MakeOrthographicCamera(glm::vec3(0.0f, 0.0f, 100.0f), glm::vec3(0.0f)), light_environment);
+		CheckGridAgainstBruteForce("Orthographic (Rotated)", MakeOrthographicCamera(glm::vec3(-60.0f, 50.0f, 40.0f), glm::vec3(0.0f)), light_environment);
+	}
+
+	static void TestLightsAroundTheCamera()
+	{
+		// Lights containing the camera, straddling the near clip or the far
+		// clip, and touching the edges of the view
+		CameraContext context = MakePerspectiveCamera(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f));
+
+		LightEnvironment light_environment;
+		auto add_sphere = [&light_environment](const glm::vec3& position, float radius)
+		{
+			Util::LightData light = {};
+			light.sphere.light_type = Util::LightType_Sphere;
+			light.sphere.position = glm::vec4(position, 1.0f);
+			light.sphere.radius = radius;
+			light_environment.lights.push_back(light);
+		};
+
+		add_sphere(glm::vec3(0.0f), 5.0f);
+		add_sphere(glm::vec3(0.0f, 0.0f, 2.0f), 2.05f);
+		add_sphere(glm::vec3(3.0f, -1.0f, 0.5f), 1.0f);
+		add_sphere(glm::vec3(0.0f, 0.0f, -255.0f), 10.0f);
+		add_sphere(glm::vec3(0.0f, 0.0f, -265.0f), 10.0f);
+		add_sphere(glm::vec3(60.0f, 0.0f, -50.0f), 8.0f);
+		add_sphere(glm::vec3(0.0f, -32.0f, -50.0f), 4.0f);
+
+		CheckGridAgainstBruteForce("Around the Camera", context, light_environment);
+	}
+
+	static void TestSliceFormula()
+	{
+		CameraContext context = MakePerspectiveCamera(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f));
+
+		LightClusterGrid grid;
+		BuildGrid(grid, context, LightEnvironment());
+
+		// The middle of each slice maps back to it through slice_scale and slice_bias
+		float depth_ratio = context.far_clip / context.near_clip;
+		for (uint32_t slice = 0; slice < LightClusterGrid::SLICE_COUNT; ++slice)
+		{
+			float depth = context.near_clip * std::pow(depth_ratio, (static_cast<float>(slice) + 0.5f) / LightClusterGrid::SLICE_COUNT);
+			float mapped_slice = std::floor(std::log(depth) * grid.slice_scale - grid.slice_bias);
+
+			BC_TEST_CHECK(mapped_slice == static_cast<float>(slice), "Depth %f Maps to Slice %f, Expected %u.", depth, mapped_slice, slice);
+		}
+
+		BC_TEST_CHECK(grid.light_indices.empty(), "A Grid Without Lights Has %zu Light Indices.", grid.light_indices.size());
+	}
+
+}
+
+int main()
+{
+	BC::LoggingSystem::Init();
+
+	BC::Test::Run("LightClusters.PerspectiveMatchesBruteForce", BC::TestPerspectiveMatchesBruteForce);
+	BC::Test::Run("LightClusters.OrthographicMatchesBruteForce", BC::TestOrthographicMatchesBruteForce);
+	BC::Test::Run("LightClusters.LightsAroundTheCamera", BC::TestLightsAroundTheCamera);
+	BC::Test::Run("LightClusters.SliceFormula", BC::TestSliceFormula);
+
+	return BC::Test::Finish();
+}
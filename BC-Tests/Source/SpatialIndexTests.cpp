@@ -0,0 +1,167 @@
+#include "BC_PCH.h"
+#include "Test.h"
+
+// Core Headers
+#include "Project/Scene/Bounds/BVH.h"
+#include "Project/Scene/Bounds/Octree.h"
+
+// C++ Standard Library Headers
+#include <algorithm>
+#include <optional>
+#include <random>
+#include <vector>
+
+// External Vendor Library Headers
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace BC
+{
+
+	static constexpr size_t SPATIAL_INDEX_ITEM_COUNT = 2000;
+	static constexpr size_t SPATIAL_INDEX_QUERY_COUNT = 32;
+	static constexpr float SPATIAL_INDEX_WORLD_EXTENT = 200.0f;
+
+	static Bounds_AABB MakeRandomBounds(std::mt19937& rng)
+	{
+		std::uniform_real_distribution<float> coordinate(-SPATIAL_INDEX_WORLD_EXTENT, SPATIAL_INDEX_WORLD_EXTENT);
+		std::uniform_real_distribution<float> extent(0.25f, 6.0f);
+
+		glm::vec3 centre(coordinate(rng), coordinate(rng), coordinate(rng));
+		glm::vec3 half_size(extent(rng), extent(rng), extent(rng));
+		return Bounds_AABB(centre - half_size, centre + half_size);
+	}
+
+	static bool Overlaps(const Bounds_AABB& query, const Bounds_AABB& bounds) { return query.Contains(bounds) != BoundsContainResult::DoesNotContain; }
+	static bool Overlaps(const Bounds_Sphere& query, const Bounds_AABB& bounds) { return query.Contains(bounds) != BoundsContainResult::DoesNotContain; }
+	static bool Overlaps(const Frustum& query, const Bounds_AABB& bounds) { return query.Contains(bounds) != FrustumContainResult::DoesNotContain; }
+
+	/// <summary>
+	/// Checks the index finds exactly the data sources a linear search of every
+	/// bounds still held would, each only once.
+	/// </summary>
+	template<typename ShapeType>
+	static void CheckQueryAgainstBruteForce(const char* index_name, const SpatialIndex<uint32_t>& index, const std::vector<std::optional<Bounds_AABB>>& bounds,
+		const ShapeType& shape, const char* shape_name)
+	{
+		std::vector<SpatialDataSource<uint32_t>> results;
+		index.Query(shape, results);
+
+		std::vector<uint32_t> found;
+		for (const auto& result : results)
+			found.push_back(result.Data);
+		std::sort(found.begin(), found.end());
+
+		std::vector<uint32_t> expected;
+		for (uint32_t i = 0; i < bounds.size(); ++i)
+		{
+			if (bounds[i] && Overlaps(shape, *bounds[i]))
+				expected.push_back(i);
+		}
+
+		BC_TEST_CHECK(std::adjacent_find(found.begin(), found.end()) == found.end(), "%s %s Query Returned a Data Source More Than Once.", index_name, shape_name);
+		BC_TEST_CHECK(found == expected, "%s %s Query Found %zu Data Sources, a Linear Search Finds %zu.", index_name, shape_name, found.size(), expected.size());
+	}
+
+	static void CheckQueriesAgainstBruteForce(std::mt19937& rng, const char* index_name, const SpatialIndex<uint32_t>& index, const std::vector<std::optional<Bounds_AABB>>& bounds)
+	{
+		std::uniform_real_distribution<float> coordinate(-SPATIAL_INDEX_WORLD_EXTENT, SPATIAL_INDEX_WORLD_EXTENT);
+		std::uniform_real_distribution<float> size(5.0f, 60.0f);
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+		const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, SPATIAL_INDEX_WORLD_EXTENT);
+
+		for (size_t i = 0; i < SPATIAL_INDEX_QUERY_COUNT; ++i)
+		{
+			glm::vec3 centre(coordinate(rng), coordinate(rng), coordinate(rng));
+			glm::vec3 half_size(size(rng), size(rng), size(rng));
+			CheckQueryAgainstBruteForce(index_name, index, bounds, Bounds_AABB(centre - half_size, centre + half_size), "AABB");
+
+			// Large spheres hold whole nodes within the corners of their bounding box
+			CheckQueryAgainstBruteForce(index_name, index, bounds, Bounds_Sphere(glm::vec3(coordinate(rng), coordinate(rng), coordinate(rng)), size(rng) * 2.0f), "Sphere");
+
+			glm::vec3 position(coordinate(rng), coordinate(rng), coordinate(rng));
+			glm::vec3 direction = glm::normalize(glm::vec3(unit(rng), unit(rng) * 0.5f, unit(rng)) + glm::vec3(0.0f, 0.0f, 0.01f));
+			CheckQueryAgainstBruteForce(index_name, index, bounds, Frustum(projection * glm::lookAt(position, position + direction, glm::vec3(0.0f, 1.0f, 0.0f))), "Frustum");
+		}
+	}
+
+	/// <summary>
+	/// Fills the index, then moves and removes some of its data sources,
+	/// checking its queries after each step. Every third data source is
+	/// inserted as static.
+	/// </summary>
+	static void CheckIndexAgainstBruteForce(const char* index_name, SpatialIndex<uint32_t>& index)
+	{
+		std::mt19937 rng(36);
+		std::vector<std::optional<Bounds_AABB>> bounds(SPATIAL_INDEX_ITEM_COUNT);
+
+		for (uint32_t i = 0; i < SPATIAL_INDEX_ITEM_COUNT; ++i)
+		{
+			bounds[i] = MakeRandomBounds(rng);
+			bool inserted = i % 3 == 0 ? index.InsertStatic(i, *bounds[i]) : index.Insert(i, *bounds[i]);
+			BC_TEST_CHECK(inserted, "%s Failed to Insert Data Source %u.", index_name, i);
+		}
+
+		BC_TEST_CHECK(index.TotalCount() == SPATIAL_INDEX_ITEM_COUNT, "%s Holds %zu Data Sources, Expected %zu.", index_name, index.TotalCount(), SPATIAL_INDEX_ITEM_COUNT);
+		CheckQueriesAgainstBruteForce(rng, index_name, index, bounds);
+
+		for (uint32_t i = 0; i < SPATIAL_INDEX_ITEM_COUNT; i += 5)
+		{
+			bounds[i] = MakeRandomBounds(rng);
+			index.Update(i, *bounds[i]);
+		}
+		CheckQueriesAgainstBruteForce(rng, index_name, index, bounds);
+
+		size_t remaining_count = SPATIAL_INDEX_ITEM_COUNT;
+		for (uint32_t i = 0; i < SPATIAL_INDEX_ITEM_COUNT; i += 7)
+		{
+			BC_TEST_CHECK(index.Remove(i), "%s Failed to Remove Data Source %u.", index_name, i);
+			bounds[i].reset();
+			--remaining_count;
+		}
+
+		BC_TEST_CHECK(index.TotalCount() == remaining_count, "%s Holds %zu Data Sources, Expected %zu.", index_name, index.TotalCount(), remaining_count);
+		CheckQueriesAgainstBruteForce(rng, index_name, index, bounds);
+	}
+
+	static void TestSphereContainsAABB()
+	{
+		const Bounds_Sphere sphere(glm::vec3(0.0f), 1.0f);
+
+		BC_TEST_CHECK(sphere.Contains(Bounds_AABB(glm::vec3(-0.5f), glm::vec3(0.5f))) == BoundsContainResult::Contains,
+			"A Box Whose Corners Are All Within the Sphere Should Be Contained.");
+		BC_TEST_CHECK(sphere.Contains(Bounds_AABB(glm::vec3(0.6f), glm::vec3(0.7f))) == BoundsContainResult::DoesNotContain,
+			"A Box Within the Sphere's Bounding Box but Outside the Sphere Should Not Be Contained.");
+		BC_TEST_CHECK(sphere.Contains(Bounds_AABB(glm::vec3(-0.9f), glm::vec3(0.9f))) == BoundsContainResult::Intersects,
+			"A Box Within the Sphere's Bounding Box With Corners Outside the Sphere Should Intersect.");
+		BC_TEST_CHECK(sphere.Contains(Bounds_AABB(glm::vec3(0.0f), glm::vec3(0.7f))) == BoundsContainResult::Intersects,
+			"A Box With One Corner Outside the Sphere Should Intersect.");
+		BC_TEST_CHECK(sphere.Contains(Bounds_AABB(glm::vec3(2.0f), glm::vec3(3.0f))) == BoundsContainResult::DoesNotContain,
+			"A Box Away From the Sphere Should Not Be Contained.");
+	}
+
+	static void TestOctreeMatchesBruteForce()
+	{
+		OctreeBounds<uint32_t> octree;
+		CheckIndexAgainstBruteForce("OctreeBounds", octree);
+	}
+
+	static void TestBVHMatchesBruteForce()
+	{
+		BVHBounds<uint32_t> bvh;
+		CheckIndexAgainstBruteForce("BVHBounds", bvh);
+	}
+
+}
+
+int main()
+{
+	BC::LoggingSystem::Init();
+
+	BC::Test::Run("SpatialIndex.SphereContainsAABB", BC::TestSphereContainsAABB);
+	BC::Test::Run("SpatialIndex.OctreeMatchesBruteForce", BC::TestOctreeMatchesBruteForce);
+	BC::Test::Run("SpatialIndex.BVHMatchesBruteForce", BC::TestBVHMatchesBruteForce);
+
+	return BC::Test::Finish();
+}
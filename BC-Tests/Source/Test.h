@@ -0,0 +1,77 @@
+#pragma once
+
+// Core Headers
+
+// C++ Standard Library Headers
+#include <cstdarg>
+#include <cstdio>
+
+// External Vendor Library Headers
+
+namespace BC::Test
+{
+
+	inline int s_FailedCheckCount = 0;
+	inline int s_FailedCaseCount = 0;
+
+	/// <summary>
+	/// Prints a failed check with a printf style message describing it.
+	/// </summary>
+	inline void ReportFailure(const char* condition, const char* file, int line, const char* format, ...)
+	{
+		++s_FailedCheckCount;
+
+		std::printf("    %s(%d): Check Failed - %s - ", file, line, condition);
+
+		va_list args;
+		va_start(args, format);
+		std::vprintf(format, args);
+		va_end(args);
+
+		std::printf("\n");
+	}
+
+	/// <summary>
+	/// Runs one test case, reporting whether any of its checks failed.
+	/// </summary>
+	template<typename Function>
+	void Run(const char* name, Function&& function)
+	{
+		int failed_checks_before = s_FailedCheckCount;
+
+		std::printf("[ RUN    ] %s\n", name);
+		function();
+
+		if (s_FailedCheckCount == failed_checks_before)
+		{
+			std::printf("[     OK ] %s\n", name);
+		}
+		else
+		{
+			std::printf("[ FAILED ] %s\n", name);
+			++s_FailedCaseCount;
+		}
+	}
+
+	/// <returns>
+	/// The exit code of the test executable, non zero if any case failed.
+	/// </returns>
+	inline int Finish()
+	{
+		if (s_FailedCaseCount == 0)
+		{
+			std::printf("All Test Cases Passed.\n");
+			return 0;
+		}
+
+		std::printf("%d Test Case(s) Failed.\n", s_FailedCaseCount);
+		return 1;
+	}
+
+}
+
+/// <summary>
+/// Checks a condition, the message is a printf style format and its arguments.
+/// </summary>
+#define BC_TEST_CHECK(condition, ...) \
+	do { if (!(condition)) ::BC::Test::ReportFailure(#condition, __FILE__, __LINE__, __VA_ARGS__); } while (false)